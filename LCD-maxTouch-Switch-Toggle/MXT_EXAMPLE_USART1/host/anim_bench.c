@@ -0,0 +1,206 @@
+/**
+ * \file
+ *
+ * \brief Cost of each frame of the drum animation of anim.c.
+ *
+ * Plays one turn of the drum into the compositor and flushes each frame to
+ * the LCD model, printing for every frame the difference bytes read, the
+ * pixels written, the pixels and bytes the flush sent and the bus time,
+ * next to a redraw of the whole sprite. The turn must end on the first
+ * frame and the panel must show the framebuffer after each flush.
+ *
+ * Then, for centrifuge speeds, the frame period main.c would use and the
+ * share of the bus the drum takes at that pace:
+ *
+ *   make -C host bench
+ *   host/build/anim_bench [-d rpm_div] [rpm...]
+ *
+ * rpm_div is DRUM_RPM_DIV of main.c, 20 by default; the speeds default to
+ * those of the wash cycles.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "host_hal.h"
+#include "hal.h"
+#include "bench_sim.h"
+#include "panel.h"
+#include "ili9488.h"
+#include "compositor.h"
+#include "tfont.h"
+#include "anim.h"
+#include "icons/drum.h"
+
+#define BENCH_X        104
+#define BENCH_Y        8
+#define BENCH_RPM_DIV  20
+
+struct bench_cost {
+	uint64_t ull_bytes;
+	uint64_t ull_pixels;
+	uint64_t ull_windows;
+	uint32_t ul_bus_us;
+};
+
+static void bench_flush(struct bench_cost *p_cost)
+{
+	struct panel_stats stats;
+
+	panel_reset_stats();
+	compositor_flush();
+	ili9488_sync();
+	panel_get_stats(&stats);
+	p_cost->ull_bytes = stats.ull_bytes;
+	p_cost->ull_pixels = stats.ull_pixels;
+	p_cost->ull_windows = stats.ull_ram_writes;
+	p_cost->ul_bus_us = (uint32_t)(stats.ull_bytes * 8 * 1000000 / hal_spi_baudrate());
+}
+
+/**
+ * \brief Check that the panel shows the framebuffer around the sprite.
+ */
+static bool bench_shown(void)
+{
+	const uint16_t *p_us_fb = compositor_get_framebuffer();
+	uint32_t x, y, c;
+
+	for (y = BENCH_Y; y < BENCH_Y + (uint32_t)drum.height; y++) {
+		for (x = BENCH_X; x < BENCH_X + (uint32_t)drum.width; x++) {
+			c = panel_get_shown_pixel(x, y);
+			if ((uint16_t)(((c >> 8) & 0xF800) | ((c >> 5) & 0x07E0)
+					| ((c >> 3) & 0x001F)) != p_us_fb[y * COMPOSITOR_WIDTH + x]) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+static void bench_save(uint16_t *p_us_out)
+{
+	const uint16_t *p_us_fb = compositor_get_framebuffer();
+	int y;
+
+	for (y = 0; y < drum.height; y++) {
+		memcpy(&p_us_out[y * drum.width],
+				&p_us_fb[(BENCH_Y + y) * COMPOSITOR_WIDTH + BENCH_X],
+				drum.width * sizeof(uint16_t));
+	}
+}
+
+int main(int argc, char **argv)
+{
+	struct ili9488_opt_t opt = {
+		.ul_width = ILI9488_LCD_WIDTH,
+		.ul_height = ILI9488_LCD_HEIGHT,
+		.foreground_color = COLOR_CONVERT(COLOR_WHITE),
+		.background_color = COLOR_CONVERT(COLOR_WHITE),
+	};
+	static const uint32_t ul_cycle_rpm[] = { 900, 1200 };
+	static uint16_t us_first[ANIM_MAX_WIDTH * ANIM_MAX_WIDTH];
+	static uint16_t us_last[ANIM_MAX_WIDTH * ANIM_MAX_WIDTH];
+	struct anim anim;
+	struct anim_stats stats;
+	struct bench_cost cost, full;
+	uint64_t ull_ns, ull_bus_us = 0, ull_sent = 0;
+	uint32_t ul_div = BENCH_RPM_DIV, ul_rpm, ul_period, ul_failed = 0;
+	int i, j, first_rpm = argc;
+	char c_label[16];
+
+	for (j = 1; j < argc; j++) {
+		if (!strcmp(argv[j], "-d") && (j + 1 < argc)) {
+			ul_div = strtoul(argv[++j], NULL, 0);
+		} else if ((argv[j][0] >= '0') && (argv[j][0] <= '9')) {
+			first_rpm = j;
+			break;
+		} else {
+			fprintf(stderr, "usage: %s [-d rpm_div] [rpm...]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (!ul_div) {
+		ul_div = BENCH_RPM_DIV;
+	}
+
+	hal_init();
+	panel_reset();
+	ili9488_init(&opt);
+	ili9488_display_on();
+	compositor_init(COLOR_WHITE);
+	compositor_flush();
+	ili9488_sync();
+
+	/* The whole sprite sent again, for reference */
+	compositor_invalidate(BENCH_X, BENCH_Y, BENCH_X + drum.width - 1,
+			BENCH_Y + drum.height - 1);
+	bench_flush(&full);
+
+	printf("drum %dx%d, %d frames over %d degrees, %" PRIu32 " bytes of data\n",
+			drum.width, drum.height, drum.count, drum.turn,
+			(uint32_t)drum.frames[drum.count + 1]);
+	printf("%-6s %6s %7s %7s %7s %4s %7s %8s\n", "frame", "diff B", "written",
+			"sent px", "bus B", "win", "bus us", "draw ns");
+	anim_init(&anim, &drum, BENCH_X, BENCH_Y);
+	for (i = 0; i <= drum.count; i++) {
+		ull_ns = bench_now_ns();
+		anim_step(&anim);
+		ull_ns = bench_now_ns() - ull_ns;
+		anim_get_stats(&stats);
+		bench_flush(&cost);
+		if (!bench_shown()) {
+			printf("frame %d: the panel does not show the framebuffer\n", i);
+			ul_failed++;
+		}
+		if (i == 0) {
+			bench_save(us_first);
+		} else {
+			ull_bus_us += cost.ul_bus_us;
+			ull_sent += cost.ull_pixels;
+		}
+		/* The first frame is drawn over the background */
+		snprintf(c_label, sizeof(c_label), i ? "%u" : "%u bg", anim.us_frame);
+		printf("%-6s %6" PRIu32 " %7" PRIu32 " %7" PRIu64 " %7" PRIu64 " %4" PRIu64
+				" %7" PRIu32 " %8" PRIu64 "\n",
+				c_label, stats.ul_last_bytes, stats.ul_last_pixels,
+				cost.ull_pixels, cost.ull_bytes, cost.ull_windows, cost.ul_bus_us,
+				ull_ns);
+	}
+	bench_save(us_last);
+	if (memcmp(us_first, us_last, drum.width * drum.height * sizeof(uint16_t))) {
+		printf("the turn does not end on the first frame\n");
+		ul_failed++;
+	}
+	printf("%-6s %6s %7d %7" PRIu64 " %7" PRIu64 " %4" PRIu64 " %7" PRIu32 "\n",
+			"whole", "", drum.width * drum.height, full.ull_pixels, full.ull_bytes,
+			full.ull_windows, full.ul_bus_us);
+	printf("per frame: %" PRIu64 " px, %" PRIu64 " us of bus on average\n",
+			ull_sent / drum.count, ull_bus_us / drum.count);
+
+	/* Pace of the drum for each speed, as drum_period() of main.c */
+	printf("\n%-6s %9s %6s %9s\n", "rpm", "period ms", "fps", "bus share");
+	for (j = 0; (first_rpm < argc) ? (first_rpm + j < argc)
+			: (j < (int)(sizeof(ul_cycle_rpm) / sizeof(ul_cycle_rpm[0]))); j++) {
+		ul_rpm = (first_rpm < argc) ? strtoul(argv[first_rpm + j], NULL, 0)
+				: ul_cycle_rpm[j];
+		if (!ul_rpm) {
+			continue;
+		}
+		ul_period = (uint32_t)(60000ULL * ul_div * (uint32_t)abs(drum.turn)
+				/ (360ULL * drum.count * ul_rpm));
+		if (!ul_period) {
+			printf("%-6" PRIu32 " faster than 1 ms per frame\n", ul_rpm);
+			continue;
+		}
+		printf("%-6" PRIu32 " %9" PRIu32 " %6" PRIu32 " %8" PRIu64 "%%\n", ul_rpm,
+				ul_period, 1000 / ul_period,
+				ull_bus_us / drum.count * 100 / (ul_period * 1000));
+	}
+
+	if (ul_failed) {
+		printf("FAILED\n");
+		return 1;
+	}
+	return 0;
+}
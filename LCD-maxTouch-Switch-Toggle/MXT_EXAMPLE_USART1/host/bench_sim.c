@@ -0,0 +1,42 @@
+/**
+ * \file
+ *
+ * \brief Clock of the benches that link the LCD model without sim.c.
+ *
+ * Time only moves on delays and no timer interrupt runs, so what a bench
+ * draws reaches the panel model synchronously. bench_now_ns() is the wall
+ * clock the benches time the code with.
+ */
+
+#include <time.h>
+#include "host_hal.h"
+#include "sim.h"
+#include "bench_sim.h"
+
+static uint64_t g_ull_now_us;
+
+uint64_t sim_now_us(void)
+{
+	return g_ull_now_us;
+}
+
+void sim_delay_us(uint64_t ull_us)
+{
+	g_ull_now_us += ull_us;
+}
+
+void sim_activity(void)
+{
+}
+
+void sim_idle(void)
+{
+}
+
+uint64_t bench_now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
@@ -0,0 +1,14 @@
+/**
+ * \file
+ *
+ * \brief Wall clock of the host benches.
+ */
+
+#ifndef BENCH_SIM_H_INCLUDED
+#define BENCH_SIM_H_INCLUDED
+
+#include <stdint.h>
+
+uint64_t bench_now_ns(void);
+
+#endif /* BENCH_SIM_H_INCLUDED */
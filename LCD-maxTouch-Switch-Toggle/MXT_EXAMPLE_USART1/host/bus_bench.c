@@ -0,0 +1,186 @@
+/**
+ * \file
+ *
+ * \brief Full screen fill and blit on each ILI9488 bus backend of the host.
+ *
+ * Brings the driver up on the SPI backend and times a full screen fill and
+ * a full screen RGB565 blit: bus time on the virtual clock and host time.
+ * The same drawing on the panel model fake of bus_host.c, which takes no
+ * bus time, must leave the same frame memory, and the blit must read back
+ * as written on both. A backend of the other pixel format must be refused
+ * by ili9488_init():
+ *
+ *   make -C host bench
+ *   host/build/bus_bench
+ *
+ * The SMC backend needs the EBI pixel format and the target; build the
+ * firmware with ILI9488_EBIMODE and ILI9488_BUS_BENCH to time it there.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "host_hal.h"
+#include "hal.h"
+#include "bench_sim.h"
+#include "panel.h"
+#include "sim.h"
+#include "ili9488.h"
+#include "bus_host.h"
+
+#define BENCH_RUNS  4
+
+struct bench_time {
+	uint64_t ull_bus_us;   //!< virtual clock
+	uint64_t ull_host_ns;  //!< best of BENCH_RUNS on the host
+};
+
+static uint16_t g_us_line[ILI9488_LCD_HEIGHT];
+static uint16_t g_us_read[ILI9488_LCD_HEIGHT];
+static uint32_t g_ul_frame[2][PANEL_WIDTH * PANEL_HEIGHT];
+
+/* A different colour for every pixel of a row, and rows that differ */
+static void bench_make_line(uint32_t y, uint32_t ul_width)
+{
+	uint32_t x;
+
+	for (x = 0; x < ul_width; x++) {
+		g_us_line[x] = (uint16_t)(x * 0x0841 + y * 0x1F);
+	}
+}
+
+static void bench_fill(const struct ili9488_opt_t *p_opt)
+{
+	ili9488_set_foreground_color(COLOR_CONVERT(COLOR_BLUE));
+	ili9488_draw_filled_rectangle(0, 0, p_opt->ul_width - 1,
+			p_opt->ul_height - 1);
+	ili9488_sync();
+}
+
+static void bench_blit(const struct ili9488_opt_t *p_opt)
+{
+	uint32_t y;
+
+	ili9488_draw_prepare(0, 0, p_opt->ul_width, p_opt->ul_height);
+	for (y = 0; y < p_opt->ul_height; y++) {
+		bench_make_line(y, p_opt->ul_width);
+		ili9488_draw_stream_rgb565(g_us_line, p_opt->ul_width);
+	}
+	ili9488_sync();
+}
+
+static void bench_time(void (*run)(const struct ili9488_opt_t *),
+		const struct ili9488_opt_t *p_opt, struct bench_time *p_time)
+{
+	uint64_t ull_us, ull_ns;
+	int i;
+
+	p_time->ull_host_ns = UINT64_MAX;
+	for (i = 0; i < BENCH_RUNS; i++) {
+		ull_us = sim_now_us();
+		ull_ns = bench_now_ns();
+		run(p_opt);
+		ull_ns = bench_now_ns() - ull_ns;
+		p_time->ull_bus_us = sim_now_us() - ull_us;
+		if (ull_ns < p_time->ull_host_ns) {
+			p_time->ull_host_ns = ull_ns;
+		}
+	}
+}
+
+static void bench_print(const char *p_name, const struct bench_time *p_time,
+		uint32_t ul_pixels)
+{
+	printf("  %-5s %9.2f ms bus %7.2f Mpx/s  %8.3f ms host %8.2f Mpx/s\n",
+			p_name, p_time->ull_bus_us / 1000.0,
+			p_time->ull_bus_us ? (double)ul_pixels / p_time->ull_bus_us : 0.0,
+			p_time->ull_host_ns / 1000000.0,
+			(double)ul_pixels * 1000.0 / p_time->ull_host_ns);
+}
+
+/**
+ * \brief Time one backend and keep the frame memory it leaves.
+ *
+ * \return the rows of the blit that did not read back as written.
+ */
+static uint32_t bench_backend(const struct ili9488_bus *p_bus, bool b_print,
+		uint32_t *p_ul_frame)
+{
+	struct ili9488_opt_t opt = {
+		.ul_width = ILI9488_LCD_WIDTH,
+		.ul_height = ILI9488_LCD_HEIGHT,
+		.foreground_color = COLOR_CONVERT(COLOR_WHITE),
+		.background_color = COLOR_CONVERT(COLOR_WHITE),
+		.p_bus = p_bus,
+	};
+	struct bench_time fill, blit;
+	uint32_t ul_pixels = opt.ul_width * opt.ul_height, ul_bad = 0, x, y;
+
+	panel_reset();
+	if (ili9488_init(&opt)) {
+		printf("%s: LCD not found\n", p_bus->p_name);
+		return opt.ul_height;
+	}
+	ili9488_display_on();
+
+	bench_time(bench_fill, &opt, &fill);
+	bench_time(bench_blit, &opt, &blit);
+	if (b_print) {
+		printf("%s, %" PRIu32 "x%" PRIu32 "\n", p_bus->p_name, opt.ul_width,
+				opt.ul_height);
+		bench_print("fill", &fill, ul_pixels);
+		bench_print("blit", &blit, ul_pixels);
+	}
+
+	for (y = 0; y < PANEL_HEIGHT; y++) {
+		for (x = 0; x < PANEL_WIDTH; x++) {
+			p_ul_frame[y * PANEL_WIDTH + x] = panel_get_pixel(x, y);
+		}
+	}
+	/* The blit is exact in RGB565: read every row back through the bus */
+	for (y = 0; y < opt.ul_height; y++) {
+		bench_make_line(y, opt.ul_width);
+		ili9488_set_top_left_limit(0, y);
+		ili9488_set_bottom_right_limit(opt.ul_width - 1, y);
+		ili9488_copy_pixels_from_screen(g_us_read, opt.ul_width);
+		if (memcmp(g_us_read, g_us_line, opt.ul_width * sizeof(g_us_line[0]))) {
+			ul_bad++;
+		}
+	}
+	return ul_bad;
+}
+
+int main(void)
+{
+	static const struct ili9488_bus *const p_bus[] = {
+		&ili9488_bus_spi, &ili9488_bus_host,
+	};
+	uint32_t ul_bad[2], ul_differ = 0, i;
+	struct ili9488_bus other = ili9488_bus_host;
+	struct ili9488_opt_t opt = {
+		.ul_width = ILI9488_LCD_WIDTH,
+		.ul_height = ILI9488_LCD_HEIGHT,
+		.p_bus = &other,
+	};
+	bool b_refused;
+
+	hal_init();
+	/* The fake takes no bus time: only its frame memory is compared */
+	for (i = 0; i < 2; i++) {
+		ul_bad[i] = bench_backend(p_bus[i], i == 0, g_ul_frame[i]);
+	}
+	other.format = (ILI9488_BUS_FORMAT == ILI9488_BUS_RGB565)
+			? ILI9488_BUS_RGB666 : ILI9488_BUS_RGB565;
+	b_refused = ili9488_init(&opt) && (ili9488_init_get_state() == ILI9488_INIT_FAILED);
+	printf("backend of the other pixel format: %s\n", b_refused ? "refused" : "ACCEPTED");
+	for (i = 0; i < PANEL_WIDTH * PANEL_HEIGHT; i++) {
+		if (g_ul_frame[0][i] != g_ul_frame[1][i]) {
+			ul_differ++;
+		}
+	}
+	printf("\nrows read back wrong: %s %" PRIu32 ", %s %" PRIu32
+			"; pixels differing between them: %" PRIu32 "\n",
+			p_bus[0]->p_name, ul_bad[0], p_bus[1]->p_name, ul_bad[1], ul_differ);
+	return (ul_bad[0] || ul_bad[1] || ul_differ || !b_refused) ? 1 : 0;
+}
@@ -0,0 +1,110 @@
+/**
+ * \file
+ *
+ * \brief ILI9488 bus backend writing straight into the panel model.
+ *
+ * The bytes go to panel.c as the SPI backend sends them, so the frame memory
+ * ends up the same, but without the SPI, the DMA engine or the busy loops:
+ * no bus time passes on the virtual clock. Tests that only check pixels run
+ * faster with it, and the bus bench checks the frame memory the SPI backend
+ * leaves against it.
+ */
+
+#include "host_hal.h"
+#include "panel.h"
+#include "bus_host.h"
+#include "ili9488_prof.h"
+
+static void bus_host_init(void)
+{
+}
+
+static void bus_host_write_register(uint8_t uc_reg, const ili9488_color_t *p_data,
+		uint32_t ul_size)
+{
+	panel_set_dc(false);
+	panel_write(&uc_reg, 1);
+	ILI9488_PROF_REGISTER(uc_reg, ul_size);
+	if (ul_size) {
+		panel_set_dc(true);
+		panel_write(p_data, ul_size);
+	}
+}
+
+static void bus_host_write_ram(ili9488_color_t color)
+{
+	panel_set_dc(true);
+	panel_write(&color, 1);
+	ILI9488_PROF_GRAM(1);
+}
+
+static void bus_host_write_ram_buffer(const ili9488_color_t *p_buf,
+		uint32_t ul_size, uint32_t ul_repeat)
+{
+	panel_set_dc(true);
+	ILI9488_PROF_GRAM(ul_size * ul_repeat);
+	while (ul_repeat--) {
+		panel_write(p_buf, ul_size);
+	}
+}
+
+/* Send a read command, then read ul_size bytes, the dummy one first */
+static void bus_host_read(uint8_t uc_reg, uint8_t *p_data, uint32_t ul_size)
+{
+	bus_host_write_register(uc_reg, NULL, 0);
+	panel_set_dc(true);
+	panel_read(p_data, ul_size);
+}
+
+static uint32_t bus_host_read_ram(void)
+{
+	uint8_t uc_buf[4];
+
+	bus_host_read(ILI9488_CMD_MEMORY_READ, uc_buf, 4);
+	return ILI9488_COLOR(uc_buf[1], uc_buf[2], uc_buf[3]);
+}
+
+static uint16_t bus_host_read_scanline(void)
+{
+	uint8_t uc_buf[3];
+
+	bus_host_read(ILI9488_CMD_GET_SCANLINE, uc_buf, 3);
+	return (uint16_t)(((uc_buf[1] & 0x03) << 8) | uc_buf[2]);
+}
+
+static uint32_t bus_host_read_chipid(void)
+{
+	uint8_t uc_buf[4];
+
+	bus_host_read(ILI9488_CMD_READ_ID4, uc_buf, 4);
+	return ((uint32_t)uc_buf[1] << 16) | ((uint32_t)uc_buf[2] << 8) | uc_buf[3];
+}
+
+static void bus_host_read_pixels(uint16_t *p_us_pixels, uint32_t ul_count)
+{
+	uint8_t uc_buf[3];
+
+	bus_host_read(ILI9488_CMD_MEMORY_READ, uc_buf, 1);
+	while (ul_count--) {
+		panel_read(uc_buf, 3);
+		*p_us_pixels++ = ILI9488_COLOR(uc_buf[0], uc_buf[1], uc_buf[2]);
+	}
+}
+
+static void bus_host_sync(void)
+{
+}
+
+const struct ili9488_bus ili9488_bus_host = {
+	.p_name = "host",
+	.format = ILI9488_BUS_FORMAT,
+	.init = bus_host_init,
+	.write_register = bus_host_write_register,
+	.write_ram = bus_host_write_ram,
+	.write_ram_buffer = bus_host_write_ram_buffer,
+	.read_ram = bus_host_read_ram,
+	.read_scanline = bus_host_read_scanline,
+	.read_chipid = bus_host_read_chipid,
+	.read_pixels = bus_host_read_pixels,
+	.sync = bus_host_sync,
+};
@@ -0,0 +1,14 @@
+/**
+ * \file
+ *
+ * \brief ILI9488 bus backend writing straight into the panel model.
+ */
+
+#ifndef BUS_HOST_H_INCLUDED
+#define BUS_HOST_H_INCLUDED
+
+#include "ili9488_bus.h"
+
+extern const struct ili9488_bus ili9488_bus_host;
+
+#endif /* BUS_HOST_H_INCLUDED */
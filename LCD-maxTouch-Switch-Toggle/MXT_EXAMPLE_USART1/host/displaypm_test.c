@@ -0,0 +1,176 @@
+/**
+ * \file
+ *
+ * \brief Mode switches of displaypm.c against the panel model.
+ *
+ * The driver runs on the panel model fake of bus_host.c and the manager is
+ * given its times directly, starting just before the millisecond clock
+ * wraps. Each step checks the mode, the event reported, the deadline
+ * returned by displaypm_poll() and what the panel model was told: idle and
+ * partial mode, partial rows, brightness, and the colours the glass shows
+ * inside and outside the band:
+ *
+ *   make -C host bench
+ *   host/build/displaypm_test
+ */
+
+#include <stdio.h>
+#include <inttypes.h>
+#include "host_hal.h"
+#include "hal.h"
+#include "panel.h"
+#include "ili9488.h"
+#include "bus_host.h"
+#include "displaypm.h"
+
+#define TEST_T0        0xFFFFF000u
+#define TEST_DIM_MS    3000
+#define TEST_BAND_MS   1000
+#define TEST_BRIGHT    0xFF
+#define TEST_DIM       0x20
+#define TEST_BAND_END  99
+
+/* 6-bit channels with the top bit set in red only */
+#define TEST_COLOR     0xC04020u
+#define TEST_IDLE      0xFC0000u
+
+static struct displaypm_event g_events[16];
+static uint32_t g_ul_events;
+static uint32_t g_ul_failed;
+
+static void test_event(const struct displaypm_event *p_event)
+{
+	printf("  t0+%-5" PRIu32 " %s -> %s (%s)\n", p_event->ul_ms - TEST_T0,
+			displaypm_mode_name(p_event->from), displaypm_mode_name(p_event->to),
+			displaypm_reason_name(p_event->reason));
+	if (g_ul_events < sizeof(g_events) / sizeof(g_events[0])) {
+		g_events[g_ul_events] = *p_event;
+	}
+	g_ul_events++;
+}
+
+static const struct displaypm_config g_config = {
+	.ul_dim_ms = TEST_DIM_MS,
+	.ul_band_ms = TEST_BAND_MS,
+	.uc_bright = TEST_BRIGHT,
+	.uc_dim = TEST_DIM,
+	.us_band_start = 0,
+	.us_band_end = TEST_BAND_END,
+	.event = test_event,
+};
+
+static void test_check(bool b_ok, const char *p_what)
+{
+	if (!b_ok) {
+		printf("  FAILED: %s\n", p_what);
+		g_ul_failed++;
+	}
+}
+
+/**
+ * \brief Check the mode, the panel state it implies and the last event.
+ *
+ * \param ul_events events expected so far.
+ */
+static void test_expect(enum displaypm_mode mode, uint32_t ul_events,
+		enum displaypm_reason reason)
+{
+	bool b_band = (mode == DISPLAYPM_BAND);
+	uint16_t us_start, us_end;
+	bool b_partial = panel_get_partial(&us_start, &us_end);
+
+	test_check(displaypm_get_mode() == mode, "mode");
+	test_check(g_ul_events == ul_events, "number of events");
+	if (ul_events && (g_ul_events == ul_events)) {
+		test_check(g_events[ul_events - 1].to == mode, "event mode");
+		test_check(g_events[ul_events - 1].reason == reason, "event reason");
+	}
+	test_check(panel_get_brightness()
+			== ((mode == DISPLAYPM_NORMAL) ? TEST_BRIGHT : TEST_DIM), "brightness");
+	test_check(panel_is_idle() == b_band, "idle mode");
+	test_check(b_partial == b_band, "partial mode");
+	if (b_band) {
+		test_check((us_start == 0) && (us_end == TEST_BAND_END), "partial rows");
+	}
+	test_check(panel_get_shown_pixel(10, 10) == (b_band ? TEST_IDLE : TEST_COLOR),
+			"colour inside the band");
+	test_check(panel_get_shown_pixel(10, 300) == (b_band ? 0 : TEST_COLOR),
+			"colour outside the band");
+}
+
+int main(void)
+{
+	struct ili9488_opt_t opt = {
+		.ul_width = ILI9488_LCD_WIDTH,
+		.ul_height = ILI9488_LCD_HEIGHT,
+		.foreground_color = COLOR_CONVERT(TEST_COLOR),
+		.background_color = COLOR_CONVERT(TEST_COLOR),
+		.p_bus = &ili9488_bus_host,
+	};
+	uint32_t t = TEST_T0;
+
+	hal_init();
+	panel_reset();
+	if (ili9488_init(&opt)) {
+		printf("LCD not found\n");
+		return 1;
+	}
+	ili9488_display_on();
+	ili9488_draw_filled_rectangle(0, 0, ILI9488_LCD_WIDTH - 1, ILI9488_LCD_HEIGHT - 1);
+	ili9488_sync();
+
+	printf("dim after %d ms, band after %d ms across the clock wrap\n",
+			TEST_DIM_MS, TEST_BAND_MS);
+	displaypm_init(&g_config, t);
+	test_expect(DISPLAYPM_NORMAL, 0, DISPLAYPM_TOUCH);
+
+	/* Unlocked: only dims, when the delay is over */
+	test_check(displaypm_poll(t + 10) == t + TEST_DIM_MS, "deadline to dim");
+	test_check(displaypm_poll(t + TEST_DIM_MS - 1) == t + TEST_DIM_MS,
+			"deadline to dim, 1 ms before");
+	test_expect(DISPLAYPM_NORMAL, 0, DISPLAYPM_TOUCH);
+	test_check(displaypm_poll(t + TEST_DIM_MS) == DISPLAYPM_NO_DEADLINE,
+			"no deadline once dimmed");
+	test_expect(DISPLAYPM_DIM, 1, DISPLAYPM_INACTIVITY);
+
+	/* A touch restores at once */
+	t += TEST_DIM_MS + 500;
+	displaypm_activity(t);
+	test_expect(DISPLAYPM_NORMAL, 2, DISPLAYPM_TOUCH);
+
+	/* Locked but not running, then running: the band after its delay */
+	displaypm_set_machine(true, false, t + 100);
+	test_check(displaypm_poll(t + 200) == t + TEST_DIM_MS, "locked, deadline to dim");
+	displaypm_set_machine(true, true, t + 300);
+	test_expect(DISPLAYPM_NORMAL, 2, DISPLAYPM_TOUCH);
+	test_check(displaypm_poll(t + 400) == t + TEST_BAND_MS, "deadline to the band");
+	test_check(displaypm_poll(t + TEST_BAND_MS) == DISPLAYPM_NO_DEADLINE,
+			"no deadline in the band");
+	test_expect(DISPLAYPM_BAND, 3, DISPLAYPM_INACTIVITY);
+
+	/* Redrawing keeps the band mode, the touch leaves it */
+	displaypm_set_machine(true, true, t + 2000);
+	test_check(displaypm_poll(t + 2500) == DISPLAYPM_NO_DEADLINE, "band kept");
+	test_expect(DISPLAYPM_BAND, 3, DISPLAYPM_INACTIVITY);
+	t += 2600;
+	displaypm_activity(t);
+	test_expect(DISPLAYPM_NORMAL, 4, DISPLAYPM_TOUCH);
+	test_check(displaypm_poll(t) == t + TEST_BAND_MS, "deadline to the band again");
+
+	/* Back in the band, then the cycle ends: dimmed only, at once */
+	displaypm_poll(t + TEST_BAND_MS);
+	test_expect(DISPLAYPM_BAND, 5, DISPLAYPM_INACTIVITY);
+	displaypm_set_machine(true, false, t + TEST_DIM_MS + 1);
+	test_expect(DISPLAYPM_DIM, 6, DISPLAYPM_MACHINE);
+
+	/* Locking while already idle long enough goes to the band at once */
+	displaypm_set_machine(false, true, t + TEST_DIM_MS + 2);
+	test_expect(DISPLAYPM_DIM, 6, DISPLAYPM_MACHINE);
+	displaypm_set_machine(true, true, t + TEST_DIM_MS + 3);
+	test_expect(DISPLAYPM_BAND, 7, DISPLAYPM_MACHINE);
+	displaypm_set_machine(false, true, t + TEST_DIM_MS + 4);
+	test_expect(DISPLAYPM_DIM, 8, DISPLAYPM_MACHINE);
+
+	printf("%" PRIu32 " events, %s\n", g_ul_events, g_ul_failed ? "FAILED" : "ok");
+	return g_ul_failed ? 1 : 0;
+}
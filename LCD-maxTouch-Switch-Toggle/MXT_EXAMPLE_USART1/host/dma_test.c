@@ -0,0 +1,266 @@
+/**
+ * \file
+ *
+ * \brief Blocks and callbacks of the GRAM transfer engine of ili9488_dma.c.
+ *
+ * The engine is built with a small ILI9488_DMA_MAX_BLOCK, so that transfers
+ * larger than a block are cut into several, and runs on its simulated
+ * backend, which records each block it starts. The test submits transfers
+ * of several sizes and repeat counts, one of them from the completion
+ * callback of another, then checks the blocks recorded (order, source and
+ * size), the byte and block totals against the statistics and the bytes the
+ * panel model was clocked, and that each callback ran once, in the order
+ * the transfers were submitted. It ends with more transfers than the queue
+ * holds, so that the ring and the log wrap:
+ *
+ *   make -C host bench
+ *   host/build/dma_test
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include "host_hal.h"
+#include "hal.h"
+#include "panel.h"
+#include "ili9488.h"
+#include "ili9488_dma.h"
+
+#ifndef ILI9488_DMA_MAX_BLOCK
+#  error "build with the ILI9488_DMA_MAX_BLOCK of the engine under test"
+#endif
+
+#define TEST_BLOCK       ILI9488_DMA_MAX_BLOCK
+#define TEST_MAX_BLOCKS  ILI9488_DMA_LOG_SIZE
+#define TEST_MAX_CALLS   64
+
+/** A transfer: a slice of g_uc_src sent ul_repeat times. */
+struct test_xfer {
+	uint32_t ul_offset;
+	uint32_t ul_size;
+	uint32_t ul_repeat;
+};
+
+/* Transfer 3 is submitted by the callback of transfer 2 */
+#define TEST_NESTED_FROM 2
+
+static const struct test_xfer g_xfer[] = {
+	{ 0,               300,                1 },   /* less than a block */
+	{ 300,             TEST_BLOCK,         1 },   /* exactly one */
+	{ 17,              2 * TEST_BLOCK + 500, 1 }, /* two and a half */
+	{ 5,               7,                  3 },   /* nested, repeated */
+	{ 64,              30,                 5 },   /* small line, repeated */
+	{ 1,               TEST_BLOCK + 200,   2 },   /* cut in each repetition */
+};
+
+#define TEST_XFERS (sizeof(g_xfer) / sizeof(g_xfer[0]))
+
+static uint8_t g_uc_src[4 * TEST_BLOCK];
+static uint32_t g_ul_calls[TEST_MAX_CALLS];
+static uint32_t g_ul_call_count;
+static uint32_t g_ul_failed;
+
+static void test_check(bool b_ok, const char *p_what)
+{
+	if (!b_ok) {
+		printf("  FAILED: %s\n", p_what);
+		g_ul_failed++;
+	}
+}
+
+static uint32_t test_submit(uint32_t ul_index);
+
+/* Completion callback: records the transfer, p_arg is its index */
+static void test_done(void *p_arg)
+{
+	uint32_t ul_index = (uint32_t)(uintptr_t)p_arg;
+
+	if (g_ul_call_count < TEST_MAX_CALLS) {
+		g_ul_calls[g_ul_call_count] = ul_index;
+	}
+	g_ul_call_count++;
+
+	if (ul_index == TEST_NESTED_FROM) {
+		test_check(!test_submit(TEST_NESTED_FROM + 1), "nested submit");
+	}
+}
+
+static uint32_t test_submit(uint32_t ul_index)
+{
+	const struct test_xfer *p_xfer = &g_xfer[ul_index];
+
+	return ili9488_dma_submit(&g_uc_src[p_xfer->ul_offset], p_xfer->ul_size,
+			p_xfer->ul_repeat, test_done, (void *)(uintptr_t)ul_index);
+}
+
+/**
+ * \brief Check the log against the blocks the transfers should be cut into.
+ *
+ * \return number of blocks expected.
+ */
+static uint32_t test_blocks(const struct ili9488_dma_record *p_log,
+		uint32_t ul_logged, uint64_t *p_ull_bytes)
+{
+	const struct ili9488_dma_record *p_rec;
+	uint32_t ul_block = 0;
+	uint32_t i, ul_pass, ul_done, ul_size;
+
+	*p_ull_bytes = 0;
+	for (i = 0; i < TEST_XFERS; i++) {
+		for (ul_pass = 0; ul_pass < g_xfer[i].ul_repeat; ul_pass++) {
+			for (ul_done = 0; ul_done < g_xfer[i].ul_size; ul_done += ul_size) {
+				ul_size = Min(g_xfer[i].ul_size - ul_done, TEST_BLOCK);
+				*p_ull_bytes += ul_size;
+				if (ul_block >= Min(ul_logged, TEST_MAX_BLOCKS)) {
+					ul_block++;
+					continue;
+				}
+				p_rec = &p_log[ul_block % ILI9488_DMA_LOG_SIZE];
+				if ((p_rec->ul_sequence != ul_block)
+						|| (p_rec->p_src != &g_uc_src[g_xfer[i].ul_offset + ul_done])
+						|| (p_rec->ul_size != ul_size)) {
+					printf("  block %" PRIu32 ": #%" PRIu32 " %+td, %" PRIu32
+							" bytes; expected transfer %" PRIu32 " +%" PRIu32
+							", %" PRIu32 " bytes\n", ul_block, p_rec->ul_sequence,
+							p_rec->p_src - g_uc_src, p_rec->ul_size, i,
+							g_xfer[i].ul_offset + ul_done, ul_size);
+					test_check(false, "block");
+				}
+				ul_block++;
+			}
+		}
+	}
+	return ul_block;
+}
+
+/**
+ * \brief Submit g_xfer and check the blocks, totals and callbacks.
+ */
+static void test_transfers(void)
+{
+	const struct ili9488_dma_record *p_log;
+	struct ili9488_dma_stats stats;
+	struct panel_stats panel;
+	uint64_t ull_bytes;
+	uint32_t ul_logged, ul_blocks;
+	uint32_t i;
+
+	printf("%u transfers, blocks of %u bytes\n", (unsigned)TEST_XFERS,
+			(unsigned)TEST_BLOCK);
+	ili9488_dma_reset_stats();
+	panel_reset_stats();
+	g_ul_call_count = 0;
+
+	for (i = 0; i < TEST_XFERS; i++) {
+		if (i != TEST_NESTED_FROM + 1) {
+			test_check(!test_submit(i), "submit");
+		}
+	}
+	ili9488_dma_wait();
+
+	ili9488_dma_get_stats(&stats);
+	panel_get_stats(&panel);
+	ul_logged = ili9488_dma_get_log(&p_log);
+	ul_blocks = test_blocks(p_log, ul_logged, &ull_bytes);
+	printf("  %" PRIu32 " blocks, %" PRIu32 " bytes, %" PRIu64 " on the bus\n",
+			stats.ul_blocks, stats.ul_bytes, panel.ull_bytes);
+
+	test_check(ul_blocks <= TEST_MAX_BLOCKS, "blocks fit in the log");
+	test_check(ul_logged == ul_blocks, "blocks logged");
+	test_check(stats.ul_blocks == ul_blocks, "blocks counted");
+	test_check(stats.ul_bytes == ull_bytes, "bytes counted");
+	test_check(panel.ull_bytes == ull_bytes, "bytes on the bus");
+	test_check(stats.ul_transfers == TEST_XFERS, "transfers counted");
+	test_check(!ili9488_dma_is_busy(), "idle after the wait");
+
+	/* Once each, in the order they were submitted, the nested one right
+	 * after the transfer whose callback submitted it */
+	test_check(g_ul_call_count == TEST_XFERS, "callbacks");
+	for (i = 0; (i < g_ul_call_count) && (i < TEST_XFERS); i++) {
+		if (g_ul_calls[i] != i) {
+			printf("  callback %" PRIu32 " is of transfer %" PRIu32 "\n", i,
+					g_ul_calls[i]);
+			test_check(false, "callback order");
+		}
+	}
+
+	/* Nothing queued, nothing called */
+	test_check(ili9488_dma_submit(g_uc_src, 0, 1, test_done, NULL)
+			&& ili9488_dma_submit(g_uc_src, 1, 0, test_done, NULL)
+			&& (g_ul_call_count == TEST_XFERS), "empty transfers refused");
+}
+
+/**
+ * \brief Run the queue and the log through their wrap.
+ */
+static void test_wrap(void)
+{
+	const struct ili9488_dma_record *p_log;
+	struct ili9488_dma_stats stats;
+	uint32_t ul_count = ILI9488_DMA_LOG_SIZE + 3 * ILI9488_DMA_QUEUE_SIZE + 1;
+	uint32_t ul_logged;
+	bool b_log = true;
+	uint32_t i;
+
+	printf("%" PRIu32 " transfers through a queue of %u and a log of %u\n",
+			ul_count, ILI9488_DMA_QUEUE_SIZE, ILI9488_DMA_LOG_SIZE);
+	ili9488_dma_reset_stats();
+	g_ul_call_count = 0;
+
+	for (i = 0; i < ul_count; i++) {
+		test_check(!ili9488_dma_submit(&g_uc_src[i], 1 + (i % 3), 1,
+				test_done, (void *)(uintptr_t)(TEST_XFERS + i)), "submit");
+	}
+	ili9488_dma_wait();
+
+	ili9488_dma_get_stats(&stats);
+	ul_logged = ili9488_dma_get_log(&p_log);
+	test_check((stats.ul_transfers == ul_count) && (stats.ul_blocks == ul_count)
+			&& (ul_logged == ul_count), "transfers and blocks counted");
+
+	/* The log keeps the last ILI9488_DMA_LOG_SIZE blocks */
+	for (i = ul_count - ILI9488_DMA_LOG_SIZE; i < ul_count; i++) {
+		const struct ili9488_dma_record *p_rec = &p_log[i % ILI9488_DMA_LOG_SIZE];
+
+		b_log &= (p_rec->ul_sequence == i) && (p_rec->p_src == &g_uc_src[i])
+				&& (p_rec->ul_size == 1 + (i % 3));
+	}
+	test_check(b_log, "log after the wrap");
+
+	test_check(g_ul_call_count == ul_count, "callbacks");
+	for (i = 0; (i < g_ul_call_count) && (i < TEST_MAX_CALLS); i++) {
+		test_check(g_ul_calls[i] == TEST_XFERS + i, "callback order");
+	}
+}
+
+int main(void)
+{
+	struct ili9488_opt_t opt = {
+		.ul_width = ILI9488_LCD_WIDTH,
+		.ul_height = ILI9488_LCD_HEIGHT,
+		.foreground_color = COLOR_CONVERT(COLOR_WHITE),
+		.background_color = COLOR_CONVERT(COLOR_WHITE),
+	};
+	uint32_t i;
+
+	for (i = 0; i < sizeof(g_uc_src); i++) {
+		g_uc_src[i] = (uint8_t)(i * 7);
+	}
+
+	hal_init();
+	panel_reset();
+	if (ili9488_init(&opt)) {
+		printf("LCD not found\n");
+		return 1;
+	}
+
+	/* The payload lands in the frame memory, as a GRAM write would */
+	ili9488_draw_prepare(0, 0, ILI9488_LCD_WIDTH, ILI9488_LCD_HEIGHT);
+	ili9488_sync();
+
+	test_transfers();
+	test_wrap();
+
+	printf("%s\n", g_ul_failed ? "FAILED" : "ok");
+	return g_ul_failed ? 1 : 0;
+}
@@ -0,0 +1,202 @@
+/**
+ * \file
+ *
+ * \brief Glyph lookup of text.c on contiguous and sparse fonts.
+ *
+ * Checks text_utf8_next() against valid and broken UTF-8, and that every
+ * character of calibri_36 is found at the same glyph through the index of
+ * the contiguous range, through bisection when the whole table is sparse,
+ * and through the plain indexing of the lcd-image-converter fonts. Then
+ * times each lookup over the strings of the user interface:
+ *
+ *   make -C host bench
+ *   host/build/font_bench [rounds]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "host_hal.h"
+#include "bench_sim.h"
+#include "text.h"
+#include "calibri_36.h"
+
+#define BENCH_ROUNDS   200000
+
+/* What main.c and maquina1.h draw */
+static const char *const g_strings[] = {
+	"Rápido", "Diário", "Pesado", "Enxágue", "Centrífuga",
+	"LAVAGEM ", "CONCLUÍDA!", "Total: 60 min", "12:34",
+};
+
+struct utf8_case {
+	const char *p_str;
+	uint32_t ul_code[4];     /* code points, 0 ends */
+};
+
+static const struct utf8_case g_utf8[] = {
+	{ "A", { 'A' } },
+	{ "\xC3\x8D", { 0xCD } },
+	{ "\xE2\x82\xAC", { 0x20AC } },
+	{ "\xF0\x9F\x98\x80", { 0x1F600 } },
+	/* Overlong, surrogate, past U+10FFFF: one invalid per byte */
+	{ "\xC0\xAF", { TEXT_UTF8_INVALID, TEXT_UTF8_INVALID } },
+	{ "\xED\xA0\x80", { TEXT_UTF8_INVALID, TEXT_UTF8_INVALID, TEXT_UTF8_INVALID } },
+	{ "\xF4\x90\x80\x80" "a", { TEXT_UTF8_INVALID, TEXT_UTF8_INVALID,
+			TEXT_UTF8_INVALID, TEXT_UTF8_INVALID } },
+	/* Truncated: decoding resumes at the next character */
+	{ "\xC3" "A", { TEXT_UTF8_INVALID, 'A' } },
+	{ "\xE2\x82", { TEXT_UTF8_INVALID, TEXT_UTF8_INVALID } },
+	{ "\x80" "b", { TEXT_UTF8_INVALID, 'b' } },
+};
+
+static uint32_t g_ul_failed;
+
+static void bench_check(bool b_ok, const char *p_what)
+{
+	if (!b_ok) {
+		printf("  FAILED: %s\n", p_what);
+		g_ul_failed++;
+	}
+}
+
+/**
+ * \brief The lookup of text.c before sparse fonts, ASCII only.
+ */
+static const tImage *bench_indexed(const tFont *p_font, uint32_t ul_code)
+{
+	if ((ul_code < (uint8_t)p_font->start_char)
+			|| (ul_code > (uint8_t)p_font->end_char)) {
+		return NULL;
+	}
+	return p_font->chars[ul_code - (uint8_t)p_font->start_char].image;
+}
+
+static int bench_compare(const void *p_a, const void *p_b)
+{
+	long a = ((const tChar *)p_a)->code;
+	long b = ((const tChar *)p_b)->code;
+
+	return (a > b) - (a < b);
+}
+
+static void bench_utf8(void)
+{
+	const char *p_str;
+	uint32_t i, k, ul_code;
+	char c_what[64];
+
+	for (i = 0; i < sizeof(g_utf8) / sizeof(g_utf8[0]); i++) {
+		p_str = g_utf8[i].p_str;
+		for (k = 0; k < 4; k++) {
+			ul_code = text_utf8_next(&p_str);
+			snprintf(c_what, sizeof(c_what), "utf-8 case %" PRIu32 ", character %"
+					PRIu32 ": U+%04" PRIX32, i, k, ul_code);
+			if (!g_utf8[i].ul_code[k]) {
+				bench_check(!ul_code, c_what);
+				break;
+			}
+			bench_check(ul_code == g_utf8[i].ul_code[k], c_what);
+		}
+	}
+	p_str = "";
+	bench_check(!text_utf8_next(&p_str) && !text_utf8_next(&p_str),
+			"end of the string");
+}
+
+/**
+ * \brief Time a lookup over the characters of the strings.
+ *
+ * \param b_indexed through bench_indexed(), else text_get_glyph().
+ *
+ * \return ns per character.
+ */
+static double bench_time(const tFont *p_font, bool b_indexed, uint32_t ul_rounds,
+		uint32_t *p_ul_found)
+{
+	static uint32_t ul_codes[256];
+	volatile uintptr_t sink = 0;
+	uint32_t ul_count = 0, ul_found = 0, r, i;
+	const char *p_str;
+	uint64_t ull_ns;
+	const tImage *p_image;
+
+	for (i = 0; i < sizeof(g_strings) / sizeof(g_strings[0]); i++) {
+		for (p_str = g_strings[i]; *p_str;) {
+			ul_codes[ul_count++] = text_utf8_next(&p_str);
+		}
+	}
+
+	ull_ns = bench_now_ns();
+	for (r = 0; r < ul_rounds; r++) {
+		for (i = 0; i < ul_count; i++) {
+			p_image = b_indexed ? bench_indexed(p_font, ul_codes[i])
+					: text_get_glyph(p_font, ul_codes[i]);
+			sink ^= (uintptr_t)p_image;
+			ul_found += p_image ? 1 : 0;
+		}
+	}
+	ull_ns = bench_now_ns() - ull_ns;
+	*p_ul_found = ul_found / ul_rounds;
+	(void)sink;
+	return (double)ull_ns / ((double)ul_rounds * ul_count);
+}
+
+int main(int argc, char **argv)
+{
+	static tChar sparse_chars[256];
+	tFont sparse = calibri_36;
+	uint32_t ul_rounds = (argc > 1) ? strtoul(argv[1], NULL, 0) : BENCH_ROUNDS;
+	uint32_t ul_chars = 0, ul_found, i, c;
+	const char *p_str;
+	double ns;
+
+	if (!ul_rounds || (calibri_36.length > 256)) {
+		fprintf(stderr, "usage: %s [rounds]\n", argv[0]);
+		return 2;
+	}
+
+	bench_utf8();
+
+	/* The same glyphs with no contiguous range, all found by bisection */
+	memcpy(sparse_chars, calibri_36.chars, calibri_36.length * sizeof(tChar));
+	qsort(sparse_chars, calibri_36.length, sizeof(tChar), bench_compare);
+	sparse.chars = sparse_chars;
+	sparse.start_char = 1;
+	sparse.end_char = 0;
+
+	for (c = 0; c < 0x110; c++) {
+		const tImage *p_image = text_get_glyph(&calibri_36, c);
+
+		bench_check(p_image == text_get_glyph(&sparse, c), "sparse lookup");
+		if (c < 0x80) {
+			bench_check(p_image == bench_indexed(&calibri_36, c), "indexed lookup");
+		}
+	}
+	for (i = 0; i < (uint32_t)calibri_36.length; i++) {
+		bench_check(text_get_glyph(&calibri_36, calibri_36.chars[i].code)
+				== calibri_36.chars[i].image, "every character found");
+	}
+	for (i = 0; i < sizeof(g_strings) / sizeof(g_strings[0]); i++) {
+		for (p_str = g_strings[i]; *p_str; ul_chars++) {
+			bench_check(text_get_glyph(&calibri_36, text_utf8_next(&p_str)) != NULL,
+					g_strings[i]);
+		}
+	}
+
+	printf("calibri_36: %d characters, %d indexed; %" PRIu32 " characters "
+			"in the strings, %" PRIu32 " rounds\n", calibri_36.length,
+			(uint8_t)calibri_36.end_char - (uint8_t)calibri_36.start_char + 1,
+			ul_chars, ul_rounds);
+	printf("%-34s %6s %8s\n", "lookup", "found", "ns/char");
+	ns = bench_time(&calibri_36, true, ul_rounds, &ul_found);
+	printf("%-34s %6" PRIu32 " %8.2f\n", "index only (accents missing)", ul_found, ns);
+	ns = bench_time(&calibri_36, false, ul_rounds, &ul_found);
+	printf("%-34s %6" PRIu32 " %8.2f\n", "index, bisection past the range", ul_found, ns);
+	ns = bench_time(&sparse, false, ul_rounds, &ul_found);
+	printf("%-34s %6" PRIu32 " %8.2f\n", "bisection of the whole table", ul_found, ns);
+
+	printf("%s\n", g_ul_failed ? "FAILED" : "ok");
+	return g_ul_failed ? 1 : 0;
+}
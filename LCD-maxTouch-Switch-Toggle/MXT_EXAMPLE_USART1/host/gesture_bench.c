@@ -0,0 +1,147 @@
+/**
+ * \file
+ *
+ * \brief Lookup cost of the gesture widget grid against a linear scan.
+ *
+ * Lays out a full-screen background and a tiled keypad of small buttons
+ * over the 320x480 area, then resolves random touch points with
+ * gesture_find() and with a scan of every widget from the top, checking
+ * that both agree:
+ *
+ *   make -C host bench
+ *   host/build/gesture_bench
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include "bench_sim.h"
+#include "gesture.h"
+
+#define BENCH_LOOKUPS  1000000
+#define BENCH_POINTS   4096
+
+static struct gesture_widget g_widgets[GESTURE_MAX_WIDGETS];
+static int16_t g_s_points[BENCH_POINTS][2];
+static volatile uintptr_t g_ul_sink;   /* keeps the lookups alive */
+
+static void bench_handler(const struct gesture_widget *p_widget,
+		const struct gesture_event *p_event)
+{
+	(void)p_widget;
+	(void)p_event;
+}
+
+/* What gesture_find() replaced: every widget, topmost first */
+static const struct gesture_widget *bench_scan(uint32_t ul_count, int16_t x,
+		int16_t y)
+{
+	int32_t i;
+
+	for (i = (int32_t)ul_count - 1; i >= 0; i--) {
+		if ((x >= g_widgets[i].x1) && (x <= g_widgets[i].x2)
+				&& (y >= g_widgets[i].y1) && (y <= g_widgets[i].y2)) {
+			return &g_widgets[i];
+		}
+	}
+	return NULL;
+}
+
+/**
+ * \brief Register a background and ul_buttons buttons tiled over the area.
+ */
+static uint32_t bench_layout(uint32_t ul_buttons)
+{
+	uint32_t ul_cols = 1, ul_rows, ul_w, ul_h, i;
+
+	while (ul_cols * ul_cols * 3 < ul_buttons * 2) {
+		ul_cols++;
+	}
+	ul_rows = (ul_buttons + ul_cols - 1) / ul_cols;
+	ul_w = GESTURE_AREA_WIDTH / ul_cols;
+	ul_h = GESTURE_AREA_HEIGHT / ul_rows;
+
+	gesture_init();
+	g_widgets[0].x1 = 0;
+	g_widgets[0].y1 = 0;
+	g_widgets[0].x2 = GESTURE_AREA_WIDTH - 1;
+	g_widgets[0].y2 = GESTURE_AREA_HEIGHT - 1;
+	g_widgets[0].us_flags = GESTURE_WANT_SWIPE_H;
+	g_widgets[0].handler = bench_handler;
+	gesture_add_widget(&g_widgets[0]);
+
+	/* Buttons with a 2 pixel gap, so some points only hit the background */
+	for (i = 0; i < ul_buttons; i++) {
+		struct gesture_widget *p_widget = &g_widgets[i + 1];
+
+		p_widget->x1 = (int16_t)((i % ul_cols) * ul_w + 1);
+		p_widget->y1 = (int16_t)((i / ul_cols) * ul_h + 1);
+		p_widget->x2 = (int16_t)(p_widget->x1 + ul_w - 3);
+		p_widget->y2 = (int16_t)(p_widget->y1 + ul_h - 3);
+		p_widget->us_flags = GESTURE_WANT_TAP;
+		p_widget->handler = bench_handler;
+		if (!gesture_add_widget(p_widget)) {
+			fprintf(stderr, "grid full at %" PRIu32 " buttons\n", i);
+			exit(1);
+		}
+	}
+	return ul_buttons + 1;
+}
+
+static void bench_run(uint32_t ul_buttons)
+{
+	uint32_t ul_count = bench_layout(ul_buttons);
+	const struct gesture_widget *p_found;
+	uint64_t ull_start, ull_grid, ull_scan;
+	uint32_t i, ul_mismatch = 0;
+
+	for (i = 0; i < BENCH_POINTS; i++) {
+		p_found = gesture_find(g_s_points[i][0], g_s_points[i][1], 0);
+		if (p_found != bench_scan(ul_count, g_s_points[i][0], g_s_points[i][1])) {
+			ul_mismatch++;
+		}
+	}
+
+	ull_start = bench_now_ns();
+	for (i = 0; i < BENCH_LOOKUPS; i++) {
+		const int16_t *p_pt = g_s_points[i % BENCH_POINTS];
+
+		g_ul_sink += (uintptr_t)gesture_find(p_pt[0], p_pt[1], 0);
+	}
+	ull_grid = bench_now_ns() - ull_start;
+
+	ull_start = bench_now_ns();
+	for (i = 0; i < BENCH_LOOKUPS; i++) {
+		const int16_t *p_pt = g_s_points[i % BENCH_POINTS];
+
+		g_ul_sink += (uintptr_t)bench_scan(ul_count, p_pt[0], p_pt[1]);
+	}
+	ull_scan = bench_now_ns() - ull_start;
+
+	printf("%5" PRIu32 " widgets  grid %7.1f ns  scan %8.1f ns  mismatches %"
+			PRIu32 "\n", ul_count, (double)ull_grid / BENCH_LOOKUPS,
+			(double)ull_scan / BENCH_LOOKUPS, ul_mismatch);
+	if (ul_mismatch) {
+		exit(1);
+	}
+}
+
+int main(void)
+{
+	static const uint32_t ul_buttons[] = { 4, 16, 64, 128, 256, 500 };
+	uint32_t i;
+
+	srand(1);
+	for (i = 0; i < BENCH_POINTS; i++) {
+		g_s_points[i][0] = (int16_t)(rand() % GESTURE_AREA_WIDTH);
+		g_s_points[i][1] = (int16_t)(rand() % GESTURE_AREA_HEIGHT);
+	}
+
+	printf("per lookup, %d random points, %dx%d area, %d px cells\n",
+			BENCH_LOOKUPS, GESTURE_AREA_WIDTH, GESTURE_AREA_HEIGHT,
+			1 << GESTURE_GRID_SHIFT);
+	for (i = 0; i < sizeof(ul_buttons) / sizeof(ul_buttons[0]); i++) {
+		bench_run(ul_buttons[i]);
+	}
+	return 0;
+}
@@ -0,0 +1,172 @@
+/**
+ * \file
+ *
+ * \brief The text redraws of a wash cycle with glyph caches of several sizes.
+ *
+ * Replays what main.c draws during a 60 minute cycle: the total time when
+ * it starts, the timer every second as update_timer() does, and the end
+ * message. For each number of slots it prints the hits and misses of the
+ * glyph cache, the glyphs still decoded from the font data and the time
+ * spent rendering the text, and checks that the framebuffer is the same as
+ * without the cache after every redraw:
+ *
+ *   make -C host bench
+ *   host/build/glyph_bench [slots...]
+ *
+ * The slot counts default to 0 (no cache) up to GLYPH_CACHE_SLOTS. On the
+ * host the font data is in RAM, so the time barely moves with the cache:
+ * what it saves on the board are the flash reads of the decodes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "host_hal.h"
+#include "hal.h"
+#include "bench_sim.h"
+#include "panel.h"
+#include "ili9488.h"
+#include "compositor.h"
+#include "text.h"
+#include "glyphcache.h"
+#include "calibri_36.h"
+
+#define BENCH_MINUTES  60
+
+struct bench_run {
+	uint64_t ull_ns;          /* rendering the text, flushes excluded */
+	uint32_t ul_redraws;
+	uint32_t ul_glyphs;       /* drawn, from the cache or decoded */
+	uint32_t ul_hash;         /* of the framebuffer after every redraw */
+};
+
+static uint32_t bench_hash(uint32_t ul_hash, uint32_t ul_x1, uint32_t ul_y1,
+		uint32_t ul_x2, uint32_t ul_y2)
+{
+	const uint16_t *p_us_fb = compositor_get_framebuffer();
+	uint32_t x, y;
+
+	for (y = ul_y1; y <= ul_y2; y++) {
+		for (x = ul_x1; x <= ul_x2; x++) {
+			ul_hash = (ul_hash ^ p_us_fb[y * COMPOSITOR_WIDTH + x]) * 16777619u;
+		}
+	}
+	return ul_hash;
+}
+
+/**
+ * \brief Draw a string as main.c does and account for it.
+ */
+static void bench_text(struct bench_run *p_run, const struct text_style *p_style,
+		const char *p_str, uint32_t ul_x1, uint32_t ul_y1, uint32_t ul_x2)
+{
+	uint32_t ul_y2 = ul_y1 + text_get_height(p_style, p_str) - 1;
+	uint64_t ull_ns;
+	const char *p_c;
+
+	if (ul_x2 == 0) {
+		ul_x2 = ul_x1 + text_get_width(p_style, p_str) - 1;
+	}
+	ull_ns = bench_now_ns();
+	text_draw(p_style, p_str, ul_x1, ul_y1, ul_x2, ul_y2);
+	p_run->ull_ns += bench_now_ns() - ull_ns;
+	p_run->ul_redraws++;
+	for (p_c = p_str; *p_c;) {
+		p_run->ul_glyphs += text_get_glyph(p_style->p_font, text_utf8_next(&p_c))
+				? 1 : 0;
+	}
+	p_run->ul_hash = bench_hash(p_run->ul_hash, ul_x1, ul_y1, ul_x2, ul_y2);
+	compositor_flush();
+	ili9488_sync();
+}
+
+static void bench_cycle(struct bench_run *p_run)
+{
+	/* The styles of the labels of ui_scene_init() */
+	struct text_style total = {&calibri_36, COLOR_WHITE, 2, TEXT_ALIGN_LEFT, false, COLOR_BLACK};
+	struct text_style timer = {&calibri_36, COLOR_WHITE, 2, TEXT_ALIGN_CENTER, true, COLOR_BLACK};
+	struct text_style label = {&calibri_36, COLOR_WHITE, 2, TEXT_ALIGN_LEFT, false, COLOR_BLACK};
+	char c_buffer[32];
+	uint32_t ul_s;
+
+	memset(p_run, 0, sizeof(*p_run));
+	p_run->ul_hash = 2166136261u;
+	compositor_init(COLOR_WHITE);
+	compositor_flush();
+	ili9488_sync();
+
+	sprintf(c_buffer, "Total: %d min", BENCH_MINUTES);
+	bench_text(p_run, &total, c_buffer, 100, 60, ILI9488_LCD_WIDTH - 1);
+	for (ul_s = 1; ul_s < BENCH_MINUTES * 60; ul_s++) {
+		sprintf(c_buffer, "%02" PRIu32 ":%02" PRIu32, ul_s / 60, ul_s % 60);
+		bench_text(p_run, &timer, c_buffer, 175, 20, 300);
+	}
+	bench_text(p_run, &label, "LAVAGEM ", 60, 10, 0);
+	bench_text(p_run, &label, "CONCLUÍDA!", 60, 45, 0);
+}
+
+int main(int argc, char **argv)
+{
+	struct ili9488_opt_t opt = {
+		.ul_width = ILI9488_LCD_WIDTH,
+		.ul_height = ILI9488_LCD_HEIGHT,
+		.foreground_color = COLOR_CONVERT(COLOR_WHITE),
+		.background_color = COLOR_CONVERT(COLOR_WHITE),
+	};
+	static const uint32_t ul_default[] = { 0, 1, 4, 8, 11, GLYPH_CACHE_SLOTS };
+	struct glyph_cache_stats stats;
+	struct bench_run ref, run;
+	uint32_t ul_slots, ul_count, ul_failed = 0;
+	int i;
+
+	for (i = 1; i < argc; i++) {
+		if ((argv[i][0] < '0') || (argv[i][0] > '9')) {
+			fprintf(stderr, "usage: %s [slots...]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	hal_init();
+	panel_reset();
+	ili9488_init(&opt);
+	ili9488_display_on();
+
+	/* Reference, without the cache */
+	glyph_cache_set_slots(0);
+	bench_cycle(&ref);
+
+	printf("%" PRIu32 " redraws of %" PRIu32 " glyphs over %d minutes, "
+			"%u pixels per slot\n", ref.ul_redraws, ref.ul_glyphs, BENCH_MINUTES,
+			GLYPH_CACHE_SLOT_PIXELS);
+	printf("%-5s %6s %8s %6s %6s %8s %6s %8s %9s\n", "slots", "KiB", "hits",
+			"misses", "evict", "bypassed", "hit %", "decodes", "ns/redraw");
+	ul_count = (argc > 1) ? (uint32_t)(argc - 1)
+			: sizeof(ul_default) / sizeof(ul_default[0]);
+	for (i = 0; i < (int)ul_count; i++) {
+		ul_slots = (argc > 1) ? strtoul(argv[i + 1], NULL, 0) : ul_default[i];
+		ul_slots = Min(ul_slots, GLYPH_CACHE_SLOTS);
+		glyph_cache_set_slots(ul_slots);
+		glyph_cache_reset_stats();
+		bench_cycle(&run);
+		glyph_cache_get_stats(&stats);
+		if (run.ul_hash != ref.ul_hash) {
+			printf("%" PRIu32 " slots: the text differs from the one drawn without cache\n",
+					ul_slots);
+			ul_failed++;
+		}
+		/* Misses are decoded into the slot, the other glyphs into the string */
+		printf("%-5" PRIu32 " %6.1f %8" PRIu32 " %6" PRIu32 " %6" PRIu32 " %8" PRIu32
+				" %5.1f%% %8" PRIu32 " %9" PRIu64 "\n",
+				ul_slots, ul_slots * GLYPH_CACHE_SLOT_PIXELS * 2 / 1024.0,
+				stats.ul_hits, stats.ul_misses, stats.ul_evictions, stats.ul_bypassed,
+				100.0 * stats.ul_hits / run.ul_glyphs, run.ul_glyphs - stats.ul_hits,
+				run.ull_ns / run.ul_redraws);
+	}
+
+	if (ul_failed) {
+		printf("FAILED\n");
+		return 1;
+	}
+	return 0;
+}
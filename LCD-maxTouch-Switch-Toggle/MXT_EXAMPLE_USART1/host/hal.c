@@ -0,0 +1,882 @@
+/**
+ * \file
+ *
+ * \brief Host implementation of the ASF driver subset used by the firmware.
+ *
+ * SPI traffic goes to the ILI9488 model (the D/C line is LCD_SPI_CDS_PIO)
+ * and takes its time on the bus at the configured baud rate, in chunks of
+ * HOST_SPI_CHUNK bytes so the model sees when each part arrives. TWIHS
+ * transfers to the maXTouch model, whose /CHG output drives
+ * MAXTOUCH_XPRO_CHG_PIO and its edge interrupt.
+ * Timer counters and the RTT alarm run on the virtual clock of sim.c and call
+ * the application handlers, which are weak no-ops when not defined.
+ */
+
+#include "host_hal.h"
+#include "hal.h"
+#include "sim.h"
+#include "panel.h"
+#include "mxt_model.h"
+
+#define HOST_CPU_HZ  300000000UL
+#define HOST_TC_CHANNELS (HOST_TC_COUNT * 3)
+#define HOST_SPI_CHUNK   64
+
+Pio g_host_pio[HOST_PIO_PORTS];
+Tc g_host_tc[HOST_TC_COUNT];
+Rtc g_host_rtc;
+Rtt g_host_rtt;
+Spi g_host_spi0;
+Twihs g_host_twihs0;
+Usart g_host_usart[2];
+
+#define HOST_WEAK __attribute__((weak))
+
+HOST_WEAK void TC0_Handler(void) {}
+HOST_WEAK void TC1_Handler(void) {}
+HOST_WEAK void TC2_Handler(void) {}
+HOST_WEAK void TC3_Handler(void) {}
+HOST_WEAK void TC4_Handler(void) {}
+HOST_WEAK void TC5_Handler(void) {}
+HOST_WEAK void TC6_Handler(void) {}
+HOST_WEAK void TC7_Handler(void) {}
+HOST_WEAK void TC8_Handler(void) {}
+HOST_WEAK void TC9_Handler(void) {}
+HOST_WEAK void TC10_Handler(void) {}
+HOST_WEAK void TC11_Handler(void) {}
+HOST_WEAK void RTT_Handler(void) {}
+
+static void (*const g_tc_handler[HOST_TC_CHANNELS])(void) = {
+	TC0_Handler, TC1_Handler, TC2_Handler, TC3_Handler,
+	TC4_Handler, TC5_Handler, TC6_Handler, TC7_Handler,
+	TC8_Handler, TC9_Handler, TC10_Handler, TC11_Handler,
+};
+
+static const uint8_t g_uc_tc_id[HOST_TC_CHANNELS] = {
+	ID_TC0, ID_TC1, ID_TC2, ID_TC3, ID_TC4, ID_TC5,
+	ID_TC6, ID_TC7, ID_TC8, ID_TC9, ID_TC10, ID_TC11,
+};
+
+struct hal_pio_handler {
+	Pio *p_pio;
+	uint32_t ul_id;
+	uint32_t ul_mask;
+	uint32_t ul_attr;
+	void (*p_handler)(uint32_t, uint32_t);
+};
+
+static bool g_b_nvic_enabled[ID_PERIPH_COUNT];
+static struct hal_pio_handler g_pio_handler[HOST_PIO_HANDLERS];
+static uint32_t g_ul_pio_handlers;
+static uint32_t g_ul_tc_divisor[HOST_TC_CHANNELS];
+static bool g_b_rtt_armed;
+static uint64_t g_ull_spi_bits;    /* bus time carried over, in us times the baud rate */
+static FILE *g_p_usart_out;        /* NULL: stdout */
+
+/**
+ * \brief Reset every peripheral to its power-on state.
+ */
+void hal_init(void)
+{
+	uint32_t i;
+
+	memset(g_host_pio, 0, sizeof(g_host_pio));
+	memset(g_host_tc, 0, sizeof(g_host_tc));
+	memset(&g_host_rtc, 0, sizeof(g_host_rtc));
+	memset(&g_host_rtt, 0, sizeof(g_host_rtt));
+	memset(&g_host_spi0, 0, sizeof(g_host_spi0));
+	memset(g_b_nvic_enabled, 0, sizeof(g_b_nvic_enabled));
+	g_ul_pio_handlers = 0;
+	g_b_rtt_armed = false;
+	g_ull_spi_bits = 0;
+
+	/* Inputs idle high (pull-ups), /CHG included */
+	for (i = 0; i < HOST_PIO_PORTS; i++) {
+		g_host_pio[i].ul_level = 0xFFFFFFFF;
+	}
+}
+
+/* ---------------------------------------------------------------------- */
+/* Core, clocks and delays                                                */
+/* ---------------------------------------------------------------------- */
+
+void NVIC_EnableIRQ(IRQn_Type irq)
+{
+	if ((irq >= 0) && (irq < ID_PERIPH_COUNT)) {
+		g_b_nvic_enabled[irq] = true;
+	}
+}
+
+void NVIC_DisableIRQ(IRQn_Type irq)
+{
+	if ((irq >= 0) && (irq < ID_PERIPH_COUNT)) {
+		g_b_nvic_enabled[irq] = false;
+	}
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type irq)
+{
+	UNUSED(irq);
+}
+
+void NVIC_SetPriority(IRQn_Type irq, uint32_t ul_priority)
+{
+	UNUSED(irq);
+	UNUSED(ul_priority);
+}
+
+void sysclk_init(void)
+{
+}
+
+uint32_t sysclk_get_cpu_hz(void)
+{
+	return HOST_CPU_HZ;
+}
+
+uint32_t sysclk_get_peripheral_hz(void)
+{
+	return HOST_CPU_HZ / 2;
+}
+
+void sysclk_enable_peripheral_clock(uint32_t ul_id)
+{
+	UNUSED(ul_id);
+}
+
+void board_init(void)
+{
+}
+
+uint32_t pmc_enable_periph_clk(uint32_t ul_id)
+{
+	UNUSED(ul_id);
+	return 0;
+}
+
+uint32_t pmc_disable_periph_clk(uint32_t ul_id)
+{
+	UNUSED(ul_id);
+	return 0;
+}
+
+/**
+ * \brief Sleeping until the next interrupt is an idle point.
+ */
+void pmc_sleep(int sleep_mode)
+{
+	UNUSED(sleep_mode);
+	sim_idle();
+}
+
+void host_wfi(void)
+{
+	sim_idle();
+}
+
+void delay_ms(uint32_t ul_ms)
+{
+	sim_delay_us((uint64_t)ul_ms * 1000);
+}
+
+void delay_us(uint32_t ul_us)
+{
+	sim_delay_us(ul_us);
+}
+
+/* ---------------------------------------------------------------------- */
+/* PIO, ioport                                                            */
+/* ---------------------------------------------------------------------- */
+
+uint32_t pio_configure(Pio *p_pio, uint32_t ul_type, uint32_t ul_mask,
+		uint32_t ul_attribute)
+{
+	UNUSED(ul_attribute);
+	if (ul_type & (PIO_OUTPUT_0 | PIO_OUTPUT_1)) {
+		p_pio->ul_output |= ul_mask;
+		if (ul_type & PIO_OUTPUT_1) {
+			p_pio->ul_level |= ul_mask;
+		} else {
+			p_pio->ul_level &= ~ul_mask;
+		}
+	} else {
+		p_pio->ul_output &= ~ul_mask;
+	}
+	return 1;
+}
+
+void pio_set(Pio *p_pio, uint32_t ul_mask)
+{
+	p_pio->ul_level |= ul_mask;
+}
+
+void pio_clear(Pio *p_pio, uint32_t ul_mask)
+{
+	p_pio->ul_level &= ~ul_mask;
+}
+
+uint32_t pio_get(Pio *p_pio, uint32_t ul_type, uint32_t ul_mask)
+{
+	UNUSED(ul_type);
+	return (p_pio->ul_level & ul_mask) ? 1 : 0;
+}
+
+void pio_set_debounce_filter(Pio *p_pio, uint32_t ul_mask, uint32_t ul_cut_off)
+{
+	UNUSED(p_pio);
+	UNUSED(ul_mask);
+	UNUSED(ul_cut_off);
+}
+
+void pio_enable_interrupt(Pio *p_pio, uint32_t ul_mask)
+{
+	p_pio->ul_irq_mask |= ul_mask;
+}
+
+void pio_disable_interrupt(Pio *p_pio, uint32_t ul_mask)
+{
+	p_pio->ul_irq_mask &= ~ul_mask;
+}
+
+uint32_t pio_handler_set(Pio *p_pio, uint32_t ul_id, uint32_t ul_mask,
+		uint32_t ul_attr, void (*p_handler) (uint32_t, uint32_t))
+{
+	struct hal_pio_handler *p_entry;
+
+	if (g_ul_pio_handlers == HOST_PIO_HANDLERS) {
+		return 1;
+	}
+	p_entry = &g_pio_handler[g_ul_pio_handlers++];
+	p_entry->p_pio = p_pio;
+	p_entry->ul_id = ul_id;
+	p_entry->ul_mask = ul_mask;
+	p_entry->ul_attr = ul_attr;
+	p_entry->p_handler = p_handler;
+	return 0;
+}
+
+Pio *pio_get_pin_group(uint32_t ul_pin)
+{
+	return &g_host_pio[ul_pin >> 5];
+}
+
+uint32_t pio_get_pin_group_id(uint32_t ul_pin)
+{
+	static const uint32_t ul_id[HOST_PIO_PORTS] = {
+		ID_PIOA, ID_PIOB, ID_PIOC, ID_PIOD, ID_PIOE,
+	};
+
+	return ul_id[ul_pin >> 5];
+}
+
+uint32_t pio_get_pin_group_mask(uint32_t ul_pin)
+{
+	return 1u << (ul_pin & 31);
+}
+
+uint32_t pio_handler_set_pin(uint32_t ul_pin, uint32_t ul_flag,
+		void (*p_handler) (uint32_t, uint32_t))
+{
+	return pio_handler_set(pio_get_pin_group(ul_pin),
+			pio_get_pin_group_id(ul_pin), pio_get_pin_group_mask(ul_pin),
+			ul_flag, p_handler);
+}
+
+void pio_enable_pin_interrupt(uint32_t ul_pin)
+{
+	pio_enable_interrupt(pio_get_pin_group(ul_pin), pio_get_pin_group_mask(ul_pin));
+}
+
+void pio_set_pin_high(uint32_t ul_pin)
+{
+	ioport_set_pin_level(ul_pin, true);
+}
+
+void pio_set_pin_low(uint32_t ul_pin)
+{
+	ioport_set_pin_level(ul_pin, false);
+}
+
+void ioport_init(void)
+{
+}
+
+/**
+ * \brief Read a pin. /CHG is driven by the touch controller model.
+ */
+bool ioport_get_pin_level(ioport_pin_t pin)
+{
+	if (pin == MAXTOUCH_XPRO_CHG_PIO) {
+		return mxt_model_chg();
+	}
+	return (g_host_pio[pin >> 5].ul_level >> (pin & 31)) & 1;
+}
+
+void ioport_set_pin_level(ioport_pin_t pin, bool level)
+{
+	if (pin == LCD_SPI_CDS_PIO) {
+		panel_set_dc(level);
+	}
+	if (level) {
+		g_host_pio[pin >> 5].ul_level |= 1u << (pin & 31);
+	} else {
+		g_host_pio[pin >> 5].ul_level &= ~(1u << (pin & 31));
+	}
+}
+
+/**
+ * \brief Drive an input pin from the script and run its change handlers.
+ *
+ * \return true if a handler was called.
+ */
+bool hal_pin_edge(uint32_t ul_port, uint32_t ul_index, bool b_rising)
+{
+	Pio *p_pio = &g_host_pio[ul_port];
+	uint32_t ul_mask = 1u << ul_index;
+	struct hal_pio_handler *p_entry;
+	bool b_rise_attr, b_called = false;
+	uint32_t i;
+
+	if (b_rising) {
+		p_pio->ul_level |= ul_mask;
+	} else {
+		p_pio->ul_level &= ~ul_mask;
+	}
+	if (!(p_pio->ul_irq_mask & ul_mask)) {
+		return false;
+	}
+	for (i = 0; i < g_ul_pio_handlers; i++) {
+		p_entry = &g_pio_handler[i];
+		b_rise_attr = (p_entry->ul_attr & (1u << 6)) != 0;
+		if ((p_entry->p_pio == p_pio) && (p_entry->ul_mask & ul_mask)
+				&& (b_rise_attr == b_rising)
+				&& g_b_nvic_enabled[p_entry->ul_id]) {
+			p_entry->p_handler(p_entry->ul_id, ul_mask);
+			b_called = true;
+		}
+	}
+	sim_activity();
+	return b_called;
+}
+
+/**
+ * \brief Follow the /CHG output of the touch controller model.
+ *
+ * Called whenever the model queue may have changed; a level change is an
+ * edge on MAXTOUCH_XPRO_CHG_PIO and runs its change handlers.
+ */
+void hal_chg_update(void)
+{
+	uint32_t ul_pin = MAXTOUCH_XPRO_CHG_PIO;
+	bool b_level = mxt_model_chg();
+
+	if ((bool)((g_host_pio[ul_pin >> 5].ul_level >> (ul_pin & 31)) & 1) != b_level) {
+		hal_pin_edge(ul_pin >> 5, ul_pin & 31, b_level);
+	}
+}
+
+/* ---------------------------------------------------------------------- */
+/* SPI master                                                             */
+/* ---------------------------------------------------------------------- */
+
+void spi_master_init(Spi *p_spi)
+{
+	p_spi->b_enabled = false;
+}
+
+void spi_master_setup_device(Spi *p_spi, struct spi_device *device,
+		spi_flags_t flags, uint32_t baud_rate, board_spi_select_id_t sel_id)
+{
+	UNUSED(device);
+	UNUSED(flags);
+	UNUSED(sel_id);
+	p_spi->ul_baud = baud_rate;
+}
+
+void spi_select_device(Spi *p_spi, struct spi_device *device)
+{
+	UNUSED(p_spi);
+	UNUSED(device);
+}
+
+void spi_deselect_device(Spi *p_spi, struct spi_device *device)
+{
+	UNUSED(p_spi);
+	UNUSED(device);
+}
+
+void spi_configure_cs_behavior(Spi *p_spi, uint32_t ul_pcs_ch, uint32_t ul_cs_behavior)
+{
+	UNUSED(p_spi);
+	UNUSED(ul_pcs_ch);
+	UNUSED(ul_cs_behavior);
+}
+
+void spi_enable(Spi *p_spi)
+{
+	p_spi->b_enabled = true;
+}
+
+void spi_disable(Spi *p_spi)
+{
+	p_spi->b_enabled = false;
+}
+
+void spi_enable_interrupt(Spi *p_spi, uint32_t ul_sources)
+{
+	UNUSED(p_spi);
+	UNUSED(ul_sources);
+}
+
+/* Clock bytes over the bus: whole microseconds pass, the rest is carried */
+static void hal_spi_clock(Spi *p_spi, size_t len)
+{
+	uint64_t ull_us;
+
+	if (!p_spi->ul_baud) {
+		return;
+	}
+	g_ull_spi_bits += (uint64_t)len * 8 * 1000000;
+	ull_us = g_ull_spi_bits / p_spi->ul_baud;
+	g_ull_spi_bits -= ull_us * p_spi->ul_baud;
+	if (ull_us) {
+		sim_delay_us(ull_us);
+	}
+}
+
+spi_status_t spi_write(Spi *p_spi, uint16_t us_data, uint8_t uc_pcs, uint8_t uc_last)
+{
+	uint8_t uc_data = (uint8_t)us_data;
+
+	UNUSED(uc_pcs);
+	UNUSED(uc_last);
+	if (p_spi == SPI0) {
+		panel_write(&uc_data, 1);
+		hal_spi_clock(p_spi, 1);
+		sim_activity();
+	}
+	return 0;
+}
+
+status_code_t spi_write_packet(Spi *p_spi, const uint8_t *data, size_t len)
+{
+	size_t chunk;
+
+	if (p_spi == SPI0) {
+		while (len) {
+			chunk = Min(len, HOST_SPI_CHUNK);
+			panel_write(data, chunk);
+			hal_spi_clock(p_spi, chunk);
+			data += chunk;
+			len -= chunk;
+		}
+		sim_activity();
+	}
+	return STATUS_OK;
+}
+
+status_code_t spi_read_packet(Spi *p_spi, uint8_t *data, size_t len)
+{
+	if (p_spi == SPI0) {
+		panel_read(data, len);
+		hal_spi_clock(p_spi, len);
+		sim_activity();
+	}
+	return STATUS_OK;
+}
+
+bool spi_is_tx_empty(Spi *p_spi)
+{
+	UNUSED(p_spi);
+	return true;
+}
+
+uint32_t hal_spi_baudrate(void)
+{
+	return g_host_spi0.ul_baud;
+}
+
+/* ---------------------------------------------------------------------- */
+/* TWIHS master                                                           */
+/* ---------------------------------------------------------------------- */
+
+uint32_t twihs_master_setup(twihs_master_t p_twihs, twihs_master_options_t *p_opt)
+{
+	p_twihs->ul_speed = p_opt->speed;
+	mxt_model_init(p_opt->chip);
+	return TWIHS_SUCCESS;
+}
+
+static uint16_t hal_twihs_address(const twihs_package_t *p_packet)
+{
+	return (p_packet->addr_length >= 2)
+			? (uint16_t)(p_packet->addr[0] | (p_packet->addr[1] << 8))
+			: p_packet->addr[0];
+}
+
+uint32_t twihs_master_read(twihs_master_t p_twihs, twihs_package_t *p_packet)
+{
+	uint32_t ul_status;
+
+	UNUSED(p_twihs);
+	sim_activity();
+	ul_status = mxt_model_read(p_packet->chip, hal_twihs_address(p_packet),
+			p_packet->buffer, p_packet->length);
+
+	/* Reading the last message releases /CHG */
+	hal_chg_update();
+	return ul_status;
+}
+
+uint32_t twihs_master_write(twihs_master_t p_twihs, twihs_package_t *p_packet)
+{
+	UNUSED(p_twihs);
+	sim_activity();
+	return mxt_model_write(p_packet->chip, hal_twihs_address(p_packet),
+			p_packet->buffer, p_packet->length);
+}
+
+/* ---------------------------------------------------------------------- */
+/* Timer counter                                                          */
+/* ---------------------------------------------------------------------- */
+
+static uint32_t hal_tc_index(Tc *p_tc, uint32_t ul_channel)
+{
+	return (uint32_t)(p_tc - g_host_tc) * 3 + ul_channel;
+}
+
+/* Counter clock of a channel */
+static uint64_t hal_tc_hz(Tc *p_tc, uint32_t ul_channel)
+{
+	TcChannel *p_ch = &p_tc->channel[ul_channel];
+	uint32_t ul_div = g_ul_tc_divisor[hal_tc_index(p_tc, ul_channel)];
+
+	if ((p_ch->ul_mode & TC_CMR_TCCLKS_Msk) == TC_CMR_TCCLKS_TIMER_CLOCK5) {
+		return BOARD_FREQ_SLCK_XTAL;
+	}
+	return sysclk_get_cpu_hz() / (ul_div ? ul_div : 2);
+}
+
+/* Period of the RC compare in microseconds */
+static uint64_t hal_tc_period_us(Tc *p_tc, uint32_t ul_channel)
+{
+	return Max((uint64_t)p_tc->channel[ul_channel].ul_rc * 1000000
+			/ hal_tc_hz(p_tc, ul_channel), 1);
+}
+
+/**
+ * \brief Same divisor search as the ASF driver.
+ */
+uint32_t tc_find_mck_divisor(uint32_t ul_freq, uint32_t ul_mck,
+		uint32_t *p_uldiv, uint32_t *ul_tcclks, uint32_t ul_boardmck)
+{
+	const uint32_t divisors[5] = { 2, 8, 32, 128,
+			ul_boardmck / BOARD_FREQ_SLCK_XTAL };
+	uint32_t ul_index = 0;
+
+	while (ul_freq < ((ul_mck / divisors[ul_index]) / 65536)) {
+		if (++ul_index == 5) {
+			return 0;
+		}
+	}
+	while (ul_index < 4) {
+		if (ul_freq > (ul_mck / divisors[ul_index + 1])) {
+			break;
+		}
+		ul_index++;
+	}
+	if (p_uldiv) {
+		*p_uldiv = divisors[ul_index];
+	}
+	if (ul_tcclks) {
+		*ul_tcclks = ul_index;
+	}
+	return 1;
+}
+
+void tc_init(Tc *p_tc, uint32_t ul_channel, uint32_t ul_mode)
+{
+	TcChannel *p_ch = &p_tc->channel[ul_channel];
+	static const uint32_t divisors[4] = { 2, 8, 32, 128 };
+	uint32_t ul_clk = ul_mode & TC_CMR_TCCLKS_Msk;
+
+	p_ch->ul_mode = ul_mode;
+	p_ch->b_running = false;
+	g_ul_tc_divisor[hal_tc_index(p_tc, ul_channel)] =
+			(ul_clk < 4) ? divisors[ul_clk] : 0;
+}
+
+void tc_write_rc(Tc *p_tc, uint32_t ul_channel, uint32_t ul_value)
+{
+	p_tc->channel[ul_channel].ul_rc = ul_value;
+}
+
+void tc_enable_interrupt(Tc *p_tc, uint32_t ul_channel, uint32_t ul_sources)
+{
+	p_tc->channel[ul_channel].ul_irq_mask |= ul_sources;
+}
+
+void tc_disable_interrupt(Tc *p_tc, uint32_t ul_channel, uint32_t ul_sources)
+{
+	p_tc->channel[ul_channel].ul_irq_mask &= ~ul_sources;
+}
+
+void tc_start(Tc *p_tc, uint32_t ul_channel)
+{
+	TcChannel *p_ch = &p_tc->channel[ul_channel];
+
+	p_ch->b_running = true;
+	p_ch->ull_next_us = sim_now_us() + hal_tc_period_us(p_tc, ul_channel);
+}
+
+void tc_stop(Tc *p_tc, uint32_t ul_channel)
+{
+	p_tc->channel[ul_channel].b_running = false;
+}
+
+/**
+ * \brief Counter value, from the time left to the next RC compare.
+ */
+uint32_t tc_read_cv(Tc *p_tc, uint32_t ul_channel)
+{
+	TcChannel *p_ch = &p_tc->channel[ul_channel];
+	uint64_t ull_period = hal_tc_period_us(p_tc, ul_channel);
+	uint64_t ull_left;
+
+	if (!p_ch->b_running) {
+		return 0;
+	}
+	ull_left = (p_ch->ull_next_us - sim_now_us()) % ull_period;
+	return (uint32_t)((ull_period - ull_left) % ull_period
+			* hal_tc_hz(p_tc, ul_channel) / 1000000);
+}
+
+uint32_t tc_get_status(Tc *p_tc, uint32_t ul_channel)
+{
+	uint32_t ul_status = p_tc->channel[ul_channel].ul_status;
+
+	p_tc->channel[ul_channel].ul_status = 0;
+	return ul_status;
+}
+
+/* ---------------------------------------------------------------------- */
+/* RTC                                                                    */
+/* ---------------------------------------------------------------------- */
+
+void rtc_set_hour_mode(Rtc *p_rtc, uint32_t ul_mode)
+{
+	p_rtc->ul_hour_mode = ul_mode;
+}
+
+uint32_t rtc_set_date(Rtc *p_rtc, uint32_t ul_year, uint32_t ul_month,
+		uint32_t ul_day, uint32_t ul_week)
+{
+	UNUSED(p_rtc);
+	UNUSED(ul_year);
+	UNUSED(ul_month);
+	UNUSED(ul_day);
+	UNUSED(ul_week);
+	return 0;
+}
+
+uint32_t rtc_set_time(Rtc *p_rtc, uint32_t ul_hour, uint32_t ul_minute,
+		uint32_t ul_second)
+{
+	UNUSED(p_rtc);
+	UNUSED(ul_hour);
+	UNUSED(ul_minute);
+	UNUSED(ul_second);
+	return 0;
+}
+
+uint32_t rtc_set_date_alarm(Rtc *p_rtc, uint32_t ul_month_flag,
+		uint32_t ul_month, uint32_t ul_day_flag, uint32_t ul_day)
+{
+	UNUSED(p_rtc);
+	UNUSED(ul_month_flag);
+	UNUSED(ul_month);
+	UNUSED(ul_day_flag);
+	UNUSED(ul_day);
+	return 0;
+}
+
+uint32_t rtc_set_time_alarm(Rtc *p_rtc, uint32_t ul_hour_flag, uint32_t ul_hour,
+		uint32_t ul_minute_flag, uint32_t ul_minute, uint32_t ul_second_flag,
+		uint32_t ul_second)
+{
+	UNUSED(p_rtc);
+	UNUSED(ul_hour_flag);
+	UNUSED(ul_hour);
+	UNUSED(ul_minute_flag);
+	UNUSED(ul_minute);
+	UNUSED(ul_second_flag);
+	UNUSED(ul_second);
+	return 0;
+}
+
+void rtc_enable_interrupt(Rtc *p_rtc, uint32_t ul_sources)
+{
+	p_rtc->ul_irq_mask |= ul_sources;
+}
+
+uint32_t rtc_get_status(Rtc *p_rtc)
+{
+	return p_rtc->ul_status;
+}
+
+void rtc_clear_status(Rtc *p_rtc, uint32_t ul_clear)
+{
+	p_rtc->ul_status &= ~ul_clear;
+}
+
+/* ---------------------------------------------------------------------- */
+/* RTT                                                                    */
+/* ---------------------------------------------------------------------- */
+
+/* Duration of one RTT increment in microseconds, scaled by 32768 */
+static uint64_t hal_rtt_tick_scaled(void)
+{
+	uint32_t ul_prescaler = g_host_rtt.ul_prescaler ? g_host_rtt.ul_prescaler : 65536;
+
+	return (uint64_t)ul_prescaler * 1000000;
+}
+
+void rtt_sel_source(Rtt *p_rtt, bool is_rtc_sel)
+{
+	UNUSED(p_rtt);
+	UNUSED(is_rtc_sel);
+}
+
+uint32_t rtt_init(Rtt *p_rtt, uint16_t us_prescaler)
+{
+	p_rtt->ul_prescaler = us_prescaler;
+	p_rtt->ull_origin_us = sim_now_us();
+	p_rtt->ul_status = 0;
+	g_b_rtt_armed = false;
+	g_ull_spi_bits = 0;
+	return 0;
+}
+
+uint32_t rtt_read_timer_value(Rtt *p_rtt)
+{
+	return (uint32_t)((sim_now_us() - p_rtt->ull_origin_us) * 32768
+			/ hal_rtt_tick_scaled());
+}
+
+uint32_t rtt_write_alarm_time(Rtt *p_rtt, uint32_t ul_alarm_time)
+{
+	p_rtt->ul_alarm = ul_alarm_time;
+	g_b_rtt_armed = true;
+	return 0;
+}
+
+void rtt_enable_interrupt(Rtt *p_rtt, uint32_t ul_sources)
+{
+	p_rtt->ul_irq_mask |= ul_sources;
+}
+
+void rtt_disable_interrupt(Rtt *p_rtt, uint32_t ul_sources)
+{
+	p_rtt->ul_irq_mask &= ~ul_sources;
+}
+
+uint32_t rtt_get_status(Rtt *p_rtt)
+{
+	uint32_t ul_status = p_rtt->ul_status;
+
+	p_rtt->ul_status = 0;
+	return ul_status;
+}
+
+/* First microsecond at which the counter reads the alarm value */
+static uint64_t hal_rtt_alarm_us(void)
+{
+	return g_host_rtt.ull_origin_us
+			+ ((uint64_t)g_host_rtt.ul_alarm * hal_rtt_tick_scaled() + 32767)
+			/ 32768;
+}
+
+/* ---------------------------------------------------------------------- */
+/* USART serial, stdio                                                    */
+/* ---------------------------------------------------------------------- */
+
+void stdio_serial_init(volatile void *p_usart, const usart_serial_options_t *opt)
+{
+	((Usart *)p_usart)->ul_baud = opt->baudrate;
+}
+
+/**
+ * \brief Send what the firmware writes to the USART to a file, NULL for
+ * stdout.
+ */
+void hal_usart_set_output(FILE *p_out)
+{
+	g_p_usart_out = p_out;
+}
+
+status_code_t usart_serial_write_packet(usart_if p_usart, const uint8_t *data,
+		size_t len)
+{
+	FILE *p_out = g_p_usart_out ? g_p_usart_out : stdout;
+
+	UNUSED(p_usart);
+	fwrite(data, 1, len, p_out);
+	fflush(p_out);
+	return STATUS_OK;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Virtual time events                                                    */
+/* ---------------------------------------------------------------------- */
+
+/**
+ * \brief Earliest armed timer interrupt, HAL_NEVER if none.
+ */
+uint64_t hal_next_timer_us(void)
+{
+	uint64_t ull_next = HAL_NEVER;
+	TcChannel *p_ch;
+	uint32_t i;
+
+	for (i = 0; i < HOST_TC_CHANNELS; i++) {
+		p_ch = &g_host_tc[i / 3].channel[i % 3];
+		if (p_ch->b_running && (p_ch->ul_irq_mask & TC_IER_CPCS)
+				&& g_b_nvic_enabled[g_uc_tc_id[i]]) {
+			ull_next = Min(ull_next, p_ch->ull_next_us);
+		}
+	}
+	if (g_b_rtt_armed && (g_host_rtt.ul_irq_mask & RTT_MR_ALMIEN)
+			&& g_b_nvic_enabled[RTT_IRQn]) {
+		ull_next = Min(ull_next, hal_rtt_alarm_us());
+	}
+	return ull_next;
+}
+
+/**
+ * \brief Call the handlers of every timer interrupt due at a given time.
+ */
+void hal_run_timers(uint64_t ull_now_us)
+{
+	TcChannel *p_ch;
+	uint32_t i;
+
+	for (i = 0; i < HOST_TC_CHANNELS; i++) {
+		p_ch = &g_host_tc[i / 3].channel[i % 3];
+		while (p_ch->b_running && (p_ch->ull_next_us <= ull_now_us)) {
+			p_ch->ull_next_us += hal_tc_period_us(&g_host_tc[i / 3], i % 3);
+			if ((p_ch->ul_irq_mask & TC_IER_CPCS) && g_b_nvic_enabled[g_uc_tc_id[i]]) {
+				p_ch->ul_status |= TC_SR_CPCS;
+				g_tc_handler[i]();
+				sim_activity();
+			}
+		}
+	}
+	if (g_b_rtt_armed && (hal_rtt_alarm_us() <= ull_now_us)) {
+		g_b_rtt_armed = false;
+		g_host_rtt.ul_status |= RTT_SR_ALMS;
+		if ((g_host_rtt.ul_irq_mask & RTT_MR_ALMIEN) && g_b_nvic_enabled[RTT_IRQn]) {
+			RTT_Handler();
+			sim_activity();
+		}
+	}
+}
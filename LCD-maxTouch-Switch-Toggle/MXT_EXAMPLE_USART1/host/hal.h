@@ -0,0 +1,25 @@
+/**
+ * \file
+ *
+ * \brief Simulator side of the host HAL: timers and input pins.
+ */
+
+#ifndef HAL_H_INCLUDED
+#define HAL_H_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/** No timer armed. */
+#define HAL_NEVER UINT64_MAX
+
+void hal_init(void);
+uint64_t hal_next_timer_us(void);
+void hal_run_timers(uint64_t ull_now_us);
+bool hal_pin_edge(uint32_t ul_port, uint32_t ul_index, bool b_rising);
+void hal_chg_update(void);
+uint32_t hal_spi_baudrate(void);
+void hal_usart_set_output(FILE *p_out);
+
+#endif /* HAL_H_INCLUDED */
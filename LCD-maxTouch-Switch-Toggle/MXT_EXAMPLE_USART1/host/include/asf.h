@@ -0,0 +1,14 @@
+/**
+ * \file
+ *
+ * \brief Host build replacement for the ASF driver selector include file.
+ */
+
+#ifndef ASF_H
+#define ASF_H
+
+#include "host_hal.h"
+#include <ili9488.h>
+#include <mxt_device_1.h>
+
+#endif // ASF_H
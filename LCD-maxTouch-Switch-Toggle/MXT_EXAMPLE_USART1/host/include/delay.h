@@ -0,0 +1,2 @@
+/* Host build: the ASF delay.h API is declared in host_hal.h */
+#include "host_hal.h"
@@ -0,0 +1,446 @@
+/**
+ * \file
+ *
+ * \brief Host replacement for the SAME70 device, board and ASF driver headers.
+ *
+ * Declares the subset of the ASF API used by the firmware with the same
+ * names and signatures. Peripheral instances are plain host structures, the
+ * functions are implemented in host/hal.c on top of the LCD and touch
+ * controller models. Interrupt handlers are called synchronously by the
+ * simulator, so the interrupt masking functions are no-ops.
+ */
+
+#ifndef HOST_HAL_H_INCLUDED
+#define HOST_HAL_H_INCLUDED
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <status_codes.h>
+
+/* ---------------------------------------------------------------------- */
+/* compiler.h                                                             */
+/* ---------------------------------------------------------------------- */
+
+typedef bool Bool;
+typedef uint32_t irqflags_t;
+
+#define UNUSED(v)                 (void)(v)
+#define Assert(expr)              ((void)0)
+#define Min(a, b)                 (((a) < (b)) ? (a) : (b))
+#define Max(a, b)                 (((a) > (b)) ? (a) : (b))
+#define min(a, b)                 Min(a, b)
+#define max(a, b)                 Max(a, b)
+#define COMPILER_ALIGNED(a)       __attribute__((__aligned__(a)))
+#define COMPILER_WORD_ALIGNED     __attribute__((__aligned__(4)))
+#define COMPILER_PACK_SET(a)      _Pragma("pack(1)")
+#define COMPILER_PACK_RESET()     _Pragma("pack()")
+#define le16_to_cpu(x)            (x)
+#define cpu_to_le16(x)            (x)
+
+static inline irqflags_t cpu_irq_save(void) { return 0; }
+static inline void cpu_irq_restore(irqflags_t flags) { (void)flags; }
+#define cpu_irq_enable()          ((void)0)
+#define cpu_irq_disable()         ((void)0)
+#define __DSB()                   ((void)0)
+#define __ISB()                   ((void)0)
+#define __DMB()                   __sync_synchronize()
+#define __WFI()                   host_wfi()
+
+void host_wfi(void);
+
+/* CMSIS SIMD intrinsics of ili9488_pixel.c, bit for bit, so that its
+ * ILI9488_PIXEL_SIMD kernels can be tested on the host. The APSR.GE flags
+ * set by USUB16 and read by SEL live in a variable. */
+static inline uint32_t *host_apsr_ge(void)
+{
+	static uint32_t ul_ge;
+
+	return &ul_ge;
+}
+
+static inline uint32_t __ROR(uint32_t op1, uint32_t op2)
+{
+	op2 &= 31;
+	return op2 ? (op1 >> op2) | (op1 << (32 - op2)) : op1;
+}
+
+static inline uint32_t __UXTB16(uint32_t op1)
+{
+	return op1 & 0x00FF00FFu;
+}
+
+#define __PKHBT(ARG1, ARG2, ARG3) \
+	((((uint32_t)(ARG1)) & 0x0000FFFFu) | ((((uint32_t)(ARG2)) << (ARG3)) & 0xFFFF0000u))
+
+static inline uint32_t __USUB16(uint32_t op1, uint32_t op2)
+{
+	uint32_t ul_lo = (op1 & 0xFFFFu) - (op2 & 0xFFFFu);
+	uint32_t ul_hi = (op1 >> 16) - (op2 >> 16);
+
+	*host_apsr_ge() = (((op1 & 0xFFFFu) >= (op2 & 0xFFFFu)) ? 0x3u : 0)
+			| (((op1 >> 16) >= (op2 >> 16)) ? 0xCu : 0);
+	return (ul_lo & 0xFFFFu) | (ul_hi << 16);
+}
+
+static inline uint32_t __SEL(uint32_t op1, uint32_t op2)
+{
+	uint32_t ul_ge = *host_apsr_ge(), ul_result = 0, i;
+
+	for (i = 0; i < 4; i++) {
+		ul_result |= (((ul_ge >> i) & 1) ? op1 : op2) & (0xFFu << (8 * i));
+	}
+	return ul_result;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Peripheral identifiers, interrupt numbers and instances                */
+/* ---------------------------------------------------------------------- */
+
+#define ID_RTC      2
+#define ID_RTT      3
+#define ID_SMC      9
+#define ID_PIOA     10
+#define ID_PIOB     11
+#define ID_PIOC     12
+#define ID_USART0   13
+#define ID_USART1   14
+#define ID_PIOD     16
+#define ID_PIOE     17
+#define ID_TWIHS0   19
+#define ID_SPI0     21
+#define ID_TC0      23
+#define ID_TC1      24
+#define ID_TC2      25
+#define ID_TC3      26
+#define ID_TC4      27
+#define ID_TC5      28
+#define ID_TC6      47
+#define ID_TC7      48
+#define ID_TC8      49
+#define ID_TC9      50
+#define ID_TC10     51
+#define ID_TC11     52
+#define ID_XDMAC    58
+#define ID_PERIPH_COUNT 74
+
+/** Interrupt numbers are the peripheral identifiers on SAME70. */
+typedef int IRQn_Type;
+#define RTC_IRQn    ID_RTC
+#define RTT_IRQn    ID_RTT
+#define PIOA_IRQn   ID_PIOA
+#define SPI0_IRQn   ID_SPI0
+#define TC1_IRQn    ID_TC1
+#define XDMAC_IRQn  ID_XDMAC
+
+#define HOST_PIO_PORTS  5
+#define HOST_TC_COUNT   4
+#define HOST_PIO_HANDLERS 8
+
+typedef struct {
+	uint32_t ul_output;       /* pins configured as outputs */
+	uint32_t ul_level;        /* current level of every pin */
+	uint32_t ul_irq_mask;     /* pins with the change interrupt enabled */
+} Pio;
+
+typedef struct {
+	uint32_t ul_mode;
+	uint32_t ul_rc;
+	uint32_t ul_irq_mask;
+	uint32_t ul_status;
+	bool b_running;
+	uint64_t ull_next_us;     /* virtual time of the next RC compare */
+} TcChannel;
+
+typedef struct {
+	TcChannel channel[3];
+} Tc;
+
+typedef struct {
+	uint32_t ul_irq_mask;
+	uint32_t ul_status;
+	uint32_t ul_hour_mode;
+} Rtc;
+
+typedef struct {
+	uint32_t ul_prescaler;
+	uint32_t ul_alarm;
+	uint32_t ul_irq_mask;
+	uint32_t ul_status;
+	uint64_t ull_origin_us;   /* virtual time of the last rtt_init() */
+} Rtt;
+
+typedef struct {
+	uint32_t ul_baud;
+	bool b_enabled;
+} Spi;
+
+typedef struct {
+	uint32_t ul_speed;
+} Twihs;
+
+typedef struct {
+	uint32_t ul_baud;
+} Usart;
+
+extern Pio g_host_pio[HOST_PIO_PORTS];
+extern Tc g_host_tc[HOST_TC_COUNT];
+extern Rtc g_host_rtc;
+extern Rtt g_host_rtt;
+extern Spi g_host_spi0;
+extern Twihs g_host_twihs0;
+extern Usart g_host_usart[2];
+
+#define PIOA    (&g_host_pio[0])
+#define PIOB    (&g_host_pio[1])
+#define PIOC    (&g_host_pio[2])
+#define PIOD    (&g_host_pio[3])
+#define PIOE    (&g_host_pio[4])
+#define TC0     (&g_host_tc[0])
+#define TC1     (&g_host_tc[1])
+#define TC2     (&g_host_tc[2])
+#define TC3     (&g_host_tc[3])
+#define RTC     (&g_host_rtc)
+#define RTT     (&g_host_rtt)
+#define SPI0    (&g_host_spi0)
+#define TWIHS0  (&g_host_twihs0)
+#define USART0  (&g_host_usart[0])
+#define USART1  (&g_host_usart[1])
+
+/* Pin numbering of the ioport service: 32 pins per port */
+#define PIO_PA2_IDX   2
+#define PIO_PA6_IDX   6
+#define PIO_PA19_IDX  19
+#define PIO_PC8_IDX   (64 + 8)
+
+/* ---------------------------------------------------------------------- */
+/* Register fields used by the application                                */
+/* ---------------------------------------------------------------------- */
+
+#define TC_CMR_TCCLKS_Msk      0x7u
+#define TC_CMR_TCCLKS_TIMER_CLOCK5 0x4u
+#define TC_CMR_CPCTRG          (0x1u << 14)
+#define TC_IER_CPCS            (0x1u << 4)
+#define TC_SR_CPCS             (0x1u << 4)
+
+#define RTC_SR_ACKUPD          (0x1u << 0)
+#define RTC_SR_ALARM           (0x1u << 1)
+#define RTC_SR_SEC             (0x1u << 2)
+#define RTC_SCCR_ACKCLR        (0x1u << 0)
+#define RTC_SCCR_ALRCLR        (0x1u << 1)
+#define RTC_SCCR_SECCLR        (0x1u << 2)
+#define RTC_SCCR_TIMCLR        (0x1u << 3)
+#define RTC_SCCR_CALCLR        (0x1u << 4)
+#define RTC_SCCR_TDERRCLR      (0x1u << 5)
+#define RTC_IER_ALREN          (0x1u << 1)
+#define RTC_IER_SECEN          (0x1u << 2)
+
+#define RTT_SR_ALMS            (0x1u << 0)
+#define RTT_SR_RTTINC          (0x1u << 1)
+#define RTT_MR_ALMIEN          (0x1u << 16)
+#define RTT_MR_RTTINCIEN       (0x1u << 17)
+
+#define US_MR_CHRL_8_BIT       (0x3u << 6)
+#define US_MR_PAR_NO           (0x4u << 9)
+#define US_MR_NBSTOP_1_BIT     (0x0u << 12)
+
+#define SPI_IER_RDRF           (0x1u << 0)
+#define SPI_CS_RISE_NO_TX      1
+#define SPI_MODE_3             3
+
+#define XDMAC_CUBC_UBLEN_Pos   0
+#define XDMAC_CUBC_UBLEN_Msk   (0xffffffu << XDMAC_CUBC_UBLEN_Pos)
+
+#define PIO_INPUT              (1u << 1)
+#define PIO_OUTPUT_0           (1u << 2)
+#define PIO_OUTPUT_1           (1u << 3)
+#define PIO_DEFAULT            (0u << 0)
+#define PIO_PULLUP             (1u << 0)
+#define PIO_DEGLITCH           (1u << 1)
+#define PIO_DEBOUNCE           (1u << 3)
+#define PIO_IT_RISE_EDGE       ((1u << 5) | (1u << 4) | (1u << 6))
+#define PIO_IT_FALL_EDGE       ((1u << 5) | (1u << 4))
+
+/* ---------------------------------------------------------------------- */
+/* Board definition (same70_xplained.h)                                   */
+/* ---------------------------------------------------------------------- */
+
+#define BOARD_NAME                "SAME70-XPLD (host)"
+#define BOARD_FREQ_SLCK_XTAL      32768UL
+#define CONSOLE_UART              USART1
+#define CONSOLE_UART_ID           ID_USART1
+#define BOARD_ILI9488_ADDR        0x63000000
+#define BOARD_ILI9488_SPI         SPI0
+#define BOARD_ILI9488_SPI_IRQN    SPI0_IRQn
+#define BOARD_ILI9488_SPI_NPCS    3
+#define LCD_SPI_CDS_PIO           PIO_PA6_IDX
+#define MAXTOUCH_XPRO_TWIHS       TWIHS0
+#define MAXTOUCH_XPRO_CHG_PIO     PIO_PA2_IDX
+
+/* ---------------------------------------------------------------------- */
+/* Core, clocks and delays                                                */
+/* ---------------------------------------------------------------------- */
+
+void NVIC_EnableIRQ(IRQn_Type irq);
+void NVIC_DisableIRQ(IRQn_Type irq);
+void NVIC_ClearPendingIRQ(IRQn_Type irq);
+void NVIC_SetPriority(IRQn_Type irq, uint32_t ul_priority);
+
+void sysclk_init(void);
+uint32_t sysclk_get_cpu_hz(void);
+uint32_t sysclk_get_peripheral_hz(void);
+void sysclk_enable_peripheral_clock(uint32_t ul_id);
+void board_init(void);
+uint32_t pmc_enable_periph_clk(uint32_t ul_id);
+uint32_t pmc_disable_periph_clk(uint32_t ul_id);
+void pmc_sleep(int sleep_mode);
+#define SAM_PM_SMODE_SLEEP_WFI 1
+
+void delay_ms(uint32_t ul_ms);
+void delay_us(uint32_t ul_us);
+#define delay_s(s)   delay_ms((s) * 1000)
+
+/* ---------------------------------------------------------------------- */
+/* PIO, ioport                                                            */
+/* ---------------------------------------------------------------------- */
+
+typedef uint32_t ioport_pin_t;
+
+uint32_t pio_configure(Pio *p_pio, uint32_t ul_type, uint32_t ul_mask,
+		uint32_t ul_attribute);
+void pio_set(Pio *p_pio, uint32_t ul_mask);
+void pio_clear(Pio *p_pio, uint32_t ul_mask);
+uint32_t pio_get(Pio *p_pio, uint32_t ul_type, uint32_t ul_mask);
+void pio_set_debounce_filter(Pio *p_pio, uint32_t ul_mask, uint32_t ul_cut_off);
+void pio_enable_interrupt(Pio *p_pio, uint32_t ul_mask);
+void pio_disable_interrupt(Pio *p_pio, uint32_t ul_mask);
+uint32_t pio_handler_set(Pio *p_pio, uint32_t ul_id, uint32_t ul_mask,
+		uint32_t ul_attr, void (*p_handler) (uint32_t, uint32_t));
+uint32_t pio_handler_set_pin(uint32_t ul_pin, uint32_t ul_flag,
+		void (*p_handler) (uint32_t, uint32_t));
+void pio_enable_pin_interrupt(uint32_t ul_pin);
+Pio *pio_get_pin_group(uint32_t ul_pin);
+uint32_t pio_get_pin_group_id(uint32_t ul_pin);
+uint32_t pio_get_pin_group_mask(uint32_t ul_pin);
+void pio_set_pin_high(uint32_t ul_pin);
+void pio_set_pin_low(uint32_t ul_pin);
+
+void ioport_init(void);
+bool ioport_get_pin_level(ioport_pin_t pin);
+void ioport_set_pin_level(ioport_pin_t pin, bool level);
+
+/* ---------------------------------------------------------------------- */
+/* SPI master                                                             */
+/* ---------------------------------------------------------------------- */
+
+typedef uint8_t spi_flags_t;
+typedef uint32_t board_spi_select_id_t;
+typedef int spi_status_t;
+
+struct spi_device {
+	board_spi_select_id_t id;
+};
+
+void spi_master_init(Spi *p_spi);
+void spi_master_setup_device(Spi *p_spi, struct spi_device *device,
+		spi_flags_t flags, uint32_t baud_rate, board_spi_select_id_t sel_id);
+void spi_select_device(Spi *p_spi, struct spi_device *device);
+void spi_deselect_device(Spi *p_spi, struct spi_device *device);
+void spi_configure_cs_behavior(Spi *p_spi, uint32_t ul_pcs_ch, uint32_t ul_cs_behavior);
+void spi_enable(Spi *p_spi);
+void spi_disable(Spi *p_spi);
+void spi_enable_interrupt(Spi *p_spi, uint32_t ul_sources);
+spi_status_t spi_write(Spi *p_spi, uint16_t us_data, uint8_t uc_pcs, uint8_t uc_last);
+status_code_t spi_write_packet(Spi *p_spi, const uint8_t *data, size_t len);
+status_code_t spi_read_packet(Spi *p_spi, uint8_t *data, size_t len);
+bool spi_is_tx_empty(Spi *p_spi);
+
+/* ---------------------------------------------------------------------- */
+/* TWIHS master                                                           */
+/* ---------------------------------------------------------------------- */
+
+#define TWIHS_SUCCESS           0
+#define TWIHS_RECEIVE_NACK      5
+
+typedef struct twihs_options {
+	uint32_t master_clk;
+	uint32_t speed;
+	uint8_t chip;
+	uint8_t smbus;
+} twihs_options_t;
+
+typedef struct twihs_packet {
+	uint8_t addr[3];
+	uint32_t addr_length;
+	void *buffer;
+	uint32_t length;
+	uint8_t chip;
+} twihs_packet_t;
+
+typedef Twihs *twihs_master_t;
+typedef twihs_options_t twihs_master_options_t;
+typedef twihs_packet_t twihs_package_t;
+
+uint32_t twihs_master_setup(twihs_master_t p_twihs, twihs_master_options_t *p_opt);
+uint32_t twihs_master_read(twihs_master_t p_twihs, twihs_package_t *p_packet);
+uint32_t twihs_master_write(twihs_master_t p_twihs, twihs_package_t *p_packet);
+
+/* ---------------------------------------------------------------------- */
+/* Timer counter, RTC, RTT                                                */
+/* ---------------------------------------------------------------------- */
+
+uint32_t tc_find_mck_divisor(uint32_t ul_freq, uint32_t ul_mck,
+		uint32_t *p_uldiv, uint32_t *ul_tcclks, uint32_t ul_boardmck);
+void tc_init(Tc *p_tc, uint32_t ul_channel, uint32_t ul_mode);
+void tc_write_rc(Tc *p_tc, uint32_t ul_channel, uint32_t ul_value);
+void tc_enable_interrupt(Tc *p_tc, uint32_t ul_channel, uint32_t ul_sources);
+void tc_disable_interrupt(Tc *p_tc, uint32_t ul_channel, uint32_t ul_sources);
+void tc_start(Tc *p_tc, uint32_t ul_channel);
+void tc_stop(Tc *p_tc, uint32_t ul_channel);
+uint32_t tc_read_cv(Tc *p_tc, uint32_t ul_channel);
+uint32_t tc_get_status(Tc *p_tc, uint32_t ul_channel);
+
+void rtc_set_hour_mode(Rtc *p_rtc, uint32_t ul_mode);
+uint32_t rtc_set_date(Rtc *p_rtc, uint32_t ul_year, uint32_t ul_month,
+		uint32_t ul_day, uint32_t ul_week);
+uint32_t rtc_set_time(Rtc *p_rtc, uint32_t ul_hour, uint32_t ul_minute,
+		uint32_t ul_second);
+uint32_t rtc_set_date_alarm(Rtc *p_rtc, uint32_t ul_month_flag,
+		uint32_t ul_month, uint32_t ul_day_flag, uint32_t ul_day);
+uint32_t rtc_set_time_alarm(Rtc *p_rtc, uint32_t ul_hour_flag, uint32_t ul_hour,
+		uint32_t ul_minute_flag, uint32_t ul_minute, uint32_t ul_second_flag,
+		uint32_t ul_second);
+void rtc_enable_interrupt(Rtc *p_rtc, uint32_t ul_sources);
+uint32_t rtc_get_status(Rtc *p_rtc);
+void rtc_clear_status(Rtc *p_rtc, uint32_t ul_clear);
+
+void rtt_sel_source(Rtt *p_rtt, bool is_rtc_sel);
+uint32_t rtt_init(Rtt *p_rtt, uint16_t us_prescaler);
+uint32_t rtt_read_timer_value(Rtt *p_rtt);
+uint32_t rtt_write_alarm_time(Rtt *p_rtt, uint32_t ul_alarm_time);
+void rtt_enable_interrupt(Rtt *p_rtt, uint32_t ul_sources);
+void rtt_disable_interrupt(Rtt *p_rtt, uint32_t ul_sources);
+uint32_t rtt_get_status(Rtt *p_rtt);
+
+/* ---------------------------------------------------------------------- */
+/* USART serial, stdio                                                    */
+/* ---------------------------------------------------------------------- */
+
+typedef Usart *usart_if;
+
+typedef struct {
+	uint32_t baudrate;
+	uint32_t charlength;
+	uint32_t paritytype;
+	uint32_t stopbits;
+} usart_rs232_options_t;
+typedef usart_rs232_options_t usart_serial_options_t;
+
+void stdio_serial_init(volatile void *p_usart, const usart_serial_options_t *opt);
+status_code_t usart_serial_write_packet(usart_if p_usart, const uint8_t *data,
+		size_t len);
+
+#endif /* HOST_HAL_H_INCLUDED */
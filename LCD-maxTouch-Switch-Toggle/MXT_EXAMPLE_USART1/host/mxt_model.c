@@ -0,0 +1,290 @@
+/**
+ * \file
+ *
+ * \brief maXTouch mXT143E model on the TWIHS bus.
+ *
+ * Object sizes match the configuration written by the application (T8, T9,
+ * T46, T56), so the configuration writes land in the model memory. Report IDs
+ * are 1 for T6 and 2..11 for the ten T9 touch slots.
+ *
+ * T44 sits right before T5, as on the recent parts, so the message count and
+ * the first message can be read in one transaction. Reading on past the
+ * first T5 message returns the following ones.
+ */
+
+#include <string.h>
+#include "mxt_model.h"
+
+#define MXT_FAMILY_143E      0x81
+#define MXT_VARIANT_143E     0x07
+#define MXT_ID_BLOCK_SIZE    7
+#define MXT_OBJECT_SIZE      6
+#define MXT_MEMORY_SIZE      512
+#define MXT_T9_REPORT_IDS    10
+
+#define TWIHS_SUCCESS        0
+#define TWIHS_RECEIVE_NACK   5
+
+struct mxt_model_object {
+	uint8_t uc_type;
+	uint8_t uc_size;
+	uint8_t uc_report_ids;
+};
+
+static const struct mxt_model_object g_objects[] = {
+	{ 44,  1, 0 },   /* SPT_MESSAGECOUNT */
+	{  5,  9, 0 },   /* GEN_MESSAGEPROCESSOR */
+	{  6,  6, 1 },   /* GEN_COMMANDPROCESSOR */
+	{  7,  4, 0 },   /* GEN_POWERCONFIG */
+	{  8, 10, 0 },   /* GEN_ACQUISITIONCONFIG */
+	{  9, 36, MXT_T9_REPORT_IDS },   /* TOUCH_MULTITOUCHSCREEN */
+	{ 46,  9, 0 },   /* SPT_CTE_CONFIGURATION */
+	{ 56, 33, 0 },   /* PROCI_SHIELDLESS */
+};
+
+#define MXT_OBJECT_COUNT (sizeof(g_objects) / sizeof(g_objects[0]))
+
+static uint8_t g_uc_mem[MXT_MEMORY_SIZE];
+static uint8_t g_uc_chip;
+static uint16_t g_us_t5_addr;
+static uint16_t g_us_t44_addr;
+static uint8_t g_uc_t9_report;
+
+static uint8_t g_uc_queue[MXT_MODEL_QUEUE_SIZE][9];
+static uint32_t g_ul_head;
+static uint32_t g_ul_count;
+
+/* Same polynomials as the mxt_device component */
+static uint32_t mxt_model_crc24(uint32_t crc, uint8_t uc_b1, uint8_t uc_b2)
+{
+	uint32_t result = (crc << 1) ^ (uint32_t)((uc_b2 << 8) | uc_b1);
+
+	if (result & 0x1000000) {
+		result ^= 0x80001B;
+	}
+	return result;
+}
+
+static uint8_t mxt_model_crc8(uint8_t crc, uint8_t uc_data)
+{
+	uint8_t i, fb;
+
+	for (i = 0; i < 8; i++) {
+		fb = (crc ^ uc_data) & 0x01;
+		uc_data >>= 1;
+		crc >>= 1;
+		if (fb) {
+			crc ^= 0x8c;
+		}
+	}
+	return crc;
+}
+
+/**
+ * \brief Build the memory map of the device.
+ *
+ * \param uc_chip TWI address the model answers to.
+ */
+void mxt_model_init(uint8_t uc_chip)
+{
+	uint16_t us_table_end = MXT_ID_BLOCK_SIZE + MXT_OBJECT_COUNT * MXT_OBJECT_SIZE;
+	uint16_t us_addr = us_table_end + 3;
+	uint8_t uc_report = 1;
+	uint8_t *p_entry;
+	uint32_t crc = 0;
+	uint32_t i;
+
+	memset(g_uc_mem, 0, sizeof(g_uc_mem));
+	g_uc_chip = uc_chip;
+	g_ul_head = 0;
+	g_ul_count = 0;
+
+	g_uc_mem[0] = MXT_FAMILY_143E;
+	g_uc_mem[1] = MXT_VARIANT_143E;
+	g_uc_mem[2] = 0x10;   /* version */
+	g_uc_mem[3] = 0xAA;   /* build */
+	g_uc_mem[4] = 14;     /* matrix X */
+	g_uc_mem[5] = 24;     /* matrix Y */
+	g_uc_mem[6] = MXT_OBJECT_COUNT;
+
+	for (i = 0; i < MXT_OBJECT_COUNT; i++) {
+		p_entry = &g_uc_mem[MXT_ID_BLOCK_SIZE + i * MXT_OBJECT_SIZE];
+		p_entry[0] = g_objects[i].uc_type;
+		p_entry[1] = (uint8_t)us_addr;
+		p_entry[2] = (uint8_t)(us_addr >> 8);
+		p_entry[3] = g_objects[i].uc_size - 1;
+		p_entry[4] = 0;   /* one instance */
+		p_entry[5] = g_objects[i].uc_report_ids;
+
+		if (g_objects[i].uc_type == 5) {
+			g_us_t5_addr = us_addr;
+		} else if (g_objects[i].uc_type == 44) {
+			g_us_t44_addr = us_addr;
+		} else if (g_objects[i].uc_type == 9) {
+			g_uc_t9_report = uc_report;
+		}
+		uc_report += g_objects[i].uc_report_ids;
+		us_addr += g_objects[i].uc_size;
+	}
+
+	/* Information block CRC over the ID block and the object table, padded
+	 * with a zero byte to an even length */
+	for (i = 0; i + 1 < us_table_end; i += 2) {
+		crc = mxt_model_crc24(crc, g_uc_mem[i], g_uc_mem[i + 1]);
+	}
+	if (us_table_end & 1) {
+		crc = mxt_model_crc24(crc, g_uc_mem[us_table_end - 1], 0);
+	}
+	crc &= 0x00FFFFFF;
+	g_uc_mem[us_table_end + 0] = (uint8_t)crc;
+	g_uc_mem[us_table_end + 1] = (uint8_t)(crc >> 8);
+	g_uc_mem[us_table_end + 2] = (uint8_t)(crc >> 16);
+}
+
+/**
+ * \brief TWI read starting at a device address.
+ *
+ * Reading T5 pops the oldest message, or returns report ID 0xFF when the
+ * queue is empty; every further 9 bytes pop the next one. A read that starts
+ * at T44 returns the count first. The checksum request bit of the address
+ * is ignored, the CRC byte is always valid.
+ */
+uint32_t mxt_model_read(uint8_t uc_chip, uint16_t us_addr, uint8_t *p_data,
+		size_t size)
+{
+	static const uint8_t uc_empty[9] = { 0xFF };
+	const uint8_t *p_msg;
+	size_t i, n;
+
+	if (uc_chip != g_uc_chip) {
+		return TWIHS_RECEIVE_NACK;
+	}
+	us_addr &= 0x7FFF;
+
+	if (us_addr == g_us_t44_addr) {
+		p_data[0] = (uint8_t)g_ul_count;
+		p_data++;
+		size--;
+		us_addr = g_us_t5_addr;
+		if (!size) {
+			return TWIHS_SUCCESS;
+		}
+	}
+
+	if (us_addr == g_us_t5_addr) {
+		for (i = 0; i < size; i += n) {
+			p_msg = g_ul_count ? g_uc_queue[g_ul_head] : uc_empty;
+			n = (size - i < 9) ? size - i : 9;
+			memcpy(&p_data[i], p_msg, n);
+			if (g_ul_count) {
+				g_ul_head = (g_ul_head + 1) % MXT_MODEL_QUEUE_SIZE;
+				g_ul_count--;
+			}
+		}
+		return TWIHS_SUCCESS;
+	}
+
+	for (i = 0; i < size; i++) {
+		p_data[i] = (us_addr + i < MXT_MEMORY_SIZE) ? g_uc_mem[us_addr + i] : 0;
+	}
+	return TWIHS_SUCCESS;
+}
+
+/**
+ * \brief TWI write starting at a device address.
+ */
+uint32_t mxt_model_write(uint8_t uc_chip, uint16_t us_addr,
+		const uint8_t *p_data, size_t size)
+{
+	size_t i;
+
+	if (uc_chip != g_uc_chip) {
+		return TWIHS_RECEIVE_NACK;
+	}
+	for (i = 0; i < size; i++) {
+		if (us_addr + i < MXT_MEMORY_SIZE) {
+			g_uc_mem[us_addr + i] = p_data[i];
+		}
+	}
+	return TWIHS_SUCCESS;
+}
+
+/**
+ * \brief Level of the /CHG line, low while messages are pending.
+ */
+bool mxt_model_chg(void)
+{
+	return g_ul_count == 0;
+}
+
+uint32_t mxt_model_pending(void)
+{
+	return g_ul_count;
+}
+
+/**
+ * \brief Queue a raw message, as recorded on a device.
+ *
+ * \param p_msg report ID followed by the 7 message bytes; the CRC is added.
+ */
+void mxt_model_message(const uint8_t *p_msg)
+{
+	uint8_t *p_slot;
+	uint8_t crc = 0;
+	uint32_t i;
+
+	if (g_ul_count == MXT_MODEL_QUEUE_SIZE) {
+		/* Overflow: drop the oldest message, as the device does */
+		g_ul_head = (g_ul_head + 1) % MXT_MODEL_QUEUE_SIZE;
+		g_ul_count--;
+	}
+	p_slot = g_uc_queue[(g_ul_head + g_ul_count) % MXT_MODEL_QUEUE_SIZE];
+	g_ul_count++;
+
+	for (i = 0; i < 8; i++) {
+		p_slot[i] = p_msg[i];
+		crc = mxt_model_crc8(crc, p_msg[i]);
+	}
+	p_slot[8] = crc;
+}
+
+/**
+ * \brief Build a T9 touch message, without the CRC.
+ *
+ * \param p_msg 8 bytes.
+ * \param uc_id touch slot, 0..9.
+ * \param uc_status T9 status bits, e.g. MXT_MODEL_PRESS.
+ * \param us_x 12-bit X of the sensor.
+ * \param us_y 12-bit Y of the sensor.
+ */
+void mxt_model_t9_message(uint8_t *p_msg, uint8_t uc_id, uint8_t uc_status,
+		uint16_t us_x, uint16_t us_y)
+{
+	us_x &= 0x0FFF;
+	us_y &= 0x0FFF;
+	p_msg[0] = g_uc_t9_report + (uc_id % MXT_T9_REPORT_IDS);
+	p_msg[1] = uc_status;
+	p_msg[2] = (uint8_t)(us_x >> 4);
+	p_msg[3] = (uint8_t)(us_y >> 4);
+	p_msg[4] = (uint8_t)(((us_x & 0x0F) << 4) | (us_y & 0x0F));
+	p_msg[5] = 0x04;      /* touch area */
+	p_msg[6] = 0x20;      /* amplitude */
+	p_msg[7] = 0;
+}
+
+/**
+ * \brief Queue a T9 touch message.
+ *
+ * \param uc_id touch slot, 0..9.
+ * \param uc_status MXT_MODEL_PRESS, MXT_MODEL_MOVE or MXT_MODEL_RELEASE.
+ * \param us_x 12-bit X of the sensor.
+ * \param us_y 12-bit Y of the sensor.
+ */
+void mxt_model_touch(uint8_t uc_id, uint8_t uc_status, uint16_t us_x,
+		uint16_t us_y)
+{
+	uint8_t msg[8];
+
+	mxt_model_t9_message(msg, uc_id, uc_status, us_x, us_y);
+	mxt_model_message(msg);
+}
@@ -0,0 +1,39 @@
+/**
+ * \file
+ *
+ * \brief maXTouch mXT143E model on the TWIHS bus.
+ *
+ * Exposes the memory map read by the mxt_device component (ID block, object
+ * table, information block CRC and the objects) and a T5 message queue that
+ * drives the /CHG line.
+ */
+
+#ifndef MXT_MODEL_H_INCLUDED
+#define MXT_MODEL_H_INCLUDED
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/** Touch status bits of the T9 messages. */
+#define MXT_MODEL_PRESS    0xC0   /* DETECT | PRESS */
+#define MXT_MODEL_MOVE     0x90   /* DETECT | MOVE */
+#define MXT_MODEL_RELEASE  0x20
+
+/** Messages that can be pending before the oldest are dropped. */
+#define MXT_MODEL_QUEUE_SIZE 32
+
+void mxt_model_init(uint8_t uc_chip);
+uint32_t mxt_model_read(uint8_t uc_chip, uint16_t us_addr, uint8_t *p_data,
+		size_t size);
+uint32_t mxt_model_write(uint8_t uc_chip, uint16_t us_addr,
+		const uint8_t *p_data, size_t size);
+bool mxt_model_chg(void);
+uint32_t mxt_model_pending(void);
+void mxt_model_message(const uint8_t *p_msg);
+void mxt_model_t9_message(uint8_t *p_msg, uint8_t uc_id, uint8_t uc_status,
+		uint16_t us_x, uint16_t us_y);
+void mxt_model_touch(uint8_t uc_id, uint8_t uc_status, uint16_t us_x,
+		uint16_t us_y);
+
+#endif /* MXT_MODEL_H_INCLUDED */
@@ -0,0 +1,333 @@
+/**
+ * \file
+ *
+ * \brief Message reader of mxt_async.c against the maXTouch model.
+ *
+ * The reader runs on the TWIHS stand-in of hal.c, the /CHG edge starting it
+ * as on the board. The test replays scripts/touch.msg a time step at a
+ * time and checks the touch events decoded from it and the TWI reads they
+ * took, then queues bursts of messages to check how they are split into
+ * reads (the count read carrying the first message, then at most
+ * MXT_ASYNC_BURST messages a read), overflows the event ring and walks its
+ * indices across the 32-bit wrap:
+ *
+ *   make -C host bench
+ *   cd host && build/mxt_test [scripts/touch.msg]
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include "host_hal.h"
+#include "hal.h"
+#include "mxt_model.h"
+#include "mxt_async.h"
+#include "conf_example.h"
+#include "conf_mxt.h"
+
+#define TEST_LINE_SIZE  256
+#define TEST_MAX_EVENTS 64
+
+/** What the touch.msg messages decode to, T6 left out. */
+struct test_event {
+	uint32_t ul_ms;
+	uint8_t uc_id;
+	uint8_t uc_status;
+	uint16_t us_x;
+	uint16_t us_y;
+	uint8_t uc_size;
+};
+
+static const struct test_event g_expected[] = {
+	{  120, 0, 0xC0, 3764,  500, 0x04 },
+	{  135, 0, 0x90, 3755,  487, 0x04 },
+	{  150, 0, 0x90, 3747,  512, 0x04 },
+	{  190, 0, 0x20, 3747,  512, 0x04 },
+	{  600, 0, 0xC0, 3755,  525, 0x04 },
+	{  600, 0, 0x20, 3755,  525, 0x04 },
+	{ 1000, 0, 0xC0,  342, 3328, 0x12 },
+	{ 1000, 1, 0xC0,  427, 2688, 0x12 },
+	{ 1000, 2, 0xC0,  342, 2048, 0x12 },
+	{ 1000, 3, 0xC0,  470, 1408, 0x12 },
+	{ 1000, 4, 0xC0,  384,  768, 0x12 },
+	{ 1040, 0, 0x20,  342, 3328, 0x12 },
+	{ 1040, 1, 0x20,  427, 2688, 0x12 },
+	{ 1040, 2, 0x20,  342, 2048, 0x12 },
+	{ 1040, 3, 0x20,  470, 1408, 0x12 },
+	{ 1040, 4, 0x20,  384,  768, 0x12 },
+	{ 1500, 0, 0xC0, 2048, 3328, 0x04 },
+	{ 1516, 0, 0x90, 2048, 3008, 0x04 },
+	{ 1532, 0, 0x90, 2048, 2688, 0x04 },
+	{ 1548, 0, 0x90, 2048, 2368, 0x04 },
+	{ 1564, 0, 0x90, 2048, 2048, 0x04 },
+	{ 1580, 0, 0x90, 2048, 1728, 0x04 },
+	{ 1596, 0, 0x90, 2048, 1408, 0x04 },
+	{ 1612, 0, 0x90, 2048, 1088, 0x04 },
+	{ 1628, 0, 0x20, 2048, 1088, 0x04 },
+};
+
+#define TEST_EXPECTED (sizeof(g_expected) / sizeof(g_expected[0]))
+
+/* 26 messages at 15 times: one read each for the 11 times with a single
+ * message, T44 + first message then one burst for the pair and the two
+ * groups of five */
+#define TEST_REPLAY_MESSAGES     26
+#define TEST_REPLAY_TRANSACTIONS 20
+
+static uint32_t g_ul_failed;
+
+static void test_check(bool b_ok, const char *p_what)
+{
+	if (!b_ok) {
+		printf("  FAILED: %s\n", p_what);
+		g_ul_failed++;
+	}
+}
+
+/**
+ * \brief Reads the reader did for the messages of one /CHG edge.
+ *
+ * With T44 right before T5 the count read takes the first message along,
+ * the rest goes MXT_ASYNC_BURST messages a read.
+ */
+static uint32_t test_reads(uint32_t ul_messages)
+{
+	return 1 + (ul_messages - 1 + MXT_ASYNC_BURST - 1) / MXT_ASYNC_BURST;
+}
+
+/**
+ * \brief Replay a message file and check the events against g_expected.
+ */
+static void test_replay(const char *p_path)
+{
+	struct mxt_touch_event events[TEST_MAX_EVENTS];
+	uint32_t ul_ms[TEST_MAX_EVENTS];
+	struct mxt_async_stats stats;
+	char line[TEST_LINE_SIZE];
+	uint8_t uc_msg[8];
+	uint32_t ul_time, ul_last = 0;
+	uint32_t ul_messages = 0, ul_events = 0;
+	bool b_queued = false;
+	FILE *p_file;
+	char *p_hash;
+	uint32_t i;
+	int n;
+
+	printf("replay %s\n", p_path);
+	if ((p_file = fopen(p_path, "r")) == NULL) {
+		test_check(false, "cannot open the replay file");
+		return;
+	}
+
+	/* The messages of one time are queued together and read on one edge */
+	for (;;) {
+		bool b_line = fgets(line, sizeof(line), p_file) != NULL;
+
+		if (b_line) {
+			if ((p_hash = strchr(line, '#')) != NULL) {
+				*p_hash = '\0';
+			}
+			if (sscanf(line, " %n", &n), line[n] == '\0') {
+				continue;
+			}
+			if (sscanf(line, "%" SCNu32 " %hhx %hhx %hhx %hhx %hhx %hhx %hhx %hhx",
+					&ul_time, &uc_msg[0], &uc_msg[1], &uc_msg[2], &uc_msg[3],
+					&uc_msg[4], &uc_msg[5], &uc_msg[6], &uc_msg[7]) != 9) {
+				test_check(false, "expected <ms> <report id> <7 bytes>");
+				break;
+			}
+		}
+		if (b_queued && (!b_line || (ul_time != ul_last))) {
+			hal_chg_update();
+			while ((ul_events < TEST_MAX_EVENTS)
+					&& mxt_async_get_event(&events[ul_events])) {
+				ul_ms[ul_events++] = ul_last;
+			}
+			b_queued = false;
+		}
+		if (!b_line) {
+			break;
+		}
+		mxt_model_message(uc_msg);
+		ul_messages++;
+		ul_last = ul_time;
+		b_queued = true;
+	}
+	fclose(p_file);
+
+	mxt_async_get_stats(&stats);
+	printf("  %" PRIu32 " messages, %" PRIu32 " touch events, %" PRIu32
+			" TWI reads\n", stats.ul_messages, stats.ul_touch_events,
+			stats.ul_transactions);
+	test_check(ul_messages == TEST_REPLAY_MESSAGES, "messages in the file");
+	test_check(stats.ul_messages == TEST_REPLAY_MESSAGES, "messages read");
+	test_check(stats.ul_transactions == TEST_REPLAY_TRANSACTIONS, "TWI reads");
+	test_check(stats.ul_touch_events == TEST_EXPECTED, "touch events");
+	test_check(!stats.ul_dropped && !stats.ul_errors, "drops or errors");
+	test_check(!mxt_model_pending(), "messages left in the device");
+
+	test_check(ul_events == TEST_EXPECTED, "events popped");
+	for (i = 0; (i < ul_events) && (i < TEST_EXPECTED); i++) {
+		const struct test_event *p_exp = &g_expected[i];
+
+		if ((ul_ms[i] != p_exp->ul_ms) || (events[i].id != p_exp->uc_id)
+				|| (events[i].status != p_exp->uc_status)
+				|| (events[i].x != p_exp->us_x) || (events[i].y != p_exp->us_y)
+				|| (events[i].size != p_exp->uc_size)) {
+			printf("  event %" PRIu32 " at %" PRIu32 " ms: id %u status %02x"
+					" (%u, %u) size %u, expected id %u status %02x (%u, %u)"
+					" size %u\n", i, ul_ms[i], events[i].id, events[i].status,
+					events[i].x, events[i].y, events[i].size, p_exp->uc_id,
+					p_exp->uc_status, p_exp->us_x, p_exp->us_y, p_exp->uc_size);
+			test_check(false, "decoded event");
+		}
+	}
+}
+
+/**
+ * \brief Queue ul_count touches at once and check how they are read.
+ *
+ * The touches move along X, so the order they come out of the ring in is
+ * checked too.
+ */
+static void test_burst(uint32_t ul_count)
+{
+	struct mxt_async_stats before, after;
+	struct mxt_touch_event event;
+	uint32_t i, ul_popped = 0;
+	bool b_order = true;
+
+	mxt_async_get_stats(&before);
+	for (i = 0; i < ul_count; i++) {
+		mxt_model_touch(0, MXT_MODEL_MOVE, (uint16_t)(100 + i), 200);
+	}
+	hal_chg_update();
+	while (mxt_async_get_event(&event)) {
+		b_order &= (event.x == 100 + ul_popped) && (event.y == 200);
+		ul_popped++;
+	}
+	mxt_async_get_stats(&after);
+
+	printf("  %2" PRIu32 " messages: %" PRIu32 " reads\n", ul_count,
+			after.ul_transactions - before.ul_transactions);
+	test_check(after.ul_transactions - before.ul_transactions
+			== test_reads(ul_count), "reads of a burst");
+	test_check(after.ul_touch_events - before.ul_touch_events == ul_count,
+			"touch events of a burst");
+	test_check(ul_popped == ul_count, "events popped from a burst");
+	test_check(b_order, "order of a burst");
+}
+
+/**
+ * \brief Queue more touches than the ring holds without popping any.
+ */
+static void test_overflow(void)
+{
+	struct mxt_async_stats before, after;
+	struct mxt_touch_event event;
+	uint32_t ul_count = MXT_RING_SIZE + 5;
+	uint32_t i, ul_popped = 0;
+	bool b_order = true;
+
+	printf("overflow: %" PRIu32 " messages into a ring of %u\n", ul_count,
+			MXT_RING_SIZE);
+	mxt_async_get_stats(&before);
+	for (i = 0; i < ul_count; i++) {
+		mxt_model_touch(0, MXT_MODEL_MOVE, (uint16_t)(300 + i), 400);
+	}
+	hal_chg_update();
+	mxt_async_get_stats(&after);
+	test_check(after.ul_touch_events - before.ul_touch_events == MXT_RING_SIZE,
+			"touch events kept");
+	test_check(after.ul_dropped - before.ul_dropped == ul_count - MXT_RING_SIZE,
+			"touch events dropped");
+	test_check(!mxt_model_pending(), "messages left in the device");
+
+	/* The oldest are kept, the newest dropped */
+	while (mxt_async_get_event(&event)) {
+		b_order &= (event.x == 300 + ul_popped);
+		ul_popped++;
+	}
+	printf("  %" PRIu32 " kept, %" PRIu32 " dropped\n", ul_popped,
+			after.ul_dropped - before.ul_dropped);
+	test_check(ul_popped == MXT_RING_SIZE, "events popped from a full ring");
+	test_check(b_order, "order of a full ring");
+
+	/* And the ring takes events again */
+	mxt_model_touch(0, MXT_MODEL_RELEASE, 500, 400);
+	hal_chg_update();
+	test_check(mxt_async_get_event(&event) && (event.x == 500),
+			"event after an overflow");
+}
+
+/**
+ * \brief Walk the ring indices across the 32-bit wrap.
+ */
+static void test_ring_wrap(void)
+{
+	struct mxt_ring ring;
+	struct mxt_touch_event event;
+	uint32_t i, ul_put = 0, ul_got = 0;
+	bool b_ok = true;
+
+	printf("ring indices across the 32-bit wrap\n");
+	mxt_ring_init(&ring);
+	ring.ul_head = ring.ul_tail = UINT32_MAX - MXT_RING_SIZE / 2;
+
+	/* Fill, drain half, fill again, drain: both indices wrap while the
+	 * ring is full */
+	memset(&event, 0, sizeof(event));
+	for (i = 0; i < MXT_RING_SIZE; i++) {
+		event.x = (uint16_t)ul_put++;
+		b_ok &= mxt_ring_put(&ring, &event);
+	}
+	b_ok &= !mxt_ring_put(&ring, &event) && (ring.ul_dropped == 1);
+	b_ok &= (mxt_ring_count(&ring) == MXT_RING_SIZE);
+	for (i = 0; i < MXT_RING_SIZE / 2; i++) {
+		b_ok &= mxt_ring_get(&ring, &event) && (event.x == ul_got++);
+	}
+	for (i = 0; i < MXT_RING_SIZE / 2; i++) {
+		event.x = (uint16_t)ul_put++;
+		b_ok &= mxt_ring_put(&ring, &event);
+	}
+	b_ok &= (mxt_ring_count(&ring) == MXT_RING_SIZE);
+	b_ok &= !mxt_ring_put(&ring, &event) && (ring.ul_dropped == 2);
+	while (mxt_ring_get(&ring, &event)) {
+		b_ok &= (event.x == ul_got++);
+	}
+	b_ok &= (ul_got == ul_put) && !mxt_ring_count(&ring);
+	b_ok &= (ring.ul_head < MXT_RING_SIZE);
+	test_check(b_ok, "ring across the wrap");
+}
+
+int main(int argc, char **argv)
+{
+	twihs_master_options_t twi_opt = {
+		.speed = MXT_TWI_SPEED,
+		.chip = MAXTOUCH_TWI_ADDRESS,
+	};
+	struct mxt_device device;
+	uint32_t ul_count;
+
+	hal_init();
+	twihs_master_setup(MAXTOUCH_TWI_INTERFACE, &twi_opt);
+	if ((mxt_init_device(&device, MAXTOUCH_TWI_INTERFACE, MAXTOUCH_TWI_ADDRESS,
+			MAXTOUCH_XPRO_CHG_PIO) != STATUS_OK)
+			|| (mxt_async_init(&device) != STATUS_OK)) {
+		printf("maXTouch not found\n");
+		return 1;
+	}
+
+	test_replay((argc > 1) ? argv[1] : "scripts/touch.msg");
+
+	printf("bursts of %u messages a read\n", MXT_ASYNC_BURST);
+	for (ul_count = 1; ul_count <= 3 * MXT_ASYNC_BURST + 1; ul_count++) {
+		test_burst(ul_count);
+	}
+
+	test_overflow();
+	test_ring_wrap();
+
+	printf("%s\n", g_ul_failed ? "FAILED" : "ok");
+	return g_ul_failed ? 1 : 0;
+}
@@ -0,0 +1,602 @@
+/**
+ * \file
+ *
+ * \brief ILI9488 controller model fed by the SPI byte stream.
+ *
+ * Only what the driver uses is modelled: address window, memory write and
+ * continue, 16 and 18-bit pixel formats, the MV bit of MADCTL, memory read,
+ * the scanline read, vertical scrolling and the ID4 read through the SPI
+ * read settings register, the idle and partial modes and the brightness.
+ * Other commands are accepted and their parameters ignored.
+ *
+ * SOFTWARE_RESET and SLEEP_OUT make the controller busy for the time the
+ * datasheet asks to wait before the next command: 5 ms, or 120 ms for a reset
+ * out of sleep. Commands sent sooner are counted as early.
+ *
+ * Vertical scrolling maps frame memory rows to the rows of the glass: row d
+ * of the scroll area shows frame memory row TFA + (d - TFA + VSP - TFA) % VSA,
+ * the fixed areas above and below show their own rows. The scan runs over
+ * the glass, so a frame memory row is refreshed when the scan reaches the
+ * glass row that shows it.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "panel.h"
+#include "sim.h"
+
+#define CMD_SOFTWARE_RESET      0x01
+#define CMD_SLEEP_OUT           0x11
+#define CMD_PARTIAL_MODE_ON     0x12
+#define CMD_NORMAL_MODE_ON      0x13
+#define CMD_DISPLAY_OFF         0x28
+#define CMD_DISPLAY_ON          0x29
+#define CMD_COLUMN_ADDRESS_SET  0x2A
+#define CMD_PAGE_ADDRESS_SET    0x2B
+#define CMD_MEMORY_WRITE        0x2C
+#define CMD_MEMORY_READ         0x2E
+#define CMD_PARTIAL_AREA        0x30
+#define CMD_MEMORY_ACCESS_CTRL  0x36
+#define CMD_VERT_SCROLL_DEF     0x33
+#define CMD_VERT_SCROLL_START   0x37
+#define CMD_IDLE_MODE_OFF       0x38
+#define CMD_IDLE_MODE_ON        0x39
+#define CMD_PIXEL_FORMAT_SET    0x3A
+#define CMD_WRITE_CONTINUE      0x3C
+#define CMD_READ_CONTINUE       0x3E
+#define CMD_GET_SCANLINE        0x45
+#define CMD_WRITE_BRIGHTNESS    0x51
+#define CMD_READ_ID4            0xD3
+#define CMD_SPI_READ_SETTINGS   0xFB
+
+#define MADCTL_MV               0x20
+
+#define PANEL_FRAME_US          (PANEL_LINES * PANEL_LINE_US)
+
+/* Waits after SOFTWARE_RESET (from sleep in, from sleep out), SLEEP_OUT */
+#define PANEL_RESET_US          5000
+#define PANEL_RESET_AWAKE_US    120000
+#define PANEL_SLEEP_OUT_US      5000
+
+/** ID4 parameters: dummy, then 0x00 0x94 0x88. */
+static const uint8_t g_uc_id4[4] = { 0x00, 0x00, 0x94, 0x88 };
+
+/* Frame memory, 0x00RRGGBB with 6 significant bits per channel */
+static uint32_t g_ul_gram[PANEL_HEIGHT][PANEL_WIDTH];
+
+static bool g_b_data;              /* D/C level */
+static uint8_t g_uc_cmd;           /* last command byte */
+static uint32_t g_ul_param;        /* parameter bytes received for it */
+static uint8_t g_uc_params[6];
+
+static uint16_t g_us_sc, g_us_ec;  /* column window */
+static uint16_t g_us_sp, g_us_ep;  /* page window */
+static uint16_t g_us_col, g_us_page;
+static uint8_t g_uc_pix[3];        /* bytes of the pixel being assembled */
+static uint32_t g_ul_pix_bytes;
+
+static uint8_t g_uc_madctl;
+static uint8_t g_uc_colmod;
+static uint8_t g_uc_read_sel;      /* parameter selected by SPI read settings */
+static uint32_t g_ul_read_index;
+static bool g_b_display_on;
+static bool g_b_awake;             /* out of sleep */
+static uint64_t g_ull_busy_until_us;
+
+/* Vertical scrolling: top fixed area, scroll area, start address */
+static uint16_t g_us_tfa, g_us_vsa, g_us_vsp;
+
+/* Idle mode, partial mode and its rows of the glass, brightness */
+static bool g_b_idle;
+static bool g_b_partial;
+static uint16_t g_us_psr, g_us_per;
+static uint8_t g_uc_brightness;
+
+/* Refreshes on which the pixels of the window being written first show */
+static bool g_b_update;
+static bool g_b_update_torn;
+static uint64_t g_ull_refresh_min, g_ull_refresh_max;
+
+static struct panel_stats g_stats;
+
+static uint32_t panel_bytes_per_pixel(void)
+{
+	return ((g_uc_colmod & 0x07) == 0x05) ? 2 : 3;
+}
+
+static uint32_t *panel_cell(uint32_t ul_col, uint32_t ul_page)
+{
+	uint32_t x = ul_col, y = ul_page;
+
+	if (g_uc_madctl & MADCTL_MV) {
+		x = ul_page;
+		y = ul_col;
+	}
+	if ((x >= PANEL_WIDTH) || (y >= PANEL_HEIGHT)) {
+		return NULL;
+	}
+	return &g_ul_gram[y][x];
+}
+
+/**
+ * \brief Frame memory row shown on a row of the glass.
+ */
+static uint32_t panel_glass_to_gram(uint32_t ul_row)
+{
+	if ((ul_row < g_us_tfa) || (ul_row >= (uint32_t)g_us_tfa + g_us_vsa)) {
+		return ul_row;
+	}
+	return g_us_tfa + (ul_row - g_us_tfa + g_us_vsp - g_us_tfa) % g_us_vsa;
+}
+
+/**
+ * \brief Row of the glass showing a frame memory row.
+ */
+static uint32_t panel_gram_to_glass(uint32_t ul_row)
+{
+	if ((ul_row < g_us_tfa) || (ul_row >= (uint32_t)g_us_tfa + g_us_vsa)) {
+		return ul_row;
+	}
+	return g_us_tfa + (ul_row - g_us_vsp + g_us_vsa) % g_us_vsa;
+}
+
+static void panel_advance(void)
+{
+	if (g_us_col >= g_us_ec) {
+		g_us_col = g_us_sc;
+		g_us_page = (g_us_page >= g_us_ep) ? g_us_sp : g_us_page + 1;
+	} else {
+		g_us_col++;
+	}
+}
+
+/**
+ * \brief Line being scanned now.
+ */
+static uint32_t panel_scanline(void)
+{
+	return (uint32_t)(sim_now_us() / PANEL_LINE_US % PANEL_LINES);
+}
+
+/**
+ * \brief Account a pixel written now on a row to the current window.
+ *
+ * The scan reaches the row at y * PANEL_LINE_US into each refresh, so the
+ * pixel first shows on the first refresh that reaches it from now on.
+ */
+static void panel_track_update(uint32_t ul_row)
+{
+	uint64_t ull_refresh = (sim_now_us() + PANEL_FRAME_US
+			- (uint64_t)ul_row * PANEL_LINE_US + PANEL_FRAME_US - 1) / PANEL_FRAME_US;
+
+	if (!g_b_update) {
+		g_b_update = true;
+		g_b_update_torn = false;
+		g_ull_refresh_min = ull_refresh;
+		g_ull_refresh_max = ull_refresh;
+		g_stats.ull_updates++;
+		return;
+	}
+	if (ull_refresh < g_ull_refresh_min) {
+		g_ull_refresh_min = ull_refresh;
+	}
+	if (ull_refresh > g_ull_refresh_max) {
+		g_ull_refresh_max = ull_refresh;
+	}
+	if (!g_b_update_torn && (g_ull_refresh_min != g_ull_refresh_max)) {
+		g_b_update_torn = true;
+		g_stats.ull_torn_updates++;
+	}
+}
+
+static void panel_store_pixel(void)
+{
+	uint32_t *p_cell = panel_cell(g_us_col, g_us_page);
+	uint32_t r, g, b;
+
+	if (panel_bytes_per_pixel() == 2) {
+		uint16_t us = (uint16_t)((g_uc_pix[0] << 8) | g_uc_pix[1]);
+
+		r = (us >> 8) & 0xF8;
+		g = (us >> 3) & 0xFC;
+		b = (us << 3) & 0xF8;
+	} else {
+		r = g_uc_pix[0] & 0xFC;
+		g = g_uc_pix[1] & 0xFC;
+		b = g_uc_pix[2] & 0xFC;
+	}
+	if (p_cell) {
+		*p_cell = (r << 16) | (g << 8) | b;
+		if (g_b_display_on) {
+			panel_track_update(panel_gram_to_glass(
+					(uint32_t)(p_cell - &g_ul_gram[0][0]) / PANEL_WIDTH));
+		}
+	}
+	g_stats.ull_pixels++;
+	panel_advance();
+}
+
+static void panel_command(uint8_t uc_cmd)
+{
+	g_uc_cmd = uc_cmd;
+	g_ul_param = 0;
+	g_ul_pix_bytes = 0;
+	g_ul_read_index = 0;
+	g_stats.ull_commands++;
+	if (sim_now_us() < g_ull_busy_until_us) {
+		g_stats.ull_early_commands++;
+	}
+
+	switch (uc_cmd) {
+	case CMD_SOFTWARE_RESET:
+		g_ull_busy_until_us = sim_now_us()
+				+ (g_b_awake ? PANEL_RESET_AWAKE_US : PANEL_RESET_US);
+		g_uc_madctl = 0;
+		g_uc_colmod = 0x06;
+		g_b_display_on = false;
+		g_b_awake = false;
+		g_b_idle = false;
+		g_b_partial = false;
+		g_us_psr = 0;
+		g_us_per = PANEL_HEIGHT - 1;
+		g_uc_brightness = 0;
+		break;
+	case CMD_SLEEP_OUT:
+		g_ull_busy_until_us = sim_now_us() + PANEL_SLEEP_OUT_US;
+		g_b_awake = true;
+		break;
+	case CMD_DISPLAY_ON:
+		g_b_display_on = true;
+		break;
+	case CMD_DISPLAY_OFF:
+		g_b_display_on = false;
+		break;
+	case CMD_MEMORY_WRITE:
+	case CMD_MEMORY_READ:
+		g_us_col = g_us_sc;
+		g_us_page = g_us_sp;
+		g_b_update = false;
+		g_stats.ull_ram_writes += (uc_cmd == CMD_MEMORY_WRITE);
+		break;
+	case CMD_COLUMN_ADDRESS_SET:
+	case CMD_PAGE_ADDRESS_SET:
+		g_stats.ull_window_sets++;
+		break;
+	case CMD_VERT_SCROLL_START:
+		g_stats.ull_scrolls++;
+		break;
+	case CMD_PARTIAL_MODE_ON:
+		g_b_partial = true;
+		break;
+	case CMD_NORMAL_MODE_ON:
+		g_b_partial = false;
+		break;
+	case CMD_IDLE_MODE_ON:
+	case CMD_IDLE_MODE_OFF:
+		g_b_idle = (uc_cmd == CMD_IDLE_MODE_ON);
+		break;
+	default:
+		break;
+	}
+	g_stats.ull_mode_changes += (uc_cmd == CMD_PARTIAL_MODE_ON)
+			|| (uc_cmd == CMD_NORMAL_MODE_ON) || (uc_cmd == CMD_IDLE_MODE_ON)
+			|| (uc_cmd == CMD_IDLE_MODE_OFF);
+}
+
+static void panel_parameter(uint8_t uc_data)
+{
+	switch (g_uc_cmd) {
+	case CMD_MEMORY_WRITE:
+	case CMD_WRITE_CONTINUE:
+		g_uc_pix[g_ul_pix_bytes++] = uc_data;
+		if (g_ul_pix_bytes == panel_bytes_per_pixel()) {
+			g_ul_pix_bytes = 0;
+			panel_store_pixel();
+		}
+		return;
+	case CMD_COLUMN_ADDRESS_SET:
+	case CMD_PAGE_ADDRESS_SET:
+		if (g_ul_param < 4) {
+			g_uc_params[g_ul_param] = uc_data;
+		}
+		if (++g_ul_param == 4) {
+			uint16_t us_start = (uint16_t)((g_uc_params[0] << 8) | g_uc_params[1]);
+			uint16_t us_end = (uint16_t)((g_uc_params[2] << 8) | g_uc_params[3]);
+
+			if (g_uc_cmd == CMD_COLUMN_ADDRESS_SET) {
+				g_us_sc = us_start;
+				g_us_ec = us_end;
+			} else {
+				g_us_sp = us_start;
+				g_us_ep = us_end;
+			}
+		}
+		return;
+	case CMD_VERT_SCROLL_DEF:
+		if (g_ul_param < 6) {
+			g_uc_params[g_ul_param] = uc_data;
+		}
+		if (++g_ul_param == 6) {
+			uint16_t us_tfa = (uint16_t)((g_uc_params[0] << 8) | g_uc_params[1]);
+			uint16_t us_vsa = (uint16_t)((g_uc_params[2] << 8) | g_uc_params[3]);
+			uint16_t us_bfa = (uint16_t)((g_uc_params[4] << 8) | g_uc_params[5]);
+
+			/* The areas must cover the glass exactly */
+			if (us_vsa && (us_tfa + us_vsa + us_bfa == PANEL_HEIGHT)) {
+				g_us_tfa = us_tfa;
+				g_us_vsa = us_vsa;
+			}
+		}
+		return;
+	case CMD_VERT_SCROLL_START:
+		if (g_ul_param < 2) {
+			g_uc_params[g_ul_param] = uc_data;
+		}
+		if (++g_ul_param == 2) {
+			uint16_t us_vsp = (uint16_t)((g_uc_params[0] << 8) | g_uc_params[1]);
+
+			if ((us_vsp >= g_us_tfa) && (us_vsp < g_us_tfa + g_us_vsa)) {
+				g_us_vsp = us_vsp;
+			}
+		}
+		return;
+	case CMD_PARTIAL_AREA:
+		if (g_ul_param < 4) {
+			g_uc_params[g_ul_param] = uc_data;
+		}
+		if (++g_ul_param == 4) {
+			g_us_psr = (uint16_t)((g_uc_params[0] << 8) | g_uc_params[1]);
+			g_us_per = (uint16_t)((g_uc_params[2] << 8) | g_uc_params[3]);
+		}
+		return;
+	case CMD_WRITE_BRIGHTNESS:
+		g_uc_brightness = uc_data;
+		break;
+	case CMD_MEMORY_ACCESS_CTRL:
+		g_uc_madctl = uc_data;
+		break;
+	case CMD_PIXEL_FORMAT_SET:
+		g_uc_colmod = uc_data;
+		break;
+	case CMD_SPI_READ_SETTINGS:
+		g_uc_read_sel = (uc_data & 0x80) ? (uc_data & 0x0F) : 0;
+		break;
+	default:
+		break;
+	}
+	g_ul_param++;
+}
+
+/**
+ * \brief Power-on state: black frame memory, 18-bit pixels, display off.
+ */
+void panel_reset(void)
+{
+	memset(g_ul_gram, 0, sizeof(g_ul_gram));
+	g_b_data = false;
+	g_uc_cmd = 0;
+	g_ul_param = 0;
+	g_us_sc = 0;
+	g_us_ec = PANEL_WIDTH - 1;
+	g_us_sp = 0;
+	g_us_ep = PANEL_HEIGHT - 1;
+	g_us_col = 0;
+	g_us_page = 0;
+	g_ul_pix_bytes = 0;
+	g_uc_madctl = 0;
+	g_uc_colmod = 0x06;
+	g_uc_read_sel = 0;
+	g_b_display_on = false;
+	g_b_awake = false;
+	g_ull_busy_until_us = 0;
+	g_us_tfa = 0;
+	g_us_vsa = PANEL_HEIGHT;
+	g_us_vsp = 0;
+	g_b_idle = false;
+	g_b_partial = false;
+	g_us_psr = 0;
+	g_us_per = PANEL_HEIGHT - 1;
+	g_uc_brightness = 0;
+	g_b_update = false;
+	panel_reset_stats();
+}
+
+/**
+ * \brief Level of the D/C line, true for data.
+ */
+void panel_set_dc(bool b_data)
+{
+	g_b_data = b_data;
+}
+
+/**
+ * \brief Bytes clocked out by the host.
+ */
+void panel_write(const uint8_t *p_data, size_t size)
+{
+	g_stats.ull_bytes += size;
+	while (size--) {
+		if (g_b_data) {
+			panel_parameter(*p_data++);
+		} else {
+			panel_command(*p_data++);
+		}
+	}
+}
+
+/**
+ * \brief Bytes clocked in by the host after a read command.
+ */
+void panel_read(uint8_t *p_data, size_t size)
+{
+	uint32_t *p_cell;
+
+	g_stats.ull_bytes += size;
+	while (size--) {
+		switch (g_uc_cmd) {
+		case CMD_READ_ID4:
+			if (g_uc_read_sel) {
+				*p_data = g_uc_id4[g_uc_read_sel & 3];
+			} else {
+				*p_data = g_uc_id4[g_ul_read_index & 3];
+			}
+			break;
+		case CMD_GET_SCANLINE:
+			/* Dummy byte, then the line, big-endian */
+			if (g_ul_read_index == 1) {
+				*p_data = (uint8_t)(panel_scanline() >> 8);
+			} else if (g_ul_read_index == 2) {
+				*p_data = (uint8_t)panel_scanline();
+			} else {
+				*p_data = 0;
+			}
+			break;
+		case CMD_MEMORY_READ:
+		case CMD_READ_CONTINUE:
+			/* First byte after the command is a dummy read */
+			if ((g_uc_cmd == CMD_MEMORY_READ) && (g_ul_read_index == 0)) {
+				*p_data = 0;
+				break;
+			}
+			p_cell = panel_cell(g_us_col, g_us_page);
+			*p_data = p_cell ? (uint8_t)(*p_cell >> (16 - 8 * g_ul_pix_bytes)) : 0;
+			if (++g_ul_pix_bytes == 3) {
+				g_ul_pix_bytes = 0;
+				panel_advance();
+			}
+			break;
+		default:
+			*p_data = 0;
+			break;
+		}
+		p_data++;
+		g_ul_read_index++;
+	}
+}
+
+/**
+ * \brief Colour at a position of the address space, 0xRRGGBB.
+ */
+uint32_t panel_get_pixel(uint32_t ul_x, uint32_t ul_y)
+{
+	uint32_t *p_cell = panel_cell(ul_x, ul_y);
+
+	return p_cell ? *p_cell : 0;
+}
+
+/**
+ * \brief Whether a row of the glass is refreshed in partial mode.
+ *
+ * The partial area runs from the start row to the end row, wrapping past
+ * the last row when the start is below the end.
+ */
+static bool panel_row_in_partial_area(uint32_t ul_row)
+{
+	if (g_us_psr <= g_us_per) {
+		return (ul_row >= g_us_psr) && (ul_row <= g_us_per);
+	}
+	return (ul_row >= g_us_psr) || (ul_row <= g_us_per);
+}
+
+/**
+ * \brief Colour shown at a position of the address space, 0xRRGGBB.
+ *
+ * Same as panel_get_pixel() with the vertical scrolling applied. In partial
+ * mode the rows outside the partial area are black, the non-display colour,
+ * and in idle mode every channel is reduced to its most significant bit.
+ */
+uint32_t panel_get_shown_pixel(uint32_t ul_x, uint32_t ul_y)
+{
+	uint32_t *p_cell = panel_cell(ul_x, ul_y);
+	uint32_t ul_offset, ul_row, ul_color;
+
+	if (!p_cell) {
+		return 0;
+	}
+	ul_offset = (uint32_t)(p_cell - &g_ul_gram[0][0]);
+	if (g_b_partial && !panel_row_in_partial_area(ul_offset / PANEL_WIDTH)) {
+		return 0;
+	}
+	ul_row = panel_glass_to_gram(ul_offset / PANEL_WIDTH);
+	ul_color = g_ul_gram[ul_row][ul_offset % PANEL_WIDTH];
+	if (g_b_idle) {
+		/* 0x80 of each channel spread over its six bits */
+		ul_color = ((ul_color >> 7) & 0x010101) * 0xFC;
+	}
+	return ul_color;
+}
+
+bool panel_is_on(void)
+{
+	return g_b_display_on;
+}
+
+bool panel_is_idle(void)
+{
+	return g_b_idle;
+}
+
+/**
+ * \brief Whether the partial mode is on, and its rows of the glass.
+ *
+ * \param p_us_start receives the first row, may be NULL.
+ * \param p_us_end receives the last row, may be NULL.
+ */
+bool panel_get_partial(uint16_t *p_us_start, uint16_t *p_us_end)
+{
+	if (p_us_start) {
+		*p_us_start = g_us_psr;
+	}
+	if (p_us_end) {
+		*p_us_end = g_us_per;
+	}
+	return g_b_partial;
+}
+
+uint8_t panel_get_brightness(void)
+{
+	return g_uc_brightness;
+}
+
+/**
+ * \brief Write what the glass shows to a binary PPM file.
+ *
+ * The image is in the address space of the driver, so it reads the same way
+ * as the application coordinates, with the vertical scrolling applied. A
+ * display that is off is dumped black.
+ */
+bool panel_dump_ppm(const char *p_path)
+{
+	bool b_mv = (g_uc_madctl & MADCTL_MV) != 0;
+	uint32_t width = b_mv ? PANEL_HEIGHT : PANEL_WIDTH;
+	uint32_t height = b_mv ? PANEL_WIDTH : PANEL_HEIGHT;
+	uint8_t uc_row[PANEL_HEIGHT * 3];
+	uint32_t x, y, c;
+	FILE *p_file = fopen(p_path, "wb");
+
+	if (!p_file) {
+		return false;
+	}
+	fprintf(p_file, "P6\n%u %u\n255\n", width, height);
+	for (y = 0; y < height; y++) {
+		for (x = 0; x < width; x++) {
+			c = g_b_display_on ? panel_get_shown_pixel(x, y) : 0;
+			/* Spread the 6-bit channels over the full 8-bit range */
+			uc_row[3 * x + 0] = (uint8_t)(((c >> 16) & 0xFC) | ((c >> 22) & 0x03));
+			uc_row[3 * x + 1] = (uint8_t)(((c >> 8) & 0xFC) | ((c >> 14) & 0x03));
+			uc_row[3 * x + 2] = (uint8_t)((c & 0xFC) | ((c >> 6) & 0x03));
+		}
+		fwrite(uc_row, 3, width, p_file);
+	}
+	return fclose(p_file) == 0;
+}
+
+void panel_get_stats(struct panel_stats *p_stats)
+{
+	*p_stats = g_stats;
+}
+
+void panel_reset_stats(void)
+{
+	memset(&g_stats, 0, sizeof(g_stats));
+}
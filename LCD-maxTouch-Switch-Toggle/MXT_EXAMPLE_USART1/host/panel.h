@@ -0,0 +1,63 @@
+/**
+ * \file
+ *
+ * \brief ILI9488 controller model fed by the SPI byte stream.
+ *
+ * Decodes commands and parameters the way the panel does (D/C low selects a
+ * command byte), keeps the frame memory in 18-bit colour and counts the bus
+ * traffic so draw paths can be compared without hardware.
+ *
+ * The refresh scan is modelled on the virtual clock: PANEL_LINES lines of
+ * PANEL_LINE_US each, the frame memory rows followed by the vertical
+ * blanking, counted from power-on. GET_SCANLINE returns the line being
+ * scanned, and every GRAM window written is checked against the scan: it is
+ * torn when some of its pixels first show on one refresh and others on the
+ * next.
+ *
+ * What the glass shows, panel_get_shown_pixel() and panel_dump_ppm(),
+ * follows the idle and partial modes; the brightness is only recorded.
+ */
+
+#ifndef PANEL_H_INCLUDED
+#define PANEL_H_INCLUDED
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/** Frame memory size, portrait. */
+#define PANEL_WIDTH   320
+#define PANEL_HEIGHT  480
+
+/** Refresh scan: lines per refresh, blanking included, and line time. */
+#define PANEL_LINES   490
+#define PANEL_LINE_US 34
+
+struct panel_stats {
+	uint64_t ull_bytes;          //!< bytes clocked on the bus, commands included
+	uint64_t ull_commands;       //!< command bytes
+	uint64_t ull_pixels;         //!< pixels written to the frame memory
+	uint64_t ull_ram_writes;     //!< MEMORY_WRITE commands (GRAM windows)
+	uint64_t ull_window_sets;    //!< column/page address commands
+	uint64_t ull_updates;        //!< GRAM windows written
+	uint64_t ull_torn_updates;   //!< of which crossed by the refresh scan
+	uint64_t ull_scrolls;        //!< vertical scroll start address commands
+	uint64_t ull_early_commands; //!< commands sent while busy after a reset or sleep out
+	uint64_t ull_mode_changes;   //!< idle and partial/normal mode commands
+};
+
+void panel_reset(void);
+void panel_set_dc(bool b_data);
+void panel_write(const uint8_t *p_data, size_t size);
+void panel_read(uint8_t *p_data, size_t size);
+uint32_t panel_get_pixel(uint32_t ul_x, uint32_t ul_y);
+uint32_t panel_get_shown_pixel(uint32_t ul_x, uint32_t ul_y);
+bool panel_is_on(void);
+bool panel_is_idle(void);
+bool panel_get_partial(uint16_t *p_us_start, uint16_t *p_us_end);
+uint8_t panel_get_brightness(void);
+bool panel_dump_ppm(const char *p_path);
+void panel_get_stats(struct panel_stats *p_stats);
+void panel_reset_stats(void);
+
+#endif /* PANEL_H_INCLUDED */
@@ -0,0 +1,155 @@
+/**
+ * \file
+ *
+ * \brief Bit exactness of the SIMD pixel kernels of ili9488_pixel.c.
+ *
+ * The Makefile builds ili9488_pixel.c a second time with ILI9488_PIXEL_SIMD
+ * defined, the intrinsics being emulated by host_hal.h, and links it here.
+ * Every kernel is run against its _ref on random pixels for every count up
+ * to a few groups, every misalignment of its buffers and, for the mono
+ * expansion, every first bit; the bytes around the destination must not be
+ * touched:
+ *
+ *   make -C host bench
+ *   host/build/pixel_test
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include "host_hal.h"
+#include "ili9488_pixel.h"
+
+#define TEST_MAX_COUNT  70
+#define TEST_GUARD      8
+#define TEST_BYTES      (TEST_MAX_COUNT * 3 + 2 * TEST_GUARD)
+
+struct test_kernel {
+	const char *p_name;
+	uint32_t ul_src_size;    //!< bytes per source pixel
+	uint32_t ul_dst_size;    //!< bytes per destination pixel
+	void (*run)(bool b_ref, uint8_t *p_uc_dst, const uint8_t *p_uc_src,
+			uint32_t ul_count, uint32_t ul_arg);
+	uint32_t ul_args;        //!< values of ul_arg to try
+};
+
+static uint32_t g_ul_seed = 1;
+static uint16_t g_us_color;
+
+static uint32_t test_random(void)
+{
+	g_ul_seed = g_ul_seed * 1664525u + 1013904223u;
+	return g_ul_seed >> 8;
+}
+
+static void run_888_666(bool b_ref, uint8_t *p_uc_dst, const uint8_t *p_uc_src,
+		uint32_t ul_count, uint32_t ul_arg)
+{
+	(b_ref ? ili9488_pixel_rgb888_to_rgb666_ref
+			: ili9488_pixel_rgb888_to_rgb666)(p_uc_dst, p_uc_src, ul_count);
+}
+
+static void run_888_565(bool b_ref, uint8_t *p_uc_dst, const uint8_t *p_uc_src,
+		uint32_t ul_count, uint32_t ul_arg)
+{
+	(b_ref ? ili9488_pixel_rgb888_to_rgb565_ref
+			: ili9488_pixel_rgb888_to_rgb565)((uint16_t *)p_uc_dst, p_uc_src,
+			ul_count);
+}
+
+static void run_565_666(bool b_ref, uint8_t *p_uc_dst, const uint8_t *p_uc_src,
+		uint32_t ul_count, uint32_t ul_arg)
+{
+	(b_ref ? ili9488_pixel_rgb565_to_rgb666_ref
+			: ili9488_pixel_rgb565_to_rgb666)(p_uc_dst,
+			(const uint16_t *)p_uc_src, ul_count);
+}
+
+static void run_fill16(bool b_ref, uint8_t *p_uc_dst, const uint8_t *p_uc_src,
+		uint32_t ul_count, uint32_t ul_arg)
+{
+	(b_ref ? ili9488_pixel_fill16_ref : ili9488_pixel_fill16)(
+			(uint16_t *)p_uc_dst, g_us_color, ul_count);
+}
+
+static void run_fill_666(bool b_ref, uint8_t *p_uc_dst, const uint8_t *p_uc_src,
+		uint32_t ul_count, uint32_t ul_arg)
+{
+	(b_ref ? ili9488_pixel_fill_rgb666_ref : ili9488_pixel_fill_rgb666)(
+			p_uc_dst, (uint32_t)g_us_color << 8 | p_uc_src[0], ul_count);
+}
+
+static void run_mono(bool b_ref, uint8_t *p_uc_dst, const uint8_t *p_uc_src,
+		uint32_t ul_count, uint32_t ul_arg)
+{
+	(b_ref ? ili9488_pixel_expand_mono_ref : ili9488_pixel_expand_mono)(
+			(uint16_t *)p_uc_dst, p_uc_src, ul_arg, ul_count, g_us_color,
+			~g_us_color);
+}
+
+static const struct test_kernel g_kernels[] = {
+	{ "rgb888_to_rgb666", 3, 3, run_888_666,  1 },
+	{ "rgb888_to_rgb565", 3, 2, run_888_565,  1 },
+	{ "rgb565_to_rgb666", 2, 3, run_565_666,  1 },
+	{ "fill16",           1, 2, run_fill16,   1 },
+	{ "fill_rgb666",      1, 3, run_fill_666, 1 },
+	{ "expand_mono",      1, 2, run_mono,     16 },
+};
+
+/**
+ * \brief Run one kernel against its reference, return the failing cases.
+ */
+static uint32_t test_kernel(const struct test_kernel *p_kernel)
+{
+	static uint8_t uc_src[TEST_BYTES];
+	static uint8_t uc_ref[TEST_BYTES], uc_out[TEST_BYTES];
+	uint32_t ul_count, ul_src_off, ul_dst_off, ul_arg, ul_cases = 0;
+	uint32_t ul_failed = 0, i;
+
+	for (ul_count = 0; ul_count <= TEST_MAX_COUNT; ul_count++) {
+		for (ul_src_off = 0; ul_src_off < 4; ul_src_off++) {
+			for (ul_dst_off = 0; ul_dst_off < 4; ul_dst_off++) {
+				for (ul_arg = 0; ul_arg < p_kernel->ul_args; ul_arg++) {
+					for (i = 0; i < TEST_BYTES; i++) {
+						uc_src[i] = test_random();
+						uc_ref[i] = uc_out[i] = test_random();
+					}
+					g_us_color = test_random();
+					/* 16-bit pixels stay halfword aligned, as in C */
+					if (((p_kernel->ul_src_size == 2) && (ul_src_off & 1))
+							|| ((p_kernel->ul_dst_size == 2) && (ul_dst_off & 1))) {
+						continue;
+					}
+					p_kernel->run(true, uc_ref + TEST_GUARD + ul_dst_off,
+							uc_src + ul_src_off, ul_count, ul_arg);
+					p_kernel->run(false, uc_out + TEST_GUARD + ul_dst_off,
+							uc_src + ul_src_off, ul_count, ul_arg);
+					ul_cases++;
+					if (memcmp(uc_ref, uc_out, TEST_BYTES)) {
+						if (!ul_failed) {
+							fprintf(stderr, "%s: count %" PRIu32 " src +%" PRIu32
+									" dst +%" PRIu32 " arg %" PRIu32 " differs\n",
+									p_kernel->p_name, ul_count, ul_src_off,
+									ul_dst_off, ul_arg);
+						}
+						ul_failed++;
+					}
+				}
+			}
+		}
+	}
+	printf("%-18s %6" PRIu32 " cases %s\n", p_kernel->p_name, ul_cases,
+			ul_failed ? "FAILED" : "ok");
+	return ul_failed;
+}
+
+int main(void)
+{
+	uint32_t ul_failed = 0;
+	size_t i;
+
+	for (i = 0; i < sizeof(g_kernels) / sizeof(g_kernels[0]); i++) {
+		ul_failed += test_kernel(&g_kernels[i]);
+	}
+	return ul_failed ? 1 : 0;
+}
@@ -0,0 +1,343 @@
+/**
+ * \file
+ *
+ * \brief Golden images and bus cost of the shapes of raster.c.
+ *
+ * Draws every shape black on white into a canvas of the compositor and
+ * compares it with host/golden/<name>.pbm, then draws it again straight to
+ * the LCD model and checks that the panel shows the same pixels. For each
+ * shape it prints the bytes and GRAM windows sent by the compositor flush,
+ * by the direct LCD path and, where the driver has one, by the old
+ * pixel-by-pixel ILI9488 primitive:
+ *
+ *   make -C host bench
+ *   cd host && build/raster_bench
+ *
+ * "-u" writes the golden images again instead of comparing them.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "host_hal.h"
+#include "hal.h"
+#include "panel.h"
+#include "ili9488.h"
+#include "compositor.h"
+#include "raster.h"
+
+#define BENCH_X     100
+#define BENCH_Y     100
+#define BENCH_SIZE  48
+#define BENCH_CX    (BENCH_X + BENCH_SIZE / 2)
+#define BENCH_CY    (BENCH_Y + BENCH_SIZE / 2)
+
+struct bench_case {
+	const char *p_name;
+	uint16_t us_thickness;
+	void (*draw)(const struct raster_style *p_style);
+	void (*old)(void);    //!< same shape with the ILI9488 driver, or NULL
+};
+
+struct bench_cost {
+	uint64_t ull_bytes;
+	uint64_t ull_windows;
+};
+
+static const char *g_p_golden_dir = "golden";
+static char g_c_canvas[BENCH_SIZE][BENCH_SIZE];
+
+static void draw_fill_circle(const struct raster_style *p_style)
+{
+	raster_fill_circle(p_style, BENCH_CX, BENCH_CY, 20);
+}
+
+static void old_fill_circle(void)
+{
+	ili9488_draw_filled_circle(BENCH_CX, BENCH_CY, 20);
+}
+
+static void draw_circle(const struct raster_style *p_style)
+{
+	raster_draw_circle(p_style, BENCH_CX, BENCH_CY, 20);
+}
+
+static void old_circle(void)
+{
+	ili9488_draw_circle(BENCH_CX, BENCH_CY, 20);
+}
+
+static void draw_arc(const struct raster_style *p_style)
+{
+	raster_draw_arc(p_style, BENCH_CX, BENCH_CY, 20, 30, 120);
+}
+
+static void draw_arc_wide(const struct raster_style *p_style)
+{
+	raster_draw_arc(p_style, BENCH_CX, BENCH_CY, 20, 300, 200);
+}
+
+static void draw_fill_round_rect(const struct raster_style *p_style)
+{
+	raster_fill_round_rect(p_style, BENCH_X + 4, BENCH_Y + 12,
+			BENCH_X + 43, BENCH_Y + 35, 6);
+}
+
+static void draw_round_rect(const struct raster_style *p_style)
+{
+	raster_draw_round_rect(p_style, BENCH_X + 4, BENCH_Y + 12,
+			BENCH_X + 43, BENCH_Y + 35, 6);
+}
+
+static void draw_line_shallow(const struct raster_style *p_style)
+{
+	raster_draw_line(p_style, BENCH_X + 8, BENCH_Y + 18,
+			BENCH_X + 38, BENCH_Y + 28);
+}
+
+static void old_line_shallow(void)
+{
+	ili9488_draw_line(BENCH_X + 8, BENCH_Y + 18, BENCH_X + 38, BENCH_Y + 28);
+}
+
+static void draw_line_steep(const struct raster_style *p_style)
+{
+	raster_draw_line(p_style, BENCH_X + 18, BENCH_Y + 8,
+			BENCH_X + 28, BENCH_Y + 38);
+}
+
+static void old_line_steep(void)
+{
+	ili9488_draw_line(BENCH_X + 18, BENCH_Y + 8, BENCH_X + 28, BENCH_Y + 38);
+}
+
+static void draw_line_thick(const struct raster_style *p_style)
+{
+	raster_draw_line(p_style, BENCH_X + 6, BENCH_Y + 34,
+			BENCH_X + 40, BENCH_Y + 12);
+}
+
+static void draw_line_flat(const struct raster_style *p_style)
+{
+	raster_draw_line(p_style, BENCH_X + 6, BENCH_CY, BENCH_X + 40, BENCH_CY);
+}
+
+static const struct bench_case g_cases[] = {
+	{ "fill_circle_r20",      1, draw_fill_circle,     old_fill_circle },
+	{ "circle_r20",           1, draw_circle,          old_circle },
+	{ "circle_r20_t4",        4, draw_circle,          NULL },
+	{ "arc_r20_30_120_t3",    3, draw_arc,             NULL },
+	{ "arc_r20_300_200_t3",   3, draw_arc_wide,        NULL },
+	{ "fill_round_rect_r6",   1, draw_fill_round_rect, NULL },
+	{ "round_rect_r6_t2",     2, draw_round_rect,      NULL },
+	{ "line_shallow",         1, draw_line_shallow,    old_line_shallow },
+	{ "line_steep",           1, draw_line_steep,      old_line_steep },
+	{ "line_thick_t5",        5, draw_line_thick,      NULL },
+	{ "line_flat_t3",         3, draw_line_flat,       NULL },
+};
+
+static void bench_clear_lcd(void)
+{
+	ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
+	ili9488_draw_filled_rectangle(BENCH_X, BENCH_Y, BENCH_X + BENCH_SIZE - 1,
+			BENCH_Y + BENCH_SIZE - 1);
+	ili9488_sync();
+	panel_reset_stats();
+}
+
+static void bench_cost(struct bench_cost *p_cost)
+{
+	struct panel_stats stats;
+
+	ili9488_sync();
+	panel_get_stats(&stats);
+	p_cost->ull_bytes = stats.ull_bytes;
+	p_cost->ull_windows = stats.ull_ram_writes;
+}
+
+static bool bench_read_golden(const char *p_path,
+		char c_golden[BENCH_SIZE][BENCH_SIZE])
+{
+	FILE *p_file = fopen(p_path, "r");
+	int x = 0, y = 0, c;
+	unsigned w, h;
+
+	if (!p_file) {
+		return false;
+	}
+	/* The name of the shape is on a comment line after the magic */
+	if ((fscanf(p_file, "P1 #%*[^\n] %u %u", &w, &h) != 2)
+			|| (w != BENCH_SIZE) || (h != BENCH_SIZE)) {
+		fclose(p_file);
+		return false;
+	}
+	while ((y < BENCH_SIZE) && ((c = fgetc(p_file)) != EOF)) {
+		if ((c != '0') && (c != '1')) {
+			continue;
+		}
+		c_golden[y][x] = (char)c;
+		if (++x == BENCH_SIZE) {
+			x = 0;
+			y++;
+		}
+	}
+	fclose(p_file);
+	return y == BENCH_SIZE;
+}
+
+static bool bench_write_golden(const char *p_path, const char *p_name)
+{
+	FILE *p_file = fopen(p_path, "w");
+	int y;
+
+	if (!p_file) {
+		return false;
+	}
+	fprintf(p_file, "P1\n# %s\n%d %d\n", p_name, BENCH_SIZE, BENCH_SIZE);
+	for (y = 0; y < BENCH_SIZE; y++) {
+		fprintf(p_file, "%.*s\n", BENCH_SIZE, g_c_canvas[y]);
+	}
+	return fclose(p_file) == 0;
+}
+
+/**
+ * \brief Check the canvas against its golden image, printing the first
+ * row that differs.
+ */
+static bool bench_check_golden(const char *p_name, bool b_update)
+{
+	static char c_golden[BENCH_SIZE][BENCH_SIZE];
+	char c_path[256];
+	int y;
+
+	snprintf(c_path, sizeof(c_path), "%s/%s.pbm", g_p_golden_dir, p_name);
+	if (b_update) {
+		if (!bench_write_golden(c_path, p_name)) {
+			fprintf(stderr, "%s: cannot write\n", c_path);
+			return false;
+		}
+		return true;
+	}
+	if (!bench_read_golden(c_path, c_golden)) {
+		fprintf(stderr, "%s: missing or not a %dx%d P1 image\n", c_path,
+				BENCH_SIZE, BENCH_SIZE);
+		return false;
+	}
+	for (y = 0; y < BENCH_SIZE; y++) {
+		if (memcmp(c_golden[y], g_c_canvas[y], BENCH_SIZE)) {
+			fprintf(stderr, "%s: row %d differs\n  golden %.*s\n  drawn  %.*s\n",
+					p_name, y, BENCH_SIZE, c_golden[y], BENCH_SIZE,
+					g_c_canvas[y]);
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool bench_run(const struct bench_case *p_case, bool b_update)
+{
+	struct raster_style style = {
+		.ul_color = COLOR_BLACK,
+		.ul_background = COLOR_WHITE,
+		.us_thickness = p_case->us_thickness,
+	};
+	struct bench_cost flush, lcd, old;
+	const uint16_t *p_us_fb = compositor_get_framebuffer();
+	bool b_ok;
+	int x, y;
+
+	/* Through the compositor */
+	compositor_fill_rect(BENCH_X, BENCH_Y, BENCH_X + BENCH_SIZE - 1,
+			BENCH_Y + BENCH_SIZE - 1, COLOR_WHITE);
+	compositor_flush();
+	ili9488_sync();
+	panel_reset_stats();
+	style.b_lcd = false;
+	p_case->draw(&style);
+	compositor_flush();
+	bench_cost(&flush);
+	for (y = 0; y < BENCH_SIZE; y++) {
+		for (x = 0; x < BENCH_SIZE; x++) {
+			g_c_canvas[y][x] = p_us_fb[(BENCH_Y + y) * ILI9488_LCD_WIDTH
+					+ BENCH_X + x] ? '0' : '1';
+		}
+	}
+	b_ok = bench_check_golden(p_case->p_name, b_update);
+
+	/* Straight to the LCD, background of the box included */
+	bench_clear_lcd();
+	style.b_lcd = true;
+	p_case->draw(&style);
+	bench_cost(&lcd);
+	for (y = 0; y < BENCH_SIZE; y++) {
+		for (x = 0; x < BENCH_SIZE; x++) {
+			char c = panel_get_shown_pixel(BENCH_X + x, BENCH_Y + y) ? '0' : '1';
+
+			if (b_ok && (c != g_c_canvas[y][x])) {
+				fprintf(stderr, "%s: LCD pixel %d,%d differs from the compositor\n",
+						p_case->p_name, x, y);
+				b_ok = false;
+			}
+		}
+	}
+
+	printf("%-20s %7" PRIu64 " B %3" PRIu64 " win  %7" PRIu64 " B %3" PRIu64
+			" win", p_case->p_name, flush.ull_bytes, flush.ull_windows,
+			lcd.ull_bytes, lcd.ull_windows);
+	if (p_case->old) {
+		bench_clear_lcd();
+		ili9488_set_foreground_color(COLOR_CONVERT(COLOR_BLACK));
+		p_case->old();
+		bench_cost(&old);
+		printf("  %7" PRIu64 " B %4" PRIu64 " win", old.ull_bytes,
+				old.ull_windows);
+	}
+	printf("%s\n", b_ok ? "" : "  FAILED");
+	return b_ok;
+}
+
+int main(int argc, char **argv)
+{
+	struct ili9488_opt_t opt = {
+		.ul_width = ILI9488_LCD_WIDTH,
+		.ul_height = ILI9488_LCD_HEIGHT,
+		.foreground_color = COLOR_CONVERT(COLOR_WHITE),
+		.background_color = COLOR_CONVERT(COLOR_WHITE),
+	};
+	bool b_update = false;
+	uint32_t ul_failed = 0;
+	size_t i;
+	int j;
+
+	for (j = 1; j < argc; j++) {
+		if (!strcmp(argv[j], "-u")) {
+			b_update = true;
+		} else if (!strcmp(argv[j], "-g") && (j + 1 < argc)) {
+			g_p_golden_dir = argv[++j];
+		} else {
+			fprintf(stderr, "usage: %s [-u] [-g golden_dir]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	hal_init();
+	panel_reset();
+	ili9488_init(&opt);
+	ili9488_display_on();
+	compositor_init(COLOR_WHITE);
+	compositor_flush();
+
+	printf("%-20s %-18s %-18s %s\n", "shape", "  compositor", "  direct LCD",
+			"  ILI9488 driver");
+	for (i = 0; i < sizeof(g_cases) / sizeof(g_cases[0]); i++) {
+		if (!bench_run(&g_cases[i], b_update)) {
+			ul_failed++;
+		}
+	}
+	if (ul_failed) {
+		fprintf(stderr, "%" PRIu32 " shapes failed\n", ul_failed);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,336 @@
+/**
+ * \file
+ *
+ * \brief State changes of the screen through scene.c, against the panel
+ * model.
+ *
+ * Builds the scene of main.c and walks it through what a wash does: lock,
+ * door, start, the timer ticking, pause and the end message. After each
+ * change it renders and flushes, then checks that the framebuffer only
+ * changed inside the nodes that should have (the frame diff), that the
+ * panel shows the framebuffer, and that repainting the whole screen from
+ * the scene changes nothing. It prints the area each change repainted and
+ * the pixels the panel was sent for it:
+ *
+ *   make -C host bench
+ *   host/build/scene_test
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include "host_hal.h"
+#include "hal.h"
+#include "panel.h"
+#include "ili9488.h"
+#include "compositor.h"
+#include "text.h"
+#include "scene.h"
+#include "calibri_36.h"
+#include "icons/Play.h"
+#include "icons/Pause.h"
+#include "icons/lock.h"
+#include "icons/unlock.h"
+#include "icons/porta.h"
+#include "icons/ON.h"
+
+/* Where main.c stops the drum */
+#define TEST_DRUM_X1   104
+#define TEST_DRUM_Y1   8
+#define TEST_DRUM_X2   146
+#define TEST_DRUM_Y2   50
+
+#define TEST_MINUTES   60
+#define TEST_MAX_RECTS 8
+
+struct test_ui {
+	struct scene_node *p_status;
+	struct scene_node *p_running;
+	struct scene_node *p_timer;
+	struct scene_node *p_total;
+	struct scene_node *p_progress;
+	struct scene_node *p_done;
+	struct scene_node *p_end[2];
+	struct scene_node *p_lock;
+	struct scene_node *p_play;
+};
+
+static struct test_ui ui;
+static uint16_t g_us_before[COMPOSITOR_WIDTH * COMPOSITOR_HEIGHT];
+static struct compositor_rect g_expect[TEST_MAX_RECTS];
+static uint32_t g_ul_expect;
+static uint32_t g_ul_failed;
+
+static void test_check(bool b_ok, const char *p_what)
+{
+	if (!b_ok) {
+		printf("  FAILED: %s\n", p_what);
+		g_ul_failed++;
+	}
+}
+
+/**
+ * \brief The same scene as ui_scene_init() of main.c.
+ */
+static void test_scene_init(void)
+{
+	struct text_style label = {&calibri_36, COLOR_WHITE, 2, TEXT_ALIGN_LEFT, false, COLOR_BLACK};
+	struct text_style timer = {&calibri_36, COLOR_WHITE, 2, TEXT_ALIGN_CENTER, true, COLOR_BLACK};
+	uint32_t h = text_get_height(&label, "0");
+
+	scene_init(COLOR_WHITE);
+
+	ui.p_status = scene_icon_new(NULL, 0, 0, &ON);
+	scene_set_visible(ui.p_status, false);
+
+	ui.p_running = scene_group_new(NULL);
+	scene_set_visible(ui.p_running, false);
+	ui.p_timer = scene_label_new(ui.p_running, &timer, 175, 20, 300, 20 + h - 1);
+	ui.p_total = scene_label_new(ui.p_running, &label, 100, 60,
+			ILI9488_LCD_WIDTH - 1, 60 + h - 1);
+	ui.p_progress = scene_bar_new(ui.p_running, 0, 60 + h, ILI9488_LCD_WIDTH - 1,
+			99, COLOR_BLACK, COLOR_WHITE);
+
+	ui.p_done = scene_group_new(NULL);
+	scene_set_visible(ui.p_done, false);
+	ui.p_end[0] = scene_label_new(ui.p_done, &label, 60, 10,
+			60 + text_get_width(&label, "LAVAGEM ") - 1, 10 + h - 1);
+	scene_label_set_text(ui.p_end[0], "LAVAGEM ");
+	ui.p_end[1] = scene_label_new(ui.p_done, &label, 60, 45,
+			60 + text_get_width(&label, "CONCLUÍDA!") - 1, 45 + h - 1);
+	scene_label_set_text(ui.p_end[1], "CONCLUÍDA!");
+
+	ui.p_lock = scene_button_new(NULL, 248, 328, &unlock, &lock);
+	ui.p_play = scene_button_new(NULL, 128, 410, &Play, &pause);
+}
+
+static void test_timer(uint32_t ul_s)
+{
+	char c_buffer[16];
+
+	sprintf(c_buffer, "%02" PRIu32 ":%02" PRIu32, ul_s / 60, ul_s % 60);
+	scene_label_set_text(ui.p_timer, c_buffer);
+	scene_bar_set_value(ui.p_progress, ul_s, TEST_MINUTES * 60);
+}
+
+/**
+ * \brief Allow the next change to alter the pixels of a node.
+ */
+static void test_expect(struct scene_node *p_node)
+{
+	if (g_ul_expect < TEST_MAX_RECTS) {
+		scene_get_bounds(p_node, &g_expect[g_ul_expect++]);
+	}
+}
+
+static void test_expect_rect(uint32_t ul_x1, uint32_t ul_y1, uint32_t ul_x2,
+		uint32_t ul_y2)
+{
+	struct compositor_rect rect = { ul_x1, ul_y1, ul_x2, ul_y2 };
+
+	if (g_ul_expect < TEST_MAX_RECTS) {
+		g_expect[g_ul_expect++] = rect;
+	}
+}
+
+static bool test_expected(uint32_t x, uint32_t y)
+{
+	uint32_t i;
+
+	for (i = 0; i < g_ul_expect; i++) {
+		if ((x >= g_expect[i].x1) && (x <= g_expect[i].x2)
+				&& (y >= g_expect[i].y1) && (y <= g_expect[i].y2)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static uint64_t test_flush(void)
+{
+	struct panel_stats stats;
+
+	panel_reset_stats();
+	compositor_flush();
+	ili9488_sync();
+	panel_get_stats(&stats);
+	return stats.ull_pixels;
+}
+
+/**
+ * \brief Render the change made since the last step and check it.
+ *
+ * \param ul_changed_min pixels that must at least have changed.
+ */
+static void test_step(const char *p_name, uint32_t ul_changed_min)
+{
+	const uint16_t *p_us_fb = compositor_get_framebuffer();
+	struct scene_stats stats;
+	uint32_t x, y, c, ul_changed = 0, ul_stray = 0, ul_unshown = 0;
+	uint64_t ull_sent;
+
+	scene_reset_stats();
+	scene_render();
+	ull_sent = test_flush();
+	scene_get_stats(&stats);
+
+	for (y = 0; y < COMPOSITOR_HEIGHT; y++) {
+		for (x = 0; x < COMPOSITOR_WIDTH; x++) {
+			c = y * COMPOSITOR_WIDTH + x;
+			if (p_us_fb[c] != g_us_before[c]) {
+				ul_changed++;
+				ul_stray += test_expected(x, y) ? 0 : 1;
+			}
+			c = panel_get_shown_pixel(x, y);
+			ul_unshown += (COMPOSITOR_RGB565(c) != p_us_fb[y * COMPOSITOR_WIDTH + x])
+					? 1 : 0;
+		}
+	}
+	printf("%-22s %5" PRIu32 " %6" PRIu32 " %8" PRIu32 " %8" PRIu32 " %8" PRIu64 "\n",
+			p_name, stats.ul_damaged, stats.ul_painted, stats.ul_pixels,
+			ul_changed, ull_sent);
+	test_check(!ul_stray, "pixels changed outside the nodes changed");
+	test_check(ul_changed >= ul_changed_min, "change not painted");
+	test_check(!ul_unshown, "panel differs from the framebuffer");
+	test_check(!scene_is_dirty(), "scene still dirty after the render");
+
+	/* Everything painted again from the scene: not a pixel differs. What
+	 * overlapping nodes paint over each other may still be sent */
+	memcpy(g_us_before, p_us_fb, sizeof(g_us_before));
+	scene_invalidate(0, 0, COMPOSITOR_WIDTH - 1, COMPOSITOR_HEIGHT - 1);
+	scene_render();
+	test_check(!memcmp(g_us_before, p_us_fb, sizeof(g_us_before)),
+			"full repaint differs from the partial ones");
+	test_flush();
+	g_ul_expect = 0;
+}
+
+int main(void)
+{
+	struct ili9488_opt_t opt = {
+		.ul_width = ILI9488_LCD_WIDTH,
+		.ul_height = ILI9488_LCD_HEIGHT,
+		.foreground_color = COLOR_CONVERT(COLOR_WHITE),
+		.background_color = COLOR_CONVERT(COLOR_WHITE),
+	};
+	char c_buffer[32];
+	uint32_t ul_s;
+
+	hal_init();
+	panel_reset();
+	if (ili9488_init(&opt)) {
+		printf("LCD not found\n");
+		return 1;
+	}
+	ili9488_display_on();
+	compositor_init(COLOR_WHITE);
+	test_flush();
+	memcpy(g_us_before, compositor_get_framebuffer(), sizeof(g_us_before));
+
+	printf("%" PRIu32 " pixels for a full screen\n",
+			(uint32_t)COMPOSITOR_WIDTH * COMPOSITOR_HEIGHT);
+	printf("%-22s %5s %6s %8s %8s %8s\n", "change", "areas", "nodes",
+			"repaint", "changed", "sent");
+
+	test_scene_init();
+	test_expect(ui.p_lock);
+	test_expect(ui.p_play);
+	test_step("boot", 1);
+
+	scene_button_set_state(ui.p_lock, true);
+	test_expect(ui.p_lock);
+	test_step("lock", 1);
+	scene_button_set_state(ui.p_lock, false);
+	test_expect(ui.p_lock);
+	test_step("unlock", 1);
+
+	/* Play with the door open */
+	scene_icon_set_image(ui.p_status, &porta);
+	scene_set_visible(ui.p_status, true);
+	test_expect(ui.p_status);
+	test_step("door open", 1);
+
+	/* play_clicked(): start */
+	scene_icon_set_image(ui.p_status, &ON);
+	scene_button_set_state(ui.p_play, true);
+	scene_set_visible(ui.p_running, true);
+	sprintf(c_buffer, "Total: %d min", TEST_MINUTES);
+	scene_label_set_text(ui.p_total, c_buffer);
+	test_timer(0);
+	test_expect(ui.p_status);
+	test_expect(ui.p_play);
+	test_expect(ui.p_timer);
+	test_expect(ui.p_total);
+	test_expect(ui.p_progress);
+	test_step("start", 1);
+
+	/* A second, then the first column of the bar */
+	test_timer(1);
+	test_expect(ui.p_timer);
+	test_step("tick 00:01", 1);
+	for (ul_s = 2; ul_s < 12; ul_s++) {
+		test_timer(ul_s);
+		scene_render();
+	}
+	test_flush();
+	memcpy(g_us_before, compositor_get_framebuffer(), sizeof(g_us_before));
+	test_timer(12);
+	test_expect(ui.p_timer);
+	test_expect(ui.p_progress);
+	test_step("tick 00:12", 1);
+
+	/* The same string again */
+	test_timer(12);
+	test_step("no change", 0);
+
+	/* Pause: the drum was left on the screen by anim.c */
+	compositor_fill_rect(TEST_DRUM_X1, TEST_DRUM_Y1, TEST_DRUM_X2, TEST_DRUM_Y2,
+			COLOR_BLACK);
+	test_flush();
+	memcpy(g_us_before, compositor_get_framebuffer(), sizeof(g_us_before));
+	scene_set_visible(ui.p_status, false);
+	scene_button_set_state(ui.p_play, false);
+	scene_set_visible(ui.p_running, false);
+	scene_invalidate(TEST_DRUM_X1, TEST_DRUM_Y1, TEST_DRUM_X2, TEST_DRUM_Y2);
+	test_expect(ui.p_status);
+	test_expect(ui.p_play);
+	test_expect(ui.p_timer);
+	test_expect(ui.p_total);
+	test_expect(ui.p_progress);
+	test_expect_rect(TEST_DRUM_X1, TEST_DRUM_Y1, TEST_DRUM_X2, TEST_DRUM_Y2);
+	test_step("pause", 1);
+
+	/* Resumed, then the end of the cycle */
+	scene_set_visible(ui.p_status, true);
+	scene_button_set_state(ui.p_play, true);
+	scene_set_visible(ui.p_running, true);
+	test_timer(TEST_MINUTES * 60 - 1);
+	test_expect(ui.p_status);
+	test_expect(ui.p_play);
+	test_expect(ui.p_timer);
+	test_expect(ui.p_total);
+	test_expect(ui.p_progress);
+	test_step("resume at 59:59", 1);
+
+	scene_set_visible(ui.p_status, false);
+	scene_button_set_state(ui.p_play, false);
+	scene_set_visible(ui.p_running, false);
+	scene_set_visible(ui.p_done, true);
+	test_expect(ui.p_status);
+	test_expect(ui.p_play);
+	test_expect(ui.p_timer);
+	test_expect(ui.p_total);
+	test_expect(ui.p_progress);
+	test_expect(ui.p_end[0]);
+	test_expect(ui.p_end[1]);
+	test_step("end", 1);
+
+	/* The end message hidden again by the next start */
+	scene_set_visible(ui.p_done, false);
+	test_expect(ui.p_end[0]);
+	test_expect(ui.p_end[1]);
+	test_step("end message hidden", 1);
+
+	printf("%s\n", g_ul_failed ? "FAILED" : "ok");
+	return g_ul_failed ? 1 : 0;
+}
@@ -0,0 +1,613 @@
+/**
+ * \file
+ *
+ * \brief Host simulator entry point, virtual clock and script runner.
+ *
+ * The firmware main() is built as firmware_main() and runs unmodified. Time
+ * is virtual: it only advances in delay_ms() and when the firmware is idle,
+ * that is when it sleeps (__WFI() or pmc_sleep()) twice in a row without any
+ * bus traffic or interrupt in between. Each idle point runs one step: the
+ * next due timer interrupt, the next replayed message, or the next script
+ * command.
+ *
+ * Script commands, one per line, '#' starts a comment:
+ *
+ *   wait <ms>                 let the timers run for <ms>
+ *   tap <x> <y>               press and release at an LCD position
+ *   press|move|release <x> <y>
+ *   pin <A..E> <index> rise|fall
+ *   replay <file>             queue recorded T5 messages on the virtual clock
+ *   trace <file>              queue touch reports on the virtual clock
+ *   dump <file.ppm>           write what the panel shows
+ *   verify                    check that the panel shows the compositor
+ *                             framebuffer (after a wait, once it is flushed)
+ *   stats                     print the bus, touch, frame, display list,
+ *                             animation, glyph cache and scene counters
+ *                             and the display modes
+ *   reset_stats
+ *   dlist on|off              cull and merge the display lists or replay
+ *                             them as recorded, to compare the traffic
+ *   capture <file>|off        start the screen capture, with what the
+ *                             firmware writes to the USART going to
+ *                             <file>, or stop it and go back to stdout;
+ *                             stats prints its counters once started
+ *   quit
+ *
+ * Positions are portrait LCD pixels; they are converted to sensor
+ * coordinates with the inverse of the mapping of the application.
+ *
+ * A replay file holds one message per line, '#' starts a comment:
+ *
+ *   <ms> <report id> <7 message bytes>
+ *
+ * with the time in milliseconds from the replay command and the bytes in
+ * hexadecimal, as read from T5 without the CRC. Messages with the same time
+ * are queued together, so they are read in one burst. The script resumes
+ * once the last message has been queued.
+ *
+ * A trace file is played the same way but holds touch reports, which are
+ * easier to write by hand than raw messages:
+ *
+ *   <ms> <touch id> <x> <y> <T9 status>
+ *
+ * with the position in LCD pixels and the status in hexadecimal (c0 press,
+ * 90 move, 20 release).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "host_hal.h"
+#include "sim.h"
+#include "hal.h"
+#include "panel.h"
+#include "mxt_model.h"
+#include "mxt_async.h"
+#include "ili9488_te.h"
+#include "compositor.h"
+#include "displaylist.h"
+#include "capture.h"
+#include "anim.h"
+#include "glyphcache.h"
+#include "scene.h"
+
+#define SIM_LINE_SIZE 256
+#define SIM_REPLAY_SIZE 1024
+
+struct sim_replay_msg {
+	uint32_t ul_ms;
+	uint8_t uc_msg[8];
+};
+
+int firmware_main(void);
+
+static FILE *g_p_script;
+static const char *g_p_script_name;
+static const char *g_p_out_dir = ".";
+static FILE *g_p_capture;
+static bool g_b_captured;
+static uint32_t g_ul_line;
+
+static uint64_t g_ull_now_us;
+static uint64_t g_ull_wait_until_us;
+static bool g_b_activity = true;
+
+static struct sim_replay_msg g_replay[SIM_REPLAY_SIZE];
+static uint32_t g_ul_replay_count;
+static uint32_t g_ul_replay_next;
+static uint64_t g_ull_replay_origin_us;
+
+uint64_t sim_now_us(void)
+{
+	return g_ull_now_us;
+}
+
+/**
+ * \brief Advance the clock, running the timer interrupts on the way.
+ */
+void sim_delay_us(uint64_t ull_us)
+{
+	uint64_t ull_target = g_ull_now_us + ull_us;
+	uint64_t ull_next;
+
+	while ((ull_next = hal_next_timer_us()) <= ull_target) {
+		g_ull_now_us = Max(g_ull_now_us, ull_next);
+		hal_run_timers(g_ull_now_us);
+	}
+	/* A handler may have spent bus time past the target already */
+	g_ull_now_us = Max(g_ull_now_us, ull_target);
+}
+
+/**
+ * \brief Record that the firmware did something since the last idle point.
+ */
+void sim_activity(void)
+{
+	g_b_activity = true;
+}
+
+static void sim_print_stats(FILE *p_out)
+{
+	struct panel_stats stats;
+	struct mxt_async_stats touch;
+	struct ili9488_te_stats frames;
+	struct displaylist_stats dlist;
+	struct capture_stats capture;
+	struct anim_stats anim;
+	struct glyph_cache_stats glyphs;
+	struct scene_stats scene;
+	uint32_t ul_baud = hal_spi_baudrate();
+	uint16_t us_start, us_end;
+	bool b_partial;
+	uint32_t i;
+
+	panel_get_stats(&stats);
+	mxt_async_get_stats(&touch);
+	ili9488_te_get_stats(&frames);
+	displaylist_get_stats(&dlist);
+	fprintf(p_out, "[sim] t=%" PRIu64 ".%03" PRIu64 " s bytes=%" PRIu64
+			" commands=%" PRIu64 " pixels=%" PRIu64 " ramwr=%" PRIu64
+			" windows=%" PRIu64 " scrolls=%" PRIu64 " early=%" PRIu64
+			" bus=%" PRIu64 " us\n",
+			g_ull_now_us / 1000000, (g_ull_now_us / 1000) % 1000,
+			stats.ull_bytes, stats.ull_commands, stats.ull_pixels,
+			stats.ull_ram_writes, stats.ull_window_sets, stats.ull_scrolls,
+			stats.ull_early_commands,
+			ul_baud ? stats.ull_bytes * 8 * 1000000 / ul_baud : 0);
+	fprintf(p_out, "[sim] touch transactions=%" PRIu32 " messages=%" PRIu32
+			" events=%" PRIu32 " dropped=%" PRIu32 " errors=%" PRIu32 "\n",
+			touch.ul_transactions, touch.ul_messages, touch.ul_touch_events,
+			touch.ul_dropped, touch.ul_errors);
+	fprintf(p_out, "[sim] frames rendered=%" PRIu32 " dropped=%" PRIu32
+			" vsyncs=%" PRIu32 " waits=%" PRIu32 " unpaced=%" PRIu32 " late=[",
+			frames.ul_frames, frames.ul_dropped, frames.ul_vsyncs,
+			frames.ul_waits, frames.ul_unpaced);
+	for (i = 0; i < ILI9488_TE_LATE_BUCKETS; i++) {
+		fprintf(p_out, i ? " %" PRIu32 : "%" PRIu32, frames.ul_late[i]);
+	}
+	fprintf(p_out, "] updates=%" PRIu64 " torn=%" PRIu64 "\n",
+			stats.ull_updates, stats.ull_torn_updates);
+	fprintf(p_out, "[sim] dlist lists=%" PRIu32 " commands=%" PRIu32
+			" culled=%" PRIu32 " trimmed=%" PRIu32 " merged=%" PRIu32
+			" replayed=%" PRIu32 " pixels=%" PRIu32 "/%" PRIu32 "\n",
+			dlist.ul_lists, dlist.ul_commands, dlist.ul_culled,
+			dlist.ul_trimmed, dlist.ul_merged, dlist.ul_replayed,
+			dlist.ul_pixels_replayed, dlist.ul_pixels_recorded);
+	b_partial = panel_get_partial(&us_start, &us_end);
+	fprintf(p_out, "[sim] display idle=%s partial=", panel_is_idle() ? "on" : "off");
+	fprintf(p_out, b_partial ? "%u-%u" : "off", us_start, us_end);
+	fprintf(p_out, " brightness=%u mode_changes=%" PRIu64 "\n",
+			panel_get_brightness(), stats.ull_mode_changes);
+	anim_get_stats(&anim);
+	fprintf(p_out, "[sim] anim frames=%" PRIu32 " skipped=%" PRIu32
+			" bytes=%" PRIu32 " pixels=%" PRIu32 " max_bytes=%" PRIu32 "\n",
+			anim.ul_frames, anim.ul_skipped, anim.ul_bytes, anim.ul_pixels,
+			anim.ul_max_bytes);
+	glyph_cache_get_stats(&glyphs);
+	fprintf(p_out, "[sim] glyphs hits=%" PRIu32 " misses=%" PRIu32
+			" evictions=%" PRIu32 " bypassed=%" PRIu32 " busy=%" PRIu32 "\n",
+			glyphs.ul_hits, glyphs.ul_misses, glyphs.ul_evictions,
+			glyphs.ul_bypassed, glyphs.ul_busy);
+	scene_get_stats(&scene);
+	fprintf(p_out, "[sim] scene renders=%" PRIu32 " damaged=%" PRIu32
+			" pixels=%" PRIu32 " painted=%" PRIu32 "\n",
+			scene.ul_renders, scene.ul_damaged, scene.ul_pixels,
+			scene.ul_painted);
+	if (g_b_captured) {
+		capture_get_stats(&capture);
+		fprintf(p_out, "[sim] capture frames=%" PRIu32 " keyframes=%" PRIu32
+				" packets=%" PRIu32 " bytes=%" PRIu32 " pixels=%" PRIu32
+				" text=%" PRIu32 " dropped=%" PRIu32 "\n",
+				capture.ul_frames, capture.ul_keyframes, capture.ul_packets,
+				capture.ul_bytes, capture.ul_pixels, capture.ul_text_bytes,
+				capture.ul_text_dropped);
+	}
+}
+
+static void sim_exit(int code)
+{
+	fflush(stdout);
+	sim_print_stats(stderr);
+	exit(code);
+}
+
+static void sim_error(const char *p_msg)
+{
+	fprintf(stderr, "%s:%u: %s\n", g_p_script_name, g_ul_line, p_msg);
+	sim_exit(1);
+}
+
+/* Inverse of convert_axis_system_x/y of main.c */
+static void sim_lcd_to_sensor(int32_t l_x, int32_t l_y, uint16_t *p_us_x,
+		uint16_t *p_us_y)
+{
+	int32_t l_tx = (l_y * 4096 + PANEL_HEIGHT - 1) / PANEL_HEIGHT;
+	int32_t l_ty = ((PANEL_WIDTH - l_x) * 4096 + PANEL_WIDTH - 1) / PANEL_WIDTH;
+
+	*p_us_x = (uint16_t)Min(Max(l_tx, 0), 4095);
+	*p_us_y = (uint16_t)Min(Max(l_ty, 0), 4095);
+}
+
+static void sim_touch(uint8_t uc_status, const char *p_args)
+{
+	int32_t l_x, l_y;
+	uint16_t us_x, us_y;
+
+	if (sscanf(p_args, "%" SCNd32 " %" SCNd32, &l_x, &l_y) != 2) {
+		sim_error("expected <x> <y>");
+	}
+	sim_lcd_to_sensor(l_x, l_y, &us_x, &us_y);
+	mxt_model_touch(0, uc_status, us_x, us_y);
+	hal_chg_update();
+}
+
+static void sim_pin(const char *p_args)
+{
+	char c_port, edge[8];
+	uint32_t ul_index;
+
+	if ((sscanf(p_args, " %c %" SCNu32 " %7s", &c_port, &ul_index, edge) != 3)
+			|| (c_port < 'A') || (c_port > 'E') || (ul_index > 31)) {
+		sim_error("expected pin <A..E> <index> rise|fall");
+	}
+	hal_pin_edge(c_port - 'A', ul_index, strcmp(edge, "rise") == 0);
+}
+
+/* Output file names are relative to the -o directory */
+static void sim_out_path(char *p_path, size_t size, const char *p_name)
+{
+	if (p_name[0] == '/') {
+		snprintf(p_path, size, "%s", p_name);
+	} else {
+		snprintf(p_path, size, "%s/%s", g_p_out_dir, p_name);
+	}
+}
+
+static void sim_dump(const char *p_args)
+{
+	char path[SIM_LINE_SIZE * 2];
+	char name[SIM_LINE_SIZE];
+
+	if (sscanf(p_args, "%255s", name) != 1) {
+		sim_error("expected dump <file>");
+	}
+	sim_out_path(path, sizeof(path), name);
+	if (!panel_dump_ppm(path)) {
+		sim_error("cannot write the frame dump");
+	}
+	fprintf(stderr, "[sim] t=%" PRIu64 " ms dump %s\n", g_ull_now_us / 1000, path);
+}
+
+/**
+ * \brief Compare what the panel shows with the compositor framebuffer.
+ *
+ * Pixels are compared in RGB565, the precision of the framebuffer.
+ */
+static void sim_verify(void)
+{
+	const uint16_t *p_us_fb = compositor_get_framebuffer();
+	uint32_t x, y, c, ul_mismatch = 0, ul_x = 0, ul_y = 0;
+	uint16_t us_shown;
+
+	for (y = 0; y < COMPOSITOR_HEIGHT; y++) {
+		for (x = 0; x < COMPOSITOR_WIDTH; x++) {
+			c = panel_get_shown_pixel(x, y);
+			us_shown = (uint16_t)(((c >> 8) & 0xF800) | ((c >> 5) & 0x07E0)
+					| ((c >> 3) & 0x001F));
+			if (us_shown != p_us_fb[y * COMPOSITOR_WIDTH + x]) {
+				if (!ul_mismatch++) {
+					ul_x = x;
+					ul_y = y;
+				}
+			}
+		}
+	}
+	fprintf(stderr, "[sim] t=%" PRIu64 " ms verify: %" PRIu32
+			" pixels differ", g_ull_now_us / 1000, ul_mismatch);
+	if (ul_mismatch) {
+		fprintf(stderr, ", first at %" PRIu32 ",%" PRIu32 "\n", ul_x, ul_y);
+		sim_error("the panel does not show the framebuffer");
+	}
+	fprintf(stderr, "\n");
+}
+
+static void sim_dlist(const char *p_args)
+{
+	char mode[8];
+
+	if ((sscanf(p_args, "%7s", mode) != 1)
+			|| (strcmp(mode, "on") && strcmp(mode, "off"))) {
+		sim_error("expected dlist on|off");
+	}
+	displaylist_set_enabled(!strcmp(mode, "on"));
+}
+
+/* Parse a replay line into p_msg */
+static void sim_capture(const char *p_args)
+{
+	char path[SIM_LINE_SIZE * 2];
+	char name[SIM_LINE_SIZE];
+
+	if (sscanf(p_args, "%255s", name) != 1) {
+		sim_error("expected capture <file>|off");
+	}
+	if (!strcmp(name, "off")) {
+		if (!g_p_capture) {
+			sim_error("capture not started");
+		}
+		/* The ring is written out as it fills: it is empty already, the
+		 * poll only ends the stop */
+		capture_stop();
+		capture_poll((uint32_t)(g_ull_now_us / 1000));
+		hal_usart_set_output(NULL);
+		fclose(g_p_capture);
+		g_p_capture = NULL;
+		fprintf(stderr, "[sim] t=%" PRIu64 " ms capture off\n", g_ull_now_us / 1000);
+		return;
+	}
+	if (g_p_capture) {
+		sim_error("capture already started");
+	}
+	sim_out_path(path, sizeof(path), name);
+	if ((g_p_capture = fopen(path, "wb")) == NULL) {
+		sim_error("cannot write the capture");
+	}
+	hal_usart_set_output(g_p_capture);
+	capture_start();
+	g_b_captured = true;
+	fprintf(stderr, "[sim] t=%" PRIu64 " ms capture %s\n", g_ull_now_us / 1000, path);
+}
+
+static bool sim_replay_parse(const char *p_line, struct sim_replay_msg *p_msg)
+{
+	return sscanf(p_line, "%" SCNu32 " %hhx %hhx %hhx %hhx %hhx %hhx %hhx %hhx",
+			&p_msg->ul_ms, &p_msg->uc_msg[0], &p_msg->uc_msg[1],
+			&p_msg->uc_msg[2], &p_msg->uc_msg[3], &p_msg->uc_msg[4],
+			&p_msg->uc_msg[5], &p_msg->uc_msg[6], &p_msg->uc_msg[7]) == 9;
+}
+
+/* Parse a trace line into the T9 message it stands for */
+static bool sim_trace_parse(const char *p_line, struct sim_replay_msg *p_msg)
+{
+	uint32_t ul_id;
+	int32_t l_x, l_y;
+	uint8_t uc_status;
+	uint16_t us_x, us_y;
+
+	if (sscanf(p_line, "%" SCNu32 " %" SCNu32 " %" SCNd32 " %" SCNd32 " %hhx",
+			&p_msg->ul_ms, &ul_id, &l_x, &l_y, &uc_status) != 5) {
+		return false;
+	}
+	sim_lcd_to_sensor(l_x, l_y, &us_x, &us_y);
+	mxt_model_t9_message(p_msg->uc_msg, (uint8_t)ul_id, uc_status, us_x, us_y);
+	return true;
+}
+
+/**
+ * \brief Load a replay or trace file and start playing it.
+ *
+ * \param b_trace true for a trace file.
+ */
+static void sim_replay_load(const char *p_args, bool b_trace)
+{
+	char name[SIM_LINE_SIZE];
+	char line[SIM_LINE_SIZE];
+	struct sim_replay_msg *p_msg;
+	FILE *p_file;
+	uint32_t ul_line = 0;
+	char *p_hash;
+	int n;
+
+	if (sscanf(p_args, "%255s", name) != 1) {
+		sim_error(b_trace ? "expected trace <file>" : "expected replay <file>");
+	}
+	if ((p_file = fopen(name, "r")) == NULL) {
+		sim_error("cannot open the replay file");
+	}
+
+	g_ul_replay_count = 0;
+	g_ul_replay_next = 0;
+	g_ull_replay_origin_us = g_ull_now_us;
+	while (fgets(line, sizeof(line), p_file)) {
+		ul_line++;
+		if ((p_hash = strchr(line, '#')) != NULL) {
+			*p_hash = '\0';
+		}
+		if (sscanf(line, " %n", &n), line[n] == '\0') {
+			continue;
+		}
+		if (g_ul_replay_count == SIM_REPLAY_SIZE) {
+			sim_error("replay file too long");
+		}
+		p_msg = &g_replay[g_ul_replay_count];
+		if (b_trace ? !sim_trace_parse(line, p_msg)
+				: !sim_replay_parse(line, p_msg)) {
+			fprintf(stderr, "%s:%" PRIu32 ": expected %s\n", name, ul_line,
+					b_trace ? "<ms> <touch id> <x> <y> <status>"
+					: "<ms> <report id> <7 bytes>");
+			sim_exit(1);
+		}
+		if (g_ul_replay_count
+				&& (p_msg->ul_ms < g_replay[g_ul_replay_count - 1].ul_ms)) {
+			fprintf(stderr, "%s:%" PRIu32 ": time goes backwards\n", name, ul_line);
+			sim_exit(1);
+		}
+		g_ul_replay_count++;
+	}
+	fclose(p_file);
+	fprintf(stderr, "[sim] t=%" PRIu64 " ms %s %s, %" PRIu32 " messages\n",
+			g_ull_now_us / 1000, b_trace ? "trace" : "replay", name,
+			g_ul_replay_count);
+}
+
+/**
+ * \brief Advance to the next replayed message and queue every message due.
+ */
+static void sim_replay_step(void)
+{
+	uint64_t ull_due = g_ull_replay_origin_us
+			+ (uint64_t)g_replay[g_ul_replay_next].ul_ms * 1000;
+	uint64_t ull_next = hal_next_timer_us();
+
+	if (ull_next < ull_due) {
+		g_ull_now_us = Max(g_ull_now_us, ull_next);
+		hal_run_timers(g_ull_now_us);
+		return;
+	}
+	g_ull_now_us = Max(g_ull_now_us, ull_due);
+	while ((g_ul_replay_next < g_ul_replay_count)
+			&& (g_ull_replay_origin_us
+					+ (uint64_t)g_replay[g_ul_replay_next].ul_ms * 1000
+					<= g_ull_now_us)) {
+		mxt_model_message(g_replay[g_ul_replay_next++].uc_msg);
+	}
+	hal_chg_update();
+}
+
+/**
+ * \brief Run script commands until one of them gives the firmware work.
+ */
+static void sim_run_script(void)
+{
+	char line[SIM_LINE_SIZE];
+	char cmd[16];
+	char *p_args;
+	int n;
+	uint32_t ul_ms;
+
+	while (fgets(line, sizeof(line), g_p_script)) {
+		g_ul_line++;
+		if ((p_args = strchr(line, '#')) != NULL) {
+			*p_args = '\0';
+		}
+		if (sscanf(line, "%15s%n", cmd, &n) != 1) {
+			continue;
+		}
+		p_args = line + n;
+
+		if (!strcmp(cmd, "wait")) {
+			if (sscanf(p_args, "%" SCNu32, &ul_ms) != 1) {
+				sim_error("expected wait <ms>");
+			}
+			g_ull_wait_until_us = g_ull_now_us + (uint64_t)ul_ms * 1000;
+			return;
+		} else if (!strcmp(cmd, "tap")) {
+			sim_touch(MXT_MODEL_PRESS, p_args);
+			sim_touch(MXT_MODEL_RELEASE, p_args);
+			return;
+		} else if (!strcmp(cmd, "press")) {
+			sim_touch(MXT_MODEL_PRESS, p_args);
+			return;
+		} else if (!strcmp(cmd, "move")) {
+			sim_touch(MXT_MODEL_MOVE, p_args);
+			return;
+		} else if (!strcmp(cmd, "release")) {
+			sim_touch(MXT_MODEL_RELEASE, p_args);
+			return;
+		} else if (!strcmp(cmd, "pin")) {
+			sim_pin(p_args);
+			return;
+		} else if (!strcmp(cmd, "replay")) {
+			sim_replay_load(p_args, false);
+			return;
+		} else if (!strcmp(cmd, "trace")) {
+			sim_replay_load(p_args, true);
+			return;
+		} else if (!strcmp(cmd, "dump")) {
+			sim_dump(p_args);
+		} else if (!strcmp(cmd, "verify")) {
+			sim_verify();
+		} else if (!strcmp(cmd, "stats")) {
+			sim_print_stats(stderr);
+		} else if (!strcmp(cmd, "reset_stats")) {
+			panel_reset_stats();
+			displaylist_reset_stats();
+			anim_reset_stats();
+			glyph_cache_reset_stats();
+			scene_reset_stats();
+		} else if (!strcmp(cmd, "dlist")) {
+			sim_dlist(p_args);
+		} else if (!strcmp(cmd, "capture")) {
+			sim_capture(p_args);
+		} else if (!strcmp(cmd, "quit")) {
+			break;
+		} else {
+			sim_error("unknown command");
+		}
+	}
+	sim_exit(0);
+}
+
+/**
+ * \brief Idle point of the firmware: run the next simulation step.
+ */
+void sim_idle(void)
+{
+	uint64_t ull_next;
+
+	/* Give the main loop one more pass to finish what it started */
+	if (g_b_activity) {
+		g_b_activity = false;
+		return;
+	}
+	g_b_activity = true;
+
+	if (g_ul_replay_next < g_ul_replay_count) {
+		sim_replay_step();
+		return;
+	}
+	if (g_ull_wait_until_us > g_ull_now_us) {
+		ull_next = hal_next_timer_us();
+		if (ull_next <= g_ull_wait_until_us) {
+			g_ull_now_us = Max(g_ull_now_us, ull_next);
+			hal_run_timers(g_ull_now_us);
+		} else {
+			g_ull_now_us = g_ull_wait_until_us;
+		}
+		return;
+	}
+	sim_run_script();
+}
+
+static void sim_usage(const char *p_prog)
+{
+	fprintf(stderr, "usage: %s [-o <dir>] <script | ->\n", p_prog);
+	exit(2);
+}
+
+int main(int argc, char **argv)
+{
+	int i;
+
+	g_p_script_name = NULL;
+	for (i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-o") && (i + 1 < argc)) {
+			g_p_out_dir = argv[++i];
+		} else if (!g_p_script_name) {
+			g_p_script_name = argv[i];
+		} else {
+			sim_usage(argv[0]);
+		}
+	}
+	if (!g_p_script_name) {
+		sim_usage(argv[0]);
+	}
+	if (!strcmp(g_p_script_name, "-")) {
+		g_p_script = stdin;
+	} else if ((g_p_script = fopen(g_p_script_name, "r")) == NULL) {
+		perror(g_p_script_name);
+		return 2;
+	}
+
+	/* Keep the console output in step with the simulator messages */
+	setvbuf(stdout, NULL, _IOLBF, 0);
+
+	hal_init();
+	panel_reset();
+	firmware_main();
+
+	/* The firmware never returns on the target */
+	sim_exit(0);
+	return 0;
+}
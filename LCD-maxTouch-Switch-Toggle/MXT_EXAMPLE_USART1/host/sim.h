@@ -0,0 +1,17 @@
+/**
+ * \file
+ *
+ * \brief Virtual clock and script runner of the host simulator.
+ */
+
+#ifndef SIM_H_INCLUDED
+#define SIM_H_INCLUDED
+
+#include <stdint.h>
+
+uint64_t sim_now_us(void);
+void sim_delay_us(uint64_t ull_us);
+void sim_activity(void);
+void sim_idle(void);
+
+#endif /* SIM_H_INCLUDED */
@@ -0,0 +1,170 @@
+/**
+ * \file
+ *
+ * \brief Anti-aliased TIMAGE_A4 glyphs against the same glyphs in RGB888.
+ *
+ * arial_36_aa is the 4-bit alpha font; the Makefile expands it into
+ * build/arial_36_rgb.h, the same glyphs pre-blended black on white in the
+ * 24 bpp layout of the lcd-image-converter exports. The bench checks that
+ * both draw the same pixels on the LCD model, then compares their size,
+ * the decoding time per pixel, the time to render a string and the bytes
+ * sent for it:
+ *
+ *   make -C host bench
+ *   host/build/text_bench
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include "host_hal.h"
+#include "hal.h"
+#include "bench_sim.h"
+#include "panel.h"
+#include "ili9488.h"
+#include "compositor.h"
+#include "text.h"
+#include "arial_36_aa.h"
+#include "arial_36_rgb.h"
+
+#define BENCH_DECODES  2000
+#define BENCH_STRINGS  20000
+#define BENCH_STRING   "0123456789"
+
+static volatile uint32_t g_ul_sink;   /* keeps the decoded pixels alive */
+
+static uint32_t bench_font_bytes(const tFont *p_font, uint32_t *p_ul_pixels)
+{
+	const tImage *p_image;
+	uint32_t ul_bytes = 0, ul_count;
+	int i;
+
+	*p_ul_pixels = 0;
+	for (i = 0; i < p_font->length; i++) {
+		p_image = p_font->chars[i].image;
+		ul_count = p_image->width * p_image->height;
+		*p_ul_pixels += ul_count;
+		ul_bytes += (p_image->format == TIMAGE_A4) ? (ul_count + 1) / 2
+				: ul_count * 3;
+	}
+	return ul_bytes;
+}
+
+/**
+ * \brief Decode every glyph of a font, return the nanoseconds per pixel.
+ */
+static double bench_decode(const tFont *p_font, uint32_t ul_color,
+		uint32_t ul_background)
+{
+	static uint16_t us_row[ILI9488_LCD_WIDTH];
+	struct timage_decoder dec;
+	const tImage *p_image;
+	uint64_t ull_start, ull_pixels = 0;
+	uint32_t n, y;
+	int i;
+
+	ull_start = bench_now_ns();
+	for (n = 0; n < BENCH_DECODES; n++) {
+		for (i = 0; i < p_font->length; i++) {
+			p_image = p_font->chars[i].image;
+			timage_decoder_init(&dec, p_image);
+			timage_decoder_set_colors(&dec, ul_color, ul_background);
+			for (y = 0; y < (uint32_t)p_image->height; y++) {
+				timage_decode(&dec, us_row, p_image->width);
+				g_ul_sink += us_row[p_image->width / 2];
+			}
+			ull_pixels += p_image->width * p_image->height;
+		}
+	}
+	return (double)(bench_now_ns() - ull_start) / (double)ull_pixels;
+}
+
+/**
+ * \brief Render a string into the compositor, return microseconds per string.
+ */
+static double bench_render(const struct text_style *p_style)
+{
+	uint64_t ull_start;
+	uint32_t n;
+
+	ull_start = bench_now_ns();
+	for (n = 0; n < BENCH_STRINGS; n++) {
+		text_draw_at(p_style, BENCH_STRING, 10, 200);
+	}
+	return (double)(bench_now_ns() - ull_start) / 1000.0 / BENCH_STRINGS;
+}
+
+static uint64_t bench_lcd_bytes(const struct text_style *p_style, uint32_t ul_y)
+{
+	struct panel_stats stats;
+	uint32_t ul_w = text_get_width(p_style, BENCH_STRING);
+	uint32_t ul_h = text_get_height(p_style, BENCH_STRING);
+
+	ili9488_sync();
+	panel_reset_stats();
+	text_draw_lcd(p_style, BENCH_STRING, 10, ul_y, 10 + ul_w - 1, ul_y + ul_h - 1);
+	ili9488_sync();
+	panel_get_stats(&stats);
+	return stats.ull_bytes;
+}
+
+int main(void)
+{
+	struct ili9488_opt_t opt = {
+		.ul_width = ILI9488_LCD_WIDTH,
+		.ul_height = ILI9488_LCD_HEIGHT,
+		.foreground_color = COLOR_CONVERT(COLOR_WHITE),
+		.background_color = COLOR_CONVERT(COLOR_WHITE),
+	};
+	struct text_style a4 = {&arial_36_aa, COLOR_WHITE, 2, TEXT_ALIGN_LEFT, false,
+			COLOR_BLACK};
+	struct text_style rgb = {&arial_36_rgb, COLOR_WHITE, 2, TEXT_ALIGN_LEFT, false,
+			COLOR_BLACK};
+	struct text_style color = {&arial_36_aa, 0x1F3F7F, 2, TEXT_ALIGN_LEFT, false,
+			0xFFD000};
+	struct timage_lut_stats lut;
+	uint32_t ul_w, ul_h, ul_pixels, ul_mismatch = 0, x, y;
+	uint64_t ull_a4_bus, ull_rgb_bus;
+
+	hal_init();
+	panel_reset();
+	ili9488_init(&opt);
+	ili9488_display_on();
+	compositor_init(COLOR_WHITE);
+
+	/* Same pixels from both fonts, one string above the other */
+	ul_w = text_get_width(&a4, BENCH_STRING);
+	ul_h = text_get_height(&a4, BENCH_STRING);
+	ull_a4_bus = bench_lcd_bytes(&a4, 20);
+	ull_rgb_bus = bench_lcd_bytes(&rgb, 20 + ul_h);
+	for (y = 0; y < ul_h; y++) {
+		for (x = 10; x < 10 + ul_w; x++) {
+			if (panel_get_shown_pixel(x, 20 + y)
+					!= panel_get_shown_pixel(x, 20 + ul_h + y)) {
+				ul_mismatch++;
+			}
+		}
+	}
+
+	printf("\"%s\", %" PRIu32 "x%" PRIu32 " pixels, %" PRIu32 " differ\n\n",
+			BENCH_STRING, ul_w, ul_h, ul_mismatch);
+	printf("%-22s %9s %12s %12s %10s\n", "font", "bytes", "decode", "string",
+			"bus");
+	printf("%-22s %9" PRIu32 " %9.2f ns %9.2f us %8" PRIu64 " B\n",
+			"RGB888 black/white", bench_font_bytes(&arial_36_rgb, &ul_pixels),
+			bench_decode(&arial_36_rgb, COLOR_BLACK, COLOR_WHITE),
+			bench_render(&rgb), ull_rgb_bus);
+	printf("%-22s %9" PRIu32 " %9.2f ns %9.2f us %8" PRIu64 " B\n",
+			"A4 black/white", bench_font_bytes(&arial_36_aa, &ul_pixels),
+			bench_decode(&arial_36_aa, COLOR_BLACK, COLOR_WHITE),
+			bench_render(&a4), ull_a4_bus);
+	printf("%-22s %9" PRIu32 " %9.2f ns %9.2f us %8" PRIu64 " B\n",
+			"A4 yellow/blue", bench_font_bytes(&arial_36_aa, &ul_pixels),
+			bench_decode(&arial_36_aa, color.ul_color, color.ul_background),
+			bench_render(&color), bench_lcd_bytes(&color, 20 + 2 * ul_h));
+
+	timage_get_lut_stats(&lut);
+	printf("\n%" PRIu32 " glyph pixels, alpha tables: %" PRIu32 " hits %"
+			PRIu32 " misses\n", ul_pixels, lut.ul_hits, lut.ul_misses);
+	return ul_mismatch ? 1 : 0;
+}
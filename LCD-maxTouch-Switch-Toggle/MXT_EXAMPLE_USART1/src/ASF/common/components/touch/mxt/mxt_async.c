@@ -0,0 +1,438 @@
+/**
+ * \file
+ *
+ * \brief Interrupt-driven maXTouch message reader.
+ *
+ * The reader is a small state machine advanced by transaction completions:
+ * a count read (T44, possibly with the first message), then message reads of
+ * at most MXT_ASYNC_BURST messages until the announced count is consumed,
+ * then /CHG is sampled again to either start over or go idle. The /CHG edge
+ * handler and mxt_async_poll() only start it when it is idle.
+ *
+ * On the target the transfer runs from the TWIHS interrupt, one RXRDY per
+ * byte; at 400 kHz that is one interrupt every 22 us, which is cheaper than
+ * setting up an XDMAC channel for ten-byte reads (and the XDMAC interrupt is
+ * owned by the LCD transfer engine).
+ */
+
+#include "mxt_async.h"
+#include "ioport.h"
+#include "pio.h"
+#include "pio_handler.h"
+#include "interrupt.h"
+#include <string.h>
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+ extern "C" {
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+/** TWIHS instance interrupt the reader runs from. */
+#ifndef MXT_ASYNC_TWIHS_IRQn
+#  define MXT_ASYNC_TWIHS_IRQn    TWIHS0_IRQn
+#  define MXT_ASYNC_TWIHS_Handler TWIHS0_Handler
+#endif
+
+/** Bytes of one T5 read; MXT_TWI_MSG_SIZE_T5 is not parenthesized. */
+#define MXT_ASYNC_MSG_SIZE        (MXT_TWI_MSG_SIZE_T5)
+
+/** Report ID of an empty message slot. */
+#define MXT_ASYNC_INVALID_REPORT  0xFF
+
+/** Address bit that asks the device to append a checksum to T5 reads. */
+#define MXT_ASYNC_CRC_FLAG        0x8000
+
+enum mxt_async_state {
+	MXT_ASYNC_COUNT,      /* T44, followed by the first T5 message if adjacent */
+	MXT_ASYNC_MESSAGES,   /* g_ul_burst T5 messages */
+};
+
+static struct mxt_device *g_p_mxt;
+static struct mxt_ring g_mxt_ring;
+static struct mxt_async_stats g_mxt_stats;
+
+static uint16_t g_us_t5_addr;
+static uint16_t g_us_t44_addr;        /* 0 if the device has no T44 */
+static bool g_b_count_first;          /* T44 and T5 read in one transaction */
+
+static volatile bool g_b_busy;        /* a transaction sequence is running */
+static enum mxt_async_state g_state;
+static uint32_t g_ul_left;            /* messages announced by T44, not read yet */
+static uint32_t g_ul_burst;           /* messages in the current read */
+
+static uint8_t g_uc_rx[1 + MXT_ASYNC_BURST * MXT_ASYNC_MSG_SIZE];
+static uint16_t g_us_rx_addr;
+static uint32_t g_ul_rx_size;
+
+#ifdef MXT_ASYNC_SIMULATED
+static bool g_b_rx_pending;
+#else
+static volatile uint32_t g_ul_rx_index;
+#endif
+
+#ifdef CONF_VALIDATE_MESSAGES
+/* Same polynomial as the mxt_device component */
+static uint8_t mxt_async_crc8(uint8_t crc, uint8_t data)
+{
+	uint8_t index = 8, fb;
+
+	do {
+		fb = (crc ^ data) & 0x01;
+		data >>= 1;
+		crc >>= 1;
+		if (fb) {
+			crc ^= 0x8c;
+		}
+	} while (--index);
+
+	return crc;
+}
+#endif
+
+/**
+ * \brief Decode one T5 message, push it into the ring if it is a touch.
+ */
+static void mxt_async_decode(const uint8_t *p_msg)
+{
+	struct mxt_touch_event event;
+	uint8_t uc_report = p_msg[0];
+
+	if (uc_report == MXT_ASYNC_INVALID_REPORT) {
+		return;
+	}
+
+#ifdef CONF_VALIDATE_MESSAGES
+	uint8_t crc = 0;
+	uint32_t i;
+
+	for (i = 0; i < MXT_ASYNC_MSG_SIZE; i++) {
+		crc = mxt_async_crc8(crc, p_msg[i]);
+	}
+	if (crc != 0) {
+		g_mxt_stats.ul_errors++;
+		return;
+	}
+#endif
+
+	g_mxt_stats.ul_messages++;
+	if (g_p_mxt->report_id_map[uc_report].object_type
+			!= MXT_TOUCH_MULTITOUCHSCREEN_T9) {
+		return;
+	}
+
+	event.id = uc_report - g_p_mxt->multitouch_report_offset;
+	event.status = p_msg[1];
+	event.x = (p_msg[2] << 4) | ((p_msg[4] & 0xf0) >> 4);
+	event.y = (p_msg[3] << 4) | (p_msg[4] & 0x0f);
+	event.size = p_msg[5];
+	event.deltax = 0;
+	event.deltay = 0;
+
+	if (mxt_ring_put(&g_mxt_ring, &event)) {
+		g_mxt_stats.ul_touch_events++;
+	}
+}
+
+#ifndef MXT_ASYNC_SIMULATED
+/**
+ * \brief Program the TWIHS for the read set up by mxt_async_read().
+ */
+static void mxt_async_twihs_start(void)
+{
+	Twihs *p_twihs = g_p_mxt->interface;
+
+	g_ul_rx_index = 0;
+
+	p_twihs->TWIHS_MMR = 0;
+	p_twihs->TWIHS_MMR = TWIHS_MMR_MREAD | TWIHS_MMR_DADR(g_p_mxt->mxt_chip_adr)
+			| TWIHS_MMR_IADRSZ_2_BYTE;
+
+	/* Low address byte first on the wire, as twihs_mk_addr() sends the
+	 * addresses built by the mxt_device component */
+	p_twihs->TWIHS_IADR = ((uint32_t)(g_us_rx_addr & 0xFF) << 8)
+			| (g_us_rx_addr >> 8);
+
+	/* Drop stale flags and data of the previous transfer */
+	(void)p_twihs->TWIHS_SR;
+	(void)p_twihs->TWIHS_RHR;
+
+	if (g_ul_rx_size == 1) {
+		p_twihs->TWIHS_CR = TWIHS_CR_START | TWIHS_CR_STOP;
+	} else {
+		p_twihs->TWIHS_CR = TWIHS_CR_START;
+	}
+	p_twihs->TWIHS_IER = TWIHS_IER_RXRDY | TWIHS_IER_NACK | TWIHS_IER_ARBLST;
+}
+#endif
+
+/**
+ * \brief Start a read of the device memory into g_uc_rx.
+ */
+static void mxt_async_read(uint16_t us_addr, uint32_t ul_size)
+{
+	g_us_rx_addr = us_addr;
+	g_ul_rx_size = ul_size;
+#ifdef MXT_ASYNC_SIMULATED
+	g_b_rx_pending = true;
+#else
+	mxt_async_twihs_start();
+#endif
+}
+
+/**
+ * \brief Start the next read of the sequence, or go idle.
+ *
+ * Called with g_b_busy set, from the completion or from a starter.
+ */
+static void mxt_async_next(void)
+{
+	uint16_t us_t5 = g_us_t5_addr;
+
+#ifdef CONF_VALIDATE_MESSAGES
+	us_t5 |= MXT_ASYNC_CRC_FLAG;
+#endif
+
+	if (g_ul_left) {
+		g_state = MXT_ASYNC_MESSAGES;
+		g_ul_burst = Min(g_ul_left, MXT_ASYNC_BURST);
+		mxt_async_read(us_t5, g_ul_burst * MXT_ASYNC_MSG_SIZE);
+	} else if (!ioport_get_pin_level(g_p_mxt->chgpin)) {
+		if (g_us_t44_addr) {
+			g_state = MXT_ASYNC_COUNT;
+			mxt_async_read(g_us_t44_addr,
+					g_b_count_first ? 1 + MXT_ASYNC_MSG_SIZE : 1);
+		} else {
+			/* Unknown count: one message at a time while /CHG is low */
+			g_state = MXT_ASYNC_MESSAGES;
+			g_ul_burst = 1;
+			mxt_async_read(us_t5, MXT_ASYNC_MSG_SIZE);
+		}
+	} else {
+		g_b_busy = false;
+	}
+}
+
+/**
+ * \brief Transaction completion.
+ *
+ * \param status STATUS_OK, or ERR_IO_ERROR if the device did not answer.
+ */
+static void mxt_async_done(status_code_t status)
+{
+	uint32_t i;
+
+	if (status != STATUS_OK) {
+		/* Give up; mxt_async_poll() retries while /CHG stays low */
+		g_mxt_stats.ul_errors++;
+		g_ul_left = 0;
+		g_b_busy = false;
+		return;
+	}
+	g_mxt_stats.ul_transactions++;
+
+	if (g_state == MXT_ASYNC_COUNT) {
+		g_ul_left = g_uc_rx[0];
+		if (g_b_count_first && g_ul_left) {
+			mxt_async_decode(&g_uc_rx[1]);
+			g_ul_left--;
+		}
+	} else {
+		for (i = 0; i < g_ul_burst; i++) {
+			mxt_async_decode(&g_uc_rx[i * MXT_ASYNC_MSG_SIZE]);
+		}
+		g_ul_left -= Min(g_ul_left, g_ul_burst);
+	}
+
+	mxt_async_next();
+}
+
+#ifdef MXT_ASYNC_SIMULATED
+/**
+ * \brief Run the queued reads synchronously until the sequence goes idle.
+ */
+static void mxt_async_run(void)
+{
+	static bool b_in_run = false;
+	twihs_package_t packet;
+
+	if (b_in_run) {
+		return;
+	}
+	b_in_run = true;
+	while (g_b_rx_pending) {
+		g_b_rx_pending = false;
+		packet.addr[0] = (uint8_t)g_us_rx_addr;
+		packet.addr[1] = (uint8_t)(g_us_rx_addr >> 8);
+		packet.addr_length = sizeof(mxt_memory_adr);
+		packet.chip = g_p_mxt->mxt_chip_adr;
+		packet.buffer = g_uc_rx;
+		packet.length = g_ul_rx_size;
+		if (twihs_master_read(g_p_mxt->interface, &packet) == TWIHS_SUCCESS) {
+			mxt_async_done(STATUS_OK);
+		} else {
+			mxt_async_done(ERR_IO_ERROR);
+		}
+	}
+	b_in_run = false;
+}
+#else
+/**
+ * \brief TWIHS interrupt handler: receive one byte, or finish the read.
+ */
+void MXT_ASYNC_TWIHS_Handler(void)
+{
+	Twihs *p_twihs = g_p_mxt->interface;
+	uint32_t ul_status = p_twihs->TWIHS_SR & p_twihs->TWIHS_IMR;
+
+	if (ul_status & (TWIHS_SR_NACK | TWIHS_SR_ARBLST)) {
+		p_twihs->TWIHS_IDR = ~0UL;
+		mxt_async_done(ERR_IO_ERROR);
+		return;
+	}
+
+	if (ul_status & TWIHS_SR_RXRDY) {
+		g_uc_rx[g_ul_rx_index++] = p_twihs->TWIHS_RHR;
+		if (g_ul_rx_index == g_ul_rx_size - 1) {
+			/* The STOP goes out after the byte now on the bus */
+			p_twihs->TWIHS_CR = TWIHS_CR_STOP;
+		} else if (g_ul_rx_index == g_ul_rx_size) {
+			p_twihs->TWIHS_IDR = TWIHS_IDR_RXRDY;
+			p_twihs->TWIHS_IER = TWIHS_IER_TXCOMP;
+		}
+	}
+
+	if (ul_status & TWIHS_SR_TXCOMP) {
+		p_twihs->TWIHS_IDR = ~0UL;
+		mxt_async_done(STATUS_OK);
+	}
+}
+#endif
+
+/**
+ * \brief Start a sequence if none is running and /CHG is low.
+ */
+static void mxt_async_start(void)
+{
+	irqflags_t flags = cpu_irq_save();
+
+	/* Sampling /CHG and taking the reader must not be split by the edge
+	 * interrupt, or its edge would be ignored while we go idle */
+	if (!g_b_busy && !ioport_get_pin_level(g_p_mxt->chgpin)) {
+		g_b_busy = true;
+		g_ul_left = 0;
+		mxt_async_next();
+	}
+	cpu_irq_restore(flags);
+
+#ifdef MXT_ASYNC_SIMULATED
+	mxt_async_run();
+#endif
+}
+
+/**
+ * \brief /CHG falling edge handler.
+ */
+static void mxt_async_chg_handler(uint32_t ul_id, uint32_t ul_mask)
+{
+	UNUSED(ul_id);
+	UNUSED(ul_mask);
+	mxt_async_start();
+}
+
+/**
+ * \brief Take over the message reading of an initialized device.
+ *
+ * \param device device set up by mxt_init_device() and configured.
+ *
+ * \return STATUS_OK, ERR_UNSUPPORTED_DEV if the device has no T5 object or
+ * ERR_NO_MEMORY if no PIO handler slot is left for /CHG.
+ */
+status_code_t mxt_async_init(struct mxt_device *device)
+{
+	g_p_mxt = device;
+	g_us_t5_addr = mxt_get_object_address(device, MXT_GEN_MESSAGEPROCESSOR_T5, 0);
+	g_us_t44_addr = mxt_get_object_address(device, MXT_SPT_MESSAGECOUNT_T44, 0);
+	if (!g_us_t5_addr) {
+		return ERR_UNSUPPORTED_DEV;
+	}
+
+#ifdef CONF_VALIDATE_MESSAGES
+	/* The checksum request only applies to reads that start at T5 */
+	g_b_count_first = false;
+#else
+	g_b_count_first = g_us_t44_addr && (g_us_t44_addr + 1 == g_us_t5_addr);
+#endif
+
+	mxt_ring_init(&g_mxt_ring);
+	memset(&g_mxt_stats, 0, sizeof(g_mxt_stats));
+	g_ul_left = 0;
+	g_b_busy = false;
+
+#ifndef MXT_ASYNC_SIMULATED
+	device->interface->TWIHS_IDR = ~0UL;
+	NVIC_ClearPendingIRQ(MXT_ASYNC_TWIHS_IRQn);
+	NVIC_SetPriority(MXT_ASYNC_TWIHS_IRQn, MXT_ASYNC_IRQ_PRIORITY);
+	NVIC_EnableIRQ(MXT_ASYNC_TWIHS_IRQn);
+#endif
+
+	if (pio_handler_set_pin(device->chgpin, PIO_IT_FALL_EDGE,
+			mxt_async_chg_handler) != 0) {
+		return ERR_NO_MEMORY;
+	}
+	pio_enable_pin_interrupt(device->chgpin);
+	NVIC_EnableIRQ((IRQn_Type)pio_get_pin_group_id(device->chgpin));
+
+	/* Messages queued before the interrupt was enabled have no edge left */
+	mxt_async_start();
+
+	return STATUS_OK;
+}
+
+/**
+ * \brief Pop the oldest touch event.
+ *
+ * \return false if the ring is empty.
+ */
+bool mxt_async_get_event(struct mxt_touch_event *p_event)
+{
+	return mxt_ring_get(&g_mxt_ring, p_event);
+}
+
+/**
+ * \brief Whether touch events are waiting in the ring.
+ */
+bool mxt_async_pending(void)
+{
+	return mxt_ring_count(&g_mxt_ring) != 0;
+}
+
+/**
+ * \brief Restart the reader if /CHG is low while it is idle.
+ *
+ * Recovers from a failed transaction, which leaves /CHG low without a new
+ * edge. Cheap enough to call on every pass of the application loop.
+ */
+void mxt_async_poll(void)
+{
+	mxt_async_start();
+}
+
+/**
+ * \brief Get the reader statistics.
+ */
+void mxt_async_get_stats(struct mxt_async_stats *p_stats)
+{
+	*p_stats = g_mxt_stats;
+	p_stats->ul_dropped = g_mxt_ring.ul_dropped;
+}
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+}
+#endif
+/**INDENT-ON**/
+/// @endcond
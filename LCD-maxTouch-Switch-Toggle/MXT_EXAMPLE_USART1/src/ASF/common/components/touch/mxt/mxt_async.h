@@ -0,0 +1,75 @@
+/**
+ * \file
+ *
+ * \brief Interrupt-driven maXTouch message reader.
+ *
+ * A falling edge on /CHG starts a TWIHS read of the message processor (T5)
+ * that runs from the TWIHS interrupt. T9 messages are decoded into touch
+ * events and pushed into an mxt_ring; other messages are skipped, as
+ * mxt_read_touch_event() does. The reader keeps going for as long as /CHG
+ * stays low, so the application only has to drain the ring.
+ *
+ * When the device has a message count object (T44) the count is read first
+ * and up to MXT_ASYNC_BURST messages are then read in one transaction. If
+ * T44 sits right before T5 in the memory map, the count and the first
+ * message share the first transaction.
+ *
+ * Once mxt_async_init() has run, the TWIHS bus belongs to the reader: the
+ * blocking mxt_read_message()/mxt_read_touch_event() calls must not be used.
+ *
+ * With MXT_ASYNC_SIMULATED defined the TWIHS registers are not touched: each
+ * transaction is done with twihs_master_read() from the caller's context and
+ * completes immediately, which is what the host build uses.
+ */
+
+#ifndef MXT_ASYNC_H_INCLUDED
+#define MXT_ASYNC_H_INCLUDED
+
+#include "compiler.h"
+#include "mxt_device_1.h"
+#include "mxt_ring.h"
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+ extern "C" {
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+/** Largest number of T5 messages read in one transaction. */
+#ifndef MXT_ASYNC_BURST
+#  define MXT_ASYNC_BURST 4
+#endif
+
+/** NVIC priority of the TWIHS interrupt. */
+#ifndef MXT_ASYNC_IRQ_PRIORITY
+#  define MXT_ASYNC_IRQ_PRIORITY 4
+#endif
+
+/**
+ * Reader statistics.
+ */
+struct mxt_async_stats {
+	uint32_t ul_transactions;   //!< TWIHS reads completed
+	uint32_t ul_messages;       //!< valid T5 messages received
+	uint32_t ul_touch_events;   //!< T9 messages pushed into the ring
+	uint32_t ul_dropped;        //!< touch events lost to a full ring
+	uint32_t ul_errors;         //!< NACK, arbitration loss or bad checksum
+};
+
+status_code_t mxt_async_init(struct mxt_device *device);
+bool mxt_async_get_event(struct mxt_touch_event *p_event);
+bool mxt_async_pending(void);
+void mxt_async_poll(void);
+void mxt_async_get_stats(struct mxt_async_stats *p_stats);
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+}
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+#endif /* MXT_ASYNC_H_INCLUDED */
@@ -0,0 +1,121 @@
+/**
+ * \file
+ *
+ * \brief Single-producer/single-consumer ring of maXTouch touch events.
+ *
+ * The producer (the message reader, in interrupt context) only writes
+ * \c ul_head and the consumer (the application loop) only writes \c ul_tail,
+ * so neither side needs to mask interrupts. Both indexes run freely and are
+ * reduced modulo the power-of-two size when the slot is accessed. A memory
+ * barrier orders the slot copy against the index update on each side.
+ *
+ * A full ring drops the new event and counts it: the producer cannot move
+ * the consumer's tail.
+ */
+
+#ifndef MXT_RING_H_INCLUDED
+#define MXT_RING_H_INCLUDED
+
+#include "compiler.h"
+#include "mxt_device_1.h"
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+ extern "C" {
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+/** Number of events the ring holds, a power of two. */
+#ifndef MXT_RING_SIZE
+#  define MXT_RING_SIZE 16
+#endif
+
+#if (MXT_RING_SIZE < 2) || (MXT_RING_SIZE & (MXT_RING_SIZE - 1))
+#  error "MXT_RING_SIZE must be a power of two"
+#endif
+
+/**
+ * Touch event ring.
+ */
+struct mxt_ring {
+	struct mxt_touch_event events[MXT_RING_SIZE];
+	volatile uint32_t ul_head;   //!< next slot to fill, written by the producer
+	volatile uint32_t ul_tail;   //!< next slot to read, written by the consumer
+	volatile uint32_t ul_dropped;   //!< events lost because the ring was full
+};
+
+/**
+ * \brief Empty the ring. Neither side may be running.
+ */
+static inline void mxt_ring_init(struct mxt_ring *p_ring)
+{
+	p_ring->ul_head = 0;
+	p_ring->ul_tail = 0;
+	p_ring->ul_dropped = 0;
+}
+
+/**
+ * \brief Number of events waiting in the ring.
+ */
+static inline uint32_t mxt_ring_count(const struct mxt_ring *p_ring)
+{
+	return p_ring->ul_head - p_ring->ul_tail;
+}
+
+/**
+ * \brief Append an event, producer side.
+ *
+ * \return false if the ring was full and the event was dropped.
+ */
+static inline bool mxt_ring_put(struct mxt_ring *p_ring,
+		const struct mxt_touch_event *p_event)
+{
+	uint32_t ul_head = p_ring->ul_head;
+
+	if (ul_head - p_ring->ul_tail >= MXT_RING_SIZE) {
+		p_ring->ul_dropped++;
+		return false;
+	}
+	p_ring->events[ul_head & (MXT_RING_SIZE - 1)] = *p_event;
+
+	/* Publish the slot before the index that makes it visible */
+	__DMB();
+	p_ring->ul_head = ul_head + 1;
+	return true;
+}
+
+/**
+ * \brief Remove the oldest event, consumer side.
+ *
+ * \return false if the ring was empty.
+ */
+static inline bool mxt_ring_get(struct mxt_ring *p_ring,
+		struct mxt_touch_event *p_event)
+{
+	uint32_t ul_tail = p_ring->ul_tail;
+
+	if (ul_tail == p_ring->ul_head) {
+		return false;
+	}
+
+	/* Read the slot after the index that published it... */
+	__DMB();
+	*p_event = p_ring->events[ul_tail & (MXT_RING_SIZE - 1)];
+
+	/* ...and release it only once the copy is done */
+	__DMB();
+	p_ring->ul_tail = ul_tail + 1;
+	return true;
+}
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+}
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+#endif /* MXT_RING_H_INCLUDED */
@@ -49,13 +49,10 @@
 #include <assert.h>
 #include <stdlib.h>
 #include "pio.h"
-#ifdef ILI9488_EBIMODE
-#  include "smc.h"
-#  include "pmc.h"
-#endif
-#ifdef ILI9488_SPIMODE
-#  include "spi_master.h"
-#endif
+#include "delay.h"
+#include "ili9488_bus.h"
+#include "ili9488_prof.h"
+#include "ili9488_pixel.h"
 
 /// @cond 0
 /**INDENT-OFF**/
@@ -272,61 +269,8 @@ const uint8_t p_uc_charset10x14[] = {
 	0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC
 };
 
-#ifdef ILI9488_EBIMODE
-/**
- * \brief Read 32 bit data.
- */
-static uint32_t ili9488_lcd_get_16(void)
-{
-	uint16_t readbuf[5];
-	uint16_t *ptr, i;
-	uint32_t shift_cnt = 2;
-	uint32_t chipid = 0;
-	uint32_t retval = 0;
-
-	pio_set(PIN_EBI_CDS_PIO, PIN_EBI_CDS_MASK);
-	LCD_MULTI_RD(readbuf, 5);
-	ptr = &readbuf[1];
-	for(i = 1; i < 4; i++) {
-		chipid |= (*ptr &0xFF)<< (shift_cnt << 3);
-		ptr++;
-		shift_cnt--;
-	}
-	retval = chipid;
-	return retval;
-}
-
-/**
- * \brief Prepare to write GRAM data.
- */
-static void ili9488_write_ram_prepare(void)
-{
-	pio_clear(PIN_EBI_CDS_PIO, PIN_EBI_CDS_MASK);
-	LCD_IR(ILI9488_CMD_MEMORY_WRITE); /* Write Data to GRAM (R2Ch) */
-}
-
-/**
- * \brief Write data to LCD GRAM.
- *
- * \param ul_color 16-bits RGB color.
- */
-static void ili9488_write_ram(ili9488_color_t ul_color)
-{
-	pio_set(PIN_EBI_CDS_PIO, PIN_EBI_CDS_MASK);
-	LCD_WD(ul_color);
-}
-
-/**
- * \brief Write multiple data in buffer to LCD controller.
- *
- * \param p_ul_buf data buffer.
- * \param ul_size size in pixels.
- */
-static void ili9488_write_ram_buffer(const ili9488_color_t *p_ul_buf, uint32_t ul_size)
-{
-	pio_set(PIN_EBI_CDS_PIO, PIN_EBI_CDS_MASK);
-	LCD_MULTI_WD(p_ul_buf, ul_size);
-}
+/** Backend the driver talks to, set by ili9488_init_start(). */
+static const struct ili9488_bus *g_p_bus = &ILI9488_BUS_DEFAULT;
 
 /**
  * \brief Write data to LCD Register.
@@ -335,136 +279,59 @@ static void ili9488_write_ram_buffer(const ili9488_color_t *p_ul_buf, uint32_t u
  * \param us_data data to be written.
  * \param size the number of parameters.
  */
-static void ili9488_write_register(uint8_t uc_reg, const ili9488_color_t *us_data, uint32_t size)
-{
-	/* CDS pin is set low level when writing command*/
-	pio_clear(PIN_EBI_CDS_PIO, PIN_EBI_CDS_MASK);
-	LCD_IR(uc_reg);
-
-	if(size == 0) {
-		return;
-	}
-
-	/* CDS pin is set high level when writing parameters or image data*/
-	pio_set(PIN_EBI_CDS_PIO, PIN_EBI_CDS_MASK);
-	LCD_MULTI_WD(us_data, size);
-}
-
-/**
- * \brief Read data to LCD GRAM.
- *
- * \note Because pixel data LCD GRAM is 18-bits, so convertion to RGB565 16-bits
- * will cause low color bit lose.
- *
- * \return color 16-bits RGB color.
- */
-static uint32_t ili9488_read_ram(void)
+static inline void ili9488_write_register(uint8_t uc_reg, const ili9488_color_t *us_data, uint32_t size)
 {
-	uint16_t value[3] = {0};
-	uint32_t color = 0;
-
-	pio_clear(PIN_EBI_CDS_PIO, PIN_EBI_CDS_MASK);
-	LCD_IR(ILI9488_CMD_MEMORY_READ);/* Write Data to GRAM (R2Eh) */
-
-	pio_set(PIN_EBI_CDS_PIO, PIN_EBI_CDS_MASK);
-	LCD_MULTI_RD(value, 3);
-
-	/* The first data is dummy*/
-	color = ILI9488_COLOR(value[1] >> 8, value[1] & 0xFF, value[2] >> 8);
-	return color;
+	g_p_bus->write_register(uc_reg, us_data, size);
 }
 
-/**
- * \brief Read chipid.
- *
- * \return chipid value.
- */
-static uint32_t ili9488_read_chipid(void)
-{
-	pio_clear(PIN_EBI_CDS_PIO, PIN_EBI_CDS_MASK);
-	LCD_IR(ILI9488_CMD_READ_ID4);
-
-	return ili9488_lcd_get_16();
-}
-#endif
-#ifdef ILI9488_SPIMODE
 /**
  * \brief Prepare to write GRAM data.
  */
-static void ili9488_write_ram_prepare(void)
+static inline void ili9488_write_ram_prepare(void)
 {
-	volatile uint32_t i;
-	pio_set_pin_low(LCD_SPI_CDS_PIO);
-	spi_write(BOARD_ILI9488_SPI, ILI9488_CMD_MEMORY_WRITE, BOARD_ILI9488_SPI_NPCS, 0);
-	for(i = 0; i < 0xFF; i++);
+	g_p_bus->write_register(ILI9488_CMD_MEMORY_WRITE, 0x0000, 0);
 }
 
 /**
  * \brief Write data to LCD GRAM.
- *
- * \param ul_color 16-bits RGB color.
  */
-static void ili9488_write_ram(ili9488_color_t ul_color)
+static inline void ili9488_write_ram(ili9488_color_t ul_color)
 {
-	pio_set_pin_high(LCD_SPI_CDS_PIO);
-	spi_write(BOARD_ILI9488_SPI, ul_color, BOARD_ILI9488_SPI_NPCS, 0);
+	g_p_bus->write_ram(ul_color);
 }
 
 /**
  * \brief Write multiple data in buffer to LCD controller.
  *
+ * \note The buffer may only be queued, it must stay valid until the next
+ * register access or ili9488_bus_sync().
+ *
  * \param p_ul_buf data buffer.
- * \param ul_size size in pixels.
+ * \param ul_size size in units of ili9488_color_t.
+ * \param ul_repeat number of times the buffer is sent.
  */
-static void ili9488_write_ram_buffer(const ili9488_color_t *p_ul_buf, uint32_t ul_size)
+static inline void ili9488_write_ram_buffer(const ili9488_color_t *p_ul_buf, uint32_t ul_size,
+		uint32_t ul_repeat)
 {
-	volatile uint32_t i;
-	pio_set_pin_high(LCD_SPI_CDS_PIO);
-	spi_write_packet(BOARD_ILI9488_SPI, p_ul_buf, ul_size);
-	for(i = 0; i < 0xFF; i++);
+	g_p_bus->write_ram_buffer(p_ul_buf, ul_size, ul_repeat);
 }
 
 /**
- * \brief Write data to LCD Register.
+ * \brief Read data to LCD GRAM.
  *
- * \param uc_reg register address.
- * \param us_data data to be written.
- * \param size the number of parameters.
+ * \return color 16-bits RGB color.
  */
-static void ili9488_write_register(uint8_t uc_reg, const ili9488_color_t *us_data, uint32_t size)
+static inline uint32_t ili9488_read_ram(void)
 {
-	volatile uint32_t i;
-
-	/* Transfer cmd */
-	pio_set_pin_low(LCD_SPI_CDS_PIO);
-	spi_write(BOARD_ILI9488_SPI, uc_reg, BOARD_ILI9488_SPI_NPCS, 0);
-	for(i = 0; i < 0xFF; i++);
-
-	if(size > 0) {
-		/* Transfer data */
-		pio_set_pin_high(LCD_SPI_CDS_PIO);
-		spi_write_packet(BOARD_ILI9488_SPI, us_data, size);
-		for(i = 0; i < 0x5F; i++);
-	}
+	return g_p_bus->read_ram();
 }
 
 /**
- * \brief Read data to LCD GRAM.
- *
- * \note Because pixel data LCD GRAM is 18-bits, so convertion to RGB565 16-bits
- * will cause low color bit lose.
- *
- * \return color 16-bits RGB color.
+ * \brief Read the line the panel is refreshing.
  */
-static uint32_t ili9488_read_ram(void)
+static inline uint16_t ili9488_read_scanline(void)
 {
-	uint8_t grambuf[4];
-	ili9488_write_register(ILI9488_CMD_MEMORY_READ, 0x0000, 0);
-
-	pio_set_pin_high(LCD_SPI_CDS_PIO);
-	spi_read_packet(BOARD_ILI9488_SPI, grambuf, 4);
-	/* The first data is dummy*/
-	return ILI9488_COLOR(grambuf[1], grambuf[2], grambuf[3]);
+	return g_p_bus->read_scanline();
 }
 
 /**
@@ -472,43 +339,27 @@ static uint32_t ili9488_read_ram(void)
  *
  * \return chipid value.
  */
-static uint32_t ili9488_read_chipid(void)
+static inline uint32_t ili9488_read_chipid(void)
 {
-	uint32_t i, chipid = 0;
-	volatile uint32_t j;
-	ili9488_color_t chipidBuf, reg, param;
-
-	reg = 0x81;
-	param = 0x0;
-	for (i = 3; i > 0; i--) {
-		ili9488_write_register(ILI9488_CMD_SPI_READ_SETTINGS, &reg, 1);
-		reg++;
-		for(j = 0; j < 0xFF; j++);
-		ili9488_write_register(ILI9488_CMD_READ_ID4, 0, 0);
-		{
-			pio_set_pin_high(LCD_SPI_CDS_PIO);
-			spi_read_packet(BOARD_ILI9488_SPI, &chipidBuf, 1);
-			for(j = 0; j < 0xFF; j++);
-		}
-		chipid |= (chipidBuf & 0xFF) << ((i - 1) << 3);
-		ili9488_write_register(ILI9488_CMD_SPI_READ_SETTINGS, &param, 1);
-		for(j = 0; j < 0xFFF; j++);
-	}
-	return chipid;
+	return g_p_bus->read_chipid();
+}
+
+/**
+ * \brief Wait for the pixel data still queued by the bus.
+ *
+ * Must be called before the pixel cache is modified.
+ */
+static inline void ili9488_bus_sync(void)
+{
+	g_p_bus->sync();
 }
-#endif
 
 /**
  * \brief Delay function.
  */
 void ili9488_delay(uint32_t ul_ms)
 {
-	uint32_t i;
-
-	for(i = 0; i < ul_ms; i++) {
-		for(i = 0; i < 100000; i++) {
-		}
-	}
+	delay_ms(ul_ms);
 }
 
 /**
@@ -560,12 +411,16 @@ static void ili9488_check_box_coordinates(uint32_t *p_ul_x1, uint32_t *p_ul_y1,
 void ili9488_set_display_direction(enum ili9488_display_direction direction )
 {
 	ili9488_color_t value;
+
+	ILI9488_PROF_ENTER(ILI9488_PROF_CONTROL);
+
 	if(direction) {
 		value = 0xE8;
 	} else {
 		value = 0x48;
 	}
 	ili9488_write_register(ILI9488_CMD_MEMORY_ACCESS_CONTROL, &value, 1);
+	ILI9488_PROF_LEAVE();
 }
 
 /**
@@ -582,6 +437,8 @@ void ili9488_set_window(uint16_t x, uint16_t y, uint16_t width, uint16_t height
 	uint32_t cnt = 0;
 	ili9488_color_t buf[4];
 
+	ILI9488_PROF_ENTER(ILI9488_PROF_WINDOW);
+
 	cnt = sizeof(buf)/sizeof(ili9488_color_t);
 
 	col_start  =  x ;
@@ -604,110 +461,170 @@ void ili9488_set_window(uint16_t x, uint16_t y, uint16_t width, uint16_t height
 	buf[3] = get_0b_to_8b(row_end);
 	ili9488_write_register(ILI9488_CMD_PAGE_ADDRESS_SET, buf, cnt);
 	ili9488_write_register(ILI9488_CMD_NOP, 0, 0);
+	ILI9488_PROF_LEAVE();
 }
 
+/** Steps of the initialization, each run once its wait is over. */
+enum ili9488_init_step {
+	ILI9488_STEP_SLEEP_OUT,
+	ILI9488_STEP_CONFIGURE,
+};
+
+static struct ili9488_opt_t *g_p_init_opt;
+static enum ili9488_init_state g_init_state = ILI9488_INIT_FAILED;
+static enum ili9488_init_step g_init_step;
+static uint32_t g_ul_init_due_ms;
+
 /**
- * \brief Initialize the ILI9488 lcd driver.
- *
- * \note Make sure below works have been done before calling ili9488_init()\n
- * 1. ILI9488 related Pins have been initialized correctly. \n
- * 2. SMC has been configured correctly for access ILI9488 (16-bit system interface for now). \n
+ * \brief Configure the ILI9488 once it is out of sleep, then turn it on.
  *
- * \param p_opt pointer to ILI9488 option structure.
- *
- * \return 0 if initialization succeeds, otherwise fails.
+ * \return false if the chip ID is wrong.
  */
-uint32_t ili9488_init(struct ili9488_opt_t *p_opt)
+static bool ili9488_configure(struct ili9488_opt_t *p_opt)
 {
 	ili9488_color_t param;
-	uint32_t chipid;
-#ifdef ILI9488_EBIMODE
-	/* Enable peripheral clock */
-	pmc_enable_periph_clk(ID_SMC);
-
-	/* Configure SMC, NCS3 is assigned to LCD */
-	smc_set_setup_timing(SMC, BOARD_ILI9488_EBI_NPCS, SMC_SETUP_NWE_SETUP(0)
-			| SMC_SETUP_NCS_WR_SETUP(0)
-			| SMC_SETUP_NRD_SETUP(0)
-			| SMC_SETUP_NCS_RD_SETUP(0));
-	smc_set_pulse_timing(SMC, BOARD_ILI9488_EBI_NPCS , SMC_PULSE_NWE_PULSE(3)
-			| SMC_PULSE_NCS_WR_PULSE(0x4)
-			| SMC_PULSE_NRD_PULSE(0xA)
-			| SMC_PULSE_NCS_RD_PULSE(0xA));
-	smc_set_cycle_timing(SMC, BOARD_ILI9488_EBI_NPCS, SMC_CYCLE_NWE_CYCLE(0x4)
-			| SMC_CYCLE_NRD_CYCLE(0xA));
-
-
-	smc_set_mode(SMC, BOARD_ILI9488_EBI_NPCS, SMC_MODE_READ_MODE
-			| SMC_MODE_WRITE_MODE
-			| SMC_MODE_DBW_16_BIT
-			| SMC_MODE_EXNW_MODE_DISABLED
-			| SMC_MODE_TDF_CYCLES(0xF));
-#endif
-#ifdef ILI9488_SPIMODE
-	struct spi_device ILI9488_SPI_DEVICE = {
-		// Board specific chip select configuration
-		.id = BOARD_ILI9488_SPI_NPCS
-	};
-
-	/* Init, select and configure the chip */
-	spi_master_init(BOARD_ILI9488_SPI);
-	spi_master_setup_device(BOARD_ILI9488_SPI, &ILI9488_SPI_DEVICE, SPI_MODE_3, ILI9488_SPI_BAUDRATE, 0);
-	spi_configure_cs_behavior(BOARD_ILI9488_SPI, BOARD_ILI9488_SPI_NPCS, SPI_CS_RISE_NO_TX);
-	spi_select_device(BOARD_ILI9488_SPI, &ILI9488_SPI_DEVICE);
-
-	/* Enable the SPI peripheral */
-	spi_enable(BOARD_ILI9488_SPI);
-	spi_enable_interrupt(BOARD_ILI9488_SPI, SPI_IER_RDRF);
-#endif
-
-	ili9488_write_register(ILI9488_CMD_SOFTWARE_RESET, 0x0000, 0);
-	ili9488_delay(200);
-
-	ili9488_write_register(ILI9488_CMD_SLEEP_OUT, 0x0000, 0);
-	ili9488_delay(200);
 
 	/** read chipid */
-	chipid = ili9488_read_chipid();
-	if (chipid != ILI9488_DEVICE_CODE) {
-		return 1;
+	if (ili9488_read_chipid() != ILI9488_DEVICE_CODE) {
+		return false;
 	}
 
 	/** make it tRGB and reverse the column order */
 	param = 0x48;
 	ili9488_write_register(ILI9488_CMD_MEMORY_ACCESS_CONTROL, &param, 1);
-	ili9488_delay(100);
 
 	param = 0x04;
 	ili9488_write_register(ILI9488_CMD_CABC_CONTROL_9, &param, 1);
-	ili9488_delay(100);
 #ifdef ILI9488_EBIMODE
 	/** Set ILI9488 Pixel Format in SMC mode.*/
 	param = 0x05;
 	ili9488_write_register(ILI9488_CMD_COLMOD_PIXEL_FORMAT_SET, &param, 1);
-	ili9488_delay(100);
 	ili9488_write_register(ILI9488_CMD_PARTIAL_MODE_ON, 0, 0);
-	ili9488_delay(100);
 #endif
 #ifdef ILI9488_SPIMODE
 	param = 0x06;
 	ili9488_write_register(ILI9488_CMD_COLMOD_PIXEL_FORMAT_SET, &param, 1);
-	ili9488_delay(100);
 	ili9488_write_register(ILI9488_CMD_NORMAL_DISP_MODE_ON, 0, 0);
-	ili9488_delay(100);
 #endif
 
 	ili9488_display_on();
-	ili9488_delay(100);
-
 	ili9488_set_display_direction(LANDSCAPE);
-	ili9488_delay(100);
 
 	ili9488_set_window(0, 0,p_opt->ul_width,p_opt->ul_height);
 	ili9488_set_foreground_color(p_opt->foreground_color);
 	ili9488_set_cursor_position(0, 0);
+	return true;
+}
 
-	return 0;
+/**
+ * \brief Start initializing the ILI9488 lcd driver without waiting.
+ *
+ * Sets up the bus and resets the panel. The rest is run by
+ * ili9488_init_poll() as the waits the panel needs between commands are
+ * over, so the caller can do other work, bring up other devices, meanwhile.
+ * No other ILI9488 call may be made until ili9488_init_get_state() returns
+ * ILI9488_INIT_DONE.
+ *
+ * A bus whose format is not ILI9488_BUS_FORMAT is not touched: the state is
+ * ILI9488_INIT_FAILED at once.
+ *
+ * \note Same requirements as ili9488_init().
+ *
+ * \param p_opt pointer to ILI9488 option structure, kept until done.
+ * \param ul_now_ms current time in milliseconds, any origin, rounded down.
+ */
+void ili9488_init_start(struct ili9488_opt_t *p_opt, uint32_t ul_now_ms)
+{
+	const struct ili9488_bus *p_bus = p_opt->p_bus ? p_opt->p_bus
+			: &ILI9488_BUS_DEFAULT;
+
+	/* The pixels are packed for the format of the build, not the bus */
+	if (p_bus->format != ILI9488_BUS_FORMAT) {
+		g_init_state = ILI9488_INIT_FAILED;
+		return;
+	}
+
+	ILI9488_PROF_ENTER(ILI9488_PROF_INIT);
+	g_p_bus = p_bus;
+	g_p_bus->init();
+
+	ili9488_write_register(ILI9488_CMD_SOFTWARE_RESET, 0x0000, 0);
+	g_p_init_opt = p_opt;
+	g_init_state = ILI9488_INIT_BUSY;
+	g_init_step = ILI9488_STEP_SLEEP_OUT;
+	/* One more: the clock may be about to tick when it is read */
+	g_ul_init_due_ms = ul_now_ms + ILI9488_RESET_WAIT_MS + 1;
+	ILI9488_PROF_LEAVE();
+}
+
+/**
+ * \brief Run the initialization steps that are due.
+ *
+ * \param ul_now_ms current time in milliseconds, same origin as for
+ * ili9488_init_start().
+ *
+ * \return time at which to call again, or ILI9488_INIT_NO_DEADLINE once
+ * done or failed.
+ */
+uint32_t ili9488_init_poll(uint32_t ul_now_ms)
+{
+	if (g_init_state != ILI9488_INIT_BUSY) {
+		return ILI9488_INIT_NO_DEADLINE;
+	}
+	if ((int32_t)(ul_now_ms - g_ul_init_due_ms) < 0) {
+		return g_ul_init_due_ms;
+	}
+
+	ILI9488_PROF_ENTER(ILI9488_PROF_INIT);
+	switch (g_init_step) {
+	case ILI9488_STEP_SLEEP_OUT:
+		ili9488_write_register(ILI9488_CMD_SLEEP_OUT, 0x0000, 0);
+		g_init_step = ILI9488_STEP_CONFIGURE;
+		g_ul_init_due_ms = ul_now_ms + ILI9488_SLEEP_OUT_WAIT_MS + 1;
+		break;
+	case ILI9488_STEP_CONFIGURE:
+		g_init_state = ili9488_configure(g_p_init_opt)
+				? ILI9488_INIT_DONE : ILI9488_INIT_FAILED;
+		break;
+	}
+	ILI9488_PROF_LEAVE();
+
+	return (g_init_state == ILI9488_INIT_BUSY)
+			? g_ul_init_due_ms : ILI9488_INIT_NO_DEADLINE;
+}
+
+/**
+ * \brief Get the progress of the initialization.
+ */
+enum ili9488_init_state ili9488_init_get_state(void)
+{
+	return g_init_state;
+}
+
+/**
+ * \brief Initialize the ILI9488 lcd driver.
+ *
+ * \note Make sure below works have been done before calling ili9488_init()\n
+ * 1. ILI9488 related Pins have been initialized correctly. \n
+ * 2. SMC has been configured correctly for access ILI9488 (16-bit system interface for now). \n
+ *
+ * Blocks for the waits of the panel, see ili9488_init_start() to overlap
+ * them with other work.
+ *
+ * \param p_opt pointer to ILI9488 option structure.
+ *
+ * \return 0 if initialization succeeds, otherwise fails.
+ */
+uint32_t ili9488_init(struct ili9488_opt_t *p_opt)
+{
+	uint32_t ul_now_ms = 0, ul_due_ms;
+
+	ili9488_init_start(p_opt, ul_now_ms);
+	while ((ul_due_ms = ili9488_init_poll(ul_now_ms)) != ILI9488_INIT_NO_DEADLINE) {
+		delay_ms(ul_due_ms - ul_now_ms);
+		ul_now_ms = ul_due_ms;
+	}
+	return (g_init_state == ILI9488_INIT_DONE) ? 0 : 1;
 }
 
 /**
@@ -715,7 +632,9 @@ uint32_t ili9488_init(struct ili9488_opt_t *p_opt)
  */
 void ili9488_display_on(void)
 {
+	ILI9488_PROF_ENTER(ILI9488_PROF_CONTROL);
 	ili9488_write_register(ILI9488_CMD_DISPLAY_ON, 0, 0);
+	ILI9488_PROF_LEAVE();
 }
 
 /**
@@ -723,7 +642,59 @@ void ili9488_display_on(void)
  */
 void ili9488_display_off(void)
 {
+	ILI9488_PROF_ENTER(ILI9488_PROF_CONTROL);
 	ili9488_write_register(ILI9488_CMD_DISPLAY_OFF, 0x00, 0);
+	ILI9488_PROF_LEAVE();
+}
+
+/**
+ * \brief Turn the idle mode on or off.
+ *
+ * In idle mode the panel shows 8 colours, the most significant bit of each
+ * channel, and draws less power. The frame memory keeps every colour.
+ *
+ * \param b_on true for idle mode.
+ */
+void ili9488_idle_mode(bool b_on)
+{
+	ILI9488_PROF_ENTER(ILI9488_PROF_CONTROL);
+	ili9488_write_register(b_on ? ILI9488_CMD_IDLE_MODE_ON
+			: ILI9488_CMD_IDLE_MODE_OFF, 0x00, 0);
+	ILI9488_PROF_LEAVE();
+}
+
+/**
+ * \brief Show only a band of rows, the partial area.
+ *
+ * The rows outside the band are not refreshed and show the non-display
+ * colour. The frame memory is written as usual and shows again with
+ * ili9488_normal_mode().
+ *
+ * \param us_start first row of the band, in frame memory rows.
+ * \param us_end last row of the band.
+ */
+void ili9488_partial_mode(uint16_t us_start, uint16_t us_end)
+{
+	ili9488_color_t buf[4];
+
+	ILI9488_PROF_ENTER(ILI9488_PROF_CONTROL);
+	buf[0] = (uint8_t)(us_start >> 8);
+	buf[1] = (uint8_t)us_start;
+	buf[2] = (uint8_t)(us_end >> 8);
+	buf[3] = (uint8_t)us_end;
+	ili9488_write_register(ILI9488_CMD_PARTIAL_AREA, buf, 4);
+	ili9488_write_register(ILI9488_CMD_PARTIAL_MODE_ON, 0x00, 0);
+	ILI9488_PROF_LEAVE();
+}
+
+/**
+ * \brief Leave the partial mode, every row shows again.
+ */
+void ili9488_normal_mode(void)
+{
+	ILI9488_PROF_ENTER(ILI9488_PROF_CONTROL);
+	ili9488_write_register(ILI9488_CMD_NORMAL_DISP_MODE_ON, 0x00, 0);
+	ILI9488_PROF_LEAVE();
 }
 
 /**
@@ -733,19 +704,14 @@ void ili9488_display_off(void)
  */
 void ili9488_set_foreground_color(uint32_t ul_color)
 {
-	uint32_t i;
+	/* The cache may still be streamed by a pending fill */
+	ili9488_bus_sync();
 #ifdef ILI9488_EBIMODE
 	/* Fill the cache with selected color */
-	for (i = 0; i < LCD_DATA_CACHE_SIZE; ++i) {
-		g_ul_pixel_cache[i] = ul_color;
-	}
+	ili9488_pixel_fill16(g_ul_pixel_cache, ul_color, LCD_DATA_CACHE_SIZE);
 #endif
 #ifdef ILI9488_SPIMODE
-	for (i = 0; i < LCD_DATA_CACHE_SIZE * LCD_DATA_COLOR_UNIT; ) {
-		g_ul_pixel_cache[i++] = ul_color>>16;
-		g_ul_pixel_cache[i++] = ul_color>>8;
-		g_ul_pixel_cache[i++] = ul_color&0xFF;
-	}
+	ili9488_pixel_fill_rgb666(g_ul_pixel_cache, ul_color, LCD_DATA_CACHE_SIZE);
 #endif
 }
 
@@ -758,12 +724,15 @@ void ili9488_fill(ili9488_color_t ul_color)
 {
 	uint32_t dw;
 
+	ILI9488_PROF_ENTER(ILI9488_PROF_FILL);
+
 	ili9488_set_cursor_position(0, 0);
 	ili9488_write_ram_prepare();
 
 	for (dw = ILI9488_LCD_WIDTH * ILI9488_LCD_HEIGHT; dw > 0; dw--) {
 		ili9488_write_ram(ul_color);
 	}
+	ILI9488_PROF_LEAVE();
 }
 
 /**
@@ -778,23 +747,27 @@ void ili9488_set_cursor_position(uint16_t x, uint16_t y)
 	uint32_t cnt = 0;
 
 	ili9488_color_t buf[4];
+
+	ILI9488_PROF_ENTER(ILI9488_PROF_WINDOW);
+
 	cnt = sizeof(buf)/sizeof(ili9488_color_t);
 
-	buf[0] = get_8b_to_16b(x);
-	buf[1] = get_0b_to_8b(x);
-	buf[2] = get_8b_to_16b(x);
-	buf[3] = get_0b_to_8b(x);
+	buf[0] = (uint8_t)(x >> 8);
+	buf[1] = (uint8_t)x;
+	buf[2] = (uint8_t)(x >> 8);
+	buf[3] = (uint8_t)x;
 	ili9488_write_register(ILI9488_CMD_COLUMN_ADDRESS_SET, buf, cnt);
 	ili9488_write_register(ILI9488_CMD_NOP, 0, 0);
 
 
 	/* Set Horizontal Address End Position */
-	buf[0] = get_8b_to_16b(y);
-	buf[1] = get_0b_to_8b(y);
-	buf[2] = get_8b_to_16b(y);
-	buf[3] = get_0b_to_8b(y);
+	buf[0] = (uint8_t)(y >> 8);
+	buf[1] = (uint8_t)y;
+	buf[2] = (uint8_t)(y >> 8);
+	buf[3] = (uint8_t)y;
 	ili9488_write_register(ILI9488_CMD_PAGE_ADDRESS_SET, buf, cnt);
 	ili9488_write_register(ILI9488_CMD_NOP, 0, 0);
+	ILI9488_PROF_LEAVE();
 }
 
 /**
@@ -809,18 +782,21 @@ void ili9488_scroll(uint16_t ul_tfa, uint16_t ul_vsa, uint16_t ul_bfa)
 	uint32_t cnt = 0;
 	ili9488_color_t buf[6];
 
+	ILI9488_PROF_ENTER(ILI9488_PROF_CONTROL);
+
 	cnt = sizeof(buf)/sizeof(ili9488_color_t);
 
-	buf[0] = get_8b_to_16b(ul_tfa);
-	buf[1] = get_0b_to_8b(ul_tfa);
+	buf[0] = (uint8_t)(ul_tfa >> 8);
+	buf[1] = (uint8_t)ul_tfa;
 
-	buf[2] = get_8b_to_16b(ul_vsa);
-	buf[3] = get_0b_to_8b(ul_vsa);
+	buf[2] = (uint8_t)(ul_vsa >> 8);
+	buf[3] = (uint8_t)ul_vsa;
 
-	buf[4] = get_8b_to_16b(ul_bfa);
-	buf[5] = get_0b_to_8b(ul_bfa);
+	buf[4] = (uint8_t)(ul_bfa >> 8);
+	buf[5] = (uint8_t)ul_bfa;
 
 	ili9488_write_register(ILI9488_CMD_VERT_SCROLL_DEFINITION, buf, cnt);
+	ILI9488_PROF_LEAVE();
 }
 
 /**
@@ -833,11 +809,67 @@ void ili9488_set_scroll_address(uint16_t ul_vsp)
 	uint32_t cnt = 0;
 
 	ili9488_color_t buf[2];
+
+	ILI9488_PROF_ENTER(ILI9488_PROF_CONTROL);
+
 	cnt = sizeof(buf)/sizeof(ili9488_color_t);
 
-	buf[0] = get_8b_to_16b(ul_vsp);
-	buf[1] = get_0b_to_8b(ul_vsp);
+	buf[0] = (uint8_t)(ul_vsp >> 8);
+	buf[1] = (uint8_t)ul_vsp;
 	ili9488_write_register(ILI9488_CMD_VERT_SCROLL_START_ADDRESS, buf, cnt);
+	ILI9488_PROF_LEAVE();
+}
+
+/**
+ * \brief Enable the tearing effect output.
+ *
+ * The TE line goes high when the refresh reaches the given line, V-blank
+ * information only.
+ *
+ * \param us_line Scanline of the TE pulse, ILI9488_LCD_HEIGHT for the start
+ * of the vertical blanking.
+ */
+void ili9488_set_tear_scanline(uint16_t us_line)
+{
+	ili9488_color_t buf[2];
+	ili9488_color_t mode = 0x00;
+
+	ILI9488_PROF_ENTER(ILI9488_PROF_CONTROL);
+
+	buf[0] = (uint8_t)(us_line >> 8);
+	buf[1] = (uint8_t)us_line;
+	ili9488_write_register(ILI9488_CMD_SET_TEAR_SCANLINE, buf, 2);
+	ili9488_write_register(ILI9488_CMD_TEARING_EFFECT_LINE_ON, &mode, 1);
+	ILI9488_PROF_LEAVE();
+}
+
+/**
+ * \brief Disable the tearing effect output.
+ */
+void ili9488_tearing_effect_off(void)
+{
+	ILI9488_PROF_ENTER(ILI9488_PROF_CONTROL);
+	ili9488_write_register(ILI9488_CMD_TEARING_EFFECT_LINE_OFF, 0, 0);
+	ILI9488_PROF_LEAVE();
+}
+
+/**
+ * \brief Get the line the panel is refreshing.
+ *
+ * Waits for the pending GRAM transfers first.
+ *
+ * \return 0 to ILI9488_LCD_HEIGHT - 1 in the active area, larger values in the
+ * vertical blanking.
+ */
+uint16_t ili9488_get_scanline(void)
+{
+	uint16_t us_line;
+
+	ILI9488_PROF_ENTER(ILI9488_PROF_READ);
+	ili9488_bus_sync();
+	us_line = ili9488_read_scanline();
+	ILI9488_PROF_LEAVE();
+	return us_line;
 }
 
 /**
@@ -854,12 +886,15 @@ uint32_t ili9488_draw_pixel(uint32_t ul_x, uint32_t ul_y)
 		return 1;
 	}
 
+	ILI9488_PROF_ENTER(ILI9488_PROF_PIXEL);
+
 	/* Set cursor */
 	ili9488_set_cursor_position(ul_x, ul_y);
 
 	/* Prepare to write in GRAM */
 	ili9488_write_ram_prepare();
-	ili9488_write_ram_buffer(g_ul_pixel_cache, LCD_DATA_COLOR_UNIT);
+	ili9488_write_ram_buffer(g_ul_pixel_cache, LCD_DATA_COLOR_UNIT, 1);
+	ILI9488_PROF_LEAVE();
 	return 0;
 }
 
@@ -958,11 +993,13 @@ static void ili9488_draw_line_bresenham(uint32_t ul_x1, uint32_t ul_y1,
 void ili9488_draw_line(uint32_t ul_x1, uint32_t ul_y1,
 		uint32_t ul_x2, uint32_t ul_y2)
 {
+	ILI9488_PROF_ENTER(ILI9488_PROF_LINE);
 	if ((ul_y1 == ul_y2) || (ul_x1 == ul_x2)) {
 		ili9488_draw_filled_rectangle(ul_x1, ul_y1, ul_x2, ul_y2);
 	} else {
 		ili9488_draw_line_bresenham(ul_x1, ul_y1, ul_x2, ul_y2);
 	}
+	ILI9488_PROF_LEAVE();
 }
 
 /**
@@ -976,6 +1013,7 @@ void ili9488_draw_line(uint32_t ul_x1, uint32_t ul_y1,
 void ili9488_draw_rectangle(uint32_t ul_x1, uint32_t ul_y1,
 		uint32_t ul_x2, uint32_t ul_y2)
 {
+	ILI9488_PROF_ENTER(ILI9488_PROF_RECTANGLE);
 	ili9488_check_box_coordinates(&ul_x1, &ul_y1, &ul_x2, &ul_y2);
 
 	ili9488_draw_filled_rectangle(ul_x1, ul_y1, ul_x2, ul_y1);
@@ -983,6 +1021,7 @@ void ili9488_draw_rectangle(uint32_t ul_x1, uint32_t ul_y1,
 
 	ili9488_draw_filled_rectangle(ul_x1, ul_y1, ul_x1, ul_y2);
 	ili9488_draw_filled_rectangle(ul_x2, ul_y1, ul_x2, ul_y2);
+	ILI9488_PROF_LEAVE();
 }
 
 /**
@@ -998,6 +1037,8 @@ void ili9488_draw_filled_rectangle(uint32_t ul_x1, uint32_t ul_y1,
 {
 	uint32_t size, blocks;
 
+	ILI9488_PROF_ENTER(ILI9488_PROF_FILLED_RECTANGLE);
+
 	/* Swap coordinates if necessary */
 	ili9488_check_box_coordinates(&ul_x1, &ul_y1, &ul_x2, &ul_y2);
 
@@ -1010,16 +1051,20 @@ void ili9488_draw_filled_rectangle(uint32_t ul_x1, uint32_t ul_y1,
 	size = (ul_x2 - ul_x1 + 1) * (ul_y2 - ul_y1 + 1);
 	/* Send pixels blocks => one SPI IT / block */
 	blocks = size / LCD_DATA_CACHE_SIZE;
-	while (blocks--) {
-		ili9488_write_ram_buffer(g_ul_pixel_cache, LCD_DATA_CACHE_SIZE * LCD_DATA_COLOR_UNIT);
+	if (blocks) {
+		ili9488_write_ram_buffer(g_ul_pixel_cache, LCD_DATA_CACHE_SIZE * LCD_DATA_COLOR_UNIT, blocks);
 	}
 
 	/* Send remaining pixels */
-	ili9488_write_ram_buffer(g_ul_pixel_cache, (size % LCD_DATA_CACHE_SIZE) * LCD_DATA_COLOR_UNIT);
+	if (size % LCD_DATA_CACHE_SIZE) {
+		ili9488_write_ram_buffer(g_ul_pixel_cache, (size % LCD_DATA_CACHE_SIZE) * LCD_DATA_COLOR_UNIT, 1);
+	}
 
+#ifndef ILI9488_SPI_DMA
 	/* Reset the refresh window area */
 	ili9488_set_window(0, 0, ILI9488_LCD_WIDTH, ILI9488_LCD_HEIGHT);
-
+#endif
+	ILI9488_PROF_LEAVE();
 }
 
 /**
@@ -1041,6 +1086,8 @@ uint32_t ili9488_draw_circle(uint32_t ul_x, uint32_t ul_y, uint32_t ul_r)
 		return 1;
 	}
 
+	ILI9488_PROF_ENTER(ILI9488_PROF_CIRCLE);
+
 	d = 3 - (ul_r << 1);
 	curX = 0;
 	curY = ul_r;
@@ -1064,6 +1111,7 @@ uint32_t ili9488_draw_circle(uint32_t ul_x, uint32_t ul_y, uint32_t ul_r)
 		curX++;
 	}
 
+	ILI9488_PROF_LEAVE();
 	return 0;
 }
 
@@ -1087,6 +1135,8 @@ uint32_t ili9488_draw_filled_circle(uint32_t ul_x, uint32_t ul_y, uint32_t ul_r)
 		return 1;
 	}
 
+	ILI9488_PROF_ENTER(ILI9488_PROF_CIRCLE);
+
 	d = 3 - (ul_r << 1);
 	dwCurX = 0;
 	dwCurY = ul_r;
@@ -1111,6 +1161,7 @@ uint32_t ili9488_draw_filled_circle(uint32_t ul_x, uint32_t ul_y, uint32_t ul_r)
 		dwCurX++;
 	}
 
+	ILI9488_PROF_LEAVE();
 	return 0;
 }
 
@@ -1125,14 +1176,81 @@ uint32_t ili9488_draw_filled_circle(uint32_t ul_x, uint32_t ul_y, uint32_t ul_r)
 void ili9488_draw_prepare(uint32_t ul_x, uint32_t ul_y, uint32_t ul_width,
 		uint32_t ul_height)
 {
-	/* Determine the refresh window area */
+	ILI9488_PROF_ENTER(ILI9488_PROF_WINDOW);
+	/* Determine the refresh window area, the GRAM pointer is moved to its
+	 * upper-left corner by the memory write command */
 	ili9488_set_window(ul_x, ul_y, ul_width, ul_height);
 
-	/* Set cursor */
-	ili9488_set_cursor_position(ul_x, ul_y);
-
 	/* Prepare to write in GRAM */
 	ili9488_write_ram_prepare();
+	ILI9488_PROF_LEAVE();
+}
+
+/**
+ * \brief Send pixel data to the window opened by ili9488_draw_prepare().
+ *
+ * Can be called several times to stream a window in chunks. With
+ * ILI9488_SPI_DMA the data is only queued: the buffer must not be modified
+ * before ili9488_sync() returns.
+ *
+ * \param p_ul_data pixel data, in the same format as ili9488_draw_pixmap().
+ * \param ul_size size of the data in ili9488_color_t units.
+ */
+void ili9488_draw_stream(const ili9488_color_t *p_ul_data, uint32_t ul_size)
+{
+	ILI9488_PROF_ENTER(ILI9488_PROF_STREAM);
+	if (ul_size) {
+		ili9488_write_ram_buffer(p_ul_data, ul_size, 1);
+	}
+	ILI9488_PROF_LEAVE();
+}
+
+/**
+ * \brief Send RGB565 pixels to the window opened by ili9488_draw_prepare().
+ *
+ * In SPI mode the panel only takes 18-bit pixels: the data is expanded into
+ * two line buffers used alternately, so the conversion of a line overlaps the
+ * transfer of the previous one. The source buffer can be reused as soon as
+ * the function returns. In EBI mode it is sent as is.
+ *
+ * \param p_us_data pixels, one RGB565 value each.
+ * \param ul_count number of pixels.
+ */
+void ili9488_draw_stream_rgb565(const uint16_t *p_us_data, uint32_t ul_count)
+{
+#ifdef ILI9488_EBIMODE
+	ILI9488_PROF_ENTER(ILI9488_PROF_STREAM);
+	ili9488_draw_stream(p_us_data, ul_count);
+#endif
+#ifdef ILI9488_SPIMODE
+	static uint8_t uc_line[2][LCD_DATA_CACHE_SIZE * LCD_DATA_COLOR_UNIT];
+	static uint32_t ul_buf = 0;
+	uint32_t n;
+
+	ILI9488_PROF_ENTER(ILI9488_PROF_STREAM);
+
+	while (ul_count) {
+		n = Min(ul_count, LCD_DATA_CACHE_SIZE);
+		ili9488_pixel_rgb565_to_rgb666(uc_line[ul_buf], p_us_data, n);
+		p_us_data += n;
+		/* The other line must be sent before this one is queued */
+		ili9488_bus_sync();
+		ili9488_draw_stream(uc_line[ul_buf], n * LCD_DATA_COLOR_UNIT);
+		ul_buf ^= 1;
+		ul_count -= n;
+	}
+#endif
+	ILI9488_PROF_LEAVE();
+}
+
+/**
+ * \brief Wait until all pixel data queued to the LCD has been sent.
+ */
+void ili9488_sync(void)
+{
+	ILI9488_PROF_ENTER(ILI9488_PROF_SYNC);
+	ili9488_bus_sync();
+	ILI9488_PROF_LEAVE();
 }
 
 /**
@@ -1182,6 +1300,8 @@ void ili9488_draw_string(uint32_t ul_x, uint32_t ul_y, const uint8_t *p_str)
 {
 	uint32_t xorg = ul_x;
 
+	ILI9488_PROF_ENTER(ILI9488_PROF_STRING);
+
 	while (*p_str != 0) {
 		/* If newline, jump to the next line (font height + 2) */
 		if (*p_str == '\n') {
@@ -1194,6 +1314,7 @@ void ili9488_draw_string(uint32_t ul_x, uint32_t ul_y, const uint8_t *p_str)
 		}
 		p_str++;
 	}
+	ILI9488_PROF_LEAVE();
 }
 
 /**
@@ -1210,6 +1331,9 @@ void ili9488_draw_pixmap(uint32_t ul_x, uint32_t ul_y, uint32_t ul_width,
 {
 	uint32_t size;
 	uint32_t dwX1, dwY1, dwX2, dwY2;
+
+	ILI9488_PROF_ENTER(ILI9488_PROF_PIXMAP);
+
 	dwX1 = ul_x;
 	dwY1 = ul_y;
 	dwX2 = ul_x + ul_width - 1;
@@ -1221,12 +1345,49 @@ void ili9488_draw_pixmap(uint32_t ul_x, uint32_t ul_y, uint32_t ul_width,
 	/* Determine the refresh window area */
 	ili9488_set_window(dwX1, dwY1, (dwX2 - dwX1 + 1), (dwY2 - dwY1 + 1));
 
-	size = (dwX2 - dwX1) * (dwY2 - dwY1);
+	size = (dwX2 - dwX1 + 1) * (dwY2 - dwY1 + 1);
 
-	ili9488_write_register(ILI9488_CMD_MEMORY_WRITE, p_ul_pixmap, size * LCD_DATA_COLOR_UNIT);
+	ili9488_write_ram_prepare();
+	ili9488_write_ram_buffer(p_ul_pixmap, size * LCD_DATA_COLOR_UNIT, 1);
 
+#ifndef ILI9488_SPI_DMA
 	/* Reset the refresh window area */
 	ili9488_set_window(0, 0, ILI9488_LCD_WIDTH, ILI9488_LCD_HEIGHT);
+#endif
+	ILI9488_PROF_LEAVE();
+}
+
+/**
+ * \brief Draw a RGB565 pixmap on LCD.
+ *
+ * \param ul_x X coordinate of upper-left corner on LCD.
+ * \param ul_y Y coordinate of upper-left corner on LCD.
+ * \param ul_width width of the picture.
+ * \param ul_height height of the picture.
+ * \param p_us_pixmap pixmap of the image, one RGB565 value per pixel.
+ */
+void ili9488_draw_pixmap_rgb565(uint32_t ul_x, uint32_t ul_y, uint32_t ul_width,
+		uint32_t ul_height, const uint16_t *p_us_pixmap)
+{
+	uint32_t dwX1, dwY1, dwX2, dwY2, y;
+
+	ILI9488_PROF_ENTER(ILI9488_PROF_PIXMAP);
+
+	dwX1 = ul_x;
+	dwY1 = ul_y;
+	dwX2 = ul_x + ul_width - 1;
+	dwY2 = ul_y + ul_height - 1;
+
+	/* Swap coordinates if necessary */
+	ili9488_check_box_coordinates(&dwX1, &dwY1, &dwX2, &dwY2);
+
+	ili9488_draw_prepare(dwX1, dwY1, (dwX2 - dwX1 + 1), (dwY2 - dwY1 + 1));
+
+	for (y = dwY1; y <= dwY2; y++) {
+		ili9488_draw_stream_rgb565(p_us_pixmap + (y - ul_y) * ul_width + (dwX1 - ul_x),
+				dwX2 - dwX1 + 1);
+	}
+	ILI9488_PROF_LEAVE();
 }
 
 /**
@@ -1238,7 +1399,9 @@ void ili9488_draw_pixmap(uint32_t ul_x, uint32_t ul_y, uint32_t ul_width,
  */
 void ili9488_write_brightness(uint16_t us_value)
 {
+	ILI9488_PROF_ENTER(ILI9488_PROF_CONTROL);
 	ili9488_write_register(ILI9488_CMD_WRITE_DISPLAY_BRIGHTNESS, (ili9488_color_t *)&us_value, 1);
+	ILI9488_PROF_LEAVE();
 }
 
 
@@ -1306,6 +1469,8 @@ void ili9488_set_orientation(uint8_t flags)
 	/* Flip X/Y and reverse X orientation and set BGR mode*/
 	ili9488_color_t madctl = 0x68;
 
+	ILI9488_PROF_ENTER(ILI9488_PROF_CONTROL);
+
 	if (flags & ILI9488_FLIP_X) {
 		madctl &= ~(1 << 6);
 	}
@@ -1319,6 +1484,7 @@ void ili9488_set_orientation(uint8_t flags)
 	}
 
 	ili9488_write_register(ILI9488_CMD_MEMORY_ACCESS_CONTROL, &madctl, 1);
+	ILI9488_PROF_LEAVE();
 }
 
 /**
@@ -1338,8 +1504,13 @@ void ili9488_set_orientation(uint8_t flags)
  */
 uint16_t ili9488_read_gram(void)
 {
+	uint16_t color;
+
+	ILI9488_PROF_ENTER(ILI9488_PROF_READ);
 	ili9488_set_cursor_position(limit_start_x, limit_start_y);
-	return ili9488_read_ram();
+	color = ili9488_read_ram();
+	ILI9488_PROF_LEAVE();
+	return color;
 }
 
 /**
@@ -1358,6 +1529,7 @@ uint16_t ili9488_read_gram(void)
  */
 void ili9488_write_gram(uint16_t color)
 {
+	ILI9488_PROF_ENTER(ILI9488_PROF_GFX);
 	ili9488_set_cursor_position(limit_start_x, limit_start_y);
 	ili9488_write_ram_prepare();
 #ifdef ILI9488_EBIMODE
@@ -1369,6 +1541,7 @@ void ili9488_write_gram(uint16_t color)
 	ili9488_write_ram(color_666 >> 8);
 	ili9488_write_ram(color_666 & 0xFF);
 #endif
+	ILI9488_PROF_LEAVE();
 }
 
 /**
@@ -1388,6 +1561,7 @@ void ili9488_write_gram(uint16_t color)
  */
 void ili9488_copy_pixels_to_screen(const uint16_t *pixels, uint32_t count)
 {
+	ILI9488_PROF_ENTER(ILI9488_PROF_GFX);
 	ili9488_set_window(limit_start_x, limit_start_y, (limit_end_x - limit_start_x) + 1, (limit_end_y - limit_start_y) + 1);
 
 #ifdef ILI9488_EBIMODE
@@ -1404,6 +1578,7 @@ void ili9488_copy_pixels_to_screen(const uint16_t *pixels, uint32_t count)
 		pixels++;
 	}
 #endif
+	ILI9488_PROF_LEAVE();
 }
 
 /**
@@ -1424,6 +1599,7 @@ void ili9488_copy_pixels_to_screen(const uint16_t *pixels, uint32_t count)
  */
 void ili9488_duplicate_pixel(const uint16_t color, uint32_t count)
 {
+	ILI9488_PROF_ENTER(ILI9488_PROF_GFX);
 	ili9488_set_window(limit_start_x, limit_start_y, (limit_end_x - limit_start_x) + 1, (limit_end_y - limit_start_y) + 1);
 	ili9488_write_ram_prepare();
 
@@ -1440,6 +1616,7 @@ void ili9488_duplicate_pixel(const uint16_t color, uint32_t count)
 		ili9488_write_ram(color_666 & 0xFF);
 	}
 #endif
+	ILI9488_PROF_LEAVE();
 }
 
 /**
@@ -1459,23 +1636,10 @@ void ili9488_duplicate_pixel(const uint16_t color, uint32_t count)
  */
 void ili9488_copy_pixels_from_screen(uint16_t *pixels, uint32_t count)
 {
+	ILI9488_PROF_ENTER(ILI9488_PROF_READ);
 	ili9488_set_window(limit_start_x, limit_start_y, (limit_end_x - limit_start_x) + 1, (limit_end_y - limit_start_y) + 1);
-	ili9488_write_register(ILI9488_CMD_MEMORY_READ, 0x0000, 0);
-#ifdef ILI9488_EBIMODE
-	pio_set(PIN_EBI_CDS_PIO, PIN_EBI_CDS_MASK);
-	LCD_MULTI_RD(pixels, count);
-#endif
-#ifdef ILI9488_SPIMODE
-	ili9488_color_t grambuf[3];
-	pio_set_pin_high(LCD_SPI_CDS_PIO);
-	spi_read_packet(BOARD_ILI9488_SPI, grambuf, 1);
-	while (count--) {
-		spi_read_packet(BOARD_ILI9488_SPI, grambuf, 3);
-
-		*pixels = ILI9488_COLOR(grambuf[0], grambuf[1], grambuf[2]);
-		pixels++;
-	}
-#endif
+	g_p_bus->read_pixels(pixels, count);
+	ILI9488_PROF_LEAVE();
 }
 
 /// @cond 0
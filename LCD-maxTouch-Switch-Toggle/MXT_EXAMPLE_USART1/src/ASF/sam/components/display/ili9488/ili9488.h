@@ -99,6 +99,22 @@ typedef union _union_type
 /* ILI9488 ID code */
 #define ILI9488_DEVICE_CODE (0x9488u)
 
+/**
+ * Wait after SOFTWARE_RESET before SLEEP_OUT: 5 ms when the panel was
+ * sleeping, 120 ms when it was not, which is unknown after an MCU reset.
+ */
+#ifndef ILI9488_RESET_WAIT_MS
+#  define ILI9488_RESET_WAIT_MS     120
+#endif
+
+/** Wait after SLEEP_OUT before the next command. */
+#ifndef ILI9488_SLEEP_OUT_WAIT_MS
+#  define ILI9488_SLEEP_OUT_WAIT_MS 5
+#endif
+
+/** ili9488_init_poll() has nothing more to wait for. */
+#define ILI9488_INIT_NO_DEADLINE  0xFFFFFFFFu
+
 /* Level 1 Commands (from the display Datasheet) */
 #define ILI9488_CMD_NOP                             0x00
 #define ILI9488_CMD_SOFTWARE_RESET                  0x01
@@ -295,6 +311,8 @@ typedef union _union_type
 			((((uint16_t)g) << 3) & 0x07E0) |\
 			((((uint16_t)r) << 8) & 0xf800))
 
+struct ili9488_bus;
+
 /**
  * Input parameters when initializing ili9488 driver.
  */
@@ -303,6 +321,7 @@ struct ili9488_opt_t{
 	uint32_t ul_height;         //!< lcd height in pixel
 	uint32_t foreground_color;  //!< lcd foreground color
 	uint32_t background_color;  //!< lcd background color
+	const struct ili9488_bus *p_bus; //!< bus backend of the build's pixel format, NULL for ILI9488_BUS_DEFAULT
 };
 
 /**
@@ -315,6 +334,15 @@ struct ili9488_font{
 	uint8_t height;
 };
 
+/**
+ * Progress of ili9488_init_start().
+ */
+enum ili9488_init_state {
+	ILI9488_INIT_BUSY,     //!< waiting for the panel
+	ILI9488_INIT_DONE,     //!< configured and displaying
+	ILI9488_INIT_FAILED,   //!< wrong chip ID, or bus of another pixel format
+};
+
 /**
  * Display direction option
  */
@@ -325,15 +353,24 @@ enum ili9488_display_direction{
 
 
 uint32_t ili9488_init(struct ili9488_opt_t *p_opt);
+void ili9488_init_start(struct ili9488_opt_t *p_opt, uint32_t ul_now_ms);
+uint32_t ili9488_init_poll(uint32_t ul_now_ms);
+enum ili9488_init_state ili9488_init_get_state(void);
 void ili9488_set_display_direction(enum ili9488_display_direction direction);
 void ili9488_set_window( uint16_t dwX, uint16_t dwY, uint16_t dwWidth, uint16_t dwHeight );
 void ili9488_display_on(void);
 void ili9488_display_off(void);
+void ili9488_idle_mode(bool b_on);
+void ili9488_partial_mode(uint16_t us_start, uint16_t us_end);
+void ili9488_normal_mode(void);
 void ili9488_set_foreground_color(uint32_t ul_color);
 void ili9488_fill(ili9488_color_t ul_color);
 void ili9488_set_cursor_position(uint16_t us_x, uint16_t us_y);
 void ili9488_scroll(uint16_t ul_tfa, uint16_t ul_lines, uint16_t ul_bfa);
 void ili9488_set_scroll_address(uint16_t ul_vsp);
+void ili9488_set_tear_scanline(uint16_t us_line);
+void ili9488_tearing_effect_off(void);
+uint16_t ili9488_get_scanline(void);
 uint32_t ili9488_draw_pixel(uint32_t ul_x, uint32_t ul_y);
 ili9488_color_t ili9488_get_pixel(uint32_t ul_x, uint32_t ul_y);
 void ili9488_draw_line(uint32_t ul_x1, uint32_t ul_y1,
@@ -346,9 +383,14 @@ uint32_t ili9488_draw_circle(uint32_t ul_x, uint32_t ul_y, uint32_t ul_r);
 uint32_t ili9488_draw_filled_circle(uint32_t ul_x, uint32_t ul_y, uint32_t ul_r);
 void ili9488_draw_prepare(uint32_t ul_x, uint32_t ul_y, uint32_t ul_width,
 		    uint32_t ul_height);
+void ili9488_draw_stream(const ili9488_color_t *p_ul_data, uint32_t ul_size);
+void ili9488_draw_stream_rgb565(const uint16_t *p_us_data, uint32_t ul_count);
+void ili9488_sync(void);
 void ili9488_draw_string(uint32_t ul_x, uint32_t ul_y, const uint8_t *p_str);
 void ili9488_draw_pixmap(uint32_t ul_x, uint32_t ul_y, uint32_t ul_width,
 		uint32_t ul_height, const ili9488_color_t *p_ul_pixmap);
+void ili9488_draw_pixmap_rgb565(uint32_t ul_x, uint32_t ul_y, uint32_t ul_width,
+		uint32_t ul_height, const uint16_t *p_us_pixmap);
 void ili9488_delay(uint32_t ul_ms);
 void ili9488_write_brightness(uint16_t us_value);
 uint16_t ili9488_read_gram(void);
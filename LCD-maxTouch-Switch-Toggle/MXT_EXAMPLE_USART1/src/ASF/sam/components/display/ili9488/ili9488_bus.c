@@ -0,0 +1,109 @@
+/**
+ * \file
+ *
+ * \brief Time of a full screen fill and blit on the bus backend in use.
+ *
+ * Only built with ILI9488_BUS_BENCH. The host has a bench of its own,
+ * host/bus_bench.c, that compares the SPI backend with the panel model
+ * fake on the virtual clock.
+ */
+
+#include "ili9488_bus.h"
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+ extern "C" {
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+#ifdef ILI9488_BUS_BENCH
+
+#include <stdio.h>
+#include "sysclk.h"
+
+#define ILI9488_BUS_BENCH_RUNS  4
+
+static uint16_t g_us_bench_line[ILI9488_LCD_HEIGHT];
+
+static uint32_t ili9488_bus_bench_fill(uint32_t ul_width, uint32_t ul_height)
+{
+	ili9488_set_foreground_color(COLOR_CONVERT(COLOR_BLUE));
+	ili9488_draw_filled_rectangle(0, 0, ul_width - 1, ul_height - 1);
+	ili9488_sync();
+	return ul_width * ul_height;
+}
+
+static uint32_t ili9488_bus_bench_blit(uint32_t ul_width, uint32_t ul_height)
+{
+	uint32_t y;
+
+	ili9488_draw_prepare(0, 0, ul_width, ul_height);
+	for (y = 0; y < ul_height; y++) {
+		ili9488_draw_stream_rgb565(g_us_bench_line, ul_width);
+	}
+	ili9488_sync();
+	return ul_width * ul_height;
+}
+
+static void ili9488_bus_bench_print(const char *p_name,
+		uint32_t (*run)(uint32_t, uint32_t), uint32_t ul_width,
+		uint32_t ul_height)
+{
+	uint32_t ul_best = UINT32_MAX, ul_start, ul_cycles, ul_pixels = 0, i;
+	uint32_t ul_mhz = sysclk_get_cpu_hz() / 1000000;
+
+	for (i = 0; i < ILI9488_BUS_BENCH_RUNS; i++) {
+		ul_start = DWT->CYCCNT;
+		ul_pixels = run(ul_width, ul_height);
+		ul_cycles = DWT->CYCCNT - ul_start;
+		ul_best = Min(ul_best, ul_cycles);
+	}
+	/* us = cycles / MHz, pixels per us = Mpx/s */
+	printf("  %-6s %6lu us  %3lu.%02lu Mpx/s\r\n", p_name,
+			(unsigned long)(ul_best / ul_mhz),
+			(unsigned long)((uint64_t)ul_pixels * ul_mhz / ul_best),
+			(unsigned long)((uint64_t)ul_pixels * ul_mhz * 100 / ul_best % 100));
+}
+
+/**
+ * \brief Time a full screen fill and a full screen RGB565 blit on the
+ * backend of p_opt, and print them on the console.
+ *
+ * The best of ILI9488_BUS_BENCH_RUNS runs is kept. The driver must be
+ * initialized with p_opt; the screen is left with the blit pattern.
+ *
+ * \param p_opt options the driver was initialized with.
+ */
+void ili9488_bus_bench(struct ili9488_opt_t *p_opt)
+{
+	const struct ili9488_bus *p_bus = p_opt->p_bus ? p_opt->p_bus
+			: &ILI9488_BUS_DEFAULT;
+	uint32_t i;
+
+	for (i = 0; i < sizeof(g_us_bench_line) / sizeof(g_us_bench_line[0]); i++) {
+		g_us_bench_line[i] = (uint16_t)(i * 0x0841);
+	}
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR = 0xC5ACCE55;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	printf("bus %s, %lux%lu\r\n", p_bus->p_name,
+			(unsigned long)p_opt->ul_width, (unsigned long)p_opt->ul_height);
+	ili9488_bus_bench_print("fill", ili9488_bus_bench_fill, p_opt->ul_width,
+			p_opt->ul_height);
+	ili9488_bus_bench_print("blit", ili9488_bus_bench_blit, p_opt->ul_width,
+			p_opt->ul_height);
+}
+
+#endif /* ILI9488_BUS_BENCH */
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+}
+#endif
+/**INDENT-ON**/
+/// @endcond
@@ -0,0 +1,108 @@
+/**
+ * \file
+ *
+ * \brief Bus backends of the ILI9488 driver.
+ *
+ * Everything ili9488.c sends to or reads from the panel goes through the
+ * operations of one struct ili9488_bus: the 4-wire SPI interface
+ * (ili9488_bus_spi.c), the 16-bit parallel interface on the SMC
+ * (ili9488_bus_smc.c), or a fake for host tests. The backend is given to
+ * ili9488_init() in struct ili9488_opt_t, NULL selecting ILI9488_BUS_DEFAULT.
+ *
+ * The pixel format is still chosen at build time, by ILI9488_SPIMODE or
+ * ILI9488_EBIMODE: it sets ili9488_color_t and LCD_DATA_COLOR_UNIT, which
+ * the callers of ili9488_draw_stream() depend on. A build can only use the
+ * backends of its format, 18-bit pixels in three bytes for SPI and RGB565
+ * in one 16-bit word for the SMC: each backend gives the format it sends,
+ * and ili9488_init_start() fails on one that is not ILI9488_BUS_FORMAT.
+ */
+
+#ifndef ILI9488_BUS_H_INCLUDED
+#define ILI9488_BUS_H_INCLUDED
+
+#include "ili9488.h"
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+ extern "C" {
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+/**
+ * Pixel format a backend sends to the GRAM.
+ */
+enum ili9488_bus_format {
+	ILI9488_BUS_RGB666,    //!< 18-bit pixels, three ili9488_color_t bytes
+	ILI9488_BUS_RGB565,    //!< one 16-bit ili9488_color_t word
+};
+
+/** Format of ili9488_color_t in this build. */
+#ifdef ILI9488_EBIMODE
+#  define ILI9488_BUS_FORMAT  ILI9488_BUS_RGB565
+#else
+#  define ILI9488_BUS_FORMAT  ILI9488_BUS_RGB666
+#endif
+
+/**
+ * Operations of a bus backend. Commands and their parameters are written
+ * synchronously; GRAM data written by write_ram_buffer() may only be queued
+ * and must then stay valid until sync() returns. Every other operation waits
+ * for the queued data first.
+ */
+struct ili9488_bus {
+	const char *p_name;
+	/** Pixel format of the GRAM data, ILI9488_BUS_FORMAT of its build. */
+	enum ili9488_bus_format format;
+	/** Set up the peripheral, before the first command. */
+	void (*init)(void);
+	/** Write a command and its parameters, ul_size of them. */
+	void (*write_register)(uint8_t uc_reg, const ili9488_color_t *p_data,
+			uint32_t ul_size);
+	/** Write one unit of GRAM data after ILI9488_CMD_MEMORY_WRITE. */
+	void (*write_ram)(ili9488_color_t color);
+	/** Write ul_size units of GRAM data ul_repeat times. */
+	void (*write_ram_buffer)(const ili9488_color_t *p_buf, uint32_t ul_size,
+			uint32_t ul_repeat);
+	/** Read the GRAM pixel at the cursor, RGB565. */
+	uint32_t (*read_ram)(void);
+	/** Read the line being refreshed, ILI9488_CMD_GET_SCANLINE. */
+	uint16_t (*read_scanline)(void);
+	/** Read the ID4 code, ILI9488_DEVICE_CODE for a working panel. */
+	uint32_t (*read_chipid)(void);
+	/** Read ul_count GRAM pixels from the window start, RGB565. */
+	void (*read_pixels)(uint16_t *p_us_pixels, uint32_t ul_count);
+	/** Wait until the queued GRAM data has been sent. */
+	void (*sync)(void);
+};
+
+#ifdef ILI9488_SPIMODE
+extern const struct ili9488_bus ili9488_bus_spi;
+#endif
+#ifdef ILI9488_EBIMODE
+extern const struct ili9488_bus ili9488_bus_smc;
+#endif
+
+/** Backend used when struct ili9488_opt_t gives none. */
+#ifndef ILI9488_BUS_DEFAULT
+#  ifdef ILI9488_EBIMODE
+#    define ILI9488_BUS_DEFAULT ili9488_bus_smc
+#  else
+#    define ILI9488_BUS_DEFAULT ili9488_bus_spi
+#  endif
+#endif
+
+#ifdef ILI9488_BUS_BENCH
+void ili9488_bus_bench(struct ili9488_opt_t *p_opt);
+#endif
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+}
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+#endif /* ILI9488_BUS_H_INCLUDED */
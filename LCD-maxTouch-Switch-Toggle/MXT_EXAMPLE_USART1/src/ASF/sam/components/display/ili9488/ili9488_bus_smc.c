@@ -0,0 +1,229 @@
+/**
+ * \file
+ *
+ * \brief 16-bit parallel bus backend of the ILI9488 driver, on the SMC.
+ *
+ * The panel is mapped at BOARD_ILI9488_ADDR on chip select
+ * BOARD_ILI9488_EBI_NPCS, the D/C line is PIN_EBI_CDS. Every pixel is one
+ * RGB565 write, so the CPU stores straight into the panel and nothing is
+ * left pending when a write returns.
+ */
+
+#include "ili9488_bus.h"
+#include "pio.h"
+#ifdef ILI9488_EBIMODE
+#  include "smc.h"
+#  include "pmc.h"
+#endif
+#include "ili9488_prof.h"
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+ extern "C" {
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+#ifdef ILI9488_EBIMODE
+
+/**
+ * \brief Set up the SMC chip select of the panel.
+ */
+static void ili9488_smc_init(void)
+{
+	/* Enable peripheral clock */
+	pmc_enable_periph_clk(ID_SMC);
+
+	/* Configure SMC, NCS3 is assigned to LCD */
+	smc_set_setup_timing(SMC, BOARD_ILI9488_EBI_NPCS, SMC_SETUP_NWE_SETUP(0)
+			| SMC_SETUP_NCS_WR_SETUP(0)
+			| SMC_SETUP_NRD_SETUP(0)
+			| SMC_SETUP_NCS_RD_SETUP(0));
+	smc_set_pulse_timing(SMC, BOARD_ILI9488_EBI_NPCS , SMC_PULSE_NWE_PULSE(3)
+			| SMC_PULSE_NCS_WR_PULSE(0x4)
+			| SMC_PULSE_NRD_PULSE(0xA)
+			| SMC_PULSE_NCS_RD_PULSE(0xA));
+	smc_set_cycle_timing(SMC, BOARD_ILI9488_EBI_NPCS, SMC_CYCLE_NWE_CYCLE(0x4)
+			| SMC_CYCLE_NRD_CYCLE(0xA));
+
+
+	smc_set_mode(SMC, BOARD_ILI9488_EBI_NPCS, SMC_MODE_READ_MODE
+			| SMC_MODE_WRITE_MODE
+			| SMC_MODE_DBW_16_BIT
+			| SMC_MODE_EXNW_MODE_DISABLED
+			| SMC_MODE_TDF_CYCLES(0xF));
+}
+
+/**
+ * \brief Read 32 bit data.
+ */
+static uint32_t ili9488_lcd_get_16(void)
+{
+	uint16_t readbuf[5];
+	uint16_t *ptr, i;
+	uint32_t shift_cnt = 2;
+	uint32_t chipid = 0;
+	uint32_t retval = 0;
+
+	pio_set(PIN_EBI_CDS_PIO, PIN_EBI_CDS_MASK);
+	LCD_MULTI_RD(readbuf, 5);
+	ptr = &readbuf[1];
+	for(i = 1; i < 4; i++) {
+		chipid |= (*ptr &0xFF)<< (shift_cnt << 3);
+		ptr++;
+		shift_cnt--;
+	}
+	retval = chipid;
+	return retval;
+}
+
+/**
+ * \brief Write data to LCD GRAM.
+ *
+ * \param ul_color 16-bits RGB color.
+ */
+static void ili9488_smc_write_ram(ili9488_color_t ul_color)
+{
+	pio_set(PIN_EBI_CDS_PIO, PIN_EBI_CDS_MASK);
+	LCD_WD(ul_color);
+	ILI9488_PROF_GRAM(1);
+}
+
+/**
+ * \brief Write multiple data in buffer to LCD controller.
+ *
+ * \param p_ul_buf data buffer.
+ * \param ul_size size in pixels.
+ * \param ul_repeat number of times the buffer is sent.
+ */
+static void ili9488_smc_write_ram_buffer(const ili9488_color_t *p_ul_buf, uint32_t ul_size,
+		uint32_t ul_repeat)
+{
+	pio_set(PIN_EBI_CDS_PIO, PIN_EBI_CDS_MASK);
+	ILI9488_PROF_GRAM(ul_size * ul_repeat);
+	while (ul_repeat--) {
+		LCD_MULTI_WD(p_ul_buf, ul_size);
+	}
+}
+
+/**
+ * \brief Write data to LCD Register.
+ *
+ * \param uc_reg register address.
+ * \param us_data data to be written.
+ * \param size the number of parameters.
+ */
+static void ili9488_smc_write_register(uint8_t uc_reg, const ili9488_color_t *us_data, uint32_t size)
+{
+	/* CDS pin is set low level when writing command*/
+	pio_clear(PIN_EBI_CDS_PIO, PIN_EBI_CDS_MASK);
+	LCD_IR(uc_reg);
+	ILI9488_PROF_REGISTER(uc_reg, size);
+
+	if(size == 0) {
+		return;
+	}
+
+	/* CDS pin is set high level when writing parameters or image data*/
+	pio_set(PIN_EBI_CDS_PIO, PIN_EBI_CDS_MASK);
+	LCD_MULTI_WD(us_data, size);
+}
+
+/**
+ * \brief Read data to LCD GRAM.
+ *
+ * \note Because pixel data LCD GRAM is 18-bits, so convertion to RGB565 16-bits
+ * will cause low color bit lose.
+ *
+ * \return color 16-bits RGB color.
+ */
+static uint32_t ili9488_smc_read_ram(void)
+{
+	uint16_t value[3] = {0};
+	uint32_t color = 0;
+
+	pio_clear(PIN_EBI_CDS_PIO, PIN_EBI_CDS_MASK);
+	LCD_IR(ILI9488_CMD_MEMORY_READ);/* Write Data to GRAM (R2Eh) */
+
+	pio_set(PIN_EBI_CDS_PIO, PIN_EBI_CDS_MASK);
+	LCD_MULTI_RD(value, 3);
+
+	/* The first data is dummy*/
+	color = ILI9488_COLOR(value[1] >> 8, value[1] & 0xFF, value[2] >> 8);
+	return color;
+}
+
+/**
+ * \brief Read the line the panel is refreshing.
+ */
+static uint16_t ili9488_smc_read_scanline(void)
+{
+	uint16_t value[3] = {0};
+
+	pio_clear(PIN_EBI_CDS_PIO, PIN_EBI_CDS_MASK);
+	LCD_IR(ILI9488_CMD_GET_SCANLINE);
+
+	pio_set(PIN_EBI_CDS_PIO, PIN_EBI_CDS_MASK);
+	LCD_MULTI_RD(value, 3);
+
+	/* The first data is dummy*/
+	return (uint16_t)(((value[1] & 0x03) << 8) | (value[2] & 0xFF));
+}
+
+/**
+ * \brief Read chipid.
+ *
+ * \return chipid value.
+ */
+static uint32_t ili9488_smc_read_chipid(void)
+{
+	pio_clear(PIN_EBI_CDS_PIO, PIN_EBI_CDS_MASK);
+	LCD_IR(ILI9488_CMD_READ_ID4);
+
+	return ili9488_lcd_get_16();
+}
+
+/**
+ * \brief Read GRAM pixels from the start of the window.
+ *
+ * \param pixels receives the pixels, RGB565.
+ * \param count number of pixels.
+ */
+static void ili9488_smc_read_pixels(uint16_t *pixels, uint32_t count)
+{
+	ili9488_smc_write_register(ILI9488_CMD_MEMORY_READ, 0x0000, 0);
+	pio_set(PIN_EBI_CDS_PIO, PIN_EBI_CDS_MASK);
+	LCD_MULTI_RD(pixels, count);
+}
+
+/**
+ * \brief Nothing is ever queued on the SMC.
+ */
+static void ili9488_smc_sync(void)
+{
+}
+
+const struct ili9488_bus ili9488_bus_smc = {
+	.p_name = "SMC 16-bit",
+	.format = ILI9488_BUS_RGB565,
+	.init = ili9488_smc_init,
+	.write_register = ili9488_smc_write_register,
+	.write_ram = ili9488_smc_write_ram,
+	.write_ram_buffer = ili9488_smc_write_ram_buffer,
+	.read_ram = ili9488_smc_read_ram,
+	.read_scanline = ili9488_smc_read_scanline,
+	.read_chipid = ili9488_smc_read_chipid,
+	.read_pixels = ili9488_smc_read_pixels,
+	.sync = ili9488_smc_sync,
+};
+
+#endif /* ILI9488_EBIMODE */
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+}
+#endif
+/**INDENT-ON**/
+/// @endcond
@@ -0,0 +1,247 @@
+/**
+ * \file
+ *
+ * \brief 4-wire SPI bus backend of the ILI9488 driver.
+ *
+ * The D/C line is the LCD_SPI_CDS_PIO pin. Pixels are 18-bit, three bytes
+ * each; with ILI9488_SPI_DMA the GRAM data is streamed by ili9488_dma.c and
+ * write_ram_buffer() returns before it has been sent.
+ */
+
+#include "ili9488_bus.h"
+#include "pio.h"
+#include "spi_master.h"
+#ifdef ILI9488_SPI_DMA
+#  include "ili9488_dma.h"
+#endif
+#include "ili9488_prof.h"
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+ extern "C" {
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+#ifdef ILI9488_SPIMODE
+
+/**
+ * \brief Wait for the pixel data still streamed by the DMA engine.
+ *
+ * Must be called before the D/C line is toggled or the pixel cache is
+ * modified.
+ */
+static void ili9488_spi_sync(void)
+{
+#ifdef ILI9488_SPI_DMA
+	/* Counts the busy wait for the profiler, and polls the channel when
+	 * called with interrupts masked */
+	ili9488_dma_wait();
+#endif
+}
+
+/**
+ * \brief Set up the SPI, and the DMA engine with ILI9488_SPI_DMA.
+ */
+static void ili9488_spi_init(void)
+{
+	struct spi_device ILI9488_SPI_DEVICE = {
+		// Board specific chip select configuration
+		.id = BOARD_ILI9488_SPI_NPCS
+	};
+
+	/* Init, select and configure the chip */
+	spi_master_init(BOARD_ILI9488_SPI);
+	spi_master_setup_device(BOARD_ILI9488_SPI, &ILI9488_SPI_DEVICE, SPI_MODE_3, ILI9488_SPI_BAUDRATE, 0);
+	spi_configure_cs_behavior(BOARD_ILI9488_SPI, BOARD_ILI9488_SPI_NPCS, SPI_CS_RISE_NO_TX);
+	spi_select_device(BOARD_ILI9488_SPI, &ILI9488_SPI_DEVICE);
+
+	/* Enable the SPI peripheral */
+	spi_enable(BOARD_ILI9488_SPI);
+	spi_enable_interrupt(BOARD_ILI9488_SPI, SPI_IER_RDRF);
+#ifdef ILI9488_SPI_DMA
+	ili9488_dma_init();
+#endif
+}
+
+/**
+ * \brief Write data to LCD GRAM.
+ *
+ * \param ul_color one byte of an 18-bit pixel.
+ */
+static void ili9488_spi_write_ram(ili9488_color_t ul_color)
+{
+	ili9488_spi_sync();
+	pio_set_pin_high(LCD_SPI_CDS_PIO);
+	spi_write(BOARD_ILI9488_SPI, ul_color, BOARD_ILI9488_SPI_NPCS, 0);
+	ILI9488_PROF_GRAM(1);
+}
+
+/**
+ * \brief Write multiple data in buffer to LCD controller.
+ *
+ * \note With ILI9488_SPI_DMA the buffer is queued and the function returns
+ * before it has been sent, so it must stay valid until the next register
+ * access.
+ *
+ * \param p_ul_buf data buffer.
+ * \param ul_size size in bytes.
+ * \param ul_repeat number of times the buffer is sent.
+ */
+static void ili9488_spi_write_ram_buffer(const ili9488_color_t *p_ul_buf, uint32_t ul_size,
+		uint32_t ul_repeat)
+{
+	pio_set_pin_high(LCD_SPI_CDS_PIO);
+	ILI9488_PROF_GRAM(ul_size * ul_repeat);
+#ifdef ILI9488_SPI_DMA
+	ili9488_dma_submit(p_ul_buf, ul_size, ul_repeat, NULL, NULL);
+#else
+	volatile uint32_t i;
+	while (ul_repeat--) {
+		spi_write_packet(BOARD_ILI9488_SPI, p_ul_buf, ul_size);
+	}
+	for(i = 0; i < 0xFF; i++);
+	ILI9488_PROF_BUSY(0xFF);
+#endif
+}
+
+/**
+ * \brief Write data to LCD Register.
+ *
+ * \param uc_reg register address.
+ * \param us_data data to be written.
+ * \param size the number of parameters.
+ */
+static void ili9488_spi_write_register(uint8_t uc_reg, const ili9488_color_t *us_data, uint32_t size)
+{
+	volatile uint32_t i;
+
+	ili9488_spi_sync();
+
+	/* Transfer cmd */
+	pio_set_pin_low(LCD_SPI_CDS_PIO);
+	spi_write(BOARD_ILI9488_SPI, uc_reg, BOARD_ILI9488_SPI_NPCS, 0);
+	for(i = 0; i < 0xFF; i++);
+	ILI9488_PROF_REGISTER(uc_reg, size);
+	ILI9488_PROF_BUSY(0xFF);
+
+	if(size > 0) {
+		/* Transfer data */
+		pio_set_pin_high(LCD_SPI_CDS_PIO);
+		spi_write_packet(BOARD_ILI9488_SPI, us_data, size);
+		for(i = 0; i < 0x5F; i++);
+		ILI9488_PROF_BUSY(0x5F);
+	}
+}
+
+/**
+ * \brief Read data to LCD GRAM.
+ *
+ * \note Because pixel data LCD GRAM is 18-bits, so convertion to RGB565 16-bits
+ * will cause low color bit lose.
+ *
+ * \return color 16-bits RGB color.
+ */
+static uint32_t ili9488_spi_read_ram(void)
+{
+	uint8_t grambuf[4];
+	ili9488_spi_write_register(ILI9488_CMD_MEMORY_READ, 0x0000, 0);
+
+	pio_set_pin_high(LCD_SPI_CDS_PIO);
+	spi_read_packet(BOARD_ILI9488_SPI, grambuf, 4);
+	/* The first data is dummy*/
+	return ILI9488_COLOR(grambuf[1], grambuf[2], grambuf[3]);
+}
+
+/**
+ * \brief Read the line the panel is refreshing.
+ */
+static uint16_t ili9488_spi_read_scanline(void)
+{
+	uint8_t buf[3];
+	ili9488_spi_write_register(ILI9488_CMD_GET_SCANLINE, 0x0000, 0);
+
+	pio_set_pin_high(LCD_SPI_CDS_PIO);
+	spi_read_packet(BOARD_ILI9488_SPI, buf, 3);
+	/* The first data is dummy*/
+	return (uint16_t)(((buf[1] & 0x03) << 8) | buf[2]);
+}
+
+/**
+ * \brief Read chipid.
+ *
+ * The SPI interface returns one parameter per read: each byte of ID4 is
+ * selected with the SPI read settings command first.
+ *
+ * \return chipid value.
+ */
+static uint32_t ili9488_spi_read_chipid(void)
+{
+	uint32_t i, chipid = 0;
+	volatile uint32_t j;
+	ili9488_color_t chipidBuf, reg, param;
+
+	reg = 0x81;
+	param = 0x0;
+	for (i = 3; i > 0; i--) {
+		ili9488_spi_write_register(ILI9488_CMD_SPI_READ_SETTINGS, &reg, 1);
+		reg++;
+		for(j = 0; j < 0xFF; j++);
+		ili9488_spi_write_register(ILI9488_CMD_READ_ID4, 0, 0);
+		{
+			pio_set_pin_high(LCD_SPI_CDS_PIO);
+			spi_read_packet(BOARD_ILI9488_SPI, &chipidBuf, 1);
+			for(j = 0; j < 0xFF; j++);
+		}
+		chipid |= (chipidBuf & 0xFF) << ((i - 1) << 3);
+		ili9488_spi_write_register(ILI9488_CMD_SPI_READ_SETTINGS, &param, 1);
+		for(j = 0; j < 0xFFF; j++);
+	}
+	return chipid;
+}
+
+/**
+ * \brief Read GRAM pixels from the start of the window.
+ *
+ * \param pixels receives the pixels, RGB565.
+ * \param count number of pixels.
+ */
+static void ili9488_spi_read_pixels(uint16_t *pixels, uint32_t count)
+{
+	ili9488_color_t grambuf[3];
+
+	ili9488_spi_write_register(ILI9488_CMD_MEMORY_READ, 0x0000, 0);
+	pio_set_pin_high(LCD_SPI_CDS_PIO);
+	spi_read_packet(BOARD_ILI9488_SPI, grambuf, 1);
+	while (count--) {
+		spi_read_packet(BOARD_ILI9488_SPI, grambuf, 3);
+
+		*pixels = ILI9488_COLOR(grambuf[0], grambuf[1], grambuf[2]);
+		pixels++;
+	}
+}
+
+const struct ili9488_bus ili9488_bus_spi = {
+	.p_name = "SPI",
+	.format = ILI9488_BUS_RGB666,
+	.init = ili9488_spi_init,
+	.write_register = ili9488_spi_write_register,
+	.write_ram = ili9488_spi_write_ram,
+	.write_ram_buffer = ili9488_spi_write_ram_buffer,
+	.read_ram = ili9488_spi_read_ram,
+	.read_scanline = ili9488_spi_read_scanline,
+	.read_chipid = ili9488_spi_read_chipid,
+	.read_pixels = ili9488_spi_read_pixels,
+	.sync = ili9488_spi_sync,
+};
+
+#endif /* ILI9488_SPIMODE */
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+}
+#endif
+/**INDENT-ON**/
+/// @endcond
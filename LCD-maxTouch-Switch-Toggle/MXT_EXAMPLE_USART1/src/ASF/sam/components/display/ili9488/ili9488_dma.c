@@ -0,0 +1,474 @@
+/**
+ * \file
+ *
+ * \brief Asynchronous GRAM transfer engine for the ILI9488 SPI interface.
+ *
+ * Submitted transfers are kept in a small ring. Each transfer is a source
+ * buffer sent \c ul_repeat times in a row (a fill sends the same pixel cache
+ * line over and over, a pixmap is sent once). The ring is cut into XDMAC
+ * blocks, two of them at a time: while one block is on the bus the next one
+ * is already cut, and the end of block interrupt re-arms the channel with
+ * it. The blocks are not chained by the XDMAC (no linked list descriptors),
+ * so the SPI idles between two blocks for the interrupt latency; blocks are
+ * as large as the XDMAC allows to keep those gaps rare.
+ *
+ * With ILI9488_DMA_SIMULATED defined the XDMAC is not touched at all: every
+ * block is recorded in a log and pushed out with spi_write_packet(), which
+ * keeps ordering and byte counts observable on a host build.
+ */
+
+#include "ili9488_dma.h"
+#include "ili9488.h"
+#include "spi_master.h"
+#include "interrupt.h"
+#include "ili9488_prof.h"
+#ifndef ILI9488_DMA_SIMULATED
+#  include "pmc.h"
+#endif
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+ extern "C" {
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+/** XDMAC hardware interface number of the SPI0 transmitter. */
+#define ILI9488_DMA_PERID_SPI0_TX 1
+
+/** Largest block the XDMAC can move in one microblock; the host test builds
+ * the engine with a smaller one, to cut its transfers into several blocks. */
+#ifndef ILI9488_DMA_MAX_BLOCK
+#  define ILI9488_DMA_MAX_BLOCK   (XDMAC_CUBC_UBLEN_Msk >> XDMAC_CUBC_UBLEN_Pos)
+#endif
+
+/** Data cache line size of the Cortex-M7. */
+#define ILI9488_DMA_CACHE_LINE    32
+
+struct ili9488_dma_xfer {
+	const uint8_t *p_data;
+	uint32_t ul_size;
+	uint32_t ul_repeat;
+	ili9488_dma_callback_t callback;
+	void *p_arg;
+};
+
+struct ili9488_dma_block {
+	const uint8_t *p_src;
+	uint32_t ul_size;       /* 0 when the slot is empty */
+	bool b_last;            /* completes the transfer at g_ul_tail */
+};
+
+static struct ili9488_dma_xfer g_dma_queue[ILI9488_DMA_QUEUE_SIZE];
+static volatile uint32_t g_ul_dma_head;   /* next free slot, owned by submit */
+static volatile uint32_t g_ul_dma_tail;   /* oldest unfinished slot, owned by the IRQ */
+static uint32_t g_ul_dma_issue;           /* slot currently cut into blocks */
+static uint32_t g_ul_dma_issue_pass;      /* repetitions already cut for it */
+static uint32_t g_ul_dma_issue_offset;    /* offset inside the current repetition */
+
+static struct ili9488_dma_block g_dma_block[2];
+static volatile uint8_t g_uc_dma_active;
+static volatile bool g_b_dma_running;
+
+static struct ili9488_dma_stats g_dma_stats;
+
+#ifdef ILI9488_DMA_SIMULATED
+static struct ili9488_dma_record g_dma_log[ILI9488_DMA_LOG_SIZE];
+static uint32_t g_ul_dma_log_count;
+#endif
+
+/**
+ * \brief Cut the next block out of the transfer ring.
+ *
+ * \param p_block block to fill.
+ *
+ * \return true if a block was prepared.
+ */
+static bool ili9488_dma_prepare(struct ili9488_dma_block *p_block)
+{
+	struct ili9488_dma_xfer *p_xfer;
+	uint32_t ul_left;
+
+	if (g_ul_dma_issue == g_ul_dma_head) {
+		p_block->ul_size = 0;
+		return false;
+	}
+
+	p_xfer = &g_dma_queue[g_ul_dma_issue % ILI9488_DMA_QUEUE_SIZE];
+	ul_left = p_xfer->ul_size - g_ul_dma_issue_offset;
+
+	p_block->p_src = p_xfer->p_data + g_ul_dma_issue_offset;
+	p_block->ul_size = Min(ul_left, ILI9488_DMA_MAX_BLOCK);
+	p_block->b_last = false;
+
+	g_ul_dma_issue_offset += p_block->ul_size;
+	if (g_ul_dma_issue_offset == p_xfer->ul_size) {
+		g_ul_dma_issue_offset = 0;
+		if (++g_ul_dma_issue_pass == p_xfer->ul_repeat) {
+			g_ul_dma_issue_pass = 0;
+			g_ul_dma_issue++;
+			p_block->b_last = true;
+		}
+	}
+
+	return true;
+}
+
+#ifndef ILI9488_DMA_SIMULATED
+/**
+ * \brief Write back the data cache lines covering an SRAM buffer.
+ *
+ * Flash sources are read coherently by the XDMAC, only SRAM buffers written
+ * by the CPU (the pixel cache, line buffers) need to be cleaned.
+ */
+static void ili9488_dma_clean_dcache(const uint8_t *p_data, uint32_t ul_size)
+{
+#ifdef CONF_BOARD_ENABLE_CACHE
+	uint32_t ul_addr = (uint32_t)p_data & ~(ILI9488_DMA_CACHE_LINE - 1);
+	uint32_t ul_end = (uint32_t)p_data + ul_size;
+
+	if ((uint32_t)p_data < IRAM_ADDR) {
+		return;
+	}
+
+	__DSB();
+	while (ul_addr < ul_end) {
+		SCB->DCCMVAC = ul_addr;
+		ul_addr += ILI9488_DMA_CACHE_LINE;
+	}
+	__DSB();
+	__ISB();
+#else
+	UNUSED(p_data);
+	UNUSED(ul_size);
+#endif
+}
+#endif
+
+/**
+ * \brief Program the channel with a prepared block and enable it.
+ */
+static void ili9488_dma_start(struct ili9488_dma_block *p_block)
+{
+	g_dma_stats.ul_blocks++;
+	g_dma_stats.ul_bytes += p_block->ul_size;
+
+#ifdef ILI9488_DMA_SIMULATED
+	struct ili9488_dma_record *p_rec =
+			&g_dma_log[g_ul_dma_log_count % ILI9488_DMA_LOG_SIZE];
+
+	p_rec->p_src = p_block->p_src;
+	p_rec->ul_size = p_block->ul_size;
+	p_rec->ul_sequence = g_ul_dma_log_count++;
+	spi_write_packet(BOARD_ILI9488_SPI, p_block->p_src, p_block->ul_size);
+#else
+	XdmacChid *p_ch = &XDMAC->XDMAC_CHID[ILI9488_DMA_CHANNEL];
+
+	ili9488_dma_clean_dcache(p_block->p_src, p_block->ul_size);
+
+	/* Reading the status register clears stale flags */
+	(void)p_ch->XDMAC_CIS;
+
+	p_ch->XDMAC_CSA = (uint32_t)p_block->p_src;
+	p_ch->XDMAC_CDA = (uint32_t)spi_get_tx_access(BOARD_ILI9488_SPI);
+	p_ch->XDMAC_CUBC = XDMAC_CUBC_UBLEN(p_block->ul_size);
+	p_ch->XDMAC_CBC = 0;
+	p_ch->XDMAC_CNDC = 0;
+	p_ch->XDMAC_CDS_MSP = 0;
+	p_ch->XDMAC_CSUS = 0;
+	p_ch->XDMAC_CDUS = 0;
+	p_ch->XDMAC_CC = XDMAC_CC_TYPE_PER_TRAN
+			| XDMAC_CC_MBSIZE_SINGLE
+			| XDMAC_CC_DSYNC_MEM2PER
+			| XDMAC_CC_SWREQ_HWR_CONNECTED
+			| XDMAC_CC_MEMSET_NORMAL_MODE
+			| XDMAC_CC_CSIZE_CHK_1
+			| XDMAC_CC_DWIDTH_BYTE
+			| XDMAC_CC_SIF_AHB_IF0
+			| XDMAC_CC_DIF_AHB_IF1
+			| XDMAC_CC_SAM_INCREMENTED_AM
+			| XDMAC_CC_DAM_FIXED_AM
+			| XDMAC_CC_PERID(ILI9488_DMA_PERID_SPI0_TX);
+	p_ch->XDMAC_CIE = XDMAC_CIE_BIE;
+	XDMAC->XDMAC_GE = (XDMAC_GE_EN0 << ILI9488_DMA_CHANNEL);
+#endif
+}
+
+/**
+ * \brief End of block processing.
+ *
+ * Re-arms the channel with the block already prepared, completes the
+ * finished transfer and cuts the next block into the slot that went idle.
+ */
+static void ili9488_dma_block_done(void)
+{
+	uint8_t uc_done = g_uc_dma_active;
+	struct ili9488_dma_block *p_done = &g_dma_block[uc_done];
+	struct ili9488_dma_block *p_next = &g_dma_block[uc_done ^ 1];
+	bool b_last = p_done->b_last;
+
+	p_done->ul_size = 0;
+
+	if (p_next->ul_size) {
+		g_uc_dma_active = uc_done ^ 1;
+#ifndef ILI9488_DMA_SIMULATED
+		ili9488_dma_start(p_next);
+#endif
+	} else {
+		g_b_dma_running = false;
+	}
+
+	if (b_last) {
+		struct ili9488_dma_xfer *p_xfer =
+				&g_dma_queue[g_ul_dma_tail % ILI9488_DMA_QUEUE_SIZE];
+
+		g_dma_stats.ul_transfers++;
+		if (p_xfer->callback) {
+			p_xfer->callback(p_xfer->p_arg);
+		}
+		g_ul_dma_tail++;
+	}
+
+	/* A callback that submitted may have cut the block already */
+	if (!p_done->ul_size) {
+		ili9488_dma_prepare(p_done);
+	}
+	if (!g_b_dma_running && p_done->ul_size) {
+		g_uc_dma_active = uc_done;
+		g_b_dma_running = true;
+#ifndef ILI9488_DMA_SIMULATED
+		ili9488_dma_start(p_done);
+#endif
+	}
+}
+
+#ifdef ILI9488_DMA_SIMULATED
+/**
+ * \brief Run the simulated channel until the ring is empty.
+ *
+ * Blocks complete as soon as they are started, so the whole queue is
+ * drained synchronously from the caller's context.
+ */
+static void ili9488_dma_run(void)
+{
+	static bool b_in_run = false;
+
+	/* A completion callback may submit more work, keep a single loop */
+	if (b_in_run) {
+		return;
+	}
+	b_in_run = true;
+	while (g_b_dma_running) {
+		ili9488_dma_start(&g_dma_block[g_uc_dma_active]);
+		ili9488_dma_block_done();
+	}
+	b_in_run = false;
+}
+#else
+/**
+ * \brief XDMAC interrupt handler.
+ */
+void XDMAC_Handler(void)
+{
+	uint32_t ul_status = XDMAC->XDMAC_CHID[ILI9488_DMA_CHANNEL].XDMAC_CIS;
+
+	if (ul_status & XDMAC_CIS_BIS) {
+		ili9488_dma_block_done();
+	}
+}
+#endif
+
+/**
+ * \brief Let the ring move while the caller waits on it.
+ *
+ * The ring only moves in the XDMAC interrupt, which cannot run while the
+ * caller has interrupts masked or is itself an interrupt handler (a draw
+ * call in a critical section, a scene setter from TC1). The end of block
+ * is then taken from the channel status here instead, under the same
+ * masking as the handler so that one of them only sees it.
+ */
+static void ili9488_dma_service(void)
+{
+#ifndef ILI9488_DMA_SIMULATED
+	irqflags_t flags;
+
+	if (cpu_irq_is_enabled() && !__get_IPSR()) {
+		return;
+	}
+	flags = cpu_irq_save();
+	if (XDMAC->XDMAC_CHID[ILI9488_DMA_CHANNEL].XDMAC_CIS & XDMAC_CIS_BIS) {
+		ili9488_dma_block_done();
+	}
+	cpu_irq_restore(flags);
+#endif
+}
+
+/**
+ * \brief Initialize the transfer engine.
+ */
+void ili9488_dma_init(void)
+{
+	g_ul_dma_head = 0;
+	g_ul_dma_tail = 0;
+	g_ul_dma_issue = 0;
+	g_ul_dma_issue_pass = 0;
+	g_ul_dma_issue_offset = 0;
+	g_dma_block[0].ul_size = 0;
+	g_dma_block[1].ul_size = 0;
+	g_uc_dma_active = 0;
+	g_b_dma_running = false;
+	ili9488_dma_reset_stats();
+
+#ifndef ILI9488_DMA_SIMULATED
+	pmc_enable_periph_clk(ID_XDMAC);
+
+	XDMAC->XDMAC_GD = (XDMAC_GD_DI0 << ILI9488_DMA_CHANNEL);
+	(void)XDMAC->XDMAC_CHID[ILI9488_DMA_CHANNEL].XDMAC_CIS;
+	XDMAC->XDMAC_GIE = (XDMAC_GIE_IE0 << ILI9488_DMA_CHANNEL);
+
+	NVIC_ClearPendingIRQ(XDMAC_IRQn);
+	NVIC_SetPriority(XDMAC_IRQn, 1);
+	NVIC_EnableIRQ(XDMAC_IRQn);
+#endif
+}
+
+/**
+ * \brief Queue a GRAM payload.
+ *
+ * The D/C line must already select data. The buffer is read by the DMA
+ * after this function returns, so it has to stay untouched until the
+ * completion callback runs (flash constants and static caches are fine,
+ * stack buffers are not).
+ *
+ * When the queue is full, waits for a slot. With interrupts masked, or
+ * from an interrupt handler, the channel is polled meanwhile, see
+ * ili9488_dma_service(); the completion callbacks then run from there.
+ *
+ * \param p_data source buffer.
+ * \param ul_size size of the buffer in bytes.
+ * \param ul_repeat number of times the buffer is sent back to back.
+ * \param callback optional completion callback.
+ * \param p_arg argument for the callback.
+ *
+ * \return 0 if the transfer was queued, otherwise fails.
+ */
+uint32_t ili9488_dma_submit(const uint8_t *p_data, uint32_t ul_size,
+		uint32_t ul_repeat, ili9488_dma_callback_t callback, void *p_arg)
+{
+	struct ili9488_dma_xfer *p_xfer;
+	irqflags_t flags;
+
+	if ((ul_size == 0) || (ul_repeat == 0)) {
+		return 1;
+	}
+
+	if ((g_ul_dma_head - g_ul_dma_tail) >= ILI9488_DMA_QUEUE_SIZE) {
+		g_dma_stats.ul_queue_full++;
+		while ((g_ul_dma_head - g_ul_dma_tail) >= ILI9488_DMA_QUEUE_SIZE) {
+			ili9488_dma_service();
+		}
+	}
+
+	p_xfer = &g_dma_queue[g_ul_dma_head % ILI9488_DMA_QUEUE_SIZE];
+	p_xfer->p_data = p_data;
+	p_xfer->ul_size = ul_size;
+	p_xfer->ul_repeat = ul_repeat;
+	p_xfer->callback = callback;
+	p_xfer->p_arg = p_arg;
+
+	flags = cpu_irq_save();
+	g_ul_dma_head++;
+
+	/* Keep the next block cut so the IRQ can re-arm at once */
+	if (!g_b_dma_running) {
+		g_uc_dma_active = 0;
+		ili9488_dma_prepare(&g_dma_block[0]);
+		ili9488_dma_prepare(&g_dma_block[1]);
+		g_b_dma_running = true;
+#ifndef ILI9488_DMA_SIMULATED
+		ili9488_dma_start(&g_dma_block[0]);
+#endif
+	} else if (g_dma_block[g_uc_dma_active ^ 1].ul_size == 0) {
+		ili9488_dma_prepare(&g_dma_block[g_uc_dma_active ^ 1]);
+	}
+	cpu_irq_restore(flags);
+
+#ifdef ILI9488_DMA_SIMULATED
+	ili9488_dma_run();
+#endif
+	return 0;
+}
+
+/**
+ * \brief Check if a transfer is still on the bus.
+ */
+bool ili9488_dma_is_busy(void)
+{
+	return g_b_dma_running;
+}
+
+/**
+ * \brief Wait until every queued transfer has left the SPI.
+ *
+ * \note Like ili9488_dma_submit() on a full queue, may be called with
+ * interrupts masked: the channel is then polled. Each turn of the wait is
+ * counted as busy by the profiler.
+ */
+void ili9488_dma_wait(void)
+{
+	while (g_b_dma_running) {
+		ILI9488_PROF_BUSY(1);
+		ili9488_dma_service();
+	}
+	while (!spi_is_tx_empty(BOARD_ILI9488_SPI)) {
+	}
+}
+
+/**
+ * \brief Get the transfer statistics.
+ *
+ * \param p_stats structure receiving a copy of the counters.
+ */
+void ili9488_dma_get_stats(struct ili9488_dma_stats *p_stats)
+{
+	*p_stats = g_dma_stats;
+}
+
+/**
+ * \brief Clear the transfer statistics.
+ */
+void ili9488_dma_reset_stats(void)
+{
+	g_dma_stats.ul_transfers = 0;
+	g_dma_stats.ul_blocks = 0;
+	g_dma_stats.ul_bytes = 0;
+	g_dma_stats.ul_queue_full = 0;
+#ifdef ILI9488_DMA_SIMULATED
+	g_ul_dma_log_count = 0;
+#endif
+}
+
+#ifdef ILI9488_DMA_SIMULATED
+/**
+ * \brief Get the blocks recorded by the simulated backend.
+ *
+ * \param pp_log receives the log base address.
+ *
+ * \return number of blocks recorded since the last reset. Only the last
+ * ILI9488_DMA_LOG_SIZE entries are kept, indexed by sequence modulo size.
+ */
+uint32_t ili9488_dma_get_log(const struct ili9488_dma_record **pp_log)
+{
+	*pp_log = g_dma_log;
+	return g_ul_dma_log_count;
+}
+#endif
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+}
+#endif
+/**INDENT-ON**/
+/// @endcond
@@ -0,0 +1,87 @@
+/**
+ * \file
+ *
+ * \brief Asynchronous GRAM transfer engine for the ILI9488 SPI interface.
+ *
+ * Pixel payloads (the data phase that follows ILI9488_CMD_MEMORY_WRITE) are
+ * queued here and streamed to the SPI transmit register by an XDMAC channel,
+ * so the CPU is released while the bus is busy. Commands and parameters are
+ * still written by the driver itself; every register access first waits for
+ * the queue to drain so the D/C line is never toggled under a running
+ * transfer.
+ */
+
+#ifndef ILI9488_DMA_H_INCLUDED
+#define ILI9488_DMA_H_INCLUDED
+
+#include "compiler.h"
+#include "conf_ili9488.h"
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+ extern "C" {
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+/** Number of transfers that can be pending at the same time. */
+#ifndef ILI9488_DMA_QUEUE_SIZE
+#  define ILI9488_DMA_QUEUE_SIZE 8
+#endif
+
+/** XDMAC channel used for the LCD SPI transmit path. */
+#ifndef ILI9488_DMA_CHANNEL
+#  define ILI9488_DMA_CHANNEL 0
+#endif
+
+/** Number of transfer records kept by the simulated backend. */
+#ifndef ILI9488_DMA_LOG_SIZE
+#  define ILI9488_DMA_LOG_SIZE 64
+#endif
+
+/**
+ * Completion callback, called from the XDMAC interrupt once the last byte of
+ * a submitted transfer has been handed to the SPI.
+ */
+typedef void (*ili9488_dma_callback_t)(void *p_arg);
+
+/**
+ * Transfer statistics.
+ */
+struct ili9488_dma_stats {
+	uint32_t ul_transfers;   //!< completed submit() requests
+	uint32_t ul_blocks;      //!< XDMAC blocks executed
+	uint32_t ul_bytes;       //!< payload bytes streamed
+	uint32_t ul_queue_full;  //!< submit() calls that had to wait for a free slot
+};
+
+/**
+ * One block as seen by the simulated backend.
+ */
+struct ili9488_dma_record {
+	const uint8_t *p_src;    //!< source address of the block
+	uint32_t ul_size;        //!< block length in bytes
+	uint32_t ul_sequence;    //!< running block number
+};
+
+void ili9488_dma_init(void);
+uint32_t ili9488_dma_submit(const uint8_t *p_data, uint32_t ul_size,
+		uint32_t ul_repeat, ili9488_dma_callback_t callback, void *p_arg);
+bool ili9488_dma_is_busy(void);
+void ili9488_dma_wait(void);
+void ili9488_dma_get_stats(struct ili9488_dma_stats *p_stats);
+void ili9488_dma_reset_stats(void);
+#ifdef ILI9488_DMA_SIMULATED
+uint32_t ili9488_dma_get_log(const struct ili9488_dma_record **pp_log);
+#endif
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+}
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+#endif /* ILI9488_DMA_H_INCLUDED */
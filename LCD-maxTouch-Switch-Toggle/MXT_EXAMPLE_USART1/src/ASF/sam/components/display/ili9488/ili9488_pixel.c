@@ -0,0 +1,500 @@
+/**
+ * \file
+ *
+ * \brief Pixel conversion and fill kernels for the ILI9488 driver.
+ *
+ * The SIMD kernels work on groups of four pixels, the least common multiple
+ * of three-byte pixels and four-byte words: twelve bytes of RGB888 or
+ * RGB666 are three words, four RGB565 pixels two. Groups are loaded and
+ * stored with unaligned word accesses, which the Cortex-M7 does in one
+ * cycle on normal memory; the pixels left over are done by the reference.
+ */
+
+#include "ili9488_pixel.h"
+#include <string.h>
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+ extern "C" {
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+/**
+ * \brief Convert RGB888 pixels to the RGB666 bytes of the SPI interface,
+ * portable reference.
+ *
+ * \param p_uc_dst receives three bytes per pixel.
+ * \param p_uc_src three bytes per pixel, red first.
+ * \param ul_count number of pixels.
+ */
+void ili9488_pixel_rgb888_to_rgb666_ref(uint8_t *p_uc_dst,
+		const uint8_t *p_uc_src, uint32_t ul_count)
+{
+	uint32_t i;
+
+	for (i = 0; i < ul_count * 3; i++) {
+		p_uc_dst[i] = p_uc_src[i] & 0xFC;
+	}
+}
+
+/**
+ * \brief Convert RGB888 pixels to RGB565, portable reference.
+ *
+ * \param p_us_dst receives one RGB565 value per pixel.
+ * \param p_uc_src three bytes per pixel, red first.
+ * \param ul_count number of pixels.
+ */
+void ili9488_pixel_rgb888_to_rgb565_ref(uint16_t *p_us_dst,
+		const uint8_t *p_uc_src, uint32_t ul_count)
+{
+	uint32_t i;
+
+	for (i = 0; i < ul_count; i++, p_uc_src += 3) {
+		p_us_dst[i] = ((p_uc_src[0] & 0xF8) << 8) | ((p_uc_src[1] & 0xFC) << 3)
+				| (p_uc_src[2] >> 3);
+	}
+}
+
+/**
+ * \brief Expand RGB565 pixels to the RGB666 bytes of the SPI interface,
+ * portable reference.
+ *
+ * The high bits of each component are replicated into its low bits, so
+ * white stays 0xFF.
+ *
+ * \param p_uc_dst receives three bytes per pixel.
+ * \param p_us_src one RGB565 value per pixel.
+ * \param ul_count number of pixels.
+ */
+void ili9488_pixel_rgb565_to_rgb666_ref(uint8_t *p_uc_dst,
+		const uint16_t *p_us_src, uint32_t ul_count)
+{
+	uint16_t us_color;
+	uint32_t i;
+
+	for (i = 0; i < ul_count; i++) {
+		us_color = p_us_src[i];
+		*p_uc_dst++ = ((us_color >> 8) & 0xF8) | (us_color >> 13);
+		*p_uc_dst++ = ((us_color >> 3) & 0xFC) | ((us_color >> 9) & 0x03);
+		*p_uc_dst++ = ((us_color << 3) & 0xF8) | ((us_color >> 2) & 0x07);
+	}
+}
+
+/**
+ * \brief Fill RGB565 pixels with one color, portable reference.
+ *
+ * \param p_us_dst pixels to fill.
+ * \param us_color RGB565 color.
+ * \param ul_count number of pixels.
+ */
+void ili9488_pixel_fill16_ref(uint16_t *p_us_dst, uint16_t us_color,
+		uint32_t ul_count)
+{
+	uint32_t i;
+
+	for (i = 0; i < ul_count; i++) {
+		p_us_dst[i] = us_color;
+	}
+}
+
+/**
+ * \brief Fill three-byte pixels with one color, portable reference.
+ *
+ * \param p_uc_dst receives three bytes per pixel.
+ * \param ul_color 0xRRGGBB, the bytes are stored as they are.
+ * \param ul_count number of pixels.
+ */
+void ili9488_pixel_fill_rgb666_ref(uint8_t *p_uc_dst, uint32_t ul_color,
+		uint32_t ul_count)
+{
+	uint32_t i;
+
+	for (i = 0; i < ul_count; i++) {
+		*p_uc_dst++ = ul_color >> 16;
+		*p_uc_dst++ = ul_color >> 8;
+		*p_uc_dst++ = ul_color & 0xFF;
+	}
+}
+
+/**
+ * \brief Expand one bit per pixel to one of two RGB565 colors, portable
+ * reference.
+ *
+ * \param p_us_dst receives one RGB565 value per pixel.
+ * \param p_uc_src bits, most significant first.
+ * \param ul_bit index of the first bit to expand, from the MSB of
+ * p_uc_src[0].
+ * \param ul_count number of pixels.
+ * \param us_fg color of the set bits.
+ * \param us_bg color of the clear bits.
+ */
+void ili9488_pixel_expand_mono_ref(uint16_t *p_us_dst, const uint8_t *p_uc_src,
+		uint32_t ul_bit, uint32_t ul_count, uint16_t us_fg, uint16_t us_bg)
+{
+	uint32_t i;
+
+	for (i = 0; i < ul_count; i++, ul_bit++) {
+		p_us_dst[i] = (p_uc_src[ul_bit >> 3] & (0x80 >> (ul_bit & 7)))
+				? us_fg : us_bg;
+	}
+}
+
+#ifdef ILI9488_PIXEL_SIMD
+
+static inline uint32_t ili9488_pixel_load(const void *p_src)
+{
+	uint32_t ul_word;
+
+	memcpy(&ul_word, p_src, sizeof(ul_word));
+	return ul_word;
+}
+
+static inline void ili9488_pixel_store(void *p_dst, uint32_t ul_word)
+{
+	memcpy(p_dst, &ul_word, sizeof(ul_word));
+}
+
+/**
+ * \brief Convert RGB888 pixels to the RGB666 bytes of the SPI interface.
+ *
+ * Four bytes are masked at once.
+ */
+void ili9488_pixel_rgb888_to_rgb666(uint8_t *p_uc_dst, const uint8_t *p_uc_src,
+		uint32_t ul_count)
+{
+	uint32_t ul_bytes = ul_count * 3;
+
+	for (; ul_bytes >= 16; ul_bytes -= 16, p_uc_src += 16, p_uc_dst += 16) {
+		ili9488_pixel_store(p_uc_dst, ili9488_pixel_load(p_uc_src) & 0xFCFCFCFCu);
+		ili9488_pixel_store(p_uc_dst + 4, ili9488_pixel_load(p_uc_src + 4) & 0xFCFCFCFCu);
+		ili9488_pixel_store(p_uc_dst + 8, ili9488_pixel_load(p_uc_src + 8) & 0xFCFCFCFCu);
+		ili9488_pixel_store(p_uc_dst + 12, ili9488_pixel_load(p_uc_src + 12) & 0xFCFCFCFCu);
+	}
+	for (; ul_bytes; ul_bytes--) {
+		*p_uc_dst++ = *p_uc_src++ & 0xFC;
+	}
+}
+
+/**
+ * \brief Convert RGB888 pixels to RGB565.
+ *
+ * UXTB16 unpacks bytes 0 and 2 of a word into two halfword lanes, so the
+ * twelve bytes of four pixels give the red, green and blue of two pixels
+ * per register, which are packed into two RGB565 values at once.
+ */
+void ili9488_pixel_rgb888_to_rgb565(uint16_t *p_us_dst, const uint8_t *p_uc_src,
+		uint32_t ul_count)
+{
+	uint32_t w0, w1, w2, t0, t1, t2, t3, t4, t5, r, g, b;
+
+	for (; ul_count >= 4; ul_count -= 4, p_uc_src += 12, p_us_dst += 4) {
+		w0 = ili9488_pixel_load(p_uc_src);       /* r0 g0 b0 r1 */
+		w1 = ili9488_pixel_load(p_uc_src + 4);   /* g1 b1 r2 g2 */
+		w2 = ili9488_pixel_load(p_uc_src + 8);   /* b2 r3 g3 b3 */
+		t0 = __UXTB16(w0);                 /* r0 b0 */
+		t1 = __UXTB16(__ROR(w0, 8));       /* g0 r1 */
+		t2 = __UXTB16(w1);                 /* g1 r2 */
+		t3 = __UXTB16(__ROR(w1, 8));       /* b1 g2 */
+		t4 = __UXTB16(w2);                 /* b2 g3 */
+		t5 = __UXTB16(__ROR(w2, 8));       /* r3 b3 */
+
+		r = __PKHBT(t0, t1, 0);
+		g = __PKHBT(t1, t2, 16);
+		b = __PKHBT(t0 >> 16, t3, 16);
+		ili9488_pixel_store(p_us_dst, ((r & 0x00F800F8u) << 8)
+				| ((g & 0x00FC00FCu) << 3) | ((b >> 3) & 0x001F001Fu));
+
+		r = __PKHBT(t2 >> 16, t5, 16);
+		g = __PKHBT(t3 >> 16, t4, 0);
+		b = __PKHBT(t4, t5, 0);
+		ili9488_pixel_store(p_us_dst + 2, ((r & 0x00F800F8u) << 8)
+				| ((g & 0x00FC00FCu) << 3) | ((b >> 3) & 0x001F001Fu));
+	}
+	ili9488_pixel_rgb888_to_rgb565_ref(p_us_dst, p_uc_src, ul_count);
+}
+
+/**
+ * \brief Expand RGB565 pixels to the RGB666 bytes of the SPI interface.
+ *
+ * Two pixels are loaded per word and their components are computed in
+ * halfword lanes, one byte each; PKHBT then interleaves the lanes of four
+ * pixels into the three words sent to the panel.
+ */
+void ili9488_pixel_rgb565_to_rgb666(uint8_t *p_uc_dst, const uint16_t *p_us_src,
+		uint32_t ul_count)
+{
+	uint32_t a, b, ra, ga, ba, rb, gb, bb, rga, rgb, xa, xb, ya, yb;
+
+	for (; ul_count >= 4; ul_count -= 4, p_us_src += 4, p_uc_dst += 12) {
+		a = ili9488_pixel_load(p_us_src);        /* pixels 0 and 1 */
+		b = ili9488_pixel_load(p_us_src + 2);    /* pixels 2 and 3 */
+		ra = ((a >> 8) & 0x00F800F8u) | ((a >> 13) & 0x00070007u);
+		ga = ((a >> 3) & 0x00FC00FCu) | ((a >> 9) & 0x00030003u);
+		ba = ((a << 3) & 0x00F800F8u) | ((a >> 2) & 0x00070007u);
+		rb = ((b >> 8) & 0x00F800F8u) | ((b >> 13) & 0x00070007u);
+		gb = ((b >> 3) & 0x00FC00FCu) | ((b >> 9) & 0x00030003u);
+		bb = ((b << 3) & 0x00F800F8u) | ((b >> 2) & 0x00070007u);
+
+		rga = ra | (ga << 8);          /* R0 G0 R1 G1 */
+		rgb = rb | (gb << 8);          /* R2 G2 R3 G3 */
+		xa = ba | (ra >> 8);           /* B0 R1 B1 -- */
+		xb = bb | (rb >> 8);           /* B2 R3 B3 -- */
+		ya = (ga >> 16) | (ba >> 8);   /* G1 B1 -- -- */
+		yb = (gb >> 16) | (bb >> 8);   /* G3 B3 -- -- */
+
+		ili9488_pixel_store(p_uc_dst, __PKHBT(rga, xa, 16));
+		ili9488_pixel_store(p_uc_dst + 4, __PKHBT(ya, rgb, 16));
+		ili9488_pixel_store(p_uc_dst + 8, __PKHBT(xb, yb, 16));
+	}
+	ili9488_pixel_rgb565_to_rgb666_ref(p_uc_dst, p_us_src, ul_count);
+}
+
+/**
+ * \brief Fill RGB565 pixels with one color, two pixels per word store.
+ */
+void ili9488_pixel_fill16(uint16_t *p_us_dst, uint16_t us_color,
+		uint32_t ul_count)
+{
+	uint32_t ul_pair = us_color | ((uint32_t)us_color << 16);
+
+	if (ul_count && ((uintptr_t)p_us_dst & 2)) {
+		*p_us_dst++ = us_color;
+		ul_count--;
+	}
+	for (; ul_count >= 8; ul_count -= 8, p_us_dst += 8) {
+		((uint32_t *)p_us_dst)[0] = ul_pair;
+		((uint32_t *)p_us_dst)[1] = ul_pair;
+		((uint32_t *)p_us_dst)[2] = ul_pair;
+		((uint32_t *)p_us_dst)[3] = ul_pair;
+	}
+	for (; ul_count >= 2; ul_count -= 2, p_us_dst += 2) {
+		*(uint32_t *)p_us_dst = ul_pair;
+	}
+	if (ul_count) {
+		*p_us_dst = us_color;
+	}
+}
+
+/**
+ * \brief Fill three-byte pixels with one color, four pixels per three word
+ * stores.
+ */
+void ili9488_pixel_fill_rgb666(uint8_t *p_uc_dst, uint32_t ul_color,
+		uint32_t ul_count)
+{
+	uint32_t r = (ul_color >> 16) & 0xFF, g = (ul_color >> 8) & 0xFF;
+	uint32_t b = ul_color & 0xFF;
+	uint32_t p0 = r | (g << 8) | (b << 16) | (r << 24);
+	uint32_t p1 = g | (b << 8) | (r << 16) | (g << 24);
+	uint32_t p2 = b | (r << 8) | (g << 16) | (b << 24);
+
+	for (; ul_count >= 4; ul_count -= 4, p_uc_dst += 12) {
+		ili9488_pixel_store(p_uc_dst, p0);
+		ili9488_pixel_store(p_uc_dst + 4, p1);
+		ili9488_pixel_store(p_uc_dst + 8, p2);
+	}
+	ili9488_pixel_fill_rgb666_ref(p_uc_dst, ul_color, ul_count);
+}
+
+/**
+ * \brief Expand one bit per pixel to one of two RGB565 colors.
+ *
+ * Each pair of bits is spread into the two halfword lanes of a word;
+ * USUB16 against 1 sets the GE flags of the lanes whose bit is set and SEL
+ * picks the foreground or the background halfword accordingly. Whole source
+ * bytes are expanded this way, the bits before and after by the reference.
+ */
+void ili9488_pixel_expand_mono(uint16_t *p_us_dst, const uint8_t *p_uc_src,
+		uint32_t ul_bit, uint32_t ul_count, uint16_t us_fg, uint16_t us_bg)
+{
+	uint32_t ul_fg = us_fg | ((uint32_t)us_fg << 16);
+	uint32_t ul_bg = us_bg | ((uint32_t)us_bg << 16);
+	uint32_t ul_head, ul_byte, ul_pairs;
+	const uint8_t *p_uc;
+
+	p_uc_src += ul_bit >> 3;
+	ul_bit &= 7;
+	if (ul_bit) {
+		ul_head = Min(8 - ul_bit, ul_count);
+		ili9488_pixel_expand_mono_ref(p_us_dst, p_uc_src, ul_bit, ul_head,
+				us_fg, us_bg);
+		p_us_dst += ul_head;
+		ul_count -= ul_head;
+		p_uc_src++;
+	}
+
+	for (p_uc = p_uc_src; ul_count >= 8; ul_count -= 8, p_us_dst += 8) {
+		/* Bit 7 goes to the low lane of the first word, the first pixel */
+		ul_byte = *p_uc++;
+		ul_pairs = ((ul_byte >> 7) & 1) | ((ul_byte << 10) & 0x10000u);
+		__USUB16(ul_pairs, 0x00010001u);
+		ili9488_pixel_store(p_us_dst, __SEL(ul_fg, ul_bg));
+		ul_pairs = ((ul_byte >> 5) & 1) | ((ul_byte << 12) & 0x10000u);
+		__USUB16(ul_pairs, 0x00010001u);
+		ili9488_pixel_store(p_us_dst + 2, __SEL(ul_fg, ul_bg));
+		ul_pairs = ((ul_byte >> 3) & 1) | ((ul_byte << 14) & 0x10000u);
+		__USUB16(ul_pairs, 0x00010001u);
+		ili9488_pixel_store(p_us_dst + 4, __SEL(ul_fg, ul_bg));
+		ul_pairs = ((ul_byte >> 1) & 1) | ((ul_byte << 16) & 0x10000u);
+		__USUB16(ul_pairs, 0x00010001u);
+		ili9488_pixel_store(p_us_dst + 6, __SEL(ul_fg, ul_bg));
+	}
+	ili9488_pixel_expand_mono_ref(p_us_dst, p_uc, 0, ul_count, us_fg, us_bg);
+}
+
+#else /* !ILI9488_PIXEL_SIMD */
+
+void ili9488_pixel_rgb888_to_rgb666(uint8_t *p_uc_dst, const uint8_t *p_uc_src,
+		uint32_t ul_count)
+{
+	ili9488_pixel_rgb888_to_rgb666_ref(p_uc_dst, p_uc_src, ul_count);
+}
+
+void ili9488_pixel_rgb888_to_rgb565(uint16_t *p_us_dst, const uint8_t *p_uc_src,
+		uint32_t ul_count)
+{
+	ili9488_pixel_rgb888_to_rgb565_ref(p_us_dst, p_uc_src, ul_count);
+}
+
+void ili9488_pixel_rgb565_to_rgb666(uint8_t *p_uc_dst, const uint16_t *p_us_src,
+		uint32_t ul_count)
+{
+	ili9488_pixel_rgb565_to_rgb666_ref(p_uc_dst, p_us_src, ul_count);
+}
+
+void ili9488_pixel_fill16(uint16_t *p_us_dst, uint16_t us_color,
+		uint32_t ul_count)
+{
+	ili9488_pixel_fill16_ref(p_us_dst, us_color, ul_count);
+}
+
+void ili9488_pixel_fill_rgb666(uint8_t *p_uc_dst, uint32_t ul_color,
+		uint32_t ul_count)
+{
+	ili9488_pixel_fill_rgb666_ref(p_uc_dst, ul_color, ul_count);
+}
+
+void ili9488_pixel_expand_mono(uint16_t *p_us_dst, const uint8_t *p_uc_src,
+		uint32_t ul_bit, uint32_t ul_count, uint16_t us_fg, uint16_t us_bg)
+{
+	ili9488_pixel_expand_mono_ref(p_us_dst, p_uc_src, ul_bit, ul_count, us_fg,
+			us_bg);
+}
+
+#endif /* ILI9488_PIXEL_SIMD */
+
+#ifdef ILI9488_PIXEL_BENCH
+
+#include <stdio.h>
+
+/* One line of the panel per call */
+#define ILI9488_PIXEL_BENCH_PIXELS  320
+#define ILI9488_PIXEL_BENCH_RUNS    16
+
+static uint8_t g_uc_bench_src[ILI9488_PIXEL_BENCH_PIXELS * 3 + 1];
+static uint8_t g_uc_bench_ref[ILI9488_PIXEL_BENCH_PIXELS * 3 + 4];
+static uint8_t g_uc_bench_out[ILI9488_PIXEL_BENCH_PIXELS * 3 + 4];
+static uint32_t g_ul_bench_kernel;
+
+static void ili9488_pixel_bench_run(uint32_t ul_kernel, bool b_ref)
+{
+	uint16_t *p_us_out = (uint16_t *)(b_ref ? g_uc_bench_ref : g_uc_bench_out);
+	uint8_t *p_uc_out = b_ref ? g_uc_bench_ref : g_uc_bench_out;
+	const uint16_t *p_us_src = (const uint16_t *)g_uc_bench_src;
+	uint32_t n = ILI9488_PIXEL_BENCH_PIXELS;
+
+	switch (ul_kernel) {
+	case 0:
+		(b_ref ? ili9488_pixel_rgb888_to_rgb666_ref
+				: ili9488_pixel_rgb888_to_rgb666)(p_uc_out, g_uc_bench_src, n);
+		break;
+	case 1:
+		(b_ref ? ili9488_pixel_rgb888_to_rgb565_ref
+				: ili9488_pixel_rgb888_to_rgb565)(p_us_out, g_uc_bench_src, n);
+		break;
+	case 2:
+		(b_ref ? ili9488_pixel_rgb565_to_rgb666_ref
+				: ili9488_pixel_rgb565_to_rgb666)(p_uc_out, p_us_src, n);
+		break;
+	case 3:
+		(b_ref ? ili9488_pixel_fill16_ref : ili9488_pixel_fill16)(p_us_out,
+				0xF81F, n);
+		break;
+	case 4:
+		(b_ref ? ili9488_pixel_fill_rgb666_ref : ili9488_pixel_fill_rgb666)(
+				p_uc_out, 0xFC8000, n);
+		break;
+	default:
+		(b_ref ? ili9488_pixel_expand_mono_ref : ili9488_pixel_expand_mono)(
+				p_us_out, g_uc_bench_src, 0, n, 0x0000, 0xFFFF);
+		break;
+	}
+}
+
+static uint32_t ili9488_pixel_bench_cycles(uint32_t ul_kernel, bool b_ref)
+{
+	uint32_t ul_best = UINT32_MAX, ul_start, ul_cycles, i;
+
+	for (i = 0; i < ILI9488_PIXEL_BENCH_RUNS; i++) {
+		ul_start = DWT->CYCCNT;
+		ili9488_pixel_bench_run(ul_kernel, b_ref);
+		ul_cycles = DWT->CYCCNT - ul_start;
+		ul_best = Min(ul_best, ul_cycles);
+	}
+	return ul_best;
+}
+
+/**
+ * \brief Time every kernel and its reference on a line of 320 pixels with
+ * the cycle counter, check they agree, and print the result on the console.
+ *
+ * The best of ILI9488_PIXEL_BENCH_RUNS runs is kept, with the caches warm.
+ */
+void ili9488_pixel_bench(void)
+{
+	static const char *const p_name[] = {
+		"rgb888>rgb666", "rgb888>rgb565", "rgb565>rgb666", "fill16",
+		"fill_rgb666", "expand_mono",
+	};
+	uint32_t ul_ref, ul_kernel, i;
+	bool b_same;
+
+	for (i = 0; i < sizeof(g_uc_bench_src); i++) {
+		g_ul_bench_kernel = g_ul_bench_kernel * 1664525u + 1013904223u;
+		g_uc_bench_src[i] = g_ul_bench_kernel >> 24;
+	}
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR = 0xC5ACCE55;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	printf("pixel kernels, %d pixels, %s\r\n", ILI9488_PIXEL_BENCH_PIXELS,
+#ifdef ILI9488_PIXEL_SIMD
+			"SIMD"
+#else
+			"scalar"
+#endif
+			);
+	for (i = 0; i < sizeof(p_name) / sizeof(p_name[0]); i++) {
+		memset(g_uc_bench_ref, 0, sizeof(g_uc_bench_ref));
+		memset(g_uc_bench_out, 0, sizeof(g_uc_bench_out));
+		ul_ref = ili9488_pixel_bench_cycles(i, true);
+		ul_kernel = ili9488_pixel_bench_cycles(i, false);
+		b_same = !memcmp(g_uc_bench_ref, g_uc_bench_out, sizeof(g_uc_bench_out));
+		printf("  %-14s ref %6lu  kernel %6lu cycles  %s\r\n", p_name[i],
+				(unsigned long)ul_ref, (unsigned long)ul_kernel,
+				b_same ? "same" : "DIFFERENT");
+	}
+}
+
+#endif /* ILI9488_PIXEL_BENCH */
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+}
+#endif
+/**INDENT-ON**/
+/// @endcond
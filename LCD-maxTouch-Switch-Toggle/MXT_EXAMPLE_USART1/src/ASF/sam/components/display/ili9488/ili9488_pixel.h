@@ -0,0 +1,80 @@
+/**
+ * \file
+ *
+ * \brief Pixel conversion and fill kernels for the ILI9488 driver.
+ *
+ * Line buffers are converted and filled here instead of one byte at a time
+ * in the drawing code. On the Cortex-M7 (__ARM_FEATURE_DSP) the kernels
+ * load and store whole words and use the SIMD instructions of the DSP
+ * extension through the CMSIS intrinsics: UXTB16 to unpack bytes into
+ * halfword lanes, PKHBT to pack the lanes back, USUB16 and SEL to pick one
+ * of two colors per pixel without branches. Elsewhere, or with
+ * ILI9488_PIXEL_SCALAR defined, they are the portable references.
+ *
+ * Every kernel has its reference, suffixed _ref, built in both cases: the
+ * host tests check that the SIMD versions give the same bytes, and
+ * ili9488_pixel_bench() times both on the target.
+ *
+ * Buffers need no alignment. RGB888 and RGB666 pixels are three bytes, red
+ * first, the order of the panel in SPI mode; RGB666 keeps the six bits in
+ * the high bits of each byte and fills the low two by replication.
+ */
+
+#ifndef ILI9488_PIXEL_H_INCLUDED
+#define ILI9488_PIXEL_H_INCLUDED
+
+#include "compiler.h"
+#include "conf_ili9488.h"
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+ extern "C" {
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+#if defined(__ARM_FEATURE_DSP) && !defined(ILI9488_PIXEL_SCALAR) \
+		&& !defined(ILI9488_PIXEL_SIMD)
+#  define ILI9488_PIXEL_SIMD
+#endif
+
+void ili9488_pixel_rgb888_to_rgb666(uint8_t *p_uc_dst, const uint8_t *p_uc_src,
+		uint32_t ul_count);
+void ili9488_pixel_rgb888_to_rgb565(uint16_t *p_us_dst, const uint8_t *p_uc_src,
+		uint32_t ul_count);
+void ili9488_pixel_rgb565_to_rgb666(uint8_t *p_uc_dst, const uint16_t *p_us_src,
+		uint32_t ul_count);
+void ili9488_pixel_fill16(uint16_t *p_us_dst, uint16_t us_color,
+		uint32_t ul_count);
+void ili9488_pixel_fill_rgb666(uint8_t *p_uc_dst, uint32_t ul_color,
+		uint32_t ul_count);
+void ili9488_pixel_expand_mono(uint16_t *p_us_dst, const uint8_t *p_uc_src,
+		uint32_t ul_bit, uint32_t ul_count, uint16_t us_fg, uint16_t us_bg);
+
+void ili9488_pixel_rgb888_to_rgb666_ref(uint8_t *p_uc_dst,
+		const uint8_t *p_uc_src, uint32_t ul_count);
+void ili9488_pixel_rgb888_to_rgb565_ref(uint16_t *p_us_dst,
+		const uint8_t *p_uc_src, uint32_t ul_count);
+void ili9488_pixel_rgb565_to_rgb666_ref(uint8_t *p_uc_dst,
+		const uint16_t *p_us_src, uint32_t ul_count);
+void ili9488_pixel_fill16_ref(uint16_t *p_us_dst, uint16_t us_color,
+		uint32_t ul_count);
+void ili9488_pixel_fill_rgb666_ref(uint8_t *p_uc_dst, uint32_t ul_color,
+		uint32_t ul_count);
+void ili9488_pixel_expand_mono_ref(uint16_t *p_us_dst, const uint8_t *p_uc_src,
+		uint32_t ul_bit, uint32_t ul_count, uint16_t us_fg, uint16_t us_bg);
+
+#ifdef ILI9488_PIXEL_BENCH
+void ili9488_pixel_bench(void);
+#endif
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+}
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+#endif /* ILI9488_PIXEL_H_INCLUDED */
@@ -0,0 +1,201 @@
+/**
+ * \file
+ *
+ * \brief Bus traffic accounting for the ILI9488 driver.
+ *
+ * The counters are plain increments done by the thread that draws; the driver
+ * is not reentrant, so no locking is needed. The frame report goes to stdout,
+ * which is the USART console on the board and the terminal on a host build.
+ */
+
+#include "ili9488_prof.h"
+#include "ili9488.h"
+#include <stdio.h>
+#include <string.h>
+
+#ifdef ILI9488_PROFILE
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+ extern "C" {
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+static const char *const g_p_call_name[ILI9488_PROF_CALLS] = {
+	"other", "init", "control", "window", "fill", "pixel", "line",
+	"rectangle", "filled_rect", "circle", "string", "pixmap", "stream",
+	"gfx", "read", "sync",
+};
+
+static struct ili9488_prof_counters g_prof[ILI9488_PROF_CALLS];
+static enum ili9488_prof_call g_prof_current = ILI9488_PROF_OTHER;
+static uint32_t g_ul_prof_depth;
+static uint32_t g_ul_prof_frame;
+
+/**
+ * \brief Open the scope of a public driver call.
+ *
+ * \param call kind the traffic is charged to, unless a call is already open.
+ */
+void ili9488_prof_enter(enum ili9488_prof_call call)
+{
+	if (g_ul_prof_depth++ == 0) {
+		g_prof_current = call;
+		g_prof[call].ul_calls++;
+	}
+}
+
+/**
+ * \brief Close the scope opened by ili9488_prof_enter().
+ */
+void ili9488_prof_leave(void)
+{
+	if (g_ul_prof_depth && (--g_ul_prof_depth == 0)) {
+		g_prof_current = ILI9488_PROF_OTHER;
+	}
+}
+
+/**
+ * \brief Account one register write.
+ *
+ * \param uc_reg command byte.
+ * \param ul_size parameter bytes that follow it.
+ */
+void ili9488_prof_register(uint8_t uc_reg, uint32_t ul_size)
+{
+	struct ili9488_prof_counters *p_c = &g_prof[g_prof_current];
+
+	p_c->ul_registers++;
+	if (uc_reg == ILI9488_CMD_MEMORY_WRITE) {
+		p_c->ul_gram_bytes += ul_size;
+	} else {
+		p_c->ul_param_bytes += ul_size;
+	}
+	if (uc_reg == ILI9488_CMD_COLUMN_ADDRESS_SET) {
+		p_c->ul_windows++;
+	}
+}
+
+/**
+ * \brief Account GRAM payload sent after a memory write command.
+ */
+void ili9488_prof_gram(uint32_t ul_size)
+{
+	g_prof[g_prof_current].ul_gram_bytes += ul_size;
+}
+
+/**
+ * \brief Account busy-wait loop iterations.
+ */
+void ili9488_prof_busy(uint32_t ul_count)
+{
+	g_prof[g_prof_current].ul_busy_waits += ul_count;
+}
+
+/**
+ * \brief Get the counters of one call kind.
+ */
+void ili9488_prof_get(enum ili9488_prof_call call,
+		struct ili9488_prof_counters *p_counters)
+{
+	*p_counters = g_prof[call];
+}
+
+/**
+ * \brief Get the sum of the counters of every call kind.
+ */
+void ili9488_prof_get_total(struct ili9488_prof_counters *p_counters)
+{
+	uint32_t i;
+
+	memset(p_counters, 0, sizeof(*p_counters));
+	for (i = 0; i < ILI9488_PROF_CALLS; i++) {
+		p_counters->ul_calls += g_prof[i].ul_calls;
+		p_counters->ul_registers += g_prof[i].ul_registers;
+		p_counters->ul_param_bytes += g_prof[i].ul_param_bytes;
+		p_counters->ul_gram_bytes += g_prof[i].ul_gram_bytes;
+		p_counters->ul_windows += g_prof[i].ul_windows;
+		p_counters->ul_busy_waits += g_prof[i].ul_busy_waits;
+	}
+}
+
+/**
+ * \brief Time the counted bytes take on the wire at ILI9488_SPI_BAUDRATE.
+ *
+ * \return microseconds, one bit per clock.
+ */
+uint32_t ili9488_prof_wire_time_us(const struct ili9488_prof_counters *p_counters)
+{
+	uint64_t ull_bytes = (uint64_t)p_counters->ul_registers
+			+ p_counters->ul_param_bytes + p_counters->ul_gram_bytes;
+
+	return (uint32_t)(ull_bytes * 8 * 1000000 / ILI9488_SPI_BAUDRATE);
+}
+
+static void ili9488_prof_print(const char *p_name,
+		const struct ili9488_prof_counters *p_c)
+{
+	printf("  %-12s %4lu calls %5lu regs %6lu param %8lu gram %4lu win %8lu busy %7lu us\r\n",
+			p_name, (unsigned long)p_c->ul_calls,
+			(unsigned long)p_c->ul_registers,
+			(unsigned long)p_c->ul_param_bytes,
+			(unsigned long)p_c->ul_gram_bytes,
+			(unsigned long)p_c->ul_windows,
+			(unsigned long)p_c->ul_busy_waits,
+			(unsigned long)ili9488_prof_wire_time_us(p_c));
+}
+
+/**
+ * \brief Print the traffic of the frame on the console and clear it.
+ *
+ * Frames that did not touch the bus print nothing.
+ *
+ * \return true if a report was printed.
+ */
+bool ili9488_prof_frame(void)
+{
+	struct ili9488_prof_counters total;
+	uint32_t i;
+
+	ili9488_prof_get_total(&total);
+	if (!total.ul_registers && !total.ul_gram_bytes && !total.ul_busy_waits) {
+		return false;
+	}
+
+	printf("lcd frame %lu: %lu bytes, %lu us at %lu Hz\r\n",
+			(unsigned long)g_ul_prof_frame++,
+			(unsigned long)(total.ul_registers + total.ul_param_bytes
+					+ total.ul_gram_bytes),
+			(unsigned long)ili9488_prof_wire_time_us(&total),
+			(unsigned long)ILI9488_SPI_BAUDRATE);
+	for (i = 0; i < ILI9488_PROF_CALLS; i++) {
+		if (g_prof[i].ul_registers || g_prof[i].ul_gram_bytes
+				|| g_prof[i].ul_busy_waits) {
+			ili9488_prof_print(g_p_call_name[i], &g_prof[i]);
+		}
+	}
+	ili9488_prof_print("total", &total);
+
+	ili9488_prof_reset();
+	return true;
+}
+
+/**
+ * \brief Clear the counters.
+ */
+void ili9488_prof_reset(void)
+{
+	memset(g_prof, 0, sizeof(g_prof));
+}
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+}
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+#endif /* ILI9488_PROFILE */
@@ -0,0 +1,112 @@
+/**
+ * \file
+ *
+ * \brief Bus traffic accounting for the ILI9488 driver.
+ *
+ * With ILI9488_PROFILE defined the driver attributes everything it puts on
+ * the bus to the public call that caused it: register writes, parameter
+ * bytes, ILI9488_CMD_MEMORY_WRITE payload bytes, address window changes and
+ * busy-wait loop iterations. Nested calls (a rectangle drawn by a line, a
+ * window set by a pixmap) are charged to the outermost one.
+ *
+ * The counters accumulate until ili9488_prof_frame() prints them on the
+ * console and clears them. The application calls it once per frame; without
+ * ILI9488_PROFILE it is an empty inline and the hooks in the driver expand to
+ * nothing.
+ *
+ * In EBI mode the byte counters count 16-bit bus writes instead.
+ */
+
+#ifndef ILI9488_PROF_H_INCLUDED
+#define ILI9488_PROF_H_INCLUDED
+
+#include "compiler.h"
+#include "conf_ili9488.h"
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+ extern "C" {
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+/**
+ * Public driver calls the traffic is charged to.
+ */
+enum ili9488_prof_call {
+	ILI9488_PROF_OTHER = 0,     //!< outside any instrumented call
+	ILI9488_PROF_INIT,
+	ILI9488_PROF_CONTROL,       //!< display on/off, scroll, brightness, orientation
+	ILI9488_PROF_WINDOW,        //!< set_window, set_cursor_position, draw_prepare
+	ILI9488_PROF_FILL,
+	ILI9488_PROF_PIXEL,
+	ILI9488_PROF_LINE,
+	ILI9488_PROF_RECTANGLE,
+	ILI9488_PROF_FILLED_RECTANGLE,
+	ILI9488_PROF_CIRCLE,
+	ILI9488_PROF_STRING,
+	ILI9488_PROF_PIXMAP,
+	ILI9488_PROF_STREAM,        //!< draw_stream, draw_stream_rgb565
+	ILI9488_PROF_GFX,           //!< write_gram, copy_pixels, duplicate_pixel
+	ILI9488_PROF_READ,
+	ILI9488_PROF_SYNC,
+	ILI9488_PROF_CALLS
+};
+
+/**
+ * Traffic counters of one call kind.
+ */
+struct ili9488_prof_counters {
+	uint32_t ul_calls;          //!< outermost calls
+	uint32_t ul_registers;      //!< command bytes (register writes)
+	uint32_t ul_param_bytes;    //!< parameter bytes following the commands
+	uint32_t ul_gram_bytes;     //!< ILI9488_CMD_MEMORY_WRITE payload
+	uint32_t ul_windows;        //!< column/page address window changes
+	uint32_t ul_busy_waits;     //!< settle loop and DMA wait iterations
+};
+
+#ifdef ILI9488_PROFILE
+
+void ili9488_prof_enter(enum ili9488_prof_call call);
+void ili9488_prof_leave(void);
+void ili9488_prof_register(uint8_t uc_reg, uint32_t ul_size);
+void ili9488_prof_gram(uint32_t ul_size);
+void ili9488_prof_busy(uint32_t ul_count);
+void ili9488_prof_get(enum ili9488_prof_call call,
+		struct ili9488_prof_counters *p_counters);
+void ili9488_prof_get_total(struct ili9488_prof_counters *p_counters);
+uint32_t ili9488_prof_wire_time_us(const struct ili9488_prof_counters *p_counters);
+bool ili9488_prof_frame(void);
+void ili9488_prof_reset(void);
+
+#  define ILI9488_PROF_ENTER(call)          ili9488_prof_enter(call)
+#  define ILI9488_PROF_LEAVE()              ili9488_prof_leave()
+#  define ILI9488_PROF_REGISTER(reg, size)  ili9488_prof_register(reg, size)
+#  define ILI9488_PROF_GRAM(size)           ili9488_prof_gram(size)
+#  define ILI9488_PROF_BUSY(count)          ili9488_prof_busy(count)
+
+#else
+
+#  define ILI9488_PROF_ENTER(call)          ((void)0)
+#  define ILI9488_PROF_LEAVE()              ((void)0)
+#  define ILI9488_PROF_REGISTER(reg, size)  ((void)0)
+#  define ILI9488_PROF_GRAM(size)           ((void)0)
+#  define ILI9488_PROF_BUSY(count)          ((void)0)
+
+static inline bool ili9488_prof_frame(void)
+{
+	return false;
+}
+
+#endif /* ILI9488_PROFILE */
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+}
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+#endif /* ILI9488_PROF_H_INCLUDED */
@@ -0,0 +1,356 @@
+/**
+ * \file
+ *
+ * \brief Frame pacing of the ILI9488 against its refresh scan.
+ *
+ * The TC channel runs from the slow clock in both modes. Emulating the
+ * vsync, it resets on RC compare once per refresh and the compare interrupt
+ * is the vsync, so the counter itself is the time since the vsync. With the
+ * TE line, it runs freely over 16 bits and the TE edge handler stores the
+ * counter value of the edge; the refresh period is measured between edges.
+ *
+ * Scanline windows: with d(y) the lines the scan still has to go before it
+ * reaches row y, a rectangle whose rows take row_ns each on the bus is sent
+ * untorn if either
+ *
+ * - every row is written before the scan reaches it (the scan is above the
+ *   rectangle and slower than the transfer), or
+ * - every row not yet scanned is written after the scan passed it, and
+ *   every row is written before the next refresh comes back to it.
+ *
+ * Both conditions are linear in y, so they are checked at the ends of the
+ * rows they apply to.
+ */
+
+#include "ili9488_te.h"
+#include "ili9488.h"
+#include "tc.h"
+#include "pmc.h"
+#include "delay.h"
+#include "interrupt.h"
+#ifdef CONF_ILI9488_TE_PIN
+#  include "pio.h"
+#  include "pio_handler.h"
+#endif
+#include <string.h>
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+ extern "C" {
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+/** Timestamp clock: TIMER_CLOCK5, the 32.768 kHz slow clock. */
+#define ILI9488_TE_TICK_HZ      32768
+#define ILI9488_TE_TCCLKS       4
+
+/** Counter period of the free-running timestamp clock. */
+#define ILI9488_TE_TC_WRAP      0x10000
+
+static volatile uint32_t g_ul_vsync_seq;    /* vsyncs since init */
+static volatile uint32_t g_ul_vsync_tick;   /* counter value of the last one */
+static volatile uint32_t g_ul_period;       /* ticks per refresh */
+static uint32_t g_ul_line_ns;               /* duration of one scanline */
+
+static uint32_t g_ul_frame_seq;     /* vsync the last frame started after */
+static uint32_t g_ul_begin_seq;     /* vsync the current frame started after */
+static uint32_t g_ul_request_seq;   /* vsync seen when the frame was wanted */
+static bool g_b_requested;
+static bool g_b_running;
+
+static struct ili9488_te_stats g_te_stats;
+
+#ifdef CONF_ILI9488_TE_PIN
+/**
+ * \brief TE rising edge: the refresh reached the tear scanline.
+ */
+static void ili9488_te_edge_handler(uint32_t ul_id, uint32_t ul_mask)
+{
+	uint32_t ul_tick = tc_read_cv(ILI9488_TE_TC, ILI9488_TE_TC_CHANNEL);
+
+	UNUSED(ul_id);
+	UNUSED(ul_mask);
+
+	if (g_te_stats.ul_vsyncs) {
+		g_ul_period = (ul_tick - g_ul_vsync_tick) & (ILI9488_TE_TC_WRAP - 1);
+		g_ul_line_ns = (uint32_t)((uint64_t)g_ul_period * 1000000000
+				/ ILI9488_TE_TICK_HZ / ILI9488_TE_LINES);
+	}
+	g_ul_vsync_tick = ul_tick;
+	g_ul_vsync_seq++;
+	g_te_stats.ul_vsyncs++;
+}
+#else
+/**
+ * \brief RC compare of the emulated vsync.
+ */
+void ILI9488_TE_TC_Handler(void)
+{
+	tc_get_status(ILI9488_TE_TC, ILI9488_TE_TC_CHANNEL);
+
+	g_ul_vsync_seq++;
+	g_te_stats.ul_vsyncs++;
+}
+#endif
+
+/**
+ * \brief Ticks since the last vsync.
+ */
+static uint32_t ili9488_te_since_vsync(void)
+{
+	uint32_t ul_now = tc_read_cv(ILI9488_TE_TC, ILI9488_TE_TC_CHANNEL);
+
+#ifdef CONF_ILI9488_TE_PIN
+	return (ul_now - g_ul_vsync_tick) & (ILI9488_TE_TC_WRAP - 1);
+#else
+	return ul_now;
+#endif
+}
+
+/**
+ * \brief Start pacing.
+ *
+ * Sets the TE scanline to the start of the vertical blanking and starts the
+ * timestamp clock. Without CONF_ILI9488_TE_PIN the vsync timer is started
+ * when the panel enters the blanking, which blocks for up to one refresh.
+ * Must be called once ili9488_init() returned or ili9488_init_poll() is done.
+ */
+void ili9488_te_init(void)
+{
+	uint32_t ul_mode = ILI9488_TE_TCCLKS | TC_CMR_CPCTRG;
+#ifndef CONF_ILI9488_TE_PIN
+	uint32_t ul_lines;
+#endif
+
+	memset(&g_te_stats, 0, sizeof(g_te_stats));
+	g_ul_vsync_seq = 0;
+	g_ul_vsync_tick = 0;
+	g_ul_frame_seq = 0;
+	g_b_requested = false;
+	g_ul_period = ILI9488_TE_TICK_HZ / ILI9488_TE_FRAME_HZ;
+	g_ul_line_ns = 1000000000UL / (ILI9488_TE_FRAME_HZ * ILI9488_TE_LINES);
+
+	pmc_enable_periph_clk(ILI9488_TE_TC_ID);
+	tc_init(ILI9488_TE_TC, ILI9488_TE_TC_CHANNEL, ul_mode);
+
+	ili9488_set_tear_scanline(ILI9488_LCD_HEIGHT);
+
+#ifdef CONF_ILI9488_TE_PIN
+	tc_write_rc(ILI9488_TE_TC, ILI9488_TE_TC_CHANNEL, ILI9488_TE_TC_WRAP - 1);
+	tc_start(ILI9488_TE_TC, ILI9488_TE_TC_CHANNEL);
+
+	pio_handler_set_pin(CONF_ILI9488_TE_PIN, PIO_IT_RISE_EDGE,
+			ili9488_te_edge_handler);
+	pio_enable_pin_interrupt(CONF_ILI9488_TE_PIN);
+	NVIC_EnableIRQ((IRQn_Type)pio_get_pin_group_id(CONF_ILI9488_TE_PIN));
+#else
+	tc_write_rc(ILI9488_TE_TC, ILI9488_TE_TC_CHANNEL, g_ul_period);
+
+	/* Line up the RC compare with the start of the blanking */
+	ul_lines = (ILI9488_LCD_HEIGHT + ILI9488_TE_LINES - ili9488_get_scanline())
+			% ILI9488_TE_LINES;
+	delay_us((uint32_t)((uint64_t)ul_lines * g_ul_line_ns / 1000));
+	tc_start(ILI9488_TE_TC, ILI9488_TE_TC_CHANNEL);
+
+	NVIC_ClearPendingIRQ((IRQn_Type)ILI9488_TE_TC_ID);
+	NVIC_SetPriority((IRQn_Type)ILI9488_TE_TC_ID, ILI9488_TE_IRQ_PRIORITY);
+	NVIC_EnableIRQ((IRQn_Type)ILI9488_TE_TC_ID);
+	tc_enable_interrupt(ILI9488_TE_TC, ILI9488_TE_TC_CHANNEL, TC_IER_CPCS);
+#endif
+
+	g_b_running = true;
+}
+
+/**
+ * \brief Whether a vsync came since the last frame started.
+ *
+ * The main loop can sleep while this is false, the vsync wakes it up.
+ */
+bool ili9488_te_frame_due(void)
+{
+	return !g_b_running || (g_ul_vsync_seq != g_ul_frame_seq);
+}
+
+/**
+ * \brief Ask to render a frame.
+ *
+ * Called by the main loop while it has something to draw.
+ *
+ * \return true if the frame may start now; ili9488_te_frame_end() must
+ * follow once it is sent.
+ */
+bool ili9488_te_frame_begin(void)
+{
+	uint32_t ul_seq = g_ul_vsync_seq;
+	uint32_t ul_bucket;
+
+	if (!g_b_running) {
+		return true;
+	}
+	if (!g_b_requested) {
+		g_b_requested = true;
+		g_ul_request_seq = ul_seq;
+	}
+	if (ul_seq == g_ul_frame_seq) {
+		return false;
+	}
+
+	/* Refreshes that went by after the one the frame was first due for */
+	if (ul_seq - g_ul_request_seq > 1) {
+		g_te_stats.ul_dropped += ul_seq - g_ul_request_seq - 1;
+	}
+
+	ul_bucket = ili9488_te_since_vsync() * ILI9488_TE_LATE_BUCKETS / g_ul_period;
+	g_te_stats.ul_late[Min(ul_bucket, ILI9488_TE_LATE_BUCKETS - 1)]++;
+
+	g_ul_begin_seq = ul_seq;
+	return true;
+}
+
+/**
+ * \brief The frame started by ili9488_te_frame_begin() has been sent.
+ */
+void ili9488_te_frame_end(void)
+{
+	uint32_t ul_seq = g_ul_vsync_seq;
+
+	if (!g_b_running) {
+		return;
+	}
+
+	/* A frame that overran its refresh held back the next one */
+	if (ul_seq - g_ul_begin_seq > 1) {
+		g_te_stats.ul_dropped += ul_seq - g_ul_begin_seq - 1;
+	}
+	g_ul_frame_seq = g_ul_begin_seq;
+	g_b_requested = false;
+	g_te_stats.ul_frames++;
+}
+
+/**
+ * \brief Lines until the scan reaches a row, counted from the scanline s.
+ */
+static inline int32_t ili9488_te_lines_to(int32_t l_row, int32_t l_scan)
+{
+	return (l_row - l_scan + ILI9488_TE_LINES) % ILI9488_TE_LINES;
+}
+
+/**
+ * \brief Whether a transfer starting now at scanline s lands untorn.
+ *
+ * \param l_scan current scanline.
+ * \param l_y1 first row.
+ * \param l_y2 last row.
+ * \param ul_row_ns bus time of one row.
+ */
+static bool ili9488_te_fits(int32_t l_scan, int32_t l_y1, int32_t l_y2,
+		uint32_t ul_row_ns)
+{
+	const int64_t ll_margin = (int64_t)ILI9488_TE_MARGIN_LINES * g_ul_line_ns;
+	int64_t ll_line = g_ul_line_ns;
+	int32_t l_first;
+
+	/* Ahead of the scan: the rectangle is below it, every row done in time */
+	if ((l_scan < l_y1) || (l_scan >= ILI9488_LCD_HEIGHT)) {
+		if ((int64_t)(l_y2 - l_y1 + 1) * ul_row_ns + ll_margin
+				<= ili9488_te_lines_to(l_y2, l_scan) * ll_line
+				&& (int64_t)ul_row_ns + ll_margin
+				<= ili9488_te_lines_to(l_y1, l_scan) * ll_line) {
+			return true;
+		}
+		/* Behind only works once the scan is inside or past the rectangle */
+		return false;
+	}
+
+	/* Behind the scan: rows from l_first on are still to be scanned... */
+	l_first = l_scan;
+	if (l_first <= l_y2) {
+		if ((int64_t)(l_first - l_y1) * ul_row_ns
+				< (int64_t)(l_first - l_scan) * ll_line + ll_margin
+				|| (int64_t)(l_y2 - l_y1) * ul_row_ns
+				< (int64_t)(l_y2 - l_scan) * ll_line + ll_margin) {
+			return false;
+		}
+	}
+
+	/* ...and nothing may still be written when the next refresh gets there */
+	return (int64_t)ul_row_ns + ll_margin
+			<= (ILI9488_TE_LINES - l_scan + l_y1) * ll_line
+			&& (int64_t)(l_y2 - l_y1 + 1) * ul_row_ns + ll_margin
+			<= (ILI9488_TE_LINES - l_scan + l_y2) * ll_line;
+}
+
+/**
+ * \brief Wait for the scanline window of a rectangle.
+ *
+ * Reads the scanline and returns once a transfer of the rectangle started
+ * now is not crossed by the scan. Waits at most one refresh; a rectangle that
+ * does not fit any window is let through at once.
+ *
+ * \param ul_y1 first row.
+ * \param ul_y2 last row.
+ * \param ul_width pixels per row.
+ */
+void ili9488_te_wait_rect(uint32_t ul_y1, uint32_t ul_y2, uint32_t ul_width)
+{
+#ifdef ILI9488_SPIMODE
+	uint32_t ul_row_ns = (uint32_t)((uint64_t)ul_width * LCD_DATA_COLOR_UNIT * 8
+			* 1000000000 / ILI9488_SPI_BAUDRATE);
+#else
+	uint32_t ul_row_ns = 0;
+#endif
+	int32_t l_target, l_scan, l_lines;
+
+	if (!g_b_running) {
+		return;
+	}
+
+	/*
+	 * The best chance is just behind the scan, the margin past the first
+	 * row, otherwise ahead of it from the blanking: give up if neither works
+	 */
+	l_target = (int32_t)ul_y1 + ILI9488_TE_MARGIN_LINES + 1;
+	if (!ili9488_te_fits(l_target, ul_y1, ul_y2, ul_row_ns)) {
+		l_target = ILI9488_LCD_HEIGHT;
+		if (!ili9488_te_fits(l_target, ul_y1, ul_y2, ul_row_ns)) {
+			g_te_stats.ul_unpaced++;
+			return;
+		}
+	}
+
+	l_scan = ili9488_get_scanline();
+	if (ili9488_te_fits(l_scan, ul_y1, ul_y2, ul_row_ns)) {
+		return;
+	}
+
+	/* Sleep until the scan gets to the target line, on this refresh or the next */
+	g_te_stats.ul_waits++;
+	l_lines = ili9488_te_lines_to(l_target, l_scan);
+	do {
+		delay_us((uint32_t)((uint64_t)Max(l_lines, 1) * g_ul_line_ns / 1000));
+		l_scan = ili9488_get_scanline();
+		l_lines = ili9488_te_lines_to(l_target, l_scan);
+	} while (!ili9488_te_fits(l_scan, ul_y1, ul_y2, ul_row_ns)
+			&& (l_lines < ILI9488_TE_MARGIN_LINES));
+}
+
+/**
+ * \brief Get the pacing statistics.
+ */
+void ili9488_te_get_stats(struct ili9488_te_stats *p_stats)
+{
+	irqflags_t flags = cpu_irq_save();
+
+	*p_stats = g_te_stats;
+	cpu_irq_restore(flags);
+}
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+}
+#endif
+/**INDENT-ON**/
+/// @endcond
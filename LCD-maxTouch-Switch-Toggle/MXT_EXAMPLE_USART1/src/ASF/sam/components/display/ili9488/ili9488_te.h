@@ -0,0 +1,102 @@
+/**
+ * \file
+ *
+ * \brief Frame pacing of the ILI9488 against its refresh scan.
+ *
+ * The panel refreshes its glass from GRAM top to bottom about 60 times per
+ * second. GRAM rows rewritten while the scan is crossing them show half old,
+ * half new content for one refresh: a tear. Two mechanisms avoid it:
+ *
+ * - Frames are paced on the vertical sync: ili9488_te_frame_begin() lets at
+ *   most one frame start per refresh, after the vsync. The vsync is the TE
+ *   output of the panel when CONF_ILI9488_TE_PIN names the PIO pin it is
+ *   wired to, otherwise a TC channel running at ILI9488_TE_FRAME_HZ,
+ *   phase-locked once to the panel with ILI9488_CMD_GET_SCANLINE.
+ * - Each rectangle is sent in its scanline window:
+ *   ili9488_te_wait_rect() reads the scanline and waits until the whole
+ *   transfer, at the speed of the bus, lands either ahead of the scan or
+ *   behind it and before the next refresh comes back to it. Rectangles too
+ *   large for any window are sent at once and counted.
+ *
+ * The TC channel also timestamps the vsyncs with the slow clock (30.5 us
+ * resolution, about one scanline), from which the frame start delay is
+ * measured.
+ *
+ * Without ili9488_te_init() every call returns at once and frames are not
+ * paced.
+ */
+
+#ifndef ILI9488_TE_H_INCLUDED
+#define ILI9488_TE_H_INCLUDED
+
+#include "compiler.h"
+#include "conf_ili9488.h"
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+ extern "C" {
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+/** Refresh rate of the emulated vsync. */
+#ifndef ILI9488_TE_FRAME_HZ
+#  define ILI9488_TE_FRAME_HZ     60
+#endif
+
+/** Lines of one refresh, vertical blanking included. */
+#ifndef ILI9488_TE_LINES
+#  define ILI9488_TE_LINES        490
+#endif
+
+/** Lines kept between a transfer and the scan. */
+#ifndef ILI9488_TE_MARGIN_LINES
+#  define ILI9488_TE_MARGIN_LINES 4
+#endif
+
+/** TC channel of the emulated vsync and of the timestamps. */
+#ifndef ILI9488_TE_TC
+#  define ILI9488_TE_TC           TC0
+#  define ILI9488_TE_TC_CHANNEL   2
+#  define ILI9488_TE_TC_ID        ID_TC2
+#  define ILI9488_TE_TC_Handler   TC2_Handler
+#endif
+
+/** NVIC priority of the vsync interrupt. */
+#ifndef ILI9488_TE_IRQ_PRIORITY
+#  define ILI9488_TE_IRQ_PRIORITY 4
+#endif
+
+/** Frame start delays are counted in eighths of a refresh. */
+#define ILI9488_TE_LATE_BUCKETS   8
+
+/**
+ * Pacing statistics.
+ */
+struct ili9488_te_stats {
+	uint32_t ul_vsyncs;          //!< refreshes seen
+	uint32_t ul_frames;          //!< frames rendered
+	uint32_t ul_dropped;         //!< refreshes that passed with a frame waiting
+	uint32_t ul_waits;           //!< rectangles held for their scanline window
+	uint32_t ul_unpaced;         //!< rectangles too large for any window
+	/** Frame starts by delay after the vsync, in eighths of a refresh. */
+	uint32_t ul_late[ILI9488_TE_LATE_BUCKETS];
+};
+
+void ili9488_te_init(void);
+bool ili9488_te_frame_due(void);
+bool ili9488_te_frame_begin(void);
+void ili9488_te_frame_end(void);
+void ili9488_te_wait_rect(uint32_t ul_y1, uint32_t ul_y2, uint32_t ul_width);
+void ili9488_te_get_stats(struct ili9488_te_stats *p_stats);
+
+/// @cond 0
+/**INDENT-OFF**/
+#ifdef __cplusplus
+}
+#endif
+/**INDENT-ON**/
+/// @endcond
+
+#endif /* ILI9488_TE_H_INCLUDED */
@@ -0,0 +1,182 @@
+/**
+ * \file
+ *
+ * \brief Pre-rendered sprite animations drawn as differences between frames.
+ *
+ * The spans of a difference are expanded through the palette into a row
+ * buffer and written with compositor_draw_span(), which only marks dirty
+ * the pixels that really change.
+ */
+
+#include <asf.h>
+#include <string.h>
+#include "anim.h"
+#include "compositor.h"
+#include "tfont.h"
+
+static struct anim_stats g_stats;
+
+/**
+ * \brief Palette of a sprite, RGB565.
+ */
+static uint32_t anim_palette(const tAnim *p_sprite, uint16_t *p_us_palette)
+{
+	const uint8_t *p_uc_data = p_sprite->data;
+	uint32_t i, ul_colors = p_uc_data[0] + 1;
+
+	for (i = 0; i < ul_colors; i++) {
+		p_us_palette[i] = p_uc_data[1 + 2 * i] | (p_uc_data[2 + 2 * i] << 8);
+	}
+	return ul_colors;
+}
+
+/**
+ * \brief Draw a difference of the sprite.
+ *
+ * \param ul_index 0 draws frame 0 over the background, i the frame i from
+ * i - 1, count frame 0 from the last one.
+ */
+static void anim_draw_diff(struct anim *p_anim, uint32_t ul_index)
+{
+	const tAnim *p_sprite = p_anim->p_sprite;
+	const uint8_t *p_uc_span = &p_sprite->data[p_sprite->frames[ul_index]];
+	const uint8_t *p_uc_end = &p_sprite->data[p_sprite->frames[ul_index + 1]];
+	uint16_t us_palette[TIMAGE_MAX_PALETTE];
+	uint16_t us_row[ANIM_MAX_WIDTH];
+	uint32_t i, ul_count, ul_pixels = 0;
+
+	anim_palette(p_sprite, us_palette);
+	while (p_uc_span < p_uc_end) {
+		ul_count = p_uc_span[2];
+		for (i = 0; i < ul_count; i++) {
+			us_row[i] = us_palette[(p_uc_span[3 + i / 2] >> ((i & 1) ? 0 : 4)) & 0x0F];
+		}
+		compositor_draw_span(p_anim->us_x + p_uc_span[1], p_anim->us_y + p_uc_span[0],
+				us_row, ul_count);
+		ul_pixels += ul_count;
+		p_uc_span += 3 + (ul_count + 1) / 2;
+	}
+
+	g_stats.ul_frames++;
+	g_stats.ul_last_bytes = p_uc_end - &p_sprite->data[p_sprite->frames[ul_index]];
+	g_stats.ul_last_pixels = ul_pixels;
+	g_stats.ul_bytes += g_stats.ul_last_bytes;
+	g_stats.ul_pixels += ul_pixels;
+	g_stats.ul_max_bytes = Max(g_stats.ul_max_bytes, g_stats.ul_last_bytes);
+}
+
+/**
+ * \brief Paint the sprite area with color 0 of the palette.
+ */
+static void anim_clear(struct anim *p_anim)
+{
+	const tAnim *p_sprite = p_anim->p_sprite;
+	uint16_t us_palette[TIMAGE_MAX_PALETTE];
+	uint16_t us_row[ANIM_MAX_WIDTH];
+	int32_t x, y;
+
+	anim_palette(p_sprite, us_palette);
+	for (x = 0; x < p_sprite->width; x++) {
+		us_row[x] = us_palette[0];
+	}
+	for (y = 0; y < p_sprite->height; y++) {
+		compositor_draw_span(p_anim->us_x, p_anim->us_y + y, us_row,
+				p_sprite->width);
+	}
+}
+
+/**
+ * \brief Set up an animation, hidden and stopped.
+ *
+ * Also what to call once something else has been drawn over the sprite:
+ * the next frame is drawn whole.
+ *
+ * \param p_sprite frames, from tools/asset_compiler.py --frames.
+ * \param ul_x X coordinate of the upper-left corner on the screen.
+ * \param ul_y Y coordinate.
+ */
+void anim_init(struct anim *p_anim, const tAnim *p_sprite, uint32_t ul_x,
+		uint32_t ul_y)
+{
+	p_anim->p_sprite = p_sprite;
+	p_anim->us_x = ul_x;
+	p_anim->us_y = ul_y;
+	p_anim->ul_period_ms = 0;
+	p_anim->us_frame = 0;
+	p_anim->b_shown = false;
+}
+
+/**
+ * \brief Set the time per frame.
+ *
+ * A stopped animation resumes from the frame it shows, a period later.
+ *
+ * \param ul_period_ms time per frame, 0 stops on the frame shown.
+ * \param ul_now_ms current time.
+ */
+void anim_set_period(struct anim *p_anim, uint32_t ul_period_ms,
+		uint32_t ul_now_ms)
+{
+	if (ul_period_ms && !p_anim->ul_period_ms) {
+		p_anim->ul_due_ms = ul_now_ms + ul_period_ms;
+	}
+	p_anim->ul_period_ms = ul_period_ms;
+}
+
+/**
+ * \brief Draw the next frame now, or the first one if hidden.
+ */
+void anim_step(struct anim *p_anim)
+{
+	uint32_t ul_next;
+
+	if (!p_anim->b_shown) {
+		/* Whatever is under it: only the pixels that change are sent */
+		anim_clear(p_anim);
+		anim_draw_diff(p_anim, 0);
+		p_anim->us_frame = 0;
+		p_anim->b_shown = true;
+		return;
+	}
+	ul_next = (p_anim->us_frame + 1) % p_anim->p_sprite->count;
+	anim_draw_diff(p_anim, ul_next ? ul_next : p_anim->p_sprite->count);
+	p_anim->us_frame = ul_next;
+}
+
+/**
+ * \brief Draw the frame due, if any; the first one at once if hidden,
+ * even stopped.
+ *
+ * \return time of the next frame, or ANIM_NO_DEADLINE when stopped.
+ */
+uint32_t anim_poll(struct anim *p_anim, uint32_t ul_now_ms)
+{
+	uint32_t ul_late;
+
+	if (!p_anim->b_shown) {
+		anim_step(p_anim);
+		p_anim->ul_due_ms = ul_now_ms + p_anim->ul_period_ms;
+	} else if (!p_anim->ul_period_ms) {
+		return ANIM_NO_DEADLINE;
+	} else if ((int32_t)(ul_now_ms - p_anim->ul_due_ms) >= 0) {
+		anim_step(p_anim);
+		ul_late = ul_now_ms - p_anim->ul_due_ms;
+		if (ul_late >= p_anim->ul_period_ms) {
+			/* Too late to keep the pace: the next one a period from now */
+			g_stats.ul_skipped += ul_late / p_anim->ul_period_ms;
+			p_anim->ul_due_ms = ul_now_ms;
+		}
+		p_anim->ul_due_ms += p_anim->ul_period_ms;
+	}
+	return p_anim->ul_period_ms ? p_anim->ul_due_ms : ANIM_NO_DEADLINE;
+}
+
+void anim_get_stats(struct anim_stats *p_stats)
+{
+	*p_stats = g_stats;
+}
+
+void anim_reset_stats(void)
+{
+	memset(&g_stats, 0, sizeof(g_stats));
+}
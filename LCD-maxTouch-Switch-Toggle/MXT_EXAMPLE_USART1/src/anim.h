@@ -0,0 +1,80 @@
+/**
+ * \file
+ *
+ * \brief Pre-rendered sprite animations drawn as differences between frames.
+ *
+ * A tAnim is made offline by tools/asset_compiler.py --frames. Its data
+ * starts with a palette of up to 16 RGB565 colors, like the TIMAGE_PAL
+ * formats, color 0 being the background; then come count + 1 differences:
+ * the first one draws frame 0 over the background, the next ones go from a
+ * frame to the following one, and the last one from the last frame back to
+ * frame 0. A difference is a list of spans, from frames[i] to
+ * frames[i + 1]:
+ *
+ *   <y> <x> <n> <n 4-bit palette indices, MSB first, padded to a byte>
+ *
+ * with the position in the sprite. Each frame thus only writes the pixels
+ * that change, and the compositor only sends the rows they are in.
+ *
+ * anim_poll() draws the next frame when it is due and returns when the one
+ * after it is, for the main loop to sleep until then. A late poll skips
+ * the time lost instead of drawing the frames missed, so an animation
+ * never takes more than one frame of work from the loop, whatever the
+ * touch handling or the bus did meanwhile.
+ *
+ * Drawing goes to the compositor and must be done from the main loop.
+ */
+
+#ifndef ANIM_H_
+#define ANIM_H_
+
+#include "compiler.h"
+
+/** Returned by anim_poll() when no frame is due by time. */
+#define ANIM_NO_DEADLINE  0xFFFFFFFFu
+
+/** Widest sprite, the span positions are bytes. */
+#define ANIM_MAX_WIDTH    255
+
+typedef struct {
+	const uint8_t *data;      //!< palette, then the differences
+	const uint32_t *frames;   //!< offset in data of each difference, count + 2
+	int width;
+	int height;
+	int count;                //!< frames
+	int turn;                 //!< degrees turned by the count frames, 0 if not turning
+} tAnim;
+
+/**
+ * An animation on the screen. Call anim_init() before anything else.
+ */
+struct anim {
+	const tAnim *p_sprite;
+	uint16_t us_x;            //!< upper-left corner on the screen
+	uint16_t us_y;
+	uint32_t ul_period_ms;    //!< time per frame, 0 stopped
+	uint32_t ul_due_ms;       //!< next frame
+	uint16_t us_frame;        //!< frame shown
+	bool b_shown;
+};
+
+struct anim_stats {
+	uint32_t ul_frames;       //!< frames drawn
+	uint32_t ul_skipped;      //!< frames not drawn, the poll came late
+	uint32_t ul_bytes;        //!< difference bytes read
+	uint32_t ul_pixels;       //!< pixels written
+	uint32_t ul_last_bytes;   //!< of the last frame
+	uint32_t ul_last_pixels;
+	uint32_t ul_max_bytes;    //!< of the largest frame
+};
+
+void anim_init(struct anim *p_anim, const tAnim *p_sprite, uint32_t ul_x,
+		uint32_t ul_y);
+void anim_set_period(struct anim *p_anim, uint32_t ul_period_ms,
+		uint32_t ul_now_ms);
+void anim_step(struct anim *p_anim);
+uint32_t anim_poll(struct anim *p_anim, uint32_t ul_now_ms);
+void anim_get_stats(struct anim_stats *p_stats);
+void anim_reset_stats(void);
+
+#endif /* ANIM_H_ */
@@ -0,0 +1,469 @@
+
+/*******************************************************************************
+* font
+* filename: unsaved
+* name: arial_36_aa
+* family: Arial
+* size: 36
+* style: Bold
+* included characters: 0123456789
+* antialiasing: yes, 4 bit alpha
+* type: proportional
+* encoding: ASMO-708
+* unicode bom: no
+*
+* preset name: asset_compiler a4
+* data block size: 8 bit(s), uint8_t
+* RLE compression enabled: no
+* conversion type: Color, not_used not_used
+* bits per pixel: 4
+*
+* preprocess:
+*  main scan direction: top_to_bottom
+*  line scan direction: forward
+*  inverse: no
+*******************************************************************************/
+
+/*
+ typedef struct {
+     long int code;
+     const tImage *image;
+     } tChar;
+ typedef struct {
+     int length;
+     const tChar *chars;
+     } tFont;
+*/
+
+#include <stdint.h>
+#include "tfont.h"
+
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_arial_36_aa_0x30[420] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x70, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xff, 
+    0xff, 0xb0, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x0b, 
+    0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x4f, 0xff, 0xff, 0x40, 0x04, 0xff, 0xff, 
+    0xf0, 0x00, 0x00, 0x7f, 0xff, 0xf7, 0x00, 0x00, 0xbf, 0xff, 0xf4, 0x00, 0x00, 0xff, 0xff, 0xf0, 
+    0x00, 0x00, 0x7f, 0xff, 0xf7, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xfb, 0x00, 
+    0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0xf0, 0x00, 0x00, 
+    0x0f, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x07, 0xff, 
+    0xff, 0x70, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x70, 0x00, 0x00, 0x0f, 0xff, 
+    0xff, 0x00, 0x07, 0xff, 0xff, 0x70, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x70, 
+    0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 
+    0x07, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 
+    0x0f, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x4f, 0xff, 0xfb, 0x00, 0x00, 0xbf, 
+    0xff, 0xf4, 0x00, 0x00, 0x7f, 0xff, 0xf7, 0x00, 0x00, 0x7f, 0xff, 0xfb, 0x00, 0x00, 0xff, 0xff, 
+    0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xb4, 0x4b, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x07, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x00, 
+    0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xff, 0xfb, 
+    0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage arial_36_aa_0x30 = { image_data_arial_36_aa_0x30,
+    20, 42, 4, TIMAGE_A4 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_arial_36_aa_0x31[420] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x0b, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xbf, 0xff, 0xff, 0xff, 0x00, 
+    0x00, 0x00, 0x00, 0x04, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x00, 0x00, 0x00, 
+    0x00, 0x0f, 0xff, 0xf4, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf7, 0x00, 0x0f, 0xff, 
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 
+    0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage arial_36_aa_0x31 = { image_data_arial_36_aa_0x31,
+    20, 42, 4, TIMAGE_A4 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_arial_36_aa_0x32[420] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x77, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x04, 0xbf, 0xff, 0xff, 0xfb, 0x70, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 
+    0xff, 0xfb, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x7f, 
+    0xff, 0xff, 0xfb, 0xbf, 0xff, 0xff, 0xf7, 0x00, 0x00, 0xff, 0xff, 0xfb, 0x00, 0x00, 0xbf, 0xff, 
+    0xfb, 0x00, 0x04, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x70, 
+    0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x04, 0x77, 0x77, 0x40, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x7f, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0xbf, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xfb, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 
+    0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x04, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 
+    0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x07, 0x77, 0x77, 0x77, 0x77, 0x77, 
+    0x77, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage arial_36_aa_0x32 = { image_data_arial_36_aa_0x32,
+    20, 42, 4, TIMAGE_A4 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_arial_36_aa_0x33[420] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x70, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x04, 0xbf, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 
+    0xff, 0xb4, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x4f, 
+    0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0xbf, 0xff, 0xf7, 0x00, 0x04, 0xff, 0xff, 
+    0xf0, 0x00, 0x00, 0xff, 0xff, 0xb0, 0x00, 0x00, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x77, 0xff, 0x70, 
+    0x00, 0x00, 0x7f, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xf0, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x7f, 
+    0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfb, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xb7, 0x7f, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0xbf, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0xff, 0xff, 0x70, 0x04, 0x77, 0x7f, 0x40, 0x00, 0x00, 0x07, 0xff, 0xff, 0x70, 0x07, 0xff, 
+    0xff, 0x70, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x40, 0x04, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x7f, 0xff, 
+    0xff, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x70, 0x4b, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x4f, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x40, 0x00, 
+    0x00, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xff, 0xfb, 
+    0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage arial_36_aa_0x33 = { image_data_arial_36_aa_0x33,
+    20, 42, 4, TIMAGE_A4 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_arial_36_aa_0x34[420] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
+    0x00, 0x00, 0x04, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xfb, 0x0f, 
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x04, 
+    0xff, 0xff, 0x40, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xfb, 0x00, 0x0f, 0xff, 0xff, 
+    0x00, 0x00, 0x00, 0xbf, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x04, 0xff, 0xff, 0x40, 
+    0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x0f, 0xff, 0xfb, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x47, 0x77, 0x77, 0x77, 0x77, 0x7f, 0xff, 0xff, 
+    0x77, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+    0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage arial_36_aa_0x34 = { image_data_arial_36_aa_0x34,
+    20, 42, 4, TIMAGE_A4 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_arial_36_aa_0x35[420] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb7, 0x77, 0x77, 0x77, 
+    0x77, 0x00, 0x00, 0x04, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x0f, 0xff, 0xff, 0x47, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 
+    0xff, 0xf4, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x7f, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x7f, 0xff, 0xff, 0x74, 0x47, 0xff, 0xff, 
+    0xff, 0x00, 0x00, 0x77, 0xff, 0xb0, 0x00, 0x00, 0x4f, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x07, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf0, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0xff, 0xff, 0xf0, 0x00, 0x07, 0x77, 0x40, 0x00, 0x00, 0x04, 0xff, 0xff, 0xb0, 0x04, 0xff, 
+    0xff, 0xb0, 0x00, 0x00, 0x07, 0xff, 0xff, 0x70, 0x00, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x0f, 0xff, 
+    0xff, 0x40, 0x00, 0x7f, 0xff, 0xff, 0x70, 0x04, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x0f, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 
+    0x00, 0x00, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xff, 0xff, 
+    0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage arial_36_aa_0x35 = { image_data_arial_36_aa_0x35,
+    20, 42, 4, TIMAGE_A4 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_arial_36_aa_0x36[420] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x77, 0x40, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x4b, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x04, 
+    0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xb0, 0x00, 0x4f, 0xff, 
+    0xff, 0x00, 0x00, 0x4f, 0xff, 0xfb, 0x00, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x00, 0xbf, 0xff, 0xf7, 
+    0x00, 0x00, 0x04, 0x77, 0x40, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf0, 0x7f, 0xff, 
+    0xff, 0x70, 0x00, 0x00, 0x07, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x07, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x07, 0xff, 0xff, 0xff, 0xf7, 0x77, 0xff, 0xff, 
+    0xf7, 0x00, 0x07, 0xff, 0xff, 0xff, 0x40, 0x00, 0x4f, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0xf7, 
+    0x00, 0x00, 0x07, 0xff, 0xff, 0x70, 0x07, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x04, 0xff, 0xff, 0x70, 
+    0x04, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xff, 0x70, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 
+    0x00, 0xff, 0xff, 0x70, 0x00, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0xff, 0xff, 0x70, 0x00, 0x7f, 
+    0xff, 0xf7, 0x00, 0x00, 0x07, 0xff, 0xff, 0x70, 0x00, 0x4f, 0xff, 0xff, 0x40, 0x00, 0x0b, 0xff, 
+    0xff, 0x40, 0x00, 0x0b, 0xff, 0xff, 0xf7, 0x04, 0xbf, 0xff, 0xfb, 0x00, 0x00, 0x04, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 
+    0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xbf, 0xff, 
+    0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage arial_36_aa_0x36 = { image_data_arial_36_aa_0x36,
+    20, 42, 4, TIMAGE_A4 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_arial_36_aa_0x37[420] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0x70, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x07, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x04, 0x77, 0x77, 0x77, 0x77, 0x77, 0xbf, 0xff, 
+    0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x0b, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xf7, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 
+    0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x7f, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb0, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x7f, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xf0, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0x40, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x77, 0x77, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage arial_36_aa_0x37 = { image_data_arial_36_aa_0x37,
+    20, 42, 4, TIMAGE_A4 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_arial_36_aa_0x38[420] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x74, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xfb, 0x40, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 
+    0xff, 0xf7, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x4f, 
+    0xff, 0xff, 0xb7, 0x7f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x7f, 0xff, 0xfb, 0x00, 0x00, 0xbf, 0xff, 
+    0xf7, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x4f, 0xff, 0xf7, 0x00, 0x00, 0xff, 0xff, 0xf0, 
+    0x00, 0x00, 0x0f, 0xff, 0xf7, 0x00, 0x00, 0xbf, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xf7, 0x00, 
+    0x00, 0x7f, 0xff, 0xf4, 0x00, 0x00, 0xbf, 0xff, 0xf0, 0x00, 0x00, 0x0b, 0xff, 0xff, 0x77, 0x7b, 
+    0xff, 0xff, 0xb0, 0x00, 0x00, 0x04, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 
+    0x0b, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xfb, 
+    0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xfb, 0xbf, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x7f, 0xff, 0xfb, 
+    0x00, 0x00, 0xbf, 0xff, 0xf7, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 
+    0x07, 0xff, 0xff, 0x70, 0x00, 0x00, 0x07, 0xff, 0xff, 0x40, 0x07, 0xff, 0xff, 0x70, 0x00, 0x00, 
+    0x07, 0xff, 0xff, 0x70, 0x07, 0xff, 0xff, 0x70, 0x00, 0x00, 0x07, 0xff, 0xff, 0x70, 0x07, 0xff, 
+    0xff, 0x70, 0x00, 0x00, 0x0b, 0xff, 0xff, 0x40, 0x04, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x4f, 0xff, 
+    0xff, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x40, 0x04, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x4f, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 
+    0x00, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xff, 0xff, 
+    0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage arial_36_aa_0x38 = { image_data_arial_36_aa_0x38,
+    20, 42, 4, TIMAGE_A4 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_arial_36_aa_0x39[420] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x40, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 
+    0xff, 0xb0, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x00, 0xbf, 
+    0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0xff, 0xff, 0xf4, 0x00, 0x0b, 0xff, 0xff, 
+    0xf0, 0x00, 0x07, 0xff, 0xff, 0x70, 0x00, 0x00, 0xff, 0xff, 0xf4, 0x00, 0x07, 0xff, 0xff, 0x00, 
+    0x00, 0x00, 0x7f, 0xff, 0xf7, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xff, 0x00, 
+    0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x0b, 0xff, 0xff, 0x00, 0x00, 0x00, 
+    0x0f, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0x40, 0x00, 0x00, 0x7f, 0xff, 0xff, 0x40, 0x07, 0xff, 
+    0xff, 0xb0, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x70, 0x00, 0xff, 0xff, 0xf7, 0x00, 0x0b, 0xff, 0xff, 
+    0xff, 0x70, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x0b, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x00, 
+    0x00, 0x00, 0x00, 0x77, 0xf7, 0x70, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xfb, 0x00, 0x04, 0x77, 
+    0xbf, 0x70, 0x00, 0x00, 0x7f, 0xff, 0xf7, 0x00, 0x00, 0xff, 0xff, 0xb0, 0x00, 0x04, 0xff, 0xff, 
+    0xf0, 0x00, 0x00, 0xbf, 0xff, 0xfb, 0x40, 0x7f, 0xff, 0xff, 0x70, 0x00, 0x00, 0x4f, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 
+    0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x7f, 0xff, 0xf7, 
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage arial_36_aa_0x39 = { image_data_arial_36_aa_0x39,
+    20, 42, 4, TIMAGE_A4 };
+#endif
+
+
+static const tChar arial_36_aa_array[] = {
+
+#if (0x0 == 0x0)
+  // character: '0'
+  {0x30, &arial_36_aa_0x30},
+#else
+  // character: '0' == ''
+  {0x30, &arial_36_aa_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '1'
+  {0x31, &arial_36_aa_0x31},
+#else
+  // character: '1' == ''
+  {0x31, &arial_36_aa_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '2'
+  {0x32, &arial_36_aa_0x32},
+#else
+  // character: '2' == ''
+  {0x32, &arial_36_aa_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '3'
+  {0x33, &arial_36_aa_0x33},
+#else
+  // character: '3' == ''
+  {0x33, &arial_36_aa_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '4'
+  {0x34, &arial_36_aa_0x34},
+#else
+  // character: '4' == ''
+  {0x34, &arial_36_aa_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '5'
+  {0x35, &arial_36_aa_0x35},
+#else
+  // character: '5' == ''
+  {0x35, &arial_36_aa_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '6'
+  {0x36, &arial_36_aa_0x36},
+#else
+  // character: '6' == ''
+  {0x36, &arial_36_aa_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '7'
+  {0x37, &arial_36_aa_0x37},
+#else
+  // character: '7' == ''
+  {0x37, &arial_36_aa_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '8'
+  {0x38, &arial_36_aa_0x38},
+#else
+  // character: '8' == ''
+  {0x38, &arial_36_aa_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '9'
+  {0x39, &arial_36_aa_0x39}
+#else
+  // character: '9' == ''
+  {0x39, &arial_36_aa_0x}
+#endif
+
+};
+
+
+const tFont arial_36_aa = { 10, arial_36_aa_array, '0', '9' };
+
@@ -0,0 +1,603 @@
+/**
+ * \file
+ *
+ * \brief Screen capture streamed over the console USART.
+ *
+ * The flush hook of the compositor collects the areas sent to the panel.
+ * When a frame starts they are taken as a whole, and capture_poll() sends
+ * them a packet at a time, reading the framebuffer rows as it goes: an area
+ * drawn again meanwhile is collected for the next frame, so the last frame
+ * always ends up with what the panel shows.
+ *
+ * The rows are encoded straight from the framebuffer: it is only drawn
+ * into from the main loop, between two packets, and the "above" tokens do
+ * not reach across a packet.
+ */
+
+#include <asf.h>
+#include <string.h>
+#include "capture.h"
+#include "conf_uart_serial.h"
+#ifndef CAPTURE_TX_SIMULATED
+#  include "stdio_serial.h"
+#endif
+
+/** XDMAC hardware interface number of the USART1 transmitter. */
+#define CAPTURE_DMA_PERID_USART1_TX 9
+
+/** Data cache line size of the Cortex-M7. */
+#define CAPTURE_CACHE_LINE     32
+
+/** Sync, type, length and sequence before the payload, CRC after it. */
+#define CAPTURE_HEADER_SIZE    6
+#define CAPTURE_CRC_SIZE       2
+
+#define CAPTURE_BEGIN_SIZE     11
+#define CAPTURE_RECT_HEADER    8
+#define CAPTURE_TOKEN_MAX      64
+
+/** Most bytes a row of ul_width pixels takes: literal tokens only. */
+#define CAPTURE_ROW_MAX(ul_width) \
+		(2 * (ul_width) + ((ul_width) + CAPTURE_TOKEN_MAX - 1) / CAPTURE_TOKEN_MAX)
+
+/** Budget saved while idle, in bytes: two full packets. */
+#define CAPTURE_BURST          (2 * (CAPTURE_PACKET_MAX + CAPTURE_HEADER_SIZE \
+		+ CAPTURE_CRC_SIZE))
+
+#ifdef CAPTURE_TX_SIMULATED
+/* No cycle counter on the host */
+#  define CAPTURE_CYCLES()     0
+#else
+#  define CAPTURE_CYCLES()     DWT->CYCCNT
+#endif
+
+static const struct capture_config *g_p_config;
+static struct capture_stats g_stats;
+static volatile bool g_b_active;
+static volatile bool g_b_stopping;   /* the ring still holds packets */
+
+/* TX ring: head moves with the interrupts masked, tail when a block is done */
+static uint8_t g_uc_tx[CAPTURE_TX_SIZE];
+static volatile uint32_t g_ul_tx_head;
+static volatile uint32_t g_ul_tx_tail;
+static volatile uint32_t g_ul_tx_block;   /* bytes on the XDMAC, 0 when idle */
+
+static uint8_t g_uc_packet[CAPTURE_HEADER_SIZE + CAPTURE_PACKET_MAX
+		+ CAPTURE_CRC_SIZE];
+static uint8_t g_uc_seq;
+
+/* Areas collected by the flush hook, areas of the frame being sent */
+static struct compositor_rect g_pending[CAPTURE_MAX_DIRTY];
+static uint32_t g_ul_pending;
+static struct compositor_rect g_frame[CAPTURE_MAX_DIRTY];
+static uint32_t g_ul_frame_rects;
+static uint32_t g_ul_frame_row;       /* next row of the last area */
+static bool g_b_in_frame;
+static uint16_t g_us_frame;
+static bool g_b_key;                  /* the next frame is a keyframe */
+static uint32_t g_ul_key_ms;
+
+/* Budget in bytes x 1000, refilled by ul_bytes_per_s every ms */
+static int32_t g_l_credit;
+static uint32_t g_ul_budget_ms;
+static bool g_b_budget_started;
+
+static const uint16_t g_us_crc_nibble[16] = {
+	0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+	0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+};
+
+/**
+ * \brief CRC-16/CCITT, a nibble at a time.
+ */
+static uint16_t capture_crc(const uint8_t *p_uc_data, uint32_t ul_size)
+{
+	uint16_t us_crc = 0xFFFF;
+
+	while (ul_size--) {
+		us_crc = (us_crc << 4) ^ g_us_crc_nibble[(us_crc >> 12) ^ (*p_uc_data >> 4)];
+		us_crc = (us_crc << 4) ^ g_us_crc_nibble[(us_crc >> 12) ^ (*p_uc_data & 0x0F)];
+		p_uc_data++;
+	}
+	return us_crc;
+}
+
+static uint8_t *capture_put16(uint8_t *p_uc_out, uint32_t ul_value)
+{
+	*p_uc_out++ = (uint8_t)ul_value;
+	*p_uc_out++ = (uint8_t)(ul_value >> 8);
+	return p_uc_out;
+}
+
+static uint32_t capture_tx_free(void)
+{
+	return CAPTURE_TX_SIZE - (g_ul_tx_head - g_ul_tx_tail);
+}
+
+#ifndef CAPTURE_TX_SIMULATED
+/**
+ * \brief Write back the data cache lines of a part of the ring.
+ */
+static void capture_clean_dcache(const uint8_t *p_data, uint32_t ul_size)
+{
+#ifdef CONF_BOARD_ENABLE_CACHE
+	uint32_t ul_addr = (uint32_t)p_data & ~(CAPTURE_CACHE_LINE - 1);
+	uint32_t ul_end = (uint32_t)p_data + ul_size;
+
+	__DSB();
+	while (ul_addr < ul_end) {
+		SCB->DCCMVAC = ul_addr;
+		ul_addr += CAPTURE_CACHE_LINE;
+	}
+	__DSB();
+	__ISB();
+#else
+	UNUSED(p_data);
+	UNUSED(ul_size);
+#endif
+}
+
+/**
+ * \brief Put a part of the ring on the XDMAC channel.
+ */
+static void capture_dma_start(const uint8_t *p_data, uint32_t ul_size)
+{
+	XdmacChid *p_ch = &XDMAC->XDMAC_CHID[CAPTURE_DMA_CHANNEL];
+	Usart *p_usart = (Usart *)USART_SERIAL_EXAMPLE;
+
+	capture_clean_dcache(p_data, ul_size);
+	(void)p_ch->XDMAC_CIS;
+	p_ch->XDMAC_CSA = (uint32_t)p_data;
+	p_ch->XDMAC_CDA = (uint32_t)&p_usart->US_THR;
+	p_ch->XDMAC_CUBC = XDMAC_CUBC_UBLEN(ul_size);
+	p_ch->XDMAC_CBC = 0;
+	p_ch->XDMAC_CNDC = 0;
+	p_ch->XDMAC_CDS_MSP = 0;
+	p_ch->XDMAC_CSUS = 0;
+	p_ch->XDMAC_CDUS = 0;
+	p_ch->XDMAC_CC = XDMAC_CC_TYPE_PER_TRAN
+			| XDMAC_CC_MBSIZE_SINGLE
+			| XDMAC_CC_DSYNC_MEM2PER
+			| XDMAC_CC_SWREQ_HWR_CONNECTED
+			| XDMAC_CC_MEMSET_NORMAL_MODE
+			| XDMAC_CC_CSIZE_CHK_1
+			| XDMAC_CC_DWIDTH_BYTE
+			| XDMAC_CC_SIF_AHB_IF0
+			| XDMAC_CC_DIF_AHB_IF1
+			| XDMAC_CC_SAM_INCREMENTED_AM
+			| XDMAC_CC_DAM_FIXED_AM
+			| XDMAC_CC_PERID(CAPTURE_DMA_PERID_USART1_TX);
+	p_ch->XDMAC_CIE = 0;
+	XDMAC->XDMAC_GE = (XDMAC_GE_EN0 << CAPTURE_DMA_CHANNEL);
+}
+
+static int capture_putchar(volatile void *p_usart, char c)
+{
+	UNUSED(p_usart);
+	capture_console_write((const uint8_t *)&c, 1);
+	return 1;
+}
+#endif
+
+/**
+ * \brief Retire the block sent and send the next part of the ring.
+ *
+ * May be called from interrupt handlers (console text).
+ */
+static void capture_tx_kick(void)
+{
+	uint32_t ul_offset, ul_size;
+	irqflags_t flags = cpu_irq_save();
+
+#ifdef CAPTURE_TX_SIMULATED
+	while (g_ul_tx_tail != g_ul_tx_head) {
+		ul_offset = g_ul_tx_tail % CAPTURE_TX_SIZE;
+		ul_size = Min(g_ul_tx_head - g_ul_tx_tail, CAPTURE_TX_SIZE - ul_offset);
+		usart_serial_write_packet(USART_SERIAL_EXAMPLE, &g_uc_tx[ul_offset], ul_size);
+		g_ul_tx_tail += ul_size;
+	}
+#else
+	if (g_ul_tx_block
+			&& !(XDMAC->XDMAC_GS & (XDMAC_GS_ST0 << CAPTURE_DMA_CHANNEL))) {
+		g_ul_tx_tail += g_ul_tx_block;
+		g_ul_tx_block = 0;
+	}
+	if (!g_ul_tx_block && (g_ul_tx_tail != g_ul_tx_head)) {
+		/* Up to the end of the ring, the rest goes next */
+		ul_offset = g_ul_tx_tail % CAPTURE_TX_SIZE;
+		ul_size = Min(g_ul_tx_head - g_ul_tx_tail, CAPTURE_TX_SIZE - ul_offset);
+		g_ul_tx_block = ul_size;
+		capture_dma_start(&g_uc_tx[ul_offset], ul_size);
+	}
+#endif
+	cpu_irq_restore(flags);
+}
+
+/**
+ * \brief Copy bytes into the ring. The interrupts must be masked and the
+ * room checked.
+ */
+static void capture_tx_write(const uint8_t *p_uc_data, uint32_t ul_size)
+{
+	uint32_t ul_offset = g_ul_tx_head % CAPTURE_TX_SIZE;
+	uint32_t ul_first = Min(ul_size, CAPTURE_TX_SIZE - ul_offset);
+
+	memcpy(&g_uc_tx[ul_offset], p_uc_data, ul_first);
+	memcpy(g_uc_tx, p_uc_data + ul_first, ul_size - ul_first);
+	g_ul_tx_head += ul_size;
+}
+
+/**
+ * \brief Start a packet in g_uc_packet.
+ *
+ * \return where the payload goes.
+ */
+static uint8_t *capture_packet_begin(enum capture_packet type)
+{
+	g_uc_packet[0] = CAPTURE_SYNC0;
+	g_uc_packet[1] = CAPTURE_SYNC1;
+	g_uc_packet[2] = (uint8_t)type;
+	return &g_uc_packet[CAPTURE_HEADER_SIZE];
+}
+
+/**
+ * \brief Finish the packet, queue it in one piece and charge the budget.
+ *
+ * \param p_uc_end end of the payload.
+ */
+static void capture_packet_send(const uint8_t *p_uc_end)
+{
+	uint32_t ul_payload = p_uc_end - &g_uc_packet[CAPTURE_HEADER_SIZE];
+	uint32_t ul_size = CAPTURE_HEADER_SIZE + ul_payload + CAPTURE_CRC_SIZE;
+	irqflags_t flags;
+
+	capture_put16(&g_uc_packet[3], ul_payload);
+	g_uc_packet[5] = g_uc_seq++;
+	capture_put16(&g_uc_packet[CAPTURE_HEADER_SIZE + ul_payload],
+			capture_crc(&g_uc_packet[2], CAPTURE_HEADER_SIZE - 2 + ul_payload));
+
+	/* Console text from an interrupt handler must not land inside */
+	flags = cpu_irq_save();
+	capture_tx_write(g_uc_packet, ul_size);
+	cpu_irq_restore(flags);
+	capture_tx_kick();
+
+	g_l_credit -= (int32_t)ul_size * 1000;
+	g_stats.ul_packets++;
+	g_stats.ul_bytes += ul_size;
+}
+
+/**
+ * \brief Encode a row.
+ *
+ * \param p_uc_out tokens, room for CAPTURE_ROW_MAX(ul_width) bytes.
+ * \param p_us_row pixels.
+ * \param p_us_above row above it in the packet, NULL for the first one.
+ *
+ * \return the end of the tokens.
+ */
+static uint8_t *capture_encode_row(uint8_t *p_uc_out, const uint16_t *p_us_row,
+		const uint16_t *p_us_above, uint32_t ul_width)
+{
+	uint32_t i = 0, j, n, ul_above, ul_run;
+
+	while (i < ul_width) {
+		ul_above = 0;
+		if (p_us_above) {
+			while ((i + ul_above < ul_width) && (ul_above < CAPTURE_TOKEN_MAX)
+					&& (p_us_row[i + ul_above] == p_us_above[i + ul_above])) {
+				ul_above++;
+			}
+		}
+		ul_run = 1;
+		while ((i + ul_run < ul_width) && (ul_run < CAPTURE_TOKEN_MAX)
+				&& (p_us_row[i + ul_run] == p_us_row[i])) {
+			ul_run++;
+		}
+
+		if ((ul_above >= 2) && (ul_above >= ul_run)) {
+			*p_uc_out++ = 0x80 | (ul_above - 1);
+			i += ul_above;
+		} else if (ul_run >= 2) {
+			*p_uc_out++ = 0x40 | (ul_run - 1);
+			p_uc_out = capture_put16(p_uc_out, p_us_row[i]);
+			i += ul_run;
+		} else {
+			/* Literals up to where a run or a copy of the row above
+			 * starts */
+			for (n = 1; (i + n < ul_width) && (n < CAPTURE_TOKEN_MAX); n++) {
+				j = i + n;
+				if ((j + 1 < ul_width) && ((p_us_row[j] == p_us_row[j + 1])
+						|| (p_us_above && (p_us_row[j] == p_us_above[j])
+						&& (p_us_row[j + 1] == p_us_above[j + 1])))) {
+					break;
+				}
+			}
+			*p_uc_out++ = n - 1;
+			for (j = i; j < i + n; j++) {
+				p_uc_out = capture_put16(p_uc_out, p_us_row[j]);
+			}
+			i += n;
+		}
+	}
+	return p_uc_out;
+}
+
+/**
+ * \brief Send the next rows of the last area of the frame, as many as a
+ * packet holds.
+ */
+static void capture_send_rows(void)
+{
+	const struct compositor_rect *p_rect = &g_frame[g_ul_frame_rects - 1];
+	const uint16_t *p_us_row = compositor_get_framebuffer()
+			+ g_ul_frame_row * COMPOSITOR_WIDTH + p_rect->x1;
+	uint32_t ul_width = p_rect->x2 - p_rect->x1 + 1;
+	uint32_t ul_rows = 0;
+	uint8_t *p_uc_start = capture_packet_begin(CAPTURE_PKT_RECT);
+	uint8_t *p_uc_out = p_uc_start + CAPTURE_RECT_HEADER;
+
+	capture_put16(p_uc_start, p_rect->x1);
+	capture_put16(p_uc_start + 2, g_ul_frame_row);
+	capture_put16(p_uc_start + 4, ul_width);
+
+	while ((g_ul_frame_row + ul_rows <= p_rect->y2)
+			&& (p_uc_out - p_uc_start + CAPTURE_ROW_MAX(ul_width)
+					<= CAPTURE_PACKET_MAX)) {
+		p_uc_out = capture_encode_row(p_uc_out, p_us_row,
+				ul_rows ? p_us_row - COMPOSITOR_WIDTH : NULL, ul_width);
+		p_us_row += COMPOSITOR_WIDTH;
+		ul_rows++;
+	}
+	capture_put16(p_uc_start + 6, ul_rows);
+	capture_packet_send(p_uc_out);
+	g_stats.ul_pixels += ul_rows * ul_width;
+
+	g_ul_frame_row += ul_rows;
+	if (g_ul_frame_row > p_rect->y2) {
+		if (--g_ul_frame_rects) {
+			g_ul_frame_row = g_frame[g_ul_frame_rects - 1].y1;
+		}
+	}
+}
+
+/**
+ * \brief Start a frame with the areas collected so far.
+ */
+static void capture_begin_frame(uint32_t ul_now_ms)
+{
+	uint8_t *p_uc_out = capture_packet_begin(CAPTURE_PKT_BEGIN);
+
+	memcpy(g_frame, g_pending, g_ul_pending * sizeof(g_frame[0]));
+	g_ul_frame_rects = g_ul_pending;
+	g_ul_pending = 0;
+	g_ul_frame_row = g_frame[g_ul_frame_rects - 1].y1;
+	g_b_in_frame = true;
+
+	p_uc_out = capture_put16(p_uc_out, ++g_us_frame);
+	*p_uc_out++ = g_b_key ? CAPTURE_FRAME_KEY : 0;
+	p_uc_out = capture_put16(p_uc_out, ul_now_ms);
+	p_uc_out = capture_put16(p_uc_out, ul_now_ms >> 16);
+	p_uc_out = capture_put16(p_uc_out, COMPOSITOR_WIDTH);
+	p_uc_out = capture_put16(p_uc_out, COMPOSITOR_HEIGHT);
+	capture_packet_send(p_uc_out);
+	if (g_b_key) {
+		g_b_key = false;
+		g_ul_key_ms = ul_now_ms;
+		g_stats.ul_keyframes++;
+	}
+}
+
+static void capture_end_frame(void)
+{
+	capture_packet_send(capture_put16(capture_packet_begin(CAPTURE_PKT_END),
+			g_us_frame));
+	g_b_in_frame = false;
+	g_stats.ul_frames++;
+}
+
+/**
+ * \brief Send the whole screen in the next frame.
+ */
+static void capture_key(void)
+{
+	struct compositor_rect screen = {
+		0, 0, COMPOSITOR_WIDTH - 1, COMPOSITOR_HEIGHT - 1
+	};
+
+	g_pending[0] = screen;
+	g_ul_pending = 1;
+	g_b_key = true;
+}
+
+/**
+ * \brief Flush hook: collect an area for the next frame.
+ */
+static void capture_area(const struct compositor_rect *p_rect)
+{
+	compositor_rect_add(g_pending, &g_ul_pending, CAPTURE_MAX_DIRTY, *p_rect);
+}
+
+/**
+ * \brief Refill the budget for the time gone by.
+ */
+static void capture_budget(uint32_t ul_now_ms)
+{
+	uint32_t ul_ms;
+
+	if (!g_b_budget_started) {
+		g_b_budget_started = true;
+		g_ul_budget_ms = ul_now_ms;
+		g_l_credit = CAPTURE_BURST * 1000;
+		return;
+	}
+	ul_ms = Min(ul_now_ms - g_ul_budget_ms, 1000);
+	g_ul_budget_ms = ul_now_ms;
+	g_l_credit = Min(g_l_credit + (int32_t)(ul_ms * g_p_config->ul_bytes_per_s),
+			CAPTURE_BURST * 1000);
+}
+
+/**
+ * \brief Set up the capture, stopped.
+ *
+ * \param p_config settings, kept.
+ */
+void capture_init(const struct capture_config *p_config)
+{
+	g_p_config = p_config;
+	memset(&g_stats, 0, sizeof(g_stats));
+	g_b_active = false;
+	g_b_stopping = false;
+	g_ul_tx_head = 0;
+	g_ul_tx_tail = 0;
+	g_ul_tx_block = 0;
+
+#ifndef CAPTURE_TX_SIMULATED
+	pmc_enable_periph_clk(ID_XDMAC);
+	XDMAC->XDMAC_GD = (XDMAC_GD_DI0 << CAPTURE_DMA_CHANNEL);
+	XDMAC->XDMAC_GID = (XDMAC_GID_ID0 << CAPTURE_DMA_CHANNEL);
+
+	/* Cycle counter for the time spent encoding */
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR = 0xC5ACCE55;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+/**
+ * \brief Start capturing, with a keyframe.
+ *
+ * From now on the console text must be written with printf() or
+ * capture_console_write(), which queue it between the packets.
+ */
+void capture_start(void)
+{
+	if (!g_p_config || g_b_active) {
+		return;
+	}
+	g_b_in_frame = false;
+	g_b_budget_started = false;
+	capture_key();
+	compositor_set_flush_hook(capture_area);
+#ifndef CAPTURE_TX_SIMULATED
+	ptr_put = capture_putchar;
+#endif
+	g_b_stopping = false;
+	g_b_active = true;
+}
+
+/**
+ * \brief Stop capturing. The frame being sent is dropped; the console goes
+ * back to the USART once the ring is empty.
+ */
+void capture_stop(void)
+{
+	if (!g_b_active) {
+		return;
+	}
+	compositor_set_flush_hook(NULL);
+	g_b_active = false;
+	g_b_stopping = true;
+}
+
+bool capture_is_active(void)
+{
+	return g_b_active;
+}
+
+/**
+ * \brief Send what the budget and the ring allow.
+ *
+ * Call from the main loop after compositor_flush().
+ *
+ * \return when to call again at the latest, or CAPTURE_NO_DEADLINE.
+ */
+uint32_t capture_poll(uint32_t ul_now_ms)
+{
+	uint32_t ul_start, ul_cycles, ul_packets, ul_due = CAPTURE_NO_DEADLINE;
+
+	if (!g_b_active && !g_b_stopping) {
+		return CAPTURE_NO_DEADLINE;
+	}
+	capture_tx_kick();
+	if (g_b_stopping) {
+		if (g_ul_tx_head == g_ul_tx_tail) {
+#ifndef CAPTURE_TX_SIMULATED
+			ptr_put = (int (*)(void volatile*, char))&usart_serial_putchar;
+#endif
+			g_b_stopping = false;
+		}
+	} else {
+		ul_start = CAPTURE_CYCLES();
+		ul_packets = g_stats.ul_packets;
+		capture_budget(ul_now_ms);
+		if (g_p_config->ul_key_ms && !g_b_key
+				&& (ul_now_ms - g_ul_key_ms >= g_p_config->ul_key_ms)) {
+			capture_key();
+		}
+		while ((g_l_credit > 0) && (capture_tx_free()
+				>= CAPTURE_HEADER_SIZE + CAPTURE_PACKET_MAX + CAPTURE_CRC_SIZE
+				+ CAPTURE_TEXT_RESERVE)) {
+			if (!g_b_in_frame) {
+				if (!g_ul_pending) {
+					break;
+				}
+				capture_begin_frame(ul_now_ms);
+			} else if (g_ul_frame_rects) {
+				capture_send_rows();
+			} else {
+				capture_end_frame();
+			}
+		}
+		if (g_stats.ul_packets != ul_packets) {
+			ul_cycles = CAPTURE_CYCLES() - ul_start;
+			g_stats.ul_polls++;
+			g_stats.ul_cycles += ul_cycles;
+			g_stats.ul_max_cycles = Max(g_stats.ul_max_cycles, ul_cycles);
+		}
+		/* Out of budget with work left: when there is enough again */
+		if ((g_l_credit <= 0) && (g_b_in_frame || g_ul_pending)) {
+			ul_due = ul_now_ms + (uint32_t)(-g_l_credit) / g_p_config->ul_bytes_per_s + 1;
+		}
+	}
+	/* A block on the wire: when it is done */
+	if (g_ul_tx_block) {
+		ul_due = Min(ul_due, ul_now_ms + g_ul_tx_block * 10 * 1000
+				/ USART_SERIAL_EXAMPLE_BAUDRATE + 1);
+	}
+	return ul_due;
+}
+
+/**
+ * \brief Write on the console.
+ *
+ * While capturing, or until the packets are all sent, the bytes are queued
+ * between two packets, or dropped if the ring is full; otherwise they are
+ * written to the USART at once. May be called from interrupt handlers.
+ */
+void capture_console_write(const uint8_t *p_uc_data, uint32_t ul_size)
+{
+	irqflags_t flags;
+
+	if (!g_b_active && !g_b_stopping) {
+		usart_serial_write_packet(USART_SERIAL_EXAMPLE, p_uc_data, ul_size);
+		return;
+	}
+	flags = cpu_irq_save();
+	if (capture_tx_free() >= ul_size) {
+		capture_tx_write(p_uc_data, ul_size);
+		g_stats.ul_text_bytes += ul_size;
+	} else {
+		g_stats.ul_text_dropped += ul_size;
+	}
+	cpu_irq_restore(flags);
+	capture_tx_kick();
+}
+
+/**
+ * \brief Get the capture statistics.
+ */
+void capture_get_stats(struct capture_stats *p_stats)
+{
+	*p_stats = g_stats;
+}
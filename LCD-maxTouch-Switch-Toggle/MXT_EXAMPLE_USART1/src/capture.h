@@ -0,0 +1,128 @@
+/**
+ * \file
+ *
+ * \brief Screen capture streamed over the console USART.
+ *
+ * While capturing, the content of the compositor framebuffer is sent on the
+ * console as packets: a keyframe with the whole screen first, then only the
+ * areas each flush changed. tools/capture_decode.py rebuilds the frames on
+ * the PC from what the serial port received.
+ *
+ * Packets go through a TX ring that an XDMAC channel sends to the USART in
+ * blocks, and capture_poll() only encodes as much as the ring and a byte
+ * rate budget allow, so the main loop never waits for the wire. The channel
+ * raises no interrupt (the XDMAC handler belongs to the LCD transfer
+ * engine): capture_poll() starts the next block when the previous one is
+ * done, and returns when that will be. The console text written meanwhile
+ * (printf, capture_console_write()) goes through the same ring, between two
+ * packets, and the decoder passes it through; a part that finds the ring
+ * full is dropped and counted.
+ *
+ * With CAPTURE_TX_SIMULATED defined the XDMAC is not touched: the ring is
+ * written out with usart_serial_write_packet() as soon as it is filled.
+ *
+ * Stream format, little-endian:
+ *
+ *   packet:  A5 5A <type> <length:2> <seq> <payload: length bytes> <crc:2>
+ *
+ * seq counts the packets modulo 256, the CRC-16/CCITT (0x1021, starting at
+ * 0xFFFF) covers everything from <type> to the end of the payload. Packet
+ * types and payloads:
+ *
+ *   CAPTURE_PKT_BEGIN  <frame:2> <flags> <ms:4> <width:2> <height:2>
+ *                      a frame starts; CAPTURE_FRAME_KEY: the whole screen
+ *                      follows, older frames are not needed
+ *   CAPTURE_PKT_RECT   <x:2> <y:2> <width:2> <rows:2> <tokens>
+ *                      rows of RGB565 pixels
+ *   CAPTURE_PKT_END    <frame:2>
+ *                      the frame is complete
+ *
+ * The pixels of a RECT packet are coded row by row, the top row first, with
+ * tokens of 1 to 64 pixels (n + 1, n the low 6 bits of the token byte) that
+ * never cross a row:
+ *
+ *   00nnnnnn <pixel:2>...   literal pixels
+ *   01nnnnnn <pixel:2>      one pixel repeated
+ *   10nnnnnn                same pixels as the row above, in the packet
+ *
+ * Capture starts and stops at run time. The encoder state is in SRAM next to
+ * the framebuffer: a ring of CAPTURE_TX_SIZE bytes, a packet of
+ * CAPTURE_PACKET_MAX and two rows.
+ */
+
+#ifndef CAPTURE_H_
+#define CAPTURE_H_
+
+#include "compiler.h"
+#include "compositor.h"
+
+/** XDMAC channel of the TX ring; the LCD uses ILI9488_DMA_CHANNEL. */
+#ifndef CAPTURE_DMA_CHANNEL
+#  define CAPTURE_DMA_CHANNEL    1
+#endif
+
+/** Size of the TX ring, a power of two. */
+#ifndef CAPTURE_TX_SIZE
+#  define CAPTURE_TX_SIZE        4096
+#endif
+
+/** Largest packet payload; a packet holds at least one full row. */
+#ifndef CAPTURE_PACKET_MAX
+#  define CAPTURE_PACKET_MAX     1024
+#endif
+
+/** Room kept free in the ring for the console text. */
+#ifndef CAPTURE_TEXT_RESERVE
+#  define CAPTURE_TEXT_RESERVE   512
+#endif
+
+/** Areas waiting to be sent, merged when there are more. */
+#ifndef CAPTURE_MAX_DIRTY
+#  define CAPTURE_MAX_DIRTY      8
+#endif
+
+/** Returned by capture_poll() when nothing has to be done by time. */
+#define CAPTURE_NO_DEADLINE      0xFFFFFFFFu
+
+#define CAPTURE_SYNC0            0xA5
+#define CAPTURE_SYNC1            0x5A
+
+enum capture_packet {
+	CAPTURE_PKT_BEGIN = 1,
+	CAPTURE_PKT_RECT,
+	CAPTURE_PKT_END,
+};
+
+/** BEGIN flags. */
+#define CAPTURE_FRAME_KEY        0x01
+
+/**
+ * Settings. Set the fields, then call capture_init().
+ */
+struct capture_config {
+	uint32_t ul_bytes_per_s;  //!< packet bytes per second, below the baud rate / 10
+	uint32_t ul_key_ms;       //!< a keyframe again after this long, 0 for the first only
+};
+
+struct capture_stats {
+	uint32_t ul_frames;       //!< frames completed
+	uint32_t ul_keyframes;
+	uint32_t ul_packets;
+	uint32_t ul_bytes;        //!< packet bytes, headers included
+	uint32_t ul_pixels;       //!< pixels encoded
+	uint32_t ul_text_bytes;   //!< console text sent while capturing
+	uint32_t ul_text_dropped; //!< console text dropped, the ring was full
+	uint32_t ul_polls;        //!< capture_poll() calls that encoded something
+	uint32_t ul_cycles;       //!< CPU cycles spent in them (target only)
+	uint32_t ul_max_cycles;   //!< longest of them
+};
+
+void capture_init(const struct capture_config *p_config);
+void capture_start(void);
+void capture_stop(void);
+bool capture_is_active(void);
+uint32_t capture_poll(uint32_t ul_now_ms);
+void capture_console_write(const uint8_t *p_uc_data, uint32_t ul_size);
+void capture_get_stats(struct capture_stats *p_stats);
+
+#endif /* CAPTURE_H_ */
@@ -0,0 +1,809 @@
+/**
+ * \file
+ *
+ * \brief Dirty-rectangle compositor on top of the ILI9488 driver.
+ *
+ * Everything is called from the main loop: the interrupt handlers only
+ * change the scene, which scene_render() draws here. Only compositor_flush()
+ * talks to the LCD. A pixel changed while a flush is reading the shadow is
+ * covered by a new dirty rectangle and sent again on the next flush.
+ *
+ * The hardware scroll area is kept in the shadow as the panel shows it:
+ * compositor_scroll() rotates the rows of the area in the shadow and in the
+ * dirty list, and the flush moves the scroll start address of the panel the
+ * same way and writes the rows of the area at their rotated GRAM rows.
+ */
+
+#include <asf.h>
+#include <string.h>
+#include "compositor.h"
+#include "ili9488_te.h"
+#include "ili9488_pixel.h"
+
+/* Shadow of the panel content */
+static uint16_t g_us_shadow[COMPOSITOR_WIDTH * COMPOSITOR_HEIGHT];
+
+static struct compositor_rect g_dirty[COMPOSITOR_MAX_DIRTY];
+static uint32_t g_ul_dirty_count;
+
+/* Two chunks so one is converted while the other one is on the bus */
+static ili9488_color_t g_chunk[2][COMPOSITOR_CHUNK_PIXELS * LCD_DATA_COLOR_UNIT];
+
+static struct compositor_stats g_stats;
+
+/* Told about every area sent, see compositor_set_flush_hook() */
+static compositor_flush_hook_t g_flush_hook;
+
+static const struct compositor_rect g_screen = {
+	0, 0, COMPOSITOR_WIDTH - 1, COMPOSITOR_HEIGHT - 1
+};
+
+/* Drawing calls only touch this rectangle */
+static struct compositor_rect g_clip = {
+	0, 0, COMPOSITOR_WIDTH - 1, COMPOSITOR_HEIGHT - 1
+};
+
+/* Scroll area: its screen rows show the GRAM rows of the area rotated up
+ * by g_us_scroll_offset */
+static uint16_t g_us_scroll_top;
+static uint16_t g_us_scroll_height = COMPOSITOR_HEIGHT;
+static uint16_t g_us_scroll_offset;
+static bool g_b_scroll_define;     /* VSCRDEF to send on the next flush */
+static bool g_b_scroll_move;       /* VSCRSADD to send on the next flush */
+
+/**
+ * \brief Bounding box of the pixels changed by a drawing call.
+ */
+struct compositor_bbox {
+	uint32_t x1, y1, x2, y2;
+	bool b_changed;
+};
+
+static void compositor_bbox_init(struct compositor_bbox *p_box)
+{
+	p_box->x1 = COMPOSITOR_WIDTH;
+	p_box->y1 = COMPOSITOR_HEIGHT;
+	p_box->x2 = 0;
+	p_box->y2 = 0;
+	p_box->b_changed = false;
+}
+
+static void compositor_bbox_add_row(struct compositor_bbox *p_box, uint32_t ul_y,
+		uint32_t ul_x1, uint32_t ul_x2)
+{
+	p_box->x1 = Min(p_box->x1, ul_x1);
+	p_box->x2 = Max(p_box->x2, ul_x2);
+	p_box->y1 = Min(p_box->y1, ul_y);
+	p_box->y2 = Max(p_box->y2, ul_y);
+	p_box->b_changed = true;
+}
+
+static uint32_t compositor_area(const struct compositor_rect *p_r)
+{
+	return (uint32_t)(p_r->x2 - p_r->x1 + 1) * (p_r->y2 - p_r->y1 + 1);
+}
+
+static void compositor_union(struct compositor_rect *p_r,
+		const struct compositor_rect *p_other)
+{
+	p_r->x1 = Min(p_r->x1, p_other->x1);
+	p_r->y1 = Min(p_r->y1, p_other->y1);
+	p_r->x2 = Max(p_r->x2, p_other->x2);
+	p_r->y2 = Max(p_r->y2, p_other->y2);
+}
+
+/**
+ * \brief Check if two rectangles overlap or share an edge.
+ */
+static bool compositor_touch(const struct compositor_rect *p_a,
+		const struct compositor_rect *p_b)
+{
+	return (p_a->x1 <= p_b->x2 + 1) && (p_b->x1 <= p_a->x2 + 1)
+			&& (p_a->y1 <= p_b->y2 + 1) && (p_b->y1 <= p_a->y2 + 1);
+}
+
+/**
+ * \brief Add a rectangle to a list of disjoint rectangles, merging it with
+ * the ones it touches. When the list is full the rectangle is merged with
+ * the entry whose area grows the least.
+ *
+ * \param p_list rectangles, room for ul_max.
+ * \param p_ul_count rectangles in the list, updated.
+ * \param ul_max size of the list.
+ * \param rect rectangle to add.
+ *
+ * \return the number of entries merged only because the list was full.
+ */
+uint32_t compositor_rect_add(struct compositor_rect *p_list,
+		uint32_t *p_ul_count, uint32_t ul_max, struct compositor_rect rect)
+{
+	uint32_t i, best, best_cost, cost, ul_overflows = 0;
+	struct compositor_rect merged;
+
+	i = 0;
+	while (i < *p_ul_count) {
+		if (compositor_touch(&rect, &p_list[i])) {
+			compositor_union(&rect, &p_list[i]);
+			p_list[i] = p_list[--*p_ul_count];
+			/* The grown rectangle may now touch entries already checked */
+			i = 0;
+		} else {
+			i++;
+		}
+	}
+
+	while (*p_ul_count >= ul_max) {
+		best = 0;
+		best_cost = UINT32_MAX;
+		for (i = 0; i < *p_ul_count; i++) {
+			merged = rect;
+			compositor_union(&merged, &p_list[i]);
+			cost = compositor_area(&merged) - compositor_area(&p_list[i]);
+			if (cost < best_cost) {
+				best_cost = cost;
+				best = i;
+			}
+		}
+		compositor_union(&rect, &p_list[best]);
+		p_list[best] = p_list[--*p_ul_count];
+		ul_overflows++;
+	}
+
+	p_list[(*p_ul_count)++] = rect;
+	return ul_overflows;
+}
+
+/**
+ * \brief Add a rectangle to the dirty list.
+ */
+static void compositor_add_dirty(struct compositor_rect rect)
+{
+	irqflags_t flags = cpu_irq_save();
+
+	g_stats.ul_overflows += compositor_rect_add(g_dirty, &g_ul_dirty_count,
+			COMPOSITOR_MAX_DIRTY, rect);
+	cpu_irq_restore(flags);
+}
+
+static void compositor_add_bbox(const struct compositor_bbox *p_box)
+{
+	if (p_box->b_changed) {
+		compositor_invalidate(p_box->x1, p_box->y1, p_box->x2, p_box->y2);
+	}
+}
+
+/**
+ * \brief Clip a box to a rectangle, the screen or the drawing clip.
+ *
+ * \return false if nothing is left.
+ */
+static bool compositor_clip(uint32_t *p_ul_x1, uint32_t *p_ul_y1,
+		uint32_t *p_ul_x2, uint32_t *p_ul_y2,
+		const struct compositor_rect *p_bounds)
+{
+	uint32_t tmp;
+
+	if (*p_ul_x1 > *p_ul_x2) {
+		tmp = *p_ul_x1;
+		*p_ul_x1 = *p_ul_x2;
+		*p_ul_x2 = tmp;
+	}
+	if (*p_ul_y1 > *p_ul_y2) {
+		tmp = *p_ul_y1;
+		*p_ul_y1 = *p_ul_y2;
+		*p_ul_y2 = tmp;
+	}
+	if ((*p_ul_x1 > p_bounds->x2) || (*p_ul_y1 > p_bounds->y2)
+			|| (*p_ul_x2 < p_bounds->x1) || (*p_ul_y2 < p_bounds->y1)) {
+		return false;
+	}
+	*p_ul_x1 = Max(*p_ul_x1, p_bounds->x1);
+	*p_ul_y1 = Max(*p_ul_y1, p_bounds->y1);
+	*p_ul_x2 = Min(*p_ul_x2, p_bounds->x2);
+	*p_ul_y2 = Min(*p_ul_y2, p_bounds->y2);
+	return true;
+}
+
+/**
+ * \brief Clear the shadow framebuffer and mark the whole screen dirty.
+ *
+ * \param ul_color 24-bit background color.
+ */
+void compositor_init(uint32_t ul_color)
+{
+	uint16_t us_color = COMPOSITOR_RGB565(ul_color);
+
+	ili9488_pixel_fill16(g_us_shadow, us_color,
+			COMPOSITOR_WIDTH * COMPOSITOR_HEIGHT);
+	g_ul_dirty_count = 0;
+	memset(&g_stats, 0, sizeof(g_stats));
+	g_clip = g_screen;
+	compositor_scroll_area(0, COMPOSITOR_HEIGHT);
+	compositor_invalidate(0, 0, COMPOSITOR_WIDTH - 1, COMPOSITOR_HEIGHT - 1);
+}
+
+/**
+ * \brief Fill a rectangle.
+ *
+ * \param ul_x1 X coordinate of upper-left corner.
+ * \param ul_y1 Y coordinate of upper-left corner.
+ * \param ul_x2 X coordinate of lower-right corner.
+ * \param ul_y2 Y coordinate of lower-right corner.
+ * \param ul_color 24-bit fill color.
+ */
+void compositor_fill_rect(uint32_t ul_x1, uint32_t ul_y1, uint32_t ul_x2,
+		uint32_t ul_y2, uint32_t ul_color)
+{
+	uint16_t us_color = COMPOSITOR_RGB565(ul_color);
+	struct compositor_bbox box;
+	uint32_t x, y, first, last;
+	uint16_t *p_row;
+
+	if (!compositor_clip(&ul_x1, &ul_y1, &ul_x2, &ul_y2, &g_clip)) {
+		return;
+	}
+
+	compositor_bbox_init(&box);
+	for (y = ul_y1; y <= ul_y2; y++) {
+		p_row = &g_us_shadow[y * COMPOSITOR_WIDTH];
+		first = COMPOSITOR_WIDTH;
+		last = 0;
+		for (x = ul_x1; x <= ul_x2; x++) {
+			if (p_row[x] != us_color) {
+				p_row[x] = us_color;
+				first = Min(first, x);
+				last = x;
+			}
+		}
+		if (first <= last) {
+			compositor_bbox_add_row(&box, y, first, last);
+		}
+	}
+	compositor_add_bbox(&box);
+}
+
+/**
+ * \brief Draw a R8G8B8 pixmap.
+ *
+ * \param ul_x X coordinate of upper-left corner.
+ * \param ul_y Y coordinate of upper-left corner.
+ * \param ul_width width of the picture.
+ * \param ul_height height of the picture.
+ * \param p_uc_pixmap pixel data, 3 bytes per pixel, rows top to bottom.
+ */
+void compositor_draw_pixmap(uint32_t ul_x, uint32_t ul_y, uint32_t ul_width,
+		uint32_t ul_height, const uint8_t *p_uc_pixmap)
+{
+	struct compositor_bbox box;
+	uint32_t x, y, x1, y1, x2, y2, first, last;
+	const uint8_t *p_src;
+	uint16_t *p_row;
+	uint16_t us_color;
+
+	if ((ul_width == 0) || (ul_height == 0)) {
+		return;
+	}
+	x1 = ul_x;
+	y1 = ul_y;
+	x2 = ul_x + ul_width - 1;
+	y2 = ul_y + ul_height - 1;
+	if (!compositor_clip(&x1, &y1, &x2, &y2, &g_clip)) {
+		return;
+	}
+
+	compositor_bbox_init(&box);
+	for (y = y1; y <= y2; y++) {
+		p_src = p_uc_pixmap + ((y - ul_y) * ul_width + (x1 - ul_x)) * 3;
+		p_row = &g_us_shadow[y * COMPOSITOR_WIDTH];
+		first = COMPOSITOR_WIDTH;
+		last = 0;
+		for (x = x1; x <= x2; x++, p_src += 3) {
+			us_color = ((p_src[0] & 0xF8) << 8) | ((p_src[1] & 0xFC) << 3)
+					| (p_src[2] >> 3);
+			if (p_row[x] != us_color) {
+				p_row[x] = us_color;
+				first = Min(first, x);
+				last = x;
+			}
+		}
+		if (first <= last) {
+			compositor_bbox_add_row(&box, y, first, last);
+		}
+	}
+	compositor_add_bbox(&box);
+}
+
+/**
+ * \brief Draw an image, decoding it according to its format tag.
+ *
+ * Compressed images are expanded one row at a time. The image may start
+ * above or left of the screen, only the part inside the clip is drawn.
+ *
+ * \param l_x X coordinate of upper-left corner.
+ * \param l_y Y coordinate of upper-left corner.
+ * \param p_image image to draw, at most COMPOSITOR_WIDTH pixels wide.
+ */
+void compositor_draw_image(int32_t l_x, int32_t l_y, const tImage *p_image)
+{
+	uint16_t us_line[COMPOSITOR_WIDTH];
+	struct timage_decoder dec;
+	struct compositor_bbox box;
+	uint32_t x, y, x1, y1, x2, y2, first, last;
+	const uint16_t *p_src;
+	uint16_t *p_row;
+	int32_t l_row;
+
+	if ((p_image->width <= 0) || (p_image->height <= 0)
+			|| (p_image->width > COMPOSITOR_WIDTH)) {
+		return;
+	}
+	if ((l_x + p_image->width <= (int32_t)g_clip.x1)
+			|| (l_y + p_image->height <= (int32_t)g_clip.y1)
+			|| (l_x > (int32_t)g_clip.x2) || (l_y > (int32_t)g_clip.y2)) {
+		return;
+	}
+	x1 = Max(l_x, (int32_t)g_clip.x1);
+	y1 = Max(l_y, (int32_t)g_clip.y1);
+	x2 = Min(l_x + p_image->width - 1, (int32_t)g_clip.x2);
+	y2 = Min(l_y + p_image->height - 1, (int32_t)g_clip.y2);
+
+	timage_decoder_init(&dec, p_image);
+	/* Rows above the clip are decoded and dropped */
+	for (l_row = l_y; l_row < (int32_t)y1; l_row++) {
+		timage_decode(&dec, us_line, p_image->width);
+	}
+	compositor_bbox_init(&box);
+	for (y = y1; y <= y2; y++) {
+		timage_decode(&dec, us_line, p_image->width);
+		p_src = us_line + (x1 - l_x);
+		p_row = &g_us_shadow[y * COMPOSITOR_WIDTH];
+		first = COMPOSITOR_WIDTH;
+		last = 0;
+		for (x = x1; x <= x2; x++, p_src++) {
+			if (p_row[x] != *p_src) {
+				p_row[x] = *p_src;
+				first = Min(first, x);
+				last = x;
+			}
+		}
+		if (first <= last) {
+			compositor_bbox_add_row(&box, y, first, last);
+		}
+	}
+	compositor_add_bbox(&box);
+}
+
+/**
+ * \brief Write a horizontal run of RGB565 pixels.
+ *
+ * Lets renderers that produce whole rows (text, ...) use the shadow
+ * framebuffer without building a tImage.
+ *
+ * \param ul_x X coordinate of the first pixel.
+ * \param ul_y Y coordinate of the row.
+ * \param p_us_pixels RGB565 pixels.
+ * \param ul_count number of pixels, clipped to the clip rectangle.
+ */
+void compositor_draw_span(uint32_t ul_x, uint32_t ul_y,
+		const uint16_t *p_us_pixels, uint32_t ul_count)
+{
+	struct compositor_bbox box;
+	uint32_t x, x1, y1, x2, first, last;
+	uint16_t *p_row;
+
+	if (!ul_count) {
+		return;
+	}
+	x1 = ul_x;
+	y1 = ul_y;
+	x2 = ul_x + ul_count - 1;
+	if (!compositor_clip(&x1, &y1, &x2, &ul_y, &g_clip)) {
+		return;
+	}
+	p_us_pixels += x1 - ul_x;
+
+	p_row = &g_us_shadow[ul_y * COMPOSITOR_WIDTH];
+	first = COMPOSITOR_WIDTH;
+	last = 0;
+	for (x = x1; x <= x2; x++, p_us_pixels++) {
+		if (p_row[x] != *p_us_pixels) {
+			p_row[x] = *p_us_pixels;
+			first = Min(first, x);
+			last = x;
+		}
+	}
+	if (first <= last) {
+		compositor_bbox_init(&box);
+		compositor_bbox_add_row(&box, ul_y, first, last);
+		compositor_add_bbox(&box);
+	}
+}
+
+/**
+ * \brief Force an area to be sent on the next flush.
+ */
+void compositor_invalidate(uint32_t ul_x1, uint32_t ul_y1, uint32_t ul_x2,
+		uint32_t ul_y2)
+{
+	struct compositor_rect rect;
+
+	if (!compositor_clip(&ul_x1, &ul_y1, &ul_x2, &ul_y2, &g_screen)) {
+		return;
+	}
+	rect.x1 = ul_x1;
+	rect.y1 = ul_y1;
+	rect.x2 = ul_x2;
+	rect.y2 = ul_y2;
+	compositor_add_dirty(rect);
+}
+
+/**
+ * \brief Restrict the drawing calls to a rectangle.
+ *
+ * Applies to every drawing call until compositor_reset_clip().
+ */
+void compositor_set_clip(uint32_t ul_x1, uint32_t ul_y1, uint32_t ul_x2,
+		uint32_t ul_y2)
+{
+	if (!compositor_clip(&ul_x1, &ul_y1, &ul_x2, &ul_y2, &g_screen)) {
+		/* Nothing can be drawn: an empty clip */
+		ul_x1 = 1;
+		ul_x2 = 0;
+		ul_y1 = ul_y2 = 0;
+	}
+	g_clip.x1 = ul_x1;
+	g_clip.y1 = ul_y1;
+	g_clip.x2 = ul_x2;
+	g_clip.y2 = ul_y2;
+}
+
+/**
+ * \brief Let the drawing calls use the whole screen again.
+ */
+void compositor_reset_clip(void)
+{
+	g_clip = g_screen;
+}
+
+/**
+ * \brief Swap two rows of the shadow framebuffer.
+ */
+static void compositor_swap_rows(uint32_t ul_a, uint32_t ul_b)
+{
+	uint16_t us_tmp[COMPOSITOR_WIDTH];
+	uint16_t *p_a = &g_us_shadow[ul_a * COMPOSITOR_WIDTH];
+	uint16_t *p_b = &g_us_shadow[ul_b * COMPOSITOR_WIDTH];
+
+	memcpy(us_tmp, p_a, sizeof(us_tmp));
+	memcpy(p_a, p_b, sizeof(us_tmp));
+	memcpy(p_b, us_tmp, sizeof(us_tmp));
+}
+
+static void compositor_reverse_rows(uint32_t ul_first, uint32_t ul_last)
+{
+	while (ul_first < ul_last) {
+		compositor_swap_rows(ul_first++, ul_last--);
+	}
+}
+
+/**
+ * \brief Move the rows of the dirty rectangles inside the scroll area up
+ * by ul_rows, the way the area content moves.
+ */
+static void compositor_scroll_dirty(uint32_t ul_rows)
+{
+	struct compositor_rect dirty[COMPOSITOR_MAX_DIRTY];
+	struct compositor_rect rect, part;
+	uint32_t top = g_us_scroll_top;
+	uint32_t bottom = top + g_us_scroll_height - 1;
+	uint32_t i, count, y1, y2;
+	irqflags_t flags = cpu_irq_save();
+
+	count = g_ul_dirty_count;
+	memcpy(dirty, g_dirty, count * sizeof(dirty[0]));
+	g_ul_dirty_count = 0;
+
+	for (i = 0; i < count; i++) {
+		rect = dirty[i];
+		if ((rect.y2 < top) || (rect.y1 > bottom)) {
+			compositor_add_dirty(rect);
+			continue;
+		}
+		/* Parts above and below the area stay where they are */
+		if (rect.y1 < top) {
+			part = rect;
+			part.y2 = top - 1;
+			compositor_add_dirty(part);
+		}
+		if (rect.y2 > bottom) {
+			part = rect;
+			part.y1 = bottom + 1;
+			compositor_add_dirty(part);
+		}
+		/* Rows of the area, relative to its top, rotated up */
+		y1 = Max(rect.y1, top) - top + g_us_scroll_height - ul_rows;
+		y2 = Min(rect.y2, bottom) - top + g_us_scroll_height - ul_rows;
+		part = rect;
+		if ((y1 < g_us_scroll_height) && (y2 >= g_us_scroll_height)) {
+			part.y1 = top + y1;
+			part.y2 = bottom;
+			compositor_add_dirty(part);
+			y1 = g_us_scroll_height;
+		}
+		part.y1 = top + y1 % g_us_scroll_height;
+		part.y2 = top + y2 % g_us_scroll_height;
+		compositor_add_dirty(part);
+	}
+	cpu_irq_restore(flags);
+}
+
+/**
+ * \brief Set the rows moved by compositor_scroll().
+ *
+ * The panel only scrolls whole rows: the area spans the screen width. Moving
+ * the area brings the rows of the previous one back to their place, which
+ * sends them again if they were scrolled.
+ *
+ * \param ul_top first row of the area.
+ * \param ul_height rows of the area.
+ */
+void compositor_scroll_area(uint32_t ul_top, uint32_t ul_height)
+{
+	if ((ul_height == 0) || (ul_top + ul_height > COMPOSITOR_HEIGHT)) {
+		return;
+	}
+	if (g_us_scroll_offset) {
+		compositor_invalidate(0, g_us_scroll_top, COMPOSITOR_WIDTH - 1,
+				g_us_scroll_top + g_us_scroll_height - 1);
+	}
+	g_us_scroll_top = ul_top;
+	g_us_scroll_height = ul_height;
+	g_us_scroll_offset = 0;
+	g_b_scroll_define = true;
+	g_b_scroll_move = true;
+}
+
+/**
+ * \brief Scroll the content of the scroll area.
+ *
+ * The rows leaving the area at one edge come back at the other edge, as on
+ * the panel, where only the scroll start address changes: nothing is sent
+ * for the rows that moved. Drawing the rows exposed by the scroll is up to
+ * the caller, which then costs only those rows.
+ *
+ * Does nothing before compositor_scroll_area() has defined an area.
+ *
+ * \param l_rows rows to move the content up, negative to move it down.
+ */
+void compositor_scroll(int32_t l_rows)
+{
+	uint32_t ul_rows, top = g_us_scroll_top, height = g_us_scroll_height;
+
+	if (!height) {
+		return;
+	}
+
+	/* Up by -n is up by height - n */
+	l_rows %= (int32_t)height;
+	ul_rows = (l_rows < 0) ? (uint32_t)(l_rows + (int32_t)height) : (uint32_t)l_rows;
+	if (!ul_rows) {
+		return;
+	}
+
+	/* Rotate the rows of the area up: three reversals */
+	compositor_reverse_rows(top, top + ul_rows - 1);
+	compositor_reverse_rows(top + ul_rows, top + height - 1);
+	compositor_reverse_rows(top, top + height - 1);
+	compositor_scroll_dirty(ul_rows);
+
+	g_us_scroll_offset = (g_us_scroll_offset + ul_rows) % height;
+	g_b_scroll_move = true;
+}
+
+/**
+ * \brief Check if a flush would send anything.
+ */
+bool compositor_is_dirty(void)
+{
+	return (g_ul_dirty_count != 0) || g_b_scroll_move;
+}
+
+/**
+ * \brief GRAM row shown on a screen row.
+ */
+static uint32_t compositor_gram_row(uint32_t ul_y)
+{
+	if ((ul_y < g_us_scroll_top) || (ul_y >= g_us_scroll_top + g_us_scroll_height)) {
+		return ul_y;
+	}
+	return g_us_scroll_top
+			+ (ul_y - g_us_scroll_top + g_us_scroll_offset) % g_us_scroll_height;
+}
+
+/**
+ * \brief Send one chunk and switch to the other chunk buffer.
+ */
+static uint32_t compositor_send_chunk(uint32_t ul_chunk, uint32_t ul_pixels)
+{
+	/* The previous chunk must be gone before this one is queued, which
+	 * also frees the buffer that will be filled next */
+	ili9488_sync();
+	ili9488_draw_stream(g_chunk[ul_chunk], ul_pixels * LCD_DATA_COLOR_UNIT);
+	return ul_chunk ^ 1;
+}
+
+/**
+ * \brief Send one rectangle of the shadow framebuffer to the LCD.
+ *
+ * The rows of the rectangle must be consecutive in GRAM too.
+ */
+static void compositor_send_rect(const struct compositor_rect *p_rect)
+{
+	uint32_t y, w, k, n = 0, chunk = 0;
+	const uint16_t *p_row;
+
+	ili9488_te_wait_rect(p_rect->y1, p_rect->y2, p_rect->x2 - p_rect->x1 + 1);
+	ili9488_draw_prepare(p_rect->x1, compositor_gram_row(p_rect->y1),
+			p_rect->x2 - p_rect->x1 + 1, p_rect->y2 - p_rect->y1 + 1);
+
+	/* Rows are copied into the chunks in runs, split where a chunk fills */
+	for (y = p_rect->y1; y <= p_rect->y2; y++) {
+		p_row = &g_us_shadow[y * COMPOSITOR_WIDTH + p_rect->x1];
+		for (w = p_rect->x2 - p_rect->x1 + 1; w; w -= k, p_row += k) {
+			k = Min(w, COMPOSITOR_CHUNK_PIXELS - n);
+#ifdef ILI9488_SPIMODE
+			/* RGB565 to the 3 bytes of the 18-bit SPI interface */
+			ili9488_pixel_rgb565_to_rgb666(&g_chunk[chunk][n * LCD_DATA_COLOR_UNIT],
+					p_row, k);
+#else
+			memcpy(&g_chunk[chunk][n], p_row, k * sizeof(uint16_t));
+#endif
+			n += k;
+			if (n == COMPOSITOR_CHUNK_PIXELS) {
+				chunk = compositor_send_chunk(chunk, n);
+				n = 0;
+			}
+		}
+	}
+	if (n) {
+		compositor_send_chunk(chunk, n);
+	}
+
+	g_stats.ul_rects++;
+	g_stats.ul_pixels += compositor_area(p_rect);
+}
+
+/**
+ * \brief Send a rectangle in parts whose rows are consecutive in GRAM.
+ *
+ * The scroll area rows wrap in GRAM where the offset starts, and the area
+ * edges separate rows mapped differently. Without an offset every row is
+ * its own GRAM row and the rectangle goes in one part.
+ */
+static void compositor_send_mapped(struct compositor_rect rect)
+{
+	const uint32_t edge[3] = {
+		g_us_scroll_top,
+		g_us_scroll_top + g_us_scroll_height - g_us_scroll_offset,
+		g_us_scroll_top + g_us_scroll_height,
+	};
+	struct compositor_rect part;
+	uint32_t i, end;
+
+	if (!g_us_scroll_offset) {
+		compositor_send_rect(&rect);
+		return;
+	}
+	while (rect.y1 <= rect.y2) {
+		end = rect.y2;
+		for (i = 0; i < 3; i++) {
+			if ((edge[i] > rect.y1) && (edge[i] <= end)) {
+				end = edge[i] - 1;
+			}
+		}
+		part = rect;
+		part.y2 = end;
+		compositor_send_rect(&part);
+		rect.y1 = end + 1;
+	}
+}
+
+/**
+ * \brief Insertion sort of a few rectangles by their first row.
+ */
+static void compositor_sort_by_row(struct compositor_rect *p_rects,
+		uint32_t ul_count)
+{
+	struct compositor_rect rect;
+	uint32_t i, j;
+
+	for (i = 1; i < ul_count; i++) {
+		rect = p_rects[i];
+		for (j = i; (j > 0) && (p_rects[j - 1].y1 > rect.y1); j--) {
+			p_rects[j] = p_rects[j - 1];
+		}
+		p_rects[j] = rect;
+	}
+}
+
+/**
+ * \brief Send the dirty rectangles to the LCD.
+ *
+ * Must be called from the main loop, once per frame.
+ */
+void compositor_flush(void)
+{
+	struct compositor_rect dirty[COMPOSITOR_MAX_DIRTY];
+	uint32_t i, count;
+	irqflags_t flags;
+
+	if (!compositor_is_dirty()) {
+		return;
+	}
+
+	/* The area scrolls before its rows are written at their new place */
+	if (g_b_scroll_define) {
+		ili9488_scroll(g_us_scroll_top, g_us_scroll_height,
+				COMPOSITOR_HEIGHT - g_us_scroll_top - g_us_scroll_height);
+		g_b_scroll_define = false;
+	}
+	if (g_b_scroll_move) {
+		ili9488_set_scroll_address(g_us_scroll_top + g_us_scroll_offset);
+		g_b_scroll_move = false;
+		g_stats.ul_scrolls++;
+		if (g_flush_hook) {
+			struct compositor_rect area = {0, g_us_scroll_top,
+				COMPOSITOR_WIDTH - 1, g_us_scroll_top + g_us_scroll_height - 1};
+
+			/* Every row of the area may show something else */
+			g_flush_hook(&area);
+		}
+	}
+
+	flags = cpu_irq_save();
+	count = g_ul_dirty_count;
+	memcpy(dirty, g_dirty, count * sizeof(dirty[0]));
+	g_ul_dirty_count = 0;
+	cpu_irq_restore(flags);
+
+	/* Top to bottom, the way the scan goes: each rectangle waits for its
+	 * scanline window in turn */
+	compositor_sort_by_row(dirty, count);
+	for (i = 0; i < count; i++) {
+		compositor_send_mapped(dirty[i]);
+		if (g_flush_hook) {
+			g_flush_hook(&dirty[i]);
+		}
+	}
+	g_stats.ul_flushes++;
+}
+
+/**
+ * \brief Be told about every area of the screen that a flush changes.
+ *
+ * The hook runs from compositor_flush() with each rectangle sent, in screen
+ * rows, and with the whole scroll area when it scrolled. The pixels are in
+ * the framebuffer by then.
+ *
+ * \param hook function to call, NULL for none.
+ */
+void compositor_set_flush_hook(compositor_flush_hook_t hook)
+{
+	g_flush_hook = hook;
+}
+
+/**
+ * \brief Get the shadow framebuffer, COMPOSITOR_WIDTH pixels per row.
+ */
+const uint16_t *compositor_get_framebuffer(void)
+{
+	return g_us_shadow;
+}
+
+/**
+ * \brief Get the flush statistics.
+ */
+void compositor_get_stats(struct compositor_stats *p_stats)
+{
+	*p_stats = g_stats;
+}
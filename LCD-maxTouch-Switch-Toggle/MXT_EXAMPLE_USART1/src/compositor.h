@@ -0,0 +1,89 @@
+/**
+ * \file
+ *
+ * \brief Dirty-rectangle compositor on top of the ILI9488 driver.
+ *
+ * Drawing calls only update a RGB565 shadow of the panel in SRAM and record
+ * the bounding box of the pixels that actually changed. compositor_flush()
+ * merges the overlapping boxes and sends each of them once, so blanking an
+ * area and painting over it costs a single transfer of the final pixels.
+ *
+ * Drawing can be limited to a clip rectangle, and the rows of one area of
+ * the screen can be scrolled with the vertical scrolling of the panel,
+ * which sends nothing for the rows that only moved.
+ *
+ * Whatever reads the framebuffer behind the panel's back (a screen capture)
+ * can be told about every area a flush sends.
+ *
+ * Coordinates are inclusive, as in ili9488_draw_filled_rectangle(). Colors
+ * are 24-bit 0xRRGGBB values (COLOR_WHITE, ...). Images are drawn from
+ * tImage in any of the formats of enum timage_format.
+ */
+
+#ifndef COMPOSITOR_H_
+#define COMPOSITOR_H_
+
+#include "compiler.h"
+#include "ili9488.h"
+#include "tfont.h"
+
+/** Size of the shadow framebuffer. */
+#define COMPOSITOR_WIDTH   ILI9488_LCD_WIDTH
+#define COMPOSITOR_HEIGHT  ILI9488_LCD_HEIGHT
+
+/** Maximum number of disjoint dirty rectangles kept between two flushes. */
+#ifndef COMPOSITOR_MAX_DIRTY
+#  define COMPOSITOR_MAX_DIRTY   16
+#endif
+
+/** Pixels converted per chunk when flushing. */
+#ifndef COMPOSITOR_CHUNK_PIXELS
+#  define COMPOSITOR_CHUNK_PIXELS 640
+#endif
+
+/** 24-bit 0xRRGGBB color to the RGB565 format of the shadow framebuffer. */
+#define COMPOSITOR_RGB565(rgb) \
+		((uint16_t)((((rgb) >> 8) & 0xF800) | (((rgb) >> 5) & 0x07E0) | (((rgb) >> 3) & 0x001F)))
+
+struct compositor_rect {
+	uint16_t x1;
+	uint16_t y1;
+	uint16_t x2;
+	uint16_t y2;
+};
+
+/** Called with each area of the screen sent by compositor_flush(). */
+typedef void (*compositor_flush_hook_t)(const struct compositor_rect *p_rect);
+
+struct compositor_stats {
+	uint32_t ul_flushes;     //!< compositor_flush() calls that sent something
+	uint32_t ul_rects;       //!< rectangles sent to the LCD
+	uint32_t ul_pixels;      //!< pixels sent to the LCD
+	uint32_t ul_overflows;   //!< rectangles merged because the dirty list was full
+	uint32_t ul_scrolls;     //!< scroll start addresses sent to the LCD
+};
+
+void compositor_init(uint32_t ul_color);
+void compositor_fill_rect(uint32_t ul_x1, uint32_t ul_y1, uint32_t ul_x2,
+		uint32_t ul_y2, uint32_t ul_color);
+void compositor_draw_pixmap(uint32_t ul_x, uint32_t ul_y, uint32_t ul_width,
+		uint32_t ul_height, const uint8_t *p_uc_pixmap);
+void compositor_draw_image(int32_t l_x, int32_t l_y, const tImage *p_image);
+void compositor_draw_span(uint32_t ul_x, uint32_t ul_y,
+		const uint16_t *p_us_pixels, uint32_t ul_count);
+void compositor_invalidate(uint32_t ul_x1, uint32_t ul_y1, uint32_t ul_x2,
+		uint32_t ul_y2);
+void compositor_set_clip(uint32_t ul_x1, uint32_t ul_y1, uint32_t ul_x2,
+		uint32_t ul_y2);
+void compositor_reset_clip(void);
+void compositor_scroll_area(uint32_t ul_top, uint32_t ul_height);
+void compositor_scroll(int32_t l_rows);
+bool compositor_is_dirty(void);
+void compositor_flush(void);
+void compositor_set_flush_hook(compositor_flush_hook_t hook);
+uint32_t compositor_rect_add(struct compositor_rect *p_list,
+		uint32_t *p_ul_count, uint32_t ul_max, struct compositor_rect rect);
+const uint16_t *compositor_get_framebuffer(void);
+void compositor_get_stats(struct compositor_stats *p_stats);
+
+#endif /* COMPOSITOR_H_ */
@@ -43,6 +43,42 @@
 
 #define ILI9488_SPI_BAUDRATE 20000000
 
+/* Stream GRAM data through the XDMAC, drawing calls return while the bus is
+ * busy. SPI only: the SMC backend writes the GRAM itself */
+#ifdef ILI9488_SPIMODE
+#define ILI9488_SPI_DMA
+#endif
+
+/* XDMAC channel and number of transfers that can be queued */
+#define ILI9488_DMA_CHANNEL    0
+#define ILI9488_DMA_QUEUE_SIZE 8
+
+/* Count the bus traffic of every drawing call and print it once per frame
+ * (ili9488_prof.h). Debug builds only, release builds compile it out */
+#if defined(DEBUG) && !defined(ILI9488_PROFILE)
+#define ILI9488_PROFILE
+#endif
+
+/* Pixel kernels (ili9488_pixel.h): the SIMD versions are used on the
+ * Cortex-M7, ILI9488_PIXEL_SCALAR forces the portable ones. With
+ * ILI9488_PIXEL_BENCH the firmware times both on the console at boot */
+//#define ILI9488_PIXEL_SCALAR
+//#define ILI9488_PIXEL_BENCH
+
+/* Bus backend (ili9488_bus.h): SPI with ILI9488_SPIMODE, the 16-bit SMC with
+ * ILI9488_EBIMODE. With ILI9488_BUS_BENCH the firmware times a full screen
+ * fill and blit on it once the LCD is up */
+//#define ILI9488_BUS_BENCH
+
+/* Frame pacing (ili9488_te.h). The TE output of the panel is not routed on
+ * the maXTouch Xplained Pro, so the vsync is emulated with TC0 channel 2.
+ * Define the PIO pin the TE line is wired to in order to use it instead */
+//#define CONF_ILI9488_TE_PIN  PIO_PD28_IDX
+#define ILI9488_TE_TC          TC0
+#define ILI9488_TE_TC_CHANNEL  2
+#define ILI9488_TE_TC_ID       ID_TC2
+#define ILI9488_TE_TC_Handler  TC2_Handler
+
 #if !defined(BOARD_ILI9488_ADDR)
 
 	#warning The ILI9488 EBI configuration does not exist in the board definition file. Using default settings.
@@ -0,0 +1,495 @@
+/**
+ * \file
+ *
+ * \brief Display list recorded in front of the compositor.
+ *
+ * There are two lists: the one being recorded and the one being replayed.
+ * A replay swaps them first, so a handler that draws during the replay
+ * records into the other list, which the outermost displaylist_end()
+ * replays next. Commands are kept with the screen rectangle they write,
+ * which is all the culling and merging look at.
+ */
+
+#include <asf.h>
+#include <string.h>
+#include "displaylist.h"
+
+enum displaylist_type {
+	DISPLAYLIST_FILL,
+	DISPLAYLIST_IMAGE,
+	DISPLAYLIST_TEXT,
+};
+
+struct displaylist_cmd {
+	struct compositor_rect rect;   /* pixels written, inside the screen */
+	uint8_t uc_type;
+	uint32_t ul_color;             /* fill */
+	int32_t l_x, l_y;              /* image */
+	const tImage *p_image;
+	struct text_style style;       /* text */
+	struct compositor_rect box;
+	uint16_t us_str;               /* offset of the string in c_text */
+};
+
+struct displaylist {
+	struct displaylist_cmd cmd[DISPLAYLIST_MAX_COMMANDS];
+	uint32_t ul_count;
+	char c_text[DISPLAYLIST_TEXT_SIZE];
+	uint32_t ul_text_used;
+};
+
+static struct displaylist g_lists[2];
+static struct displaylist *g_p_recording = &g_lists[0];
+
+/* Nesting of displaylist_begin(), kept at 1 while the outermost
+ * displaylist_end() replays */
+static uint32_t g_ul_depth;
+static bool g_b_replaying;
+static bool g_b_enabled = true;
+
+static struct displaylist_stats g_stats;
+
+static uint32_t displaylist_area(const struct compositor_rect *p_r)
+{
+	return (uint32_t)(p_r->x2 - p_r->x1 + 1) * (p_r->y2 - p_r->y1 + 1);
+}
+
+static bool displaylist_overlap(const struct compositor_rect *p_a,
+		const struct compositor_rect *p_b)
+{
+	return (p_a->x1 <= p_b->x2) && (p_b->x1 <= p_a->x2)
+			&& (p_a->y1 <= p_b->y2) && (p_b->y1 <= p_a->y2);
+}
+
+/**
+ * \brief Check if rectangle a is inside rectangle b.
+ */
+static bool displaylist_inside(const struct compositor_rect *p_a,
+		const struct compositor_rect *p_b)
+{
+	return (p_a->x1 >= p_b->x1) && (p_a->x2 <= p_b->x2)
+			&& (p_a->y1 >= p_b->y1) && (p_a->y2 <= p_b->y2);
+}
+
+/**
+ * \brief Check if the union of two rectangles is a rectangle.
+ */
+static bool displaylist_joinable(const struct compositor_rect *p_a,
+		const struct compositor_rect *p_b)
+{
+	if ((p_a->x1 == p_b->x1) && (p_a->x2 == p_b->x2)) {
+		return (p_a->y1 <= p_b->y2 + 1) && (p_b->y1 <= p_a->y2 + 1);
+	}
+	if ((p_a->y1 == p_b->y1) && (p_a->y2 == p_b->y2)) {
+		return (p_a->x1 <= p_b->x2 + 1) && (p_b->x1 <= p_a->x2 + 1);
+	}
+	return false;
+}
+
+/**
+ * \brief Clip a box to the screen.
+ *
+ * \return false if nothing is left.
+ */
+static bool displaylist_clip(int32_t l_x1, int32_t l_y1, int32_t l_x2,
+		int32_t l_y2, struct compositor_rect *p_rect)
+{
+	l_x1 = Max(l_x1, 0);
+	l_y1 = Max(l_y1, 0);
+	l_x2 = Min(l_x2, COMPOSITOR_WIDTH - 1);
+	l_y2 = Min(l_y2, COMPOSITOR_HEIGHT - 1);
+	if ((l_x1 > l_x2) || (l_y1 > l_y2)) {
+		return false;
+	}
+	p_rect->x1 = l_x1;
+	p_rect->y1 = l_y1;
+	p_rect->x2 = l_x2;
+	p_rect->y2 = l_y2;
+	return true;
+}
+
+static void displaylist_remove(struct displaylist *p_list, uint32_t ul_index)
+{
+	p_list->ul_count--;
+	memmove(&p_list->cmd[ul_index], &p_list->cmd[ul_index + 1],
+			(p_list->ul_count - ul_index) * sizeof(p_list->cmd[0]));
+}
+
+/**
+ * \brief Cut the parts of a fill that a rectangle covers.
+ *
+ * The fill keeps the first part left and the others are inserted after it,
+ * at the same place in the drawing order.
+ *
+ * \return false if the parts do not fit in the list; the fill is kept.
+ */
+static bool displaylist_subtract(struct displaylist *p_list, uint32_t ul_index,
+		const struct compositor_rect *p_cover)
+{
+	struct displaylist_cmd *p_fill = &p_list->cmd[ul_index];
+	struct compositor_rect r = p_fill->rect, part[4];
+	uint32_t i, n = 0;
+
+	if (r.y1 < p_cover->y1) {
+		part[n] = r;
+		part[n++].y2 = p_cover->y1 - 1;
+		r.y1 = p_cover->y1;
+	}
+	if (r.y2 > p_cover->y2) {
+		part[n] = r;
+		part[n++].y1 = p_cover->y2 + 1;
+		r.y2 = p_cover->y2;
+	}
+	if (r.x1 < p_cover->x1) {
+		part[n] = r;
+		part[n++].x2 = p_cover->x1 - 1;
+	}
+	if (r.x2 > p_cover->x2) {
+		part[n] = r;
+		part[n++].x1 = p_cover->x2 + 1;
+	}
+	if (p_list->ul_count + n - 1 > DISPLAYLIST_MAX_COMMANDS) {
+		return false;
+	}
+
+	memmove(&p_list->cmd[ul_index + n], &p_list->cmd[ul_index + 1],
+			(p_list->ul_count - ul_index - 1) * sizeof(p_list->cmd[0]));
+	for (i = 0; i < n; i++) {
+		p_list->cmd[ul_index + i] = *p_fill;
+		p_list->cmd[ul_index + i].rect = part[i];
+	}
+	p_list->ul_count += n - 1;
+	return true;
+}
+
+/**
+ * \brief Drop what is painted over later and trim the fills.
+ */
+static void displaylist_cull(struct displaylist *p_list)
+{
+	struct displaylist_cmd *p_cmd;
+	uint32_t i = 0, j;
+
+	while (i < p_list->ul_count) {
+		p_cmd = &p_list->cmd[i];
+		for (j = i + 1; j < p_list->ul_count; j++) {
+			if (displaylist_inside(&p_cmd->rect, &p_list->cmd[j].rect)) {
+				break;
+			}
+			if ((p_cmd->uc_type == DISPLAYLIST_FILL)
+					&& displaylist_overlap(&p_cmd->rect, &p_list->cmd[j].rect)
+					&& displaylist_subtract(p_list, i, &p_list->cmd[j].rect)) {
+				/* The parts pushed j further; go on with the first part */
+				g_stats.ul_trimmed++;
+				j = i;
+			}
+		}
+		if (j < p_list->ul_count) {
+			displaylist_remove(p_list, i);
+			g_stats.ul_culled++;
+		} else {
+			i++;
+		}
+	}
+}
+
+/**
+ * \brief Check if command b is a fill that can join fill a.
+ */
+static bool displaylist_can_join(const struct displaylist_cmd *p_a,
+		const struct displaylist_cmd *p_b)
+{
+	return (p_a->uc_type == DISPLAYLIST_FILL) && (p_b->uc_type == DISPLAYLIST_FILL)
+			&& (p_a->ul_color == p_b->ul_color)
+			&& displaylist_joinable(&p_a->rect, &p_b->rect);
+}
+
+/**
+ * \brief Merge each fill into an earlier fill of its color when nothing in
+ * between is drawn where it is.
+ */
+static void displaylist_merge(struct displaylist *p_list)
+{
+	struct displaylist_cmd *p_prev, *p_fill;
+	uint32_t i, j = 1;
+
+	while (j < p_list->ul_count) {
+		p_fill = &p_list->cmd[j];
+		/* Look back up to the first command drawn where the fill is */
+		for (i = j; i--; ) {
+			if (displaylist_can_join(&p_list->cmd[i], p_fill)
+					|| displaylist_overlap(&p_list->cmd[i].rect, &p_fill->rect)) {
+				break;
+			}
+		}
+		if ((i < j) && displaylist_can_join(&p_list->cmd[i], p_fill)) {
+			p_prev = &p_list->cmd[i];
+			p_prev->rect.x1 = Min(p_prev->rect.x1, p_fill->rect.x1);
+			p_prev->rect.y1 = Min(p_prev->rect.y1, p_fill->rect.y1);
+			p_prev->rect.x2 = Max(p_prev->rect.x2, p_fill->rect.x2);
+			p_prev->rect.y2 = Max(p_prev->rect.y2, p_fill->rect.y2);
+			displaylist_remove(p_list, j);
+			g_stats.ul_merged++;
+			/* The grown fill may now join another one */
+			j = 1;
+		} else {
+			j++;
+		}
+	}
+}
+
+/**
+ * \brief Optimize and draw the list being recorded, then empty it.
+ */
+static void displaylist_replay(void)
+{
+	struct displaylist *p_list;
+	struct displaylist_cmd *p_cmd;
+	irqflags_t flags;
+	uint32_t i;
+
+	flags = cpu_irq_save();
+	p_list = g_p_recording;
+	g_p_recording = (p_list == &g_lists[0]) ? &g_lists[1] : &g_lists[0];
+	g_b_replaying = true;
+	cpu_irq_restore(flags);
+
+	if (g_b_enabled) {
+		displaylist_cull(p_list);
+		displaylist_merge(p_list);
+	}
+	for (i = 0; i < p_list->ul_count; i++) {
+		p_cmd = &p_list->cmd[i];
+		switch (p_cmd->uc_type) {
+		case DISPLAYLIST_FILL:
+			compositor_fill_rect(p_cmd->rect.x1, p_cmd->rect.y1,
+					p_cmd->rect.x2, p_cmd->rect.y2, p_cmd->ul_color);
+			break;
+		case DISPLAYLIST_IMAGE:
+			compositor_draw_image(p_cmd->l_x, p_cmd->l_y, p_cmd->p_image);
+			break;
+		case DISPLAYLIST_TEXT:
+			text_draw(&p_cmd->style, &p_list->c_text[p_cmd->us_str],
+					p_cmd->box.x1, p_cmd->box.y1, p_cmd->box.x2, p_cmd->box.y2);
+			break;
+		default:
+			break;
+		}
+		g_stats.ul_pixels_replayed += displaylist_area(&p_cmd->rect);
+	}
+	g_stats.ul_replayed += p_list->ul_count;
+	g_stats.ul_lists++;
+	p_list->ul_count = 0;
+	p_list->ul_text_used = 0;
+
+	flags = cpu_irq_save();
+	g_b_replaying = false;
+	cpu_irq_restore(flags);
+}
+
+/**
+ * \brief Check if the drawing calls are recorded.
+ */
+static bool displaylist_recording(void)
+{
+	return g_ul_depth != 0;
+}
+
+/**
+ * \brief Append a command to the list being recorded.
+ *
+ * A full list is replayed first, so the order of the drawing calls is kept;
+ * it is replayed by the main loop in progress if there is one, and the
+ * command is then drawn at once.
+ *
+ * \return false if the command was not recorded and must be drawn now.
+ */
+static bool displaylist_add(struct displaylist_cmd *p_cmd, const char *p_str)
+{
+	uint32_t ul_len = p_str ? strlen(p_str) + 1 : 0;
+	struct displaylist *p_list;
+	irqflags_t flags;
+
+	if (ul_len > DISPLAYLIST_TEXT_SIZE) {
+		return false;
+	}
+	for (;;) {
+		flags = cpu_irq_save();
+		if (!displaylist_recording()) {
+			cpu_irq_restore(flags);
+			return false;
+		}
+		p_list = g_p_recording;
+		if ((p_list->ul_count < DISPLAYLIST_MAX_COMMANDS)
+				&& (p_list->ul_text_used + ul_len <= DISPLAYLIST_TEXT_SIZE)) {
+			if (p_str) {
+				p_cmd->us_str = p_list->ul_text_used;
+				memcpy(&p_list->c_text[p_list->ul_text_used], p_str, ul_len);
+				p_list->ul_text_used += ul_len;
+			}
+			p_list->cmd[p_list->ul_count++] = *p_cmd;
+			g_stats.ul_commands++;
+			g_stats.ul_pixels_recorded += displaylist_area(&p_cmd->rect);
+			cpu_irq_restore(flags);
+			return true;
+		}
+		if (g_b_replaying) {
+			/* A handler that fills the list during a replay */
+			cpu_irq_restore(flags);
+			return false;
+		}
+		cpu_irq_restore(flags);
+		displaylist_replay();
+	}
+}
+
+/**
+ * \brief Start recording the drawing calls.
+ */
+void displaylist_begin(void)
+{
+	irqflags_t flags = cpu_irq_save();
+
+	g_ul_depth++;
+	cpu_irq_restore(flags);
+}
+
+/**
+ * \brief Stop recording; the outermost call replays the list.
+ */
+void displaylist_end(void)
+{
+	irqflags_t flags = cpu_irq_save();
+	bool b_done;
+
+	if (g_ul_depth != 1) {
+		if (g_ul_depth) {
+			g_ul_depth--;
+		}
+		cpu_irq_restore(flags);
+		return;
+	}
+	cpu_irq_restore(flags);
+
+	/* Handlers that drew during a replay recorded into the other list */
+	do {
+		displaylist_replay();
+		flags = cpu_irq_save();
+		b_done = (g_p_recording->ul_count == 0);
+		if (b_done) {
+			g_ul_depth = 0;
+		}
+		cpu_irq_restore(flags);
+	} while (!b_done);
+}
+
+/**
+ * \brief Fill a rectangle, see compositor_fill_rect().
+ */
+void displaylist_fill_rect(uint32_t ul_x1, uint32_t ul_y1, uint32_t ul_x2,
+		uint32_t ul_y2, uint32_t ul_color)
+{
+	struct displaylist_cmd cmd;
+
+	if (!displaylist_clip(Min(ul_x1, ul_x2), Min(ul_y1, ul_y2),
+			Max(ul_x1, ul_x2), Max(ul_y1, ul_y2), &cmd.rect)) {
+		return;
+	}
+	cmd.uc_type = DISPLAYLIST_FILL;
+	cmd.ul_color = ul_color;
+	if (!displaylist_add(&cmd, NULL)) {
+		compositor_fill_rect(ul_x1, ul_y1, ul_x2, ul_y2, ul_color);
+	}
+}
+
+/**
+ * \brief Draw an image, see compositor_draw_image().
+ */
+void displaylist_draw_image(int32_t l_x, int32_t l_y, const tImage *p_image)
+{
+	struct displaylist_cmd cmd;
+
+	if ((p_image->width <= 0) || (p_image->height <= 0)
+			|| (p_image->width > COMPOSITOR_WIDTH)
+			|| !displaylist_clip(l_x, l_y, l_x + p_image->width - 1,
+					l_y + p_image->height - 1, &cmd.rect)) {
+		return;
+	}
+	cmd.uc_type = DISPLAYLIST_IMAGE;
+	cmd.l_x = l_x;
+	cmd.l_y = l_y;
+	cmd.p_image = p_image;
+	if (!displaylist_add(&cmd, NULL)) {
+		compositor_draw_image(l_x, l_y, p_image);
+	}
+}
+
+/**
+ * \brief Draw a string into a box, see text_draw().
+ *
+ * The string is copied, it may be a local buffer.
+ */
+void displaylist_draw_text(const struct text_style *p_style, const char *p_str,
+		uint32_t ul_x1, uint32_t ul_y1, uint32_t ul_x2, uint32_t ul_y2)
+{
+	struct displaylist_cmd cmd;
+
+	if ((ul_x1 > ul_x2) || (ul_y1 > ul_y2)
+			|| !displaylist_clip(Min(ul_x1, COMPOSITOR_WIDTH),
+					Min(ul_y1, COMPOSITOR_HEIGHT), Min(ul_x2, COMPOSITOR_WIDTH),
+					Min(ul_y2, COMPOSITOR_HEIGHT), &cmd.rect)) {
+		return;
+	}
+	cmd.uc_type = DISPLAYLIST_TEXT;
+	cmd.style = *p_style;
+	/* The layout depends on the box, not only on its visible part */
+	cmd.box.x1 = ul_x1;
+	cmd.box.y1 = ul_y1;
+	cmd.box.x2 = Min(ul_x2, UINT16_MAX);
+	cmd.box.y2 = Min(ul_y2, UINT16_MAX);
+	if (!displaylist_add(&cmd, p_str)) {
+		text_draw(p_style, p_str, ul_x1, ul_y1, ul_x2, ul_y2);
+	}
+}
+
+/**
+ * \brief Draw a string in a box of its own measured size, see
+ * text_draw_at().
+ */
+void displaylist_draw_text_at(const struct text_style *p_style,
+		const char *p_str, uint32_t ul_x, uint32_t ul_y)
+{
+	uint32_t width = text_get_width(p_style, p_str);
+	uint32_t height = text_get_height(p_style, p_str);
+
+	if (width && height) {
+		displaylist_draw_text(p_style, p_str, ul_x, ul_y, ul_x + width - 1,
+				ul_y + height - 1);
+	}
+}
+
+/**
+ * \brief Turn the culling and merging on or off, to compare the traffic.
+ *
+ * Disabled lists are replayed as recorded.
+ */
+void displaylist_set_enabled(bool b_enabled)
+{
+	g_b_enabled = b_enabled;
+}
+
+/**
+ * \brief Get the display list statistics.
+ */
+void displaylist_get_stats(struct displaylist_stats *p_stats)
+{
+	*p_stats = g_stats;
+}
+
+/**
+ * \brief Clear the display list statistics.
+ */
+void displaylist_reset_stats(void)
+{
+	memset(&g_stats, 0, sizeof(g_stats));
+}
@@ -0,0 +1,67 @@
+/**
+ * \file
+ *
+ * \brief Display list recorded in front of the compositor.
+ *
+ * Between displaylist_begin() and displaylist_end() the drawing calls of a
+ * screen update are recorded instead of drawn. displaylist_end() then
+ * drops the commands that a later command paints over entirely, trims the
+ * fills to the parts that stay visible, merges fills of one color that
+ * form a rectangle together, and replays what is left to the compositor in
+ * one pass.
+ *
+ * The compositor sends every pixel that changed during a frame, so an area
+ * blanked and then painted back by an icon goes to the LCD even where the
+ * icon did not change; with the blanking culled only the real changes are
+ * sent. Fills, images and text boxes all write every pixel of their
+ * rectangle, which is what makes the culling exact.
+ *
+ * Recordings nest: displaylist_end() only replays at the outermost level,
+ * and interrupt handlers that draw while the main loop records are
+ * recorded after what came before them. Outside a recording the drawing
+ * calls go straight to the compositor. The compositor clip must be the
+ * whole screen while a list is replayed.
+ */
+
+#ifndef DISPLAYLIST_H_
+#define DISPLAYLIST_H_
+
+#include "compiler.h"
+#include "compositor.h"
+#include "text.h"
+
+/** Commands kept before the list is replayed early. */
+#ifndef DISPLAYLIST_MAX_COMMANDS
+#  define DISPLAYLIST_MAX_COMMANDS 32
+#endif
+
+/** Bytes kept for the strings of the text commands. */
+#ifndef DISPLAYLIST_TEXT_SIZE
+#  define DISPLAYLIST_TEXT_SIZE 256
+#endif
+
+struct displaylist_stats {
+	uint32_t ul_lists;       //!< lists replayed
+	uint32_t ul_commands;    //!< commands recorded
+	uint32_t ul_culled;      //!< commands painted over entirely
+	uint32_t ul_trimmed;     //!< fills cut to their visible parts
+	uint32_t ul_merged;      //!< fills merged into another one
+	uint32_t ul_replayed;    //!< commands drawn
+	uint32_t ul_pixels_recorded;  //!< pixels of the commands recorded
+	uint32_t ul_pixels_replayed;  //!< pixels of the commands drawn
+};
+
+void displaylist_begin(void);
+void displaylist_end(void);
+void displaylist_fill_rect(uint32_t ul_x1, uint32_t ul_y1, uint32_t ul_x2,
+		uint32_t ul_y2, uint32_t ul_color);
+void displaylist_draw_image(int32_t l_x, int32_t l_y, const tImage *p_image);
+void displaylist_draw_text(const struct text_style *p_style, const char *p_str,
+		uint32_t ul_x1, uint32_t ul_y1, uint32_t ul_x2, uint32_t ul_y2);
+void displaylist_draw_text_at(const struct text_style *p_style,
+		const char *p_str, uint32_t ul_x, uint32_t ul_y);
+void displaylist_set_enabled(bool b_enabled);
+void displaylist_get_stats(struct displaylist_stats *p_stats);
+void displaylist_reset_stats(void);
+
+#endif /* DISPLAYLIST_H_ */
@@ -0,0 +1,177 @@
+/**
+ * \file
+ *
+ * \brief Display power manager: dims the backlight and cuts the panel down
+ * to a status band while nothing is being done on it.
+ *
+ * The mode is worked out again from the time of the last touch and the
+ * machine state on every call, and the panel only gets commands when it
+ * changes: leaving the band mode turns the idle and partial modes off, and
+ * the brightness is written when the level of the new mode differs.
+ */
+
+#include <asf.h>
+#include "displaypm.h"
+#include "ili9488.h"
+
+static const struct displaypm_config *g_p_config;
+static enum displaypm_mode g_mode;
+static uint8_t g_uc_level;           // brightness written to the panel
+static uint32_t g_ul_activity_ms;    // last touch
+static bool g_b_locked;
+static bool g_b_running;
+
+static const char *const g_p_mode_name[DISPLAYPM_MODES] = {
+	"normal", "dim", "band",
+};
+
+static const char *const g_p_reason_name[] = {
+	"inactivity", "touch", "machine",
+};
+
+/**
+ * \brief Mode the display should be in now.
+ */
+static enum displaypm_mode displaypm_target(uint32_t ul_now_ms)
+{
+	uint32_t ul_idle_ms = ul_now_ms - g_ul_activity_ms;
+
+	if (g_b_locked && g_b_running && (ul_idle_ms >= g_p_config->ul_band_ms)) {
+		return DISPLAYPM_BAND;
+	}
+	if (ul_idle_ms >= g_p_config->ul_dim_ms) {
+		return DISPLAYPM_DIM;
+	}
+	return DISPLAYPM_NORMAL;
+}
+
+/**
+ * \brief Switch the panel to a mode and report it.
+ */
+static void displaypm_switch(enum displaypm_mode to,
+		enum displaypm_reason reason, uint32_t ul_now_ms)
+{
+	struct displaypm_event event = {g_mode, to, reason, ul_now_ms};
+	uint8_t uc_level = (to == DISPLAYPM_NORMAL) ? g_p_config->uc_bright
+			: g_p_config->uc_dim;
+
+	if (to == DISPLAYPM_BAND) {
+		ili9488_partial_mode(g_p_config->us_band_start, g_p_config->us_band_end);
+		ili9488_idle_mode(true);
+	} else if (g_mode == DISPLAYPM_BAND) {
+		ili9488_idle_mode(false);
+		ili9488_normal_mode();
+	}
+	if (uc_level != g_uc_level) {
+		ili9488_write_brightness(uc_level);
+		g_uc_level = uc_level;
+	}
+	g_mode = to;
+	if (g_p_config->event) {
+		g_p_config->event(&event);
+	}
+}
+
+/**
+ * \brief Go to the mode due now, if it is not the current one.
+ */
+static void displaypm_update(enum displaypm_reason reason, uint32_t ul_now_ms)
+{
+	enum displaypm_mode to;
+
+	if (!g_p_config) {
+		return;
+	}
+	to = displaypm_target(ul_now_ms);
+	if (to != g_mode) {
+		displaypm_switch(to, reason, ul_now_ms);
+	}
+}
+
+/**
+ * \brief Start managing the display, in normal mode.
+ *
+ * The LCD must be initialized: the brightness is written at once.
+ *
+ * \param p_config settings, kept.
+ * \param ul_now_ms current time, counted as a touch.
+ */
+void displaypm_init(const struct displaypm_config *p_config, uint32_t ul_now_ms)
+{
+	g_p_config = p_config;
+	g_mode = DISPLAYPM_NORMAL;
+	g_ul_activity_ms = ul_now_ms;
+	g_b_locked = false;
+	g_b_running = false;
+	g_uc_level = p_config->uc_bright;
+	ili9488_write_brightness(g_uc_level);
+}
+
+/**
+ * \brief A touch: back to normal mode at once, and restart the delays.
+ */
+void displaypm_activity(uint32_t ul_now_ms)
+{
+	g_ul_activity_ms = ul_now_ms;
+	displaypm_update(DISPLAYPM_TOUCH, ul_now_ms);
+}
+
+/**
+ * \brief Tell whether the machine is locked and running a cycle.
+ *
+ * Only a change does anything: the band mode is left at once when the
+ * machine is unlocked or stops, and entered when both become true after
+ * the band delay has passed.
+ */
+void displaypm_set_machine(bool b_locked, bool b_running, uint32_t ul_now_ms)
+{
+	if ((b_locked == g_b_locked) && (b_running == g_b_running)) {
+		return;
+	}
+	g_b_locked = b_locked;
+	g_b_running = b_running;
+	displaypm_update(DISPLAYPM_MACHINE, ul_now_ms);
+}
+
+/**
+ * \brief Switch the mode whose delay has passed.
+ *
+ * \return time of the next switch by inactivity, or DISPLAYPM_NO_DEADLINE.
+ */
+uint32_t displaypm_poll(uint32_t ul_now_ms)
+{
+	uint32_t ul_left = DISPLAYPM_NO_DEADLINE;
+	uint32_t ul_idle_ms;
+
+	if (!g_p_config) {
+		return DISPLAYPM_NO_DEADLINE;
+	}
+	displaypm_update(DISPLAYPM_INACTIVITY, ul_now_ms);
+
+	ul_idle_ms = ul_now_ms - g_ul_activity_ms;
+	if ((g_mode == DISPLAYPM_NORMAL) && (ul_idle_ms < g_p_config->ul_dim_ms)) {
+		ul_left = g_p_config->ul_dim_ms - ul_idle_ms;
+	}
+	if ((g_mode != DISPLAYPM_BAND) && g_b_locked && g_b_running
+			&& (ul_idle_ms < g_p_config->ul_band_ms)) {
+		ul_left = Min(ul_left, g_p_config->ul_band_ms - ul_idle_ms);
+	}
+	return (ul_left == DISPLAYPM_NO_DEADLINE) ? DISPLAYPM_NO_DEADLINE
+			: ul_now_ms + ul_left;
+}
+
+enum displaypm_mode displaypm_get_mode(void)
+{
+	return g_mode;
+}
+
+const char *displaypm_mode_name(enum displaypm_mode mode)
+{
+	return (mode < DISPLAYPM_MODES) ? g_p_mode_name[mode] : "?";
+}
+
+const char *displaypm_reason_name(enum displaypm_reason reason)
+{
+	return ((uint32_t)reason < sizeof(g_p_reason_name) / sizeof(g_p_reason_name[0]))
+			? g_p_reason_name[reason] : "?";
+}
@@ -0,0 +1,79 @@
+/**
+ * \file
+ *
+ * \brief Display power manager: dims the backlight and cuts the panel down
+ * to a status band while nothing is being done on it.
+ *
+ * Three modes, from the most to the least power:
+ *
+ * - DISPLAYPM_NORMAL: full colour, every row, uc_bright brightness.
+ * - DISPLAYPM_DIM: same picture at uc_dim brightness, once no touch came
+ *   for ul_dim_ms.
+ * - DISPLAYPM_BAND: idle mode (8 colours) and partial mode restricted to
+ *   the rows us_band_start..us_band_end, dimmed, once no touch came for
+ *   ul_band_ms while the machine is locked and running. Only that band
+ *   changes during a cycle, the timer; everything else is still drawn to
+ *   the frame memory and shows again when the band mode is left.
+ *
+ * A touch, displaypm_activity(), goes back to DISPLAYPM_NORMAL at once, and
+ * the band mode is left as soon as the machine is unlocked or stops. Every
+ * switch is reported to the event callback with its reason, so it can be
+ * traced.
+ *
+ * The panel is driven through the ILI9488 driver; calls must not be made
+ * while a frame is being sent. Times are milliseconds of a free-running
+ * clock (wrap-around safe).
+ */
+
+#ifndef DISPLAYPM_H_
+#define DISPLAYPM_H_
+
+#include "compiler.h"
+
+/** Returned by displaypm_poll() when no switch is due by time. */
+#define DISPLAYPM_NO_DEADLINE  0xFFFFFFFFu
+
+enum displaypm_mode {
+	DISPLAYPM_NORMAL,
+	DISPLAYPM_DIM,
+	DISPLAYPM_BAND,
+	DISPLAYPM_MODES
+};
+
+/** Why the mode changed. */
+enum displaypm_reason {
+	DISPLAYPM_INACTIVITY,   //!< no touch for the delay of the new mode
+	DISPLAYPM_TOUCH,        //!< displaypm_activity()
+	DISPLAYPM_MACHINE,      //!< locked, unlocked, started or stopped
+};
+
+struct displaypm_event {
+	enum displaypm_mode from;
+	enum displaypm_mode to;
+	enum displaypm_reason reason;
+	uint32_t ul_ms;           //!< time of the switch
+};
+
+/**
+ * Settings. Set the fields, then call displaypm_init().
+ */
+struct displaypm_config {
+	uint32_t ul_dim_ms;       //!< no touch for this long dims
+	uint32_t ul_band_ms;      //!< no touch for this long, locked and running, cuts to the band
+	uint8_t uc_bright;        //!< brightness in normal mode
+	uint8_t uc_dim;           //!< brightness when dimmed, band mode included
+	uint16_t us_band_start;   //!< first frame memory row shown in band mode
+	uint16_t us_band_end;     //!< last row
+	/** Called after each switch, may be NULL. */
+	void (*event)(const struct displaypm_event *p_event);
+};
+
+void displaypm_init(const struct displaypm_config *p_config, uint32_t ul_now_ms);
+void displaypm_activity(uint32_t ul_now_ms);
+void displaypm_set_machine(bool b_locked, bool b_running, uint32_t ul_now_ms);
+uint32_t displaypm_poll(uint32_t ul_now_ms);
+enum displaypm_mode displaypm_get_mode(void);
+const char *displaypm_mode_name(enum displaypm_mode mode);
+const char *displaypm_reason_name(enum displaypm_reason reason);
+
+#endif /* DISPLAYPM_H_ */
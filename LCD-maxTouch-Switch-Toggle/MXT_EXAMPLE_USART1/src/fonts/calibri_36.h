@@ -0,0 +1,1002 @@
+
+/*******************************************************************************
+* font
+* filename: unsaved
+* name: calibri_36
+* subset of calibri_36.h by tools/font_subset.py, do not edit
+* family: Calibri
+* size: 36
+* style: Normal
+* included characters:  !0123456789:ACDEGLMNOPRTUVadefgilmnoprstux\x00cd\x00e1\x00ed
+* antialiasing: no
+* type: proportional
+* encoding: ASMO-708
+* unicode bom: no
+*
+* preset name: asset_compiler auto
+* data block size: 8 bit(s), uint8_t
+* RLE compression enabled: yes
+* conversion type: Color, not_used not_used
+* bits per pixel: 1/8
+*
+* preprocess:
+*  main scan direction: top_to_bottom
+*  line scan direction: forward
+*  inverse: no
+*******************************************************************************/
+
+/*
+ typedef struct {
+     long int code;
+     const tImage *image;
+     } tChar;
+ typedef struct {
+     int length;
+     const tChar *chars;
+     } tFont;
+*/
+
+#include <stdint.h>
+#include "tfont.h"
+
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x20[9] = {
+    0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x00, 0xa7, 0x00, 
+};
+static const tImage calibri_36_0x20 = { image_data_calibri_36_0x20,
+    8, 37, 8, TIMAGE_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x21[61] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 
+    0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 
+    0x07, 0x00, 0x70, 0x07, 0x00, 0x00, 0x00, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x21 = { image_data_calibri_36_0x21,
+    12, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x30[89] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 
+    0x03, 0xff, 0x01, 0xe1, 0xe0, 0x70, 0x3c, 0x38, 0x07, 0x0e, 0x01, 0xc3, 0x00, 0x39, 0xc0, 0x0e, 
+    0x70, 0x03, 0x9c, 0x00, 0xe7, 0x00, 0x39, 0xc0, 0x0e, 0x70, 0x03, 0x9c, 0x00, 0xe7, 0x00, 0x39, 
+    0xc0, 0x0e, 0x70, 0x03, 0x8e, 0x01, 0xc3, 0x80, 0x70, 0xf0, 0x38, 0x1e, 0x1e, 0x03, 0xff, 0x00, 
+    0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x30 = { image_data_calibri_36_0x30,
+    18, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x31[89] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
+    0x00, 0x3c, 0x00, 0x3f, 0x00, 0x1d, 0xc0, 0x0e, 0x70, 0x03, 0x1c, 0x00, 0x07, 0x00, 0x01, 0xc0, 
+    0x00, 0x70, 0x00, 0x1c, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x00, 0x70, 0x00, 0x1c, 0x00, 0x07, 0x00, 
+    0x01, 0xc0, 0x00, 0x70, 0x00, 0x1c, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x00, 0x70, 0x03, 0xff, 0xe0, 
+    0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x31 = { image_data_calibri_36_0x31,
+    18, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x32[89] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 
+    0x07, 0xfe, 0x03, 0x83, 0xc0, 0xc0, 0x78, 0x00, 0x0e, 0x00, 0x03, 0x80, 0x00, 0xe0, 0x00, 0x38, 
+    0x00, 0x0e, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x00, 0xf0, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x0e, 0x00, 
+    0x07, 0x80, 0x03, 0xc0, 0x01, 0xe0, 0x00, 0xf0, 0x00, 0x78, 0x00, 0x1c, 0x00, 0x0f, 0xff, 0xc3, 
+    0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x32 = { image_data_calibri_36_0x32,
+    18, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x33[89] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 
+    0x03, 0xff, 0x01, 0xc3, 0xc0, 0x40, 0x78, 0x00, 0x0e, 0x00, 0x03, 0x80, 0x00, 0xe0, 0x00, 0x38, 
+    0x00, 0x1c, 0x00, 0x1e, 0x00, 0xff, 0x00, 0x3f, 0xe0, 0x00, 0x3c, 0x00, 0x03, 0x80, 0x00, 0x70, 
+    0x00, 0x1c, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x00, 0x70, 0x80, 0x38, 0x3c, 0x1e, 0x0f, 0xfe, 0x00, 
+    0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x33 = { image_data_calibri_36_0x33,
+    18, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x34[89] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 
+    0x00, 0x1f, 0x00, 0x0f, 0xc0, 0x03, 0xf0, 0x01, 0xdc, 0x00, 0x67, 0x00, 0x39, 0xc0, 0x0c, 0x70, 
+    0x07, 0x1c, 0x01, 0x87, 0x00, 0xe1, 0xc0, 0x70, 0x70, 0x1c, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc1, 
+    0xc0, 0x70, 0x7f, 0xff, 0x9f, 0xff, 0xe0, 0x01, 0xc0, 0x00, 0x70, 0x00, 0x1c, 0x00, 0x07, 0x00, 
+    0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x34 = { image_data_calibri_36_0x34,
+    18, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x35[89] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfe, 
+    0x07, 0xff, 0x81, 0xc0, 0x00, 0x70, 0x00, 0x1c, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x00, 0x70, 0x00, 
+    0x1c, 0x00, 0x07, 0xfc, 0x01, 0xff, 0xc0, 0x00, 0xf8, 0x00, 0x0e, 0x00, 0x01, 0xc0, 0x00, 0x70, 
+    0x00, 0x1c, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x00, 0xe0, 0x00, 0x38, 0x30, 0x3c, 0x0f, 0xfe, 0x00, 
+    0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x35 = { image_data_calibri_36_0x35,
+    18, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x36[89] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 
+    0x00, 0xff, 0xc0, 0x78, 0x30, 0x38, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x00, 0xe0, 0x00, 
+    0x38, 0x00, 0x0e, 0x7f, 0x03, 0xff, 0xe0, 0xf8, 0x3c, 0x38, 0x07, 0x8e, 0x00, 0xe3, 0x80, 0x38, 
+    0xe0, 0x0e, 0x38, 0x03, 0x8e, 0x00, 0xe1, 0xc0, 0x70, 0x70, 0x1c, 0x0e, 0x0e, 0x01, 0xff, 0x00, 
+    0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x36 = { image_data_calibri_36_0x36,
+    18, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x37[89] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 
+    0x8f, 0xff, 0xe0, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x07, 0x00, 0x03, 0x80, 0x00, 0xe0, 0x00, 0x78, 
+    0x00, 0x1c, 0x00, 0x0f, 0x00, 0x03, 0x80, 0x00, 0xe0, 0x00, 0x70, 0x00, 0x1c, 0x00, 0x0f, 0x00, 
+    0x03, 0x80, 0x01, 0xe0, 0x00, 0x70, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x03, 0x80, 0x01, 0xe0, 0x00, 
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x37 = { image_data_calibri_36_0x37,
+    18, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x38[89] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 
+    0x03, 0xff, 0x01, 0xc1, 0xc0, 0xe0, 0x38, 0x38, 0x0e, 0x0e, 0x03, 0x83, 0x80, 0xe0, 0xf0, 0x70, 
+    0x1e, 0x1c, 0x03, 0xde, 0x00, 0x7f, 0x00, 0x0f, 0xc0, 0x0f, 0xf8, 0x07, 0x0f, 0x83, 0x80, 0xe1, 
+    0xc0, 0x3c, 0x70, 0x07, 0x1c, 0x01, 0xc7, 0x00, 0x71, 0xe0, 0x38, 0x3c, 0x1e, 0x07, 0xff, 0x00, 
+    0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x38 = { image_data_calibri_36_0x38,
+    18, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x39[89] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf0, 
+    0x03, 0xfe, 0x01, 0xc3, 0xc0, 0xe0, 0x38, 0x78, 0x0e, 0x1c, 0x03, 0x87, 0x00, 0x71, 0xc0, 0x1c, 
+    0x70, 0x07, 0x1c, 0x01, 0xc3, 0x80, 0x70, 0xf0, 0x7c, 0x1f, 0xff, 0x01, 0xf9, 0xc0, 0x00, 0x70, 
+    0x00, 0x18, 0x00, 0x0e, 0x00, 0x03, 0x80, 0x01, 0xc0, 0x00, 0x70, 0x30, 0x78, 0x0f, 0xfc, 0x01, 
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x39 = { image_data_calibri_36_0x39,
+    18, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x3a[39] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0xe6, 0x00, 0x83, 0x01, 0x85, 0x00, 0x83, 0x01, 0x85, 0x00, 0x83, 
+    0x01, 0x85, 0x00, 0x83, 0x01, 0xdf, 0x00, 0x83, 0x01, 0x85, 0x00, 0x83, 0x01, 0x85, 0x00, 0x83, 
+    0x01, 0x85, 0x00, 0x83, 0x01, 0xe6, 0x00, 
+};
+static const tImage calibri_36_0x3a = { image_data_calibri_36_0x3a,
+    10, 37, 8, TIMAGE_RLE };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x41[103] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0f, 0x00, 0x00, 0x7c, 0x00, 0x03, 0xe0, 0x00, 0x3f, 0x00, 0x01, 0xdc, 0x00, 0x0c, 0xe0, 0x00, 
+    0xe7, 0x80, 0x07, 0x1c, 0x00, 0x30, 0xe0, 0x03, 0x87, 0x80, 0x1c, 0x1c, 0x01, 0xc0, 0xe0, 0x0e, 
+    0x07, 0x80, 0x70, 0x1c, 0x07, 0x00, 0xe0, 0x3f, 0xff, 0x81, 0xff, 0xfc, 0x1c, 0x00, 0xf0, 0xe0, 
+    0x03, 0x87, 0x00, 0x1c, 0x70, 0x00, 0xf3, 0x80, 0x03, 0x9c, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x41 = { image_data_calibri_36_0x41,
+    21, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x43[93] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
+    0xe0, 0x07, 0xff, 0x01, 0xe0, 0x70, 0x78, 0x02, 0x0e, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0c, 
+    0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0e, 0x00, 0x01, 0xc0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 
+    0xe0, 0x00, 0x1c, 0x00, 0x01, 0xc0, 0x00, 0x38, 0x00, 0x07, 0x80, 0x00, 0x78, 0x02, 0x07, 0x81, 
+    0xc0, 0x7f, 0xf0, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x43 = { image_data_calibri_36_0x43,
+    19, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x44[107] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x1f, 0xf8, 0x00, 0x7f, 0xf8, 0x01, 0xc0, 0xf8, 0x07, 0x00, 0xf0, 0x1c, 0x01, 0xc0, 0x70, 0x03, 
+    0x81, 0xc0, 0x0e, 0x07, 0x00, 0x1c, 0x1c, 0x00, 0x70, 0x70, 0x01, 0xc1, 0xc0, 0x07, 0x07, 0x00, 
+    0x1c, 0x1c, 0x00, 0x70, 0x70, 0x01, 0xc1, 0xc0, 0x07, 0x07, 0x00, 0x1c, 0x1c, 0x00, 0xe0, 0x70, 
+    0x03, 0x81, 0xc0, 0x1c, 0x07, 0x00, 0xf0, 0x1c, 0x0f, 0x80, 0x7f, 0xf8, 0x01, 0xff, 0x80, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x44 = { image_data_calibri_36_0x44,
+    22, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x45[89] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 
+    0x07, 0xff, 0xc1, 0xc0, 0x00, 0x70, 0x00, 0x1c, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x00, 0x70, 0x00, 
+    0x1c, 0x00, 0x07, 0x00, 0x01, 0xff, 0xe0, 0x7f, 0xf8, 0x1c, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x00, 
+    0x70, 0x00, 0x1c, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x00, 0x70, 0x00, 0x1c, 0x00, 0x07, 0xff, 0xc1, 
+    0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x45 = { image_data_calibri_36_0x45,
+    18, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x47[112] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x07, 0xf8, 0x00, 0x3f, 0xfc, 0x00, 0xf0, 0x3c, 0x03, 0x80, 0x18, 0x0e, 0x00, 0x00, 0x3c, 
+    0x00, 0x00, 0x70, 0x00, 0x00, 0xe0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0e, 0x07, 0xfc, 
+    0x1c, 0x0f, 0xf8, 0x38, 0x00, 0x70, 0x70, 0x00, 0xe0, 0xe0, 0x01, 0xc1, 0xe0, 0x03, 0x81, 0xc0, 
+    0x07, 0x03, 0x80, 0x0e, 0x03, 0x80, 0x1c, 0x03, 0x80, 0x38, 0x07, 0xc0, 0xf0, 0x03, 0xff, 0xc0, 
+    0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x47 = { image_data_calibri_36_0x47,
+    23, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x4c[75] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x03, 0x80, 
+    0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 
+    0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 
+    0x0e, 0x00, 0x1c, 0x00, 0x3f, 0xfc, 0x7f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x4c = { image_data_calibri_36_0x4c,
+    15, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x4d[149] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x1f, 0x03, 0xf0, 0x00, 0x3e, 0x07, 0xe0, 0x00, 0xfc, 
+    0x0f, 0xc0, 0x01, 0xf8, 0x1d, 0xc0, 0x07, 0x70, 0x3b, 0x80, 0x0e, 0xe0, 0x73, 0x80, 0x19, 0xc0, 
+    0xe7, 0x00, 0x73, 0x81, 0xce, 0x00, 0xe7, 0x03, 0x8e, 0x03, 0x8e, 0x07, 0x1c, 0x07, 0x1c, 0x0e, 
+    0x1c, 0x1c, 0x38, 0x1c, 0x38, 0x38, 0x70, 0x38, 0x70, 0x70, 0xe0, 0x70, 0x71, 0xc1, 0xc0, 0xe0, 
+    0xe3, 0x83, 0x81, 0xc0, 0xee, 0x07, 0x03, 0x81, 0xdc, 0x0e, 0x07, 0x03, 0xf0, 0x1c, 0x0e, 0x03, 
+    0xe0, 0x38, 0x1c, 0x07, 0xc0, 0x70, 0x38, 0x07, 0x00, 0xe0, 0x70, 0x0e, 0x01, 0xc0, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x4d = { image_data_calibri_36_0x4d,
+    31, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x4e[112] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0xe0, 0x07, 0x03, 0xe0, 0x0e, 0x07, 0xe0, 0x1c, 0x0f, 0xc0, 0x38, 0x1d, 0xc0, 0x70, 0x3b, 
+    0x80, 0xe0, 0x77, 0x81, 0xc0, 0xe7, 0x03, 0x81, 0xc7, 0x07, 0x03, 0x8e, 0x0e, 0x07, 0x0e, 0x1c, 
+    0x0e, 0x1c, 0x38, 0x1c, 0x1c, 0x70, 0x38, 0x38, 0xe0, 0x70, 0x39, 0xc0, 0xe0, 0x73, 0x81, 0xc0, 
+    0x77, 0x03, 0x80, 0xee, 0x07, 0x00, 0xfc, 0x0e, 0x01, 0xf8, 0x1c, 0x01, 0xf0, 0x38, 0x03, 0xe0, 
+    0x70, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x4e = { image_data_calibri_36_0x4e,
+    23, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x4f[116] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x7f, 0x00, 0x03, 0xff, 0xc0, 0x07, 0x81, 0xe0, 0x0f, 0x00, 0xf0, 0x0e, 0x00, 0x78, 
+    0x1c, 0x00, 0x38, 0x1c, 0x00, 0x38, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 
+    0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 0x1c, 0x38, 0x00, 
+    0x1c, 0x1c, 0x00, 0x38, 0x1c, 0x00, 0x38, 0x1e, 0x00, 0x70, 0x0e, 0x00, 0xf0, 0x07, 0x81, 0xe0, 
+    0x03, 0xff, 0xc0, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x4f = { image_data_calibri_36_0x4f,
+    24, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x50[93] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 
+    0x80, 0x3f, 0xfc, 0x07, 0x03, 0xc0, 0xe0, 0x38, 0x1c, 0x03, 0x83, 0x80, 0x70, 0x70, 0x0e, 0x0e, 
+    0x01, 0xc1, 0xc0, 0x38, 0x38, 0x0f, 0x07, 0x01, 0xc0, 0xe0, 0xf0, 0x1f, 0xfc, 0x03, 0xfe, 0x00, 
+    0x70, 0x00, 0x0e, 0x00, 0x01, 0xc0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x1c, 0x00, 
+    0x03, 0x80, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x50 = { image_data_calibri_36_0x50,
+    19, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x52[98] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 
+    0xf8, 0x01, 0xff, 0xe0, 0x1c, 0x0f, 0x01, 0xc0, 0x78, 0x1c, 0x03, 0x81, 0xc0, 0x38, 0x1c, 0x03, 
+    0x81, 0xc0, 0x38, 0x1c, 0x07, 0x01, 0xc0, 0xf0, 0x1f, 0xfc, 0x01, 0xff, 0x80, 0x1c, 0x3c, 0x01, 
+    0xc1, 0xe0, 0x1c, 0x0e, 0x01, 0xc0, 0x70, 0x1c, 0x07, 0x01, 0xc0, 0x70, 0x1c, 0x03, 0x81, 0xc0, 
+    0x38, 0x1c, 0x03, 0xc1, 0xc0, 0x1c, 0x1c, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 
+};
+static const tImage calibri_36_0x52 = { image_data_calibri_36_0x52,
+    20, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x54[89] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
+    0xbf, 0xff, 0xe0, 0x1c, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x00, 0x70, 0x00, 0x1c, 0x00, 0x07, 0x00, 
+    0x01, 0xc0, 0x00, 0x70, 0x00, 0x1c, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x00, 0x70, 0x00, 0x1c, 0x00, 
+    0x07, 0x00, 0x01, 0xc0, 0x00, 0x70, 0x00, 0x1c, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x00, 0x70, 0x00, 
+    0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x54 = { image_data_calibri_36_0x54,
+    18, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x55[112] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0xc0, 0x07, 0x03, 0x80, 0x0e, 0x07, 0x00, 0x1c, 0x0e, 0x00, 0x38, 0x1c, 0x00, 0x70, 0x38, 
+    0x00, 0xe0, 0x70, 0x01, 0xc0, 0xe0, 0x03, 0x81, 0xc0, 0x07, 0x03, 0x80, 0x0e, 0x07, 0x00, 0x1c, 
+    0x0e, 0x00, 0x38, 0x1c, 0x00, 0x70, 0x38, 0x00, 0xe0, 0x70, 0x01, 0xc0, 0xe0, 0x03, 0x81, 0xc0, 
+    0x07, 0x03, 0x80, 0x0e, 0x03, 0x80, 0x38, 0x07, 0x80, 0xf0, 0x07, 0x83, 0xc0, 0x07, 0xff, 0x00, 
+    0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x55 = { image_data_calibri_36_0x55,
+    23, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x56[98] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 
+    0x00, 0xe7, 0x00, 0x0e, 0x70, 0x00, 0xe7, 0x00, 0x1c, 0x38, 0x01, 0xc3, 0x80, 0x1c, 0x38, 0x03, 
+    0x81, 0xc0, 0x38, 0x1c, 0x03, 0x81, 0xe0, 0x70, 0x0e, 0x07, 0x00, 0xe0, 0x70, 0x0f, 0x0e, 0x00, 
+    0x70, 0xe0, 0x07, 0x0e, 0x00, 0x79, 0xc0, 0x03, 0x9c, 0x00, 0x39, 0xc0, 0x03, 0xf8, 0x00, 0x1f, 
+    0x80, 0x01, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 
+};
+static const tImage calibri_36_0x56 = { image_data_calibri_36_0x56,
+    20, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x61[84] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x01, 0xff, 0x81, 0xc1, 
+    0xc0, 0x80, 0x70, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x0e, 0x01, 0xff, 0x03, 0xff, 0x83, 0xc1, 0xc3, 
+    0x80, 0xe1, 0xc0, 0x70, 0xe0, 0x38, 0x70, 0x3c, 0x1c, 0x3e, 0x0f, 0xff, 0x01, 0xf3, 0x80, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x61 = { image_data_calibri_36_0x61,
+    17, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x64[93] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 
+    0x38, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x00, 0x1c, 0x00, 0x03, 0x80, 0x00, 0x70, 0x0f, 0x8e, 0x03, 
+    0xfd, 0xc0, 0xe1, 0xf8, 0x38, 0x1f, 0x07, 0x01, 0xe1, 0xc0, 0x1c, 0x38, 0x03, 0x87, 0x00, 0x70, 
+    0xe0, 0x0e, 0x1c, 0x01, 0xc3, 0x80, 0x38, 0x70, 0x07, 0x07, 0x01, 0xe0, 0xe0, 0x7c, 0x1e, 0x1f, 
+    0x81, 0xff, 0x70, 0x0f, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x64 = { image_data_calibri_36_0x64,
+    19, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x65[89] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x1f, 0xf8, 
+    0x0e, 0x0f, 0x07, 0x01, 0xc1, 0xc0, 0x38, 0xe0, 0x0e, 0x38, 0x03, 0x8f, 0xff, 0xe3, 0xff, 0xf8, 
+    0xe0, 0x00, 0x38, 0x00, 0x0e, 0x00, 0x01, 0xc0, 0x00, 0x70, 0x00, 0x0f, 0x03, 0x01, 0xff, 0xc0, 
+    0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x65 = { image_data_calibri_36_0x65,
+    18, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x66[56] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0xfe, 0x1c, 0x47, 0x00, 0xe0, 
+    0x1c, 0x03, 0x83, 0xff, 0x7f, 0xe1, 0xc0, 0x38, 0x07, 0x00, 0xe0, 0x1c, 0x03, 0x80, 0x70, 0x0e, 
+    0x01, 0xc0, 0x38, 0x07, 0x00, 0xe0, 0x1c, 0x03, 0x80, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x66 = { image_data_calibri_36_0x66,
+    11, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x67[84] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xc1, 0xff, 0xe1, 0xc3, 
+    0x81, 0xe1, 0xe0, 0xe0, 0x70, 0x70, 0x38, 0x38, 0x1c, 0x1c, 0x0e, 0x0f, 0x0f, 0x03, 0x87, 0x01, 
+    0xff, 0x01, 0xdf, 0x00, 0xe0, 0x00, 0x70, 0x00, 0x1f, 0xf8, 0x0f, 0xff, 0x0e, 0x03, 0xce, 0x00, 
+    0xe7, 0x00, 0x73, 0x80, 0x39, 0xe0, 0x78, 0x7f, 0xf8, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x67 = { image_data_calibri_36_0x67,
+    17, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x69[42] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x1c, 
+    0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x69 = { image_data_calibri_36_0x69,
+    8, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x6c[42] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 
+    0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x6c = { image_data_calibri_36_0x6c,
+    8, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x6d[140] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1e, 0x07, 0x80, 0x3b, 0xfc, 0xfe, 
+    0x01, 0xf0, 0xee, 0x38, 0x0f, 0x07, 0xc1, 0xe0, 0x70, 0x1c, 0x07, 0x03, 0x80, 0xe0, 0x38, 0x1c, 
+    0x07, 0x01, 0xc0, 0xe0, 0x38, 0x0e, 0x07, 0x01, 0xc0, 0x70, 0x38, 0x0e, 0x03, 0x81, 0xc0, 0x70, 
+    0x1c, 0x0e, 0x03, 0x80, 0xe0, 0x70, 0x1c, 0x07, 0x03, 0x80, 0xe0, 0x38, 0x1c, 0x07, 0x01, 0xc0, 
+    0xe0, 0x38, 0x0e, 0x07, 0x01, 0xc0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x6d = { image_data_calibri_36_0x6d,
+    29, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x6e[93] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xe0, 0x0e, 
+    0xfe, 0x01, 0xf0, 0xe0, 0x3c, 0x1e, 0x07, 0x01, 0xc0, 0xe0, 0x38, 0x1c, 0x07, 0x03, 0x80, 0xe0, 
+    0x70, 0x1c, 0x0e, 0x03, 0x81, 0xc0, 0x70, 0x38, 0x0e, 0x07, 0x01, 0xc0, 0xe0, 0x38, 0x1c, 0x07, 
+    0x03, 0x80, 0xe0, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x6e = { image_data_calibri_36_0x6e,
+    19, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x6f[93] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x03, 
+    0xfe, 0x00, 0xe0, 0xe0, 0x38, 0x0e, 0x07, 0x01, 0xc1, 0xc0, 0x1c, 0x38, 0x03, 0x87, 0x00, 0x70, 
+    0xe0, 0x0e, 0x1c, 0x01, 0xc3, 0x80, 0x38, 0x70, 0x07, 0x07, 0x01, 0xc0, 0xe0, 0x38, 0x0e, 0x0e, 
+    0x00, 0xff, 0x80, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x6f = { image_data_calibri_36_0x6f,
+    19, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x70[93] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xf0, 0x0e, 
+    0xff, 0x81, 0xf8, 0x78, 0x3e, 0x07, 0x07, 0x80, 0xe0, 0xe0, 0x0e, 0x1c, 0x01, 0xc3, 0x80, 0x38, 
+    0x70, 0x07, 0x0e, 0x00, 0xe1, 0xc0, 0x1c, 0x38, 0x03, 0x87, 0x80, 0xe0, 0xf8, 0x1c, 0x1f, 0x87, 
+    0x03, 0xbf, 0xc0, 0x71, 0xf0, 0x0e, 0x00, 0x01, 0xc0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xe0, 
+    0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x70 = { image_data_calibri_36_0x70,
+    19, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x72[66] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x3c, 0x3b, 0xe1, 0xf0, 0x0f, 0x00, 0x78, 0x03, 0x80, 0x1c, 
+    0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 
+};
+static const tImage calibri_36_0x72 = { image_data_calibri_36_0x72,
+    13, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x73[70] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x0f, 0xf8, 0x38, 0x61, 0xc0, 0x07, 0x00, 0x1c, 
+    0x00, 0x7c, 0x00, 0xfc, 0x01, 0xfc, 0x00, 0xf8, 0x00, 0xf0, 0x01, 0xc0, 0x07, 0x10, 0x1c, 0x70, 
+    0xe0, 0xff, 0x81, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x73 = { image_data_calibri_36_0x73,
+    14, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x74[61] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x01, 
+    0xc0, 0x1c, 0x01, 0xc0, 0xff, 0xef, 0xfe, 0x1c, 0x01, 0xc0, 0x1c, 0x01, 0xc0, 0x1c, 0x01, 0xc0, 
+    0x1c, 0x01, 0xc0, 0x1c, 0x01, 0xc0, 0x1c, 0x01, 0xc0, 0x1e, 0x00, 0xfe, 0x07, 0xe0, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x74 = { image_data_calibri_36_0x74,
+    12, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x75[93] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0e, 0x0e, 
+    0x01, 0xc1, 0xc0, 0x38, 0x38, 0x07, 0x07, 0x00, 0xe0, 0xe0, 0x1c, 0x1c, 0x03, 0x83, 0x80, 0x70, 
+    0x70, 0x0e, 0x0e, 0x01, 0xc1, 0xc0, 0x38, 0x38, 0x07, 0x07, 0x01, 0xe0, 0xf0, 0x7c, 0x0f, 0x1f, 
+    0x80, 0xff, 0x70, 0x0f, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x75 = { image_data_calibri_36_0x75,
+    19, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0x78[79] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0e, 0x38, 0x1c, 0x3c, 0x1c, 0x1c, 
+    0x38, 0x0e, 0x70, 0x0f, 0x70, 0x07, 0xe0, 0x03, 0xe0, 0x03, 0xc0, 0x07, 0xe0, 0x07, 0xe0, 0x0e, 
+    0x70, 0x1e, 0x78, 0x1c, 0x38, 0x38, 0x1c, 0x38, 0x1e, 0x70, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0x78 = { image_data_calibri_36_0x78,
+    16, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0xcd[47] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x0e, 0x0e, 0x0c, 0x00, 0x01, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 
+    0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 
+    0x1c, 0x0e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0xcd = { image_data_calibri_36_0xcd,
+    9, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0xe1[84] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x1c, 0x00, 
+    0x1c, 0x00, 0x0c, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x01, 0xff, 0x81, 0xc1, 
+    0xc0, 0x80, 0x70, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x0e, 0x01, 0xff, 0x03, 0xff, 0x83, 0xc1, 0xc3, 
+    0x80, 0xe1, 0xc0, 0x70, 0xe0, 0x38, 0x70, 0x3c, 0x1c, 0x3e, 0x0f, 0xff, 0x01, 0xf3, 0x80, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0xe1 = { image_data_calibri_36_0xe1,
+    17, 37, 1, TIMAGE_PAL1 };
+#endif
+
+#if (0x0 == 0x0)
+static const uint8_t image_data_calibri_36_0xed[42] = {
+    0x01, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0e, 0x1c, 0x18, 0x38, 0x00, 0x00, 0x1c, 
+    0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+static const tImage calibri_36_0xed = { image_data_calibri_36_0xed,
+    8, 37, 1, TIMAGE_PAL1 };
+#endif
+
+
+static const tChar calibri_36_array[] = {
+
+#if (0x0 == 0x0)
+  // character: '0'
+  {0x30, &calibri_36_0x30},
+#else
+  // character: '0' == ''
+  {0x30, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '1'
+  {0x31, &calibri_36_0x31},
+#else
+  // character: '1' == ''
+  {0x31, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '2'
+  {0x32, &calibri_36_0x32},
+#else
+  // character: '2' == ''
+  {0x32, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '3'
+  {0x33, &calibri_36_0x33},
+#else
+  // character: '3' == ''
+  {0x33, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '4'
+  {0x34, &calibri_36_0x34},
+#else
+  // character: '4' == ''
+  {0x34, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '5'
+  {0x35, &calibri_36_0x35},
+#else
+  // character: '5' == ''
+  {0x35, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '6'
+  {0x36, &calibri_36_0x36},
+#else
+  // character: '6' == ''
+  {0x36, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '7'
+  {0x37, &calibri_36_0x37},
+#else
+  // character: '7' == ''
+  {0x37, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '8'
+  {0x38, &calibri_36_0x38},
+#else
+  // character: '8' == ''
+  {0x38, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '9'
+  {0x39, &calibri_36_0x39},
+#else
+  // character: '9' == ''
+  {0x39, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: ':'
+  {0x3a, &calibri_36_0x3a},
+#else
+  // character: ':' == ''
+  {0x3a, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: ' '
+  {0x20, &calibri_36_0x20},
+#else
+  // character: ' ' == ''
+  {0x20, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '!'
+  {0x21, &calibri_36_0x21},
+#else
+  // character: '!' == ''
+  {0x21, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'A'
+  {0x41, &calibri_36_0x41},
+#else
+  // character: 'A' == ''
+  {0x41, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'C'
+  {0x43, &calibri_36_0x43},
+#else
+  // character: 'C' == ''
+  {0x43, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'D'
+  {0x44, &calibri_36_0x44},
+#else
+  // character: 'D' == ''
+  {0x44, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'E'
+  {0x45, &calibri_36_0x45},
+#else
+  // character: 'E' == ''
+  {0x45, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'G'
+  {0x47, &calibri_36_0x47},
+#else
+  // character: 'G' == ''
+  {0x47, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'L'
+  {0x4c, &calibri_36_0x4c},
+#else
+  // character: 'L' == ''
+  {0x4c, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'M'
+  {0x4d, &calibri_36_0x4d},
+#else
+  // character: 'M' == ''
+  {0x4d, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'N'
+  {0x4e, &calibri_36_0x4e},
+#else
+  // character: 'N' == ''
+  {0x4e, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'O'
+  {0x4f, &calibri_36_0x4f},
+#else
+  // character: 'O' == ''
+  {0x4f, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'P'
+  {0x50, &calibri_36_0x50},
+#else
+  // character: 'P' == ''
+  {0x50, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'R'
+  {0x52, &calibri_36_0x52},
+#else
+  // character: 'R' == ''
+  {0x52, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'T'
+  {0x54, &calibri_36_0x54},
+#else
+  // character: 'T' == ''
+  {0x54, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'U'
+  {0x55, &calibri_36_0x55},
+#else
+  // character: 'U' == ''
+  {0x55, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'V'
+  {0x56, &calibri_36_0x56},
+#else
+  // character: 'V' == ''
+  {0x56, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'a'
+  {0x61, &calibri_36_0x61},
+#else
+  // character: 'a' == ''
+  {0x61, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'd'
+  {0x64, &calibri_36_0x64},
+#else
+  // character: 'd' == ''
+  {0x64, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'e'
+  {0x65, &calibri_36_0x65},
+#else
+  // character: 'e' == ''
+  {0x65, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'f'
+  {0x66, &calibri_36_0x66},
+#else
+  // character: 'f' == ''
+  {0x66, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'g'
+  {0x67, &calibri_36_0x67},
+#else
+  // character: 'g' == ''
+  {0x67, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'i'
+  {0x69, &calibri_36_0x69},
+#else
+  // character: 'i' == ''
+  {0x69, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'l'
+  {0x6c, &calibri_36_0x6c},
+#else
+  // character: 'l' == ''
+  {0x6c, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'm'
+  {0x6d, &calibri_36_0x6d},
+#else
+  // character: 'm' == ''
+  {0x6d, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'n'
+  {0x6e, &calibri_36_0x6e},
+#else
+  // character: 'n' == ''
+  {0x6e, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'o'
+  {0x6f, &calibri_36_0x6f},
+#else
+  // character: 'o' == ''
+  {0x6f, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'p'
+  {0x70, &calibri_36_0x70},
+#else
+  // character: 'p' == ''
+  {0x70, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'r'
+  {0x72, &calibri_36_0x72},
+#else
+  // character: 'r' == ''
+  {0x72, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 's'
+  {0x73, &calibri_36_0x73},
+#else
+  // character: 's' == ''
+  {0x73, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 't'
+  {0x74, &calibri_36_0x74},
+#else
+  // character: 't' == ''
+  {0x74, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'u'
+  {0x75, &calibri_36_0x75},
+#else
+  // character: 'u' == ''
+  {0x75, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: 'x'
+  {0x78, &calibri_36_0x78},
+#else
+  // character: 'x' == ''
+  {0x78, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '\x00cd'
+  {0xcd, &calibri_36_0xcd},
+#else
+  // character: '\x00cd' == ''
+  {0xcd, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '\x00e1'
+  {0xe1, &calibri_36_0xe1},
+#else
+  // character: '\x00e1' == ''
+  {0xe1, &calibri_36_0x},
+#endif
+
+#if (0x0 == 0x0)
+  // character: '\x00ed'
+  {0xed, &calibri_36_0xed}
+#else
+  // character: '\x00ed' == ''
+  {0xed, &calibri_36_0x}
+#endif
+
+};
+
+
+const tFont calibri_36 = { 46, calibri_36_array, '0', ':' };
+
@@ -0,0 +1,429 @@
+/**
+ * \file
+ *
+ * \brief Touch gesture recognizer on top of the maXTouch touch events.
+ *
+ * Each contact goes through down -> (moves) -> up. The widgets it may talk
+ * to are resolved once, on the press: the captured widget for press, tap,
+ * long press and cancel, and one widget per swipe axis. Later moves only
+ * update the position and the "still" flag, so the work per report is a
+ * few compares; the hit tests run once per press.
+ *
+ * The grid is a bucket list in two arrays: the references of cell c are
+ * g_us_grid[g_us_cell_first[c] .. g_us_cell_first[c + 1] - 1], in
+ * registration order. It is built by counting: one pass counts the
+ * references of each cell, a running sum turns the counts into ends, and
+ * a pass over the widgets from the top fills each cell backwards.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "gesture.h"
+
+/** No widget. */
+#define GESTURE_NONE  (-1)
+
+#define GESTURE_GRID_CELL   (1 << GESTURE_GRID_SHIFT)
+#define GESTURE_GRID_COLS   ((GESTURE_AREA_WIDTH + GESTURE_GRID_CELL - 1) \
+		>> GESTURE_GRID_SHIFT)
+#define GESTURE_GRID_ROWS   ((GESTURE_AREA_HEIGHT + GESTURE_GRID_CELL - 1) \
+		>> GESTURE_GRID_SHIFT)
+#define GESTURE_GRID_CELLS  (GESTURE_GRID_COLS * GESTURE_GRID_ROWS)
+
+#if (GESTURE_MAX_WIDGETS > 0x7FFF) || (GESTURE_GRID_ENTRIES > 0xFFFF)
+#  error "gesture grid indexes are 16-bit"
+#endif
+
+/* Cells a widget overlaps, inclusive */
+struct gesture_span {
+	uint32_t ul_col0, ul_col1;
+	uint32_t ul_row0, ul_row1;
+};
+
+struct gesture_contact {
+	bool b_down;
+	bool b_bounce;          /* press taken as a bounce of the last release */
+	bool b_still;           /* stayed within GESTURE_SLOP of the press */
+	bool b_long_done;       /* long press already reported */
+	bool b_released;        /* x_up, y_up, ul_up_ms are valid */
+	int16_t s_widget;       /* captured widget */
+	int16_t s_swipe_h;      /* widget taking horizontal swipes */
+	int16_t s_swipe_v;      /* widget taking vertical swipes */
+	int16_t x0, y0;         /* press point */
+	int16_t x, y;           /* last reported point */
+	int16_t x_up, y_up;     /* last release point */
+	uint32_t ul_down_ms;
+	uint32_t ul_up_ms;
+};
+
+static const struct gesture_widget *g_p_widgets[GESTURE_MAX_WIDGETS];
+static uint32_t g_ul_widgets;
+static struct gesture_contact g_contacts[GESTURE_MAX_CONTACTS];
+
+static uint16_t g_us_cell_first[GESTURE_GRID_CELLS + 1];
+static uint16_t g_us_grid[GESTURE_GRID_ENTRIES];
+static uint32_t g_ul_grid_entries;   /* references the widgets need */
+static bool g_b_grid_stale;
+
+static bool gesture_inside(const struct gesture_widget *p_widget, int16_t x,
+		int16_t y, int16_t margin)
+{
+	return (x >= p_widget->x1 - margin) && (x <= p_widget->x2 + margin)
+			&& (y >= p_widget->y1 - margin) && (y <= p_widget->y2 + margin);
+}
+
+static bool gesture_near(int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+		int16_t dist)
+{
+	return (abs(x1 - x2) <= dist) && (abs(y1 - y2) <= dist);
+}
+
+/**
+ * \brief Cells overlapped by a widget.
+ *
+ * \return false if the widget lies outside the touch area.
+ */
+static bool gesture_span(const struct gesture_widget *p_widget,
+		struct gesture_span *p_span)
+{
+	if ((p_widget->x2 < 0) || (p_widget->x1 >= GESTURE_AREA_WIDTH)
+			|| (p_widget->y2 < 0) || (p_widget->y1 >= GESTURE_AREA_HEIGHT)
+			|| (p_widget->x2 < p_widget->x1) || (p_widget->y2 < p_widget->y1)) {
+		return false;
+	}
+	p_span->ul_col0 = (uint32_t)Max(p_widget->x1, 0) >> GESTURE_GRID_SHIFT;
+	p_span->ul_col1 = (uint32_t)Min(p_widget->x2, GESTURE_AREA_WIDTH - 1)
+			>> GESTURE_GRID_SHIFT;
+	p_span->ul_row0 = (uint32_t)Max(p_widget->y1, 0) >> GESTURE_GRID_SHIFT;
+	p_span->ul_row1 = (uint32_t)Min(p_widget->y2, GESTURE_AREA_HEIGHT - 1)
+			>> GESTURE_GRID_SHIFT;
+	return true;
+}
+
+/**
+ * \brief Rebuild the grid from the registered widgets.
+ */
+static void gesture_build_grid(void)
+{
+	struct gesture_span span;
+	uint32_t ul_row, ul_col, ul_cell;
+	uint32_t ul_sum = 0;
+	int32_t i;
+
+	memset(g_us_cell_first, 0, sizeof(g_us_cell_first));
+
+	/* References per cell... */
+	for (i = 0; i < (int32_t)g_ul_widgets; i++) {
+		if (!gesture_span(g_p_widgets[i], &span)) {
+			continue;
+		}
+		for (ul_row = span.ul_row0; ul_row <= span.ul_row1; ul_row++) {
+			for (ul_col = span.ul_col0; ul_col <= span.ul_col1; ul_col++) {
+				g_us_cell_first[ul_row * GESTURE_GRID_COLS + ul_col]++;
+			}
+		}
+	}
+
+	/* ...turned into the end of each cell... */
+	for (ul_cell = 0; ul_cell < GESTURE_GRID_CELLS; ul_cell++) {
+		ul_sum += g_us_cell_first[ul_cell];
+		g_us_cell_first[ul_cell] = (uint16_t)ul_sum;
+	}
+	g_us_cell_first[GESTURE_GRID_CELLS] = (uint16_t)ul_sum;
+
+	/* ...and moved back to its start while filling it from the top */
+	for (i = (int32_t)g_ul_widgets - 1; i >= 0; i--) {
+		if (!gesture_span(g_p_widgets[i], &span)) {
+			continue;
+		}
+		for (ul_row = span.ul_row0; ul_row <= span.ul_row1; ul_row++) {
+			for (ul_col = span.ul_col0; ul_col <= span.ul_col1; ul_col++) {
+				ul_cell = ul_row * GESTURE_GRID_COLS + ul_col;
+				g_us_grid[--g_us_cell_first[ul_cell]] = (uint16_t)i;
+			}
+		}
+	}
+	g_b_grid_stale = false;
+}
+
+/**
+ * \brief Topmost (last registered) widget under a point.
+ *
+ * \param us_mask only widgets wanting one of these gestures, 0 for any.
+ */
+static int16_t gesture_hit(int16_t x, int16_t y, uint16_t us_mask)
+{
+	const struct gesture_widget *p_widget;
+	uint32_t ul_cell, ul_first, ul_end;
+
+	if ((x < 0) || (x >= GESTURE_AREA_WIDTH) || (y < 0)
+			|| (y >= GESTURE_AREA_HEIGHT)) {
+		return GESTURE_NONE;
+	}
+	if (g_b_grid_stale) {
+		gesture_build_grid();
+	}
+
+	ul_cell = ((uint32_t)y >> GESTURE_GRID_SHIFT) * GESTURE_GRID_COLS
+			+ ((uint32_t)x >> GESTURE_GRID_SHIFT);
+	ul_first = g_us_cell_first[ul_cell];
+	for (ul_end = g_us_cell_first[ul_cell + 1]; ul_end > ul_first; ul_end--) {
+		p_widget = g_p_widgets[g_us_grid[ul_end - 1]];
+		if ((!us_mask || (p_widget->us_flags & us_mask))
+				&& gesture_inside(p_widget, x, y, 0)) {
+			return (int16_t)g_us_grid[ul_end - 1];
+		}
+	}
+	return GESTURE_NONE;
+}
+
+static void gesture_emit(int16_t s_widget, enum gesture_type type,
+		uint8_t uc_contact, const struct gesture_contact *p_c,
+		uint32_t ul_now_ms)
+{
+	const struct gesture_widget *p_widget;
+	struct gesture_event event;
+
+	if (s_widget == GESTURE_NONE) {
+		return;
+	}
+	p_widget = g_p_widgets[s_widget];
+
+	event.type = type;
+	event.uc_contact = uc_contact;
+	event.x = p_c->x;
+	event.y = p_c->y;
+	event.dx = p_c->x - p_c->x0;
+	event.dy = p_c->y - p_c->y0;
+	event.ul_held_ms = ul_now_ms - p_c->ul_down_ms;
+	p_widget->handler(p_widget, &event);
+}
+
+static bool gesture_wants(int16_t s_widget, uint16_t us_flag)
+{
+	return (s_widget != GESTURE_NONE)
+			&& (g_p_widgets[s_widget]->us_flags & us_flag);
+}
+
+/**
+ * \brief Report the long press of a contact once it is due.
+ */
+static void gesture_check_long(uint8_t uc_contact, struct gesture_contact *p_c,
+		uint32_t ul_now_ms)
+{
+	if (p_c->b_down && !p_c->b_bounce && p_c->b_still && !p_c->b_long_done
+			&& gesture_wants(p_c->s_widget, GESTURE_WANT_LONG_PRESS)
+			&& (ul_now_ms - p_c->ul_down_ms >= GESTURE_LONG_PRESS_MS)) {
+		p_c->b_long_done = true;
+		gesture_emit(p_c->s_widget, GESTURE_LONG_PRESS, uc_contact, p_c,
+				ul_now_ms);
+	}
+}
+
+static void gesture_press(uint8_t uc_contact, struct gesture_contact *p_c,
+		uint32_t ul_now_ms)
+{
+	p_c->b_down = true;
+	p_c->b_still = true;
+	p_c->b_long_done = false;
+	p_c->x0 = p_c->x;
+	p_c->y0 = p_c->y;
+	p_c->ul_down_ms = ul_now_ms;
+
+	p_c->b_bounce = p_c->b_released
+			&& (ul_now_ms - p_c->ul_up_ms < GESTURE_DEBOUNCE_MS)
+			&& gesture_near(p_c->x, p_c->y, p_c->x_up, p_c->y_up, GESTURE_SLOP);
+	if (p_c->b_bounce) {
+		p_c->s_widget = GESTURE_NONE;
+		p_c->s_swipe_h = GESTURE_NONE;
+		p_c->s_swipe_v = GESTURE_NONE;
+		return;
+	}
+
+	p_c->s_widget = gesture_hit(p_c->x, p_c->y, 0);
+	p_c->s_swipe_h = gesture_hit(p_c->x, p_c->y, GESTURE_WANT_SWIPE_H);
+	p_c->s_swipe_v = gesture_hit(p_c->x, p_c->y, GESTURE_WANT_SWIPE_V);
+
+	if (gesture_wants(p_c->s_widget, GESTURE_WANT_PRESS)) {
+		gesture_emit(p_c->s_widget, GESTURE_PRESS, uc_contact, p_c, ul_now_ms);
+	}
+}
+
+static void gesture_release(uint8_t uc_contact, struct gesture_contact *p_c,
+		uint32_t ul_now_ms)
+{
+	int16_t dx = p_c->x - p_c->x0;
+	int16_t dy = p_c->y - p_c->y0;
+	bool b_quick = !p_c->b_long_done
+			&& (ul_now_ms - p_c->ul_down_ms <= GESTURE_SWIPE_MAX_MS);
+	int16_t s_target = GESTURE_NONE;
+	enum gesture_type type = GESTURE_CANCEL;
+
+	p_c->b_down = false;
+	p_c->b_released = true;
+	p_c->x_up = p_c->x;
+	p_c->y_up = p_c->y;
+	p_c->ul_up_ms = ul_now_ms;
+	if (p_c->b_bounce) {
+		return;
+	}
+
+	if (b_quick && (abs(dx) >= GESTURE_SWIPE_MIN) && (abs(dx) > 2 * abs(dy))
+			&& (p_c->s_swipe_h != GESTURE_NONE)) {
+		s_target = p_c->s_swipe_h;
+		type = (dx < 0) ? GESTURE_SWIPE_LEFT : GESTURE_SWIPE_RIGHT;
+	} else if (b_quick && (abs(dy) >= GESTURE_SWIPE_MIN)
+			&& (abs(dy) > 2 * abs(dx)) && (p_c->s_swipe_v != GESTURE_NONE)) {
+		s_target = p_c->s_swipe_v;
+		type = (dy < 0) ? GESTURE_SWIPE_UP : GESTURE_SWIPE_DOWN;
+	} else if (!p_c->b_long_done
+			&& gesture_wants(p_c->s_widget, GESTURE_WANT_TAP)
+			&& gesture_inside(g_p_widgets[p_c->s_widget], p_c->x, p_c->y,
+					GESTURE_HYSTERESIS)) {
+		s_target = p_c->s_widget;
+		type = GESTURE_TAP;
+	}
+
+	if (s_target != GESTURE_NONE) {
+		gesture_emit(s_target, type, uc_contact, p_c, ul_now_ms);
+	}
+
+	/* Close the PRESS the captured widget got, unless it took the gesture */
+	if ((s_target != p_c->s_widget)
+			&& gesture_wants(p_c->s_widget, GESTURE_WANT_PRESS)) {
+		gesture_emit(p_c->s_widget, GESTURE_CANCEL, uc_contact, p_c, ul_now_ms);
+	}
+}
+
+/**
+ * \brief Forget every widget and contact.
+ */
+void gesture_init(void)
+{
+	uint32_t i;
+
+	g_ul_widgets = 0;
+	g_ul_grid_entries = 0;
+	g_b_grid_stale = true;
+	for (i = 0; i < GESTURE_MAX_CONTACTS; i++) {
+		g_contacts[i].b_down = false;
+		g_contacts[i].b_released = false;
+		g_contacts[i].s_widget = GESTURE_NONE;
+	}
+}
+
+/**
+ * \brief Register a widget on top of the ones already registered.
+ *
+ * \return false if GESTURE_MAX_WIDGETS are already registered or the grid
+ * has no room for the cells the widget overlaps.
+ */
+bool gesture_add_widget(const struct gesture_widget *p_widget)
+{
+	struct gesture_span span;
+	uint32_t ul_cells = 0;
+
+	if (gesture_span(p_widget, &span)) {
+		ul_cells = (span.ul_col1 - span.ul_col0 + 1)
+				* (span.ul_row1 - span.ul_row0 + 1);
+	}
+	if ((g_ul_widgets == GESTURE_MAX_WIDGETS)
+			|| (g_ul_grid_entries + ul_cells > GESTURE_GRID_ENTRIES)) {
+		return false;
+	}
+	g_p_widgets[g_ul_widgets++] = p_widget;
+	g_ul_grid_entries += ul_cells;
+	g_b_grid_stale = true;
+	return true;
+}
+
+/**
+ * \brief Topmost widget under a point.
+ *
+ * \param us_mask only widgets wanting one of these GESTURE_WANT_* gestures,
+ * 0 for any.
+ *
+ * \return the widget, or NULL.
+ */
+const struct gesture_widget *gesture_find(int16_t x, int16_t y,
+		uint16_t us_mask)
+{
+	int16_t s_widget = gesture_hit(x, y, us_mask);
+
+	return (s_widget == GESTURE_NONE) ? NULL : g_p_widgets[s_widget];
+}
+
+/**
+ * \brief Feed one touch report.
+ *
+ * \param uc_contact touch ID (mxt_touch_event::id).
+ * \param uc_status T9 status bits (mxt_touch_event::status).
+ * \param x position in LCD pixels.
+ * \param y position in LCD pixels.
+ * \param ul_now_ms time of the report.
+ */
+void gesture_touch(uint8_t uc_contact, uint8_t uc_status, int16_t x, int16_t y,
+		uint32_t ul_now_ms)
+{
+	struct gesture_contact *p_c;
+	bool b_up;
+
+	if (uc_contact >= GESTURE_MAX_CONTACTS) {
+		return;
+	}
+	p_c = &g_contacts[uc_contact];
+	b_up = (uc_status & (GESTURE_T9_RELEASE | GESTURE_T9_SUPPRESS))
+			|| !(uc_status & GESTURE_T9_DETECT);
+
+	if (b_up) {
+		/* A release reported twice closes nothing */
+		if (p_c->b_down) {
+			p_c->x = x;
+			p_c->y = y;
+			gesture_release(uc_contact, p_c, ul_now_ms);
+		}
+		return;
+	}
+
+	p_c->x = x;
+	p_c->y = y;
+	if (!p_c->b_down) {
+		/* A move without its press starts the contact as well */
+		gesture_press(uc_contact, p_c, ul_now_ms);
+		return;
+	}
+
+	/* Moves, and presses reported twice */
+	if (p_c->b_still && !gesture_near(x, y, p_c->x0, p_c->y0, GESTURE_SLOP)) {
+		p_c->b_still = false;
+	}
+	gesture_check_long(uc_contact, p_c, ul_now_ms);
+}
+
+/**
+ * \brief Run the timers: report the long presses that are due.
+ *
+ * A held finger sends no reports, so this has to be called at the returned
+ * time even if no touch event arrives.
+ *
+ * \return time of the next long press, or GESTURE_NO_DEADLINE.
+ */
+uint32_t gesture_poll(uint32_t ul_now_ms)
+{
+	struct gesture_contact *p_c;
+	uint32_t ul_left, ul_min_left = GESTURE_NO_DEADLINE;
+	uint32_t i;
+
+	for (i = 0; i < GESTURE_MAX_CONTACTS; i++) {
+		p_c = &g_contacts[i];
+		gesture_check_long((uint8_t)i, p_c, ul_now_ms);
+
+		if (p_c->b_down && !p_c->b_bounce && p_c->b_still && !p_c->b_long_done
+				&& gesture_wants(p_c->s_widget, GESTURE_WANT_LONG_PRESS)) {
+			ul_left = GESTURE_LONG_PRESS_MS - (ul_now_ms - p_c->ul_down_ms);
+			ul_min_left = Min(ul_min_left, ul_left);
+		}
+	}
+	return (ul_min_left == GESTURE_NO_DEADLINE) ? GESTURE_NO_DEADLINE
+			: ul_now_ms + ul_min_left;
+}
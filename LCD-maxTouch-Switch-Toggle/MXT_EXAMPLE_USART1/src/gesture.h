@@ -0,0 +1,169 @@
+/**
+ * \file
+ *
+ * \brief Touch gesture recognizer on top of the maXTouch touch events.
+ *
+ * Raw T9 reports are turned into taps, long presses and swipes delivered to
+ * rectangular widgets. A contact is captured by the topmost widget under the
+ * point where it went down and every gesture of that contact goes to it,
+ * wherever the finger moves afterwards:
+ *
+ * - Press and release are paired per contact: a second press report while
+ *   down is a move, a release while up is ignored, and a press that comes
+ *   back within GESTURE_DEBOUNCE_MS near the point of the last release is
+ *   a bounce of that release and produces nothing.
+ * - A tap is a release inside the captured widget grown by
+ *   GESTURE_HYSTERESIS pixels, so a press drifting over the edge still
+ *   counts once.
+ * - A long press fires once the contact has stayed within GESTURE_SLOP
+ *   pixels for GESTURE_LONG_PRESS_MS; its release then is not a tap.
+ * - A swipe is a release at least GESTURE_SWIPE_MIN pixels away along one
+ *   axis within GESTURE_SWIPE_MAX_MS. It goes to the topmost widget under
+ *   the press point that accepts swipes in that direction.
+ *
+ * Widgets are found through a grid over the touch area: each cell of
+ * 2^GESTURE_GRID_SHIFT pixels lists the widgets overlapping it, bottom to
+ * top, so a lookup only tests the few widgets of one cell however many are
+ * registered. The grid is rebuilt on the first lookup after a widget is
+ * added.
+ *
+ * State is a fixed table of GESTURE_MAX_WIDGETS widget pointers, the grid
+ * and GESTURE_MAX_CONTACTS contacts; nothing is allocated. Handlers are
+ * called from gesture_touch() and gesture_poll(), in the caller's context.
+ *
+ * Coordinates are LCD pixels, times are milliseconds of a free-running
+ * clock (wrap-around safe).
+ */
+
+#ifndef GESTURE_H_
+#define GESTURE_H_
+
+#include "compiler.h"
+
+/** Widgets that can be registered. */
+#ifndef GESTURE_MAX_WIDGETS
+#  define GESTURE_MAX_WIDGETS    8
+#endif
+
+/** Size of the touch area, in pixels. */
+#ifndef GESTURE_AREA_WIDTH
+#  define GESTURE_AREA_WIDTH     320
+#endif
+#ifndef GESTURE_AREA_HEIGHT
+#  define GESTURE_AREA_HEIGHT    480
+#endif
+
+/** Grid cells are 2^GESTURE_GRID_SHIFT pixels square. */
+#ifndef GESTURE_GRID_SHIFT
+#  define GESTURE_GRID_SHIFT     5
+#endif
+
+/**
+ * Widget references the grid can hold: each widget takes one per cell it
+ * overlaps (a full-screen widget takes all 150 cells of the default grid).
+ */
+#ifndef GESTURE_GRID_ENTRIES
+#  define GESTURE_GRID_ENTRIES   384
+#endif
+
+/** Touch IDs tracked; reports of higher IDs are ignored. */
+#ifndef GESTURE_MAX_CONTACTS
+#  define GESTURE_MAX_CONTACTS   2
+#endif
+
+/** Margin around the captured widget where a release still taps. */
+#ifndef GESTURE_HYSTERESIS
+#  define GESTURE_HYSTERESIS     16
+#endif
+
+/** Movement that still counts as holding still. */
+#ifndef GESTURE_SLOP
+#  define GESTURE_SLOP           12
+#endif
+
+/** Window after a release in which a new press near it is a bounce. */
+#ifndef GESTURE_DEBOUNCE_MS
+#  define GESTURE_DEBOUNCE_MS    60
+#endif
+
+/** Hold time of a long press. */
+#ifndef GESTURE_LONG_PRESS_MS
+#  define GESTURE_LONG_PRESS_MS  800
+#endif
+
+/** Shortest travel of a swipe along its axis. */
+#ifndef GESTURE_SWIPE_MIN
+#  define GESTURE_SWIPE_MIN      80
+#endif
+
+/** Longest duration of a swipe. */
+#ifndef GESTURE_SWIPE_MAX_MS
+#  define GESTURE_SWIPE_MAX_MS   600
+#endif
+
+/** gesture_poll() result when no timer is pending. */
+#define GESTURE_NO_DEADLINE      0xFFFFFFFFUL
+
+/** T9 status bits of struct mxt_touch_event. */
+#define GESTURE_T9_DETECT        0x80
+#define GESTURE_T9_PRESS         0x40
+#define GESTURE_T9_RELEASE       0x20
+#define GESTURE_T9_MOVE          0x10
+#define GESTURE_T9_SUPPRESS      0x02
+
+/** Gestures a widget wants, for struct gesture_widget::us_flags. */
+#define GESTURE_WANT_PRESS       (1u << 0)
+#define GESTURE_WANT_TAP         (1u << 1)
+#define GESTURE_WANT_LONG_PRESS  (1u << 2)
+#define GESTURE_WANT_SWIPE_H     (1u << 3)
+#define GESTURE_WANT_SWIPE_V     (1u << 4)
+
+enum gesture_type {
+	GESTURE_PRESS,         //!< contact captured by the widget
+	GESTURE_TAP,
+	GESTURE_LONG_PRESS,
+	GESTURE_SWIPE_LEFT,
+	GESTURE_SWIPE_RIGHT,
+	GESTURE_SWIPE_UP,
+	GESTURE_SWIPE_DOWN,
+	GESTURE_CANCEL,        //!< released without a gesture
+};
+
+struct gesture_event {
+	enum gesture_type type;
+	uint8_t uc_contact;    //!< touch ID
+	int16_t x;             //!< position of the contact now
+	int16_t y;
+	int16_t dx;            //!< travel since the press
+	int16_t dy;
+	uint32_t ul_held_ms;   //!< time since the press
+};
+
+struct gesture_widget;
+
+typedef void (*gesture_handler_t)(const struct gesture_widget *p_widget,
+		const struct gesture_event *p_event);
+
+/**
+ * A touch target. The structure is owned by the caller and must stay valid
+ * and keep its bounds while it is registered.
+ */
+struct gesture_widget {
+	int16_t x1;            //!< inclusive bounds
+	int16_t y1;
+	int16_t x2;
+	int16_t y2;
+	uint16_t us_flags;     //!< GESTURE_WANT_*
+	gesture_handler_t handler;
+	void *p_arg;           //!< for the handler
+};
+
+void gesture_init(void);
+bool gesture_add_widget(const struct gesture_widget *p_widget);
+const struct gesture_widget *gesture_find(int16_t x, int16_t y,
+		uint16_t us_mask);
+void gesture_touch(uint8_t uc_contact, uint8_t uc_status, int16_t x, int16_t y,
+		uint32_t ul_now_ms);
+uint32_t gesture_poll(uint32_t ul_now_ms);
+
+#endif /* GESTURE_H_ */
@@ -0,0 +1,179 @@
+/**
+ * \file
+ *
+ * \brief Cache of glyphs decoded to RGB565, for the strings redrawn often.
+ *
+ * The slots are searched linearly, there are few of them. A string holds
+ * on to the slots of all its glyphs until it is drawn, so the slots used
+ * since glyph_cache_acquire() are never replaced: a string with more
+ * glyphs than slots gets the rest decoded from flash.
+ */
+
+#include <asf.h>
+#include <string.h>
+#include "glyphcache.h"
+
+static struct glyph_cache_stats g_stats;
+
+#if GLYPH_CACHE_SLOTS
+
+struct glyph_slot {
+	const tImage *p_image;    /* NULL if free */
+	uint32_t ul_color;        /* colors of an anti-aliased glyph, 0 otherwise */
+	uint32_t ul_background;
+	uint32_t ul_last_use;     /* g_ul_clock when last drawn */
+};
+
+static struct glyph_slot g_slots[GLYPH_CACHE_SLOTS];
+static uint16_t g_us_pixels[GLYPH_CACHE_SLOTS][GLYPH_CACHE_SLOT_PIXELS]
+		GLYPH_CACHE_SECTION COMPILER_WORD_ALIGNED;
+static uint32_t g_ul_slots = GLYPH_CACHE_SLOTS;
+static uint32_t g_ul_clock;
+static volatile bool g_b_busy;
+
+#endif
+
+/**
+ * \brief Set how many slots are used, and empty them.
+ *
+ * \param ul_slots up to GLYPH_CACHE_SLOTS, 0 turns the cache off.
+ */
+void glyph_cache_set_slots(uint32_t ul_slots)
+{
+#if GLYPH_CACHE_SLOTS
+	irqflags_t flags = cpu_irq_save();
+
+	g_ul_slots = Min(ul_slots, GLYPH_CACHE_SLOTS);
+	memset(g_slots, 0, sizeof(g_slots));
+	cpu_irq_restore(flags);
+#else
+	UNUSED(ul_slots);
+#endif
+}
+
+/**
+ * \brief Take the cache for the glyphs of a string.
+ *
+ * Text is only drawn from the main loop, but a string drawn while another
+ * one holds the cache, from a nested draw call, does without it.
+ *
+ * \return false if the cache is off or in use, glyph_cache_get() must not
+ * be called then.
+ */
+bool glyph_cache_acquire(void)
+{
+#if GLYPH_CACHE_SLOTS
+	irqflags_t flags = cpu_irq_save();
+	bool b_taken = false;
+
+	if (!g_ul_slots) {
+		/* Off */
+	} else if (g_b_busy) {
+		g_stats.ul_busy++;
+	} else {
+		g_b_busy = true;
+		/* The slots of the string are those used from now on */
+		g_ul_clock++;
+		b_taken = true;
+	}
+	cpu_irq_restore(flags);
+	return b_taken;
+#else
+	return false;
+#endif
+}
+
+/**
+ * \brief Give the cache back once the string is drawn.
+ */
+void glyph_cache_release(void)
+{
+#if GLYPH_CACHE_SLOTS
+	g_b_busy = false;
+#endif
+}
+
+/**
+ * \brief Get the pixels of a glyph, decoding it on a miss.
+ *
+ * \param p_image glyph.
+ * \param ul_color 24-bit color of an anti-aliased glyph.
+ * \param ul_background 24-bit color behind an anti-aliased glyph.
+ *
+ * \return the rows of the glyph one after the other, valid until
+ * glyph_cache_release(); NULL if the glyph does not fit, decode it then.
+ */
+const uint16_t *glyph_cache_get(const tImage *p_image, uint32_t ul_color,
+		uint32_t ul_background)
+{
+#if GLYPH_CACHE_SLOTS
+	struct timage_decoder dec;
+	struct glyph_slot *p_slot = NULL;
+	uint32_t i;
+
+	/* The other formats have their own colors */
+	if (p_image->format != TIMAGE_A4) {
+		ul_color = 0;
+		ul_background = 0;
+	}
+
+	if ((uint32_t)(p_image->width * p_image->height) > GLYPH_CACHE_SLOT_PIXELS) {
+		g_stats.ul_bypassed++;
+		return NULL;
+	}
+
+	for (i = 0; i < g_ul_slots; i++) {
+		if ((g_slots[i].p_image == p_image) && (g_slots[i].ul_color == ul_color)
+				&& (g_slots[i].ul_background == ul_background)) {
+			g_slots[i].ul_last_use = g_ul_clock;
+			g_stats.ul_hits++;
+			return g_us_pixels[i];
+		}
+	}
+
+	/* A free slot, or the least recently used one not in the string */
+	for (i = 0; i < g_ul_slots; i++) {
+		if (!g_slots[i].p_image) {
+			p_slot = &g_slots[i];
+			break;
+		}
+		if ((g_slots[i].ul_last_use != g_ul_clock)
+				&& (!p_slot || (g_slots[i].ul_last_use < p_slot->ul_last_use))) {
+			p_slot = &g_slots[i];
+		}
+	}
+	if (!p_slot) {
+		g_stats.ul_bypassed++;
+		return NULL;
+	}
+
+	g_stats.ul_misses++;
+	if (p_slot->p_image) {
+		g_stats.ul_evictions++;
+	}
+	i = p_slot - g_slots;
+	timage_decoder_init(&dec, p_image);
+	timage_decoder_set_colors(&dec, ul_color, ul_background);
+	timage_decode(&dec, g_us_pixels[i], p_image->width * p_image->height);
+	p_slot->p_image = p_image;
+	p_slot->ul_color = ul_color;
+	p_slot->ul_background = ul_background;
+	p_slot->ul_last_use = g_ul_clock;
+	return g_us_pixels[i];
+#else
+	UNUSED(p_image);
+	UNUSED(ul_color);
+	UNUSED(ul_background);
+	return NULL;
+#endif
+}
+
+void glyph_cache_get_stats(struct glyph_cache_stats *p_stats)
+{
+	*p_stats = g_stats;
+}
+
+void glyph_cache_reset_stats(void)
+{
+	memset(&g_stats, 0, sizeof(g_stats));
+}
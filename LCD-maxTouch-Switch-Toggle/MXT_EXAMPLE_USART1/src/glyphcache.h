@@ -0,0 +1,60 @@
+/**
+ * \file
+ *
+ * \brief Cache of glyphs decoded to RGB565, for the strings redrawn often.
+ *
+ * text.c asks the cache for each glyph it draws. A glyph found there is
+ * copied row by row into the string, the flash data of the font is not read
+ * again; a glyph not found is decoded whole into the least recently used
+ * slot first. The timer redraws the same eleven glyphs every second, so
+ * after its first minute they all come from the cache.
+ *
+ * A slot holds a glyph of up to GLYPH_CACHE_SLOT_PIXELS pixels in the
+ * colors it was drawn with, the key is the glyph image (font and code
+ * point) and, for anti-aliased fonts, the color pair. Bigger glyphs are
+ * decoded from flash as before.
+ *
+ * The slots are in GLYPH_CACHE_SECTION, plain SRAM by default: the ASF
+ * linker script has no DTCM region and board_init() leaves the TCMs off. A
+ * board enabling them (CONF_BOARD_ENABLE_TCM_AT_INIT) with a linker script
+ * that places a .dtcm section can define it as
+ * __attribute__((section(".dtcm"))).
+ */
+
+#ifndef GLYPHCACHE_H_
+#define GLYPHCACHE_H_
+
+#include "compiler.h"
+#include "tfont.h"
+
+/** Glyphs kept; 0 leaves the cache out. */
+#ifndef GLYPH_CACHE_SLOTS
+#  define GLYPH_CACHE_SLOTS 12
+#endif
+
+/** Largest glyph kept, the digits of calibri_36 are 18x37. */
+#ifndef GLYPH_CACHE_SLOT_PIXELS
+#  define GLYPH_CACHE_SLOT_PIXELS 768
+#endif
+
+#ifndef GLYPH_CACHE_SECTION
+#  define GLYPH_CACHE_SECTION
+#endif
+
+struct glyph_cache_stats {
+	uint32_t ul_hits;         //!< glyphs copied from a slot
+	uint32_t ul_misses;       //!< glyphs decoded into a slot
+	uint32_t ul_evictions;    //!< misses that replaced another glyph
+	uint32_t ul_bypassed;     //!< glyphs too big, or no slot left in the string
+	uint32_t ul_busy;         //!< strings drawn while the cache was in use
+};
+
+void glyph_cache_set_slots(uint32_t ul_slots);
+bool glyph_cache_acquire(void);
+void glyph_cache_release(void);
+const uint16_t *glyph_cache_get(const tImage *p_image, uint32_t ul_color,
+		uint32_t ul_background);
+void glyph_cache_get_stats(struct glyph_cache_stats *p_stats);
+void glyph_cache_reset_stats(void);
+
+#endif /* GLYPHCACHE_H_ */
@@ -4,11 +4,11 @@
 * filename: unsaved
 * name: ON
 *
-* preset name: R8G8B8
-* data block size: 8 bit(s), uint8_t
+* preset name: asset_compiler rgb565
+* data block size: 16 bit(s), uint16_t
 * RLE compression enabled: no
 * conversion type: Color, not_used not_used
-* bits per pixel: 24
+* bits per pixel: 16
 *
 * preprocess:
 *  main scan direction: top_to_bottom
@@ -28,72 +28,350 @@
 
 
 
-static const uint8_t image_data_ON[12288] = {
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xfa, 0xfa, 0xf8, 0xff, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xfd, 0xf4, 0xff, 0xfd, 0xf6, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xf1, 0xf3, 0xf2, 0xb8, 0xbd, 0xb9, 0x8f, 0x96, 0x8e, 0x79, 0x83, 0x78, 0x5d, 0x6b, 0x5a, 0x40, 0x51, 0x3e, 0x29, 0x3c, 0x28, 0x11, 0x27, 0x12, 0x11, 0x27, 0x12, 0x29, 0x3c, 0x28, 0x40, 0x51, 0x3e, 0x5d, 0x6b, 0x5a, 0x79, 0x83, 0x78, 0x8f, 0x96, 0x8e, 0xb8, 0xbd, 0xb9, 0xf1, 0xf3, 0xf2, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xf7, 0xff, 0xfd, 0xf4, 0xff, 0xfd, 0xfd, 0xff, 0xfa, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xf8, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xfd, 0xf8, 0xfc, 0xfa, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xef, 0xf5, 0xf5, 0x9b, 0xa2, 0x9a, 0x4d, 0x59, 0x43, 0x11, 0x25, 0x0c, 0x02, 0x16, 0x00, 0x00, 0x16, 0x00, 0x03, 0x1d, 0x02, 0x00, 0x1c, 0x00, 0x00, 0x1d, 0x03, 0x00, 0x20, 0x08, 0x00, 0x1d, 0x04, 0x00, 0x1d, 0x04, 0x00, 0x20, 0x08, 0x00, 0x1d, 0x03, 0x00, 0x1c, 0x00, 0x03, 0x1d, 0x02, 0x00, 0x16, 0x00, 0x02, 0x16, 0x00, 0x11, 0x25, 0x0c, 0x4f, 0x5b, 0x45, 0x9c, 0xa3, 0x9b, 0xee, 0xf4, 0xf4, 0xfb, 0xff, 0xfe, 0xfc, 0xfe, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfb, 0xfc, 0xfc, 0xfd, 0xf8, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xf9, 0xfb, 0xfa, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xfa, 0xfe, 0xfe, 0xfc, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfa, 0xfc, 0xff, 0xfb, 0xfc, 0xff, 0xf6, 0xf2, 0xf9, 0xf1, 0x9a, 0xa4, 0xa3, 0x3a, 0x49, 0x42, 0x03, 0x16, 0x00, 0x02, 0x18, 0x01, 0x0a, 0x20, 0x13, 0x00, 0x1a, 0x00, 0x00, 0x29, 0x03, 0x11, 0x3c, 0x0e, 0x19, 0x49, 0x0d, 0x1b, 0x4f, 0x05, 0x23, 0x5a, 0x06, 0x2c, 0x67, 0x0b, 0x2f, 0x6d, 0x0c, 0x2f, 0x6d, 0x0c, 0x2c, 0x67, 0x0b, 0x23, 0x5a, 0x06, 0x1b, 0x4f, 0x05, 0x19, 0x49, 0x0d, 0x11, 0x3c, 0x0e, 0x00, 0x29, 0x03, 0x00, 0x1a, 0x00, 0x08, 0x1e, 0x11, 0x01, 0x17, 0x00, 0x05, 0x18, 0x02, 0x3d, 0x4c, 0x45, 0x9d, 0xa7, 0xa6, 0xf3, 0xfa, 0xf2, 0xfb, 0xff, 0xf5, 0xf9, 0xfe, 0xf8, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xfd, 0xfa, 0xfa, 0xfa, 0xfe, 0xfe, 0xfc, 0xfd, 0xff, 0xfa, 0xfe, 0xff, 0xfb, 0xf9, 0xfb, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfb, 0xfa, 0xff, 0xfa, 0xa9, 0xb3, 0xaa, 0x24, 0x36, 0x20, 0x05, 0x1f, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x1b, 0x01, 0x02, 0x2e, 0x00, 0x14, 0x48, 0x00, 0x37, 0x7b, 0x02, 0x43, 0x89, 0x0d, 0x4c, 0x92, 0x16, 0x4a, 0x92, 0x14, 0x46, 0x91, 0x10, 0x49, 0x94, 0x13, 0x4a, 0x97, 0x17, 0x4b, 0x98, 0x18, 0x4b, 0x98, 0x18, 0x4a, 0x97, 0x17, 0x49, 0x94, 0x13, 0x46, 0x91, 0x10, 0x4a, 0x92, 0x14, 0x4c, 0x92, 0x16, 0x43, 0x89, 0x0d, 0x37, 0x7b, 0x02, 0x17, 0x4b, 0x00, 0x04, 0x30, 0x00, 0x00, 0x19, 0x00, 0x00, 0x1b, 0x00, 0x02, 0x1c, 0x00, 0x23, 0x35, 0x1f, 0xaa, 0xb4, 0xab, 0xfb, 0xff, 0xfb, 0xfd, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xfb, 0xf7, 0xf4, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfc, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xbb, 0xbf, 0xbe, 0x34, 0x3e, 0x3f, 0x06, 0x17, 0x07, 0x03, 0x1d, 0x00, 0x00, 0x1f, 0x00, 0x1d, 0x4f, 0x10, 0x3c, 0x7d, 0x15, 0x44, 0x8f, 0x0e, 0x4e, 0x9b, 0x19, 0x46, 0x90, 0x1d, 0x4b, 0x96, 0x20, 0x4a, 0x96, 0x1c, 0x46, 0x95, 0x16, 0x47, 0x97, 0x14, 0x46, 0x98, 0x12, 0x44, 0x96, 0x0e, 0x45, 0x97, 0x0f, 0x45, 0x97, 0x0f, 0x44, 0x96, 0x0e, 0x46, 0x98, 0x12, 0x47, 0x97, 0x14, 0x46, 0x95, 0x16, 0x4a, 0x96, 0x1c, 0x4b, 0x96, 0x20, 0x46, 0x90, 0x1d, 0x4b, 0x98, 0x16, 0x43, 0x8e, 0x0d, 0x3e, 0x7f, 0x17, 0x20, 0x52, 0x13, 0x00, 0x23, 0x00, 0x04, 0x1e, 0x01, 0x05, 0x16, 0x06, 0x30, 0x3a, 0x3b, 0xbb, 0xbf, 0xbe, 0xfe, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfb, 0xf7, 0xf4, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfd, 0xf9, 0xf8, 0xff, 0xff, 0xfd, 0xfa, 0xf8, 0xf9, 0xfc, 0xfd, 0xff, 0xe7, 0xed, 0xeb, 0x49, 0x56, 0x4c, 0x05, 0x16, 0x04, 0x01, 0x1b, 0x00, 0x00, 0x22, 0x01, 0x16, 0x43, 0x0a, 0x48, 0x85, 0x1e, 0x4b, 0x94, 0x0f, 0x46, 0x97, 0x0e, 0x44, 0x98, 0x0f, 0x3d, 0x94, 0x09, 0x46, 0x97, 0x0c, 0x47, 0x98, 0x0d, 0x45, 0x96, 0x09, 0x45, 0x96, 0x09, 0x45, 0x98, 0x0a, 0x44, 0x97, 0x0b, 0x43, 0x95, 0x0c, 0x45, 0x97, 0x0e, 0x45, 0x97, 0x0e, 0x43, 0x95, 0x0c, 0x44, 0x97, 0x0b, 0x45, 0x98, 0x0a, 0x45, 0x96, 0x09, 0x45, 0x96, 0x09, 0x47, 0x98, 0x0d, 0x46, 0x97, 0x0c, 0x40, 0x97, 0x0c, 0x45, 0x99, 0x10, 0x45, 0x96, 0x0d, 0x48, 0x91, 0x0c, 0x45, 0x82, 0x1b, 0x15, 0x42, 0x09, 0x01, 0x23, 0x02, 0x04, 0x1e, 0x01, 0x05, 0x16, 0x04, 0x49, 0x56, 0x4c, 0xe7, 0xed, 0xeb, 0xfc, 0xfd, 0xff, 0xfa, 0xf8, 0xf9, 0xff, 0xff, 0xfd, 0xfd, 0xf9, 0xf8, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfb, 0xfb, 0xff, 0xfc, 0xc3, 0xce, 0xc6, 0x17, 0x2a, 0x17, 0x00, 0x1c, 0x00, 0x00, 0x1e, 0x00, 0x10, 0x43, 0x0a, 0x40, 0x7e, 0x19, 0x50, 0x99, 0x0a, 0x45, 0x95, 0x00, 0x4c, 0x9c, 0x15, 0x41, 0x92, 0x12, 0x43, 0x94, 0x14, 0x4b, 0x9c, 0x1c, 0x45, 0x97, 0x0e, 0x45, 0x97, 0x0e, 0x46, 0x97, 0x0e, 0x47, 0x97, 0x10, 0x47, 0x97, 0x12, 0x46, 0x96, 0x13, 0x47, 0x96, 0x16, 0x48, 0x97, 0x18, 0x48, 0x97, 0x18, 0x47, 0x96, 0x16, 0x46, 0x96, 0x13, 0x47, 0x97, 0x12, 0x47, 0x97, 0x10, 0x46, 0x97, 0x0e, 0x45, 0x97, 0x0e, 0x45, 0x97, 0x0e, 0x49, 0x9a, 0x1a, 0x42, 0x93, 0x13, 0x42, 0x93, 0x13, 0x4e, 0x9e, 0x17, 0x46, 0x96, 0x01, 0x51, 0x9a, 0x0b, 0x3f, 0x7d, 0x18, 0x0e, 0x41, 0x08, 0x00, 0x1e, 0x00, 0x00, 0x1c, 0x00, 0x17, 0x2a, 0x17, 0xc3, 0xce, 0xc6, 0xfb, 0xff, 0xfc, 0xfd, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfd, 0xfa, 0xff, 0xfe, 0xa0, 0xab, 0xa5, 0x0e, 0x20, 0x10, 0x00, 0x1b, 0x00, 0x02, 0x2b, 0x00, 0x3f, 0x6e, 0x28, 0x49, 0x9a, 0x0d, 0x41, 0x91, 0x0e, 0x46, 0x96, 0x19, 0x46, 0x99, 0x17, 0x3e, 0x92, 0x09, 0x48, 0x99, 0x10, 0x4a, 0x98, 0x10, 0x46, 0x92, 0x0b, 0x45, 0x96, 0x15, 0x44, 0x95, 0x14, 0x44, 0x95, 0x12, 0x46, 0x96, 0x11, 0x45, 0x95, 0x10, 0x46, 0x96, 0x11, 0x46, 0x96, 0x11, 0x45, 0x95, 0x10, 0x45, 0x95, 0x10, 0x46, 0x96, 0x11, 0x46, 0x96, 0x11, 0x45, 0x95, 0x10, 0x46, 0x96, 0x11, 0x44, 0x95, 0x12, 0x44, 0x95, 0x14, 0x45, 0x96, 0x15, 0x47, 0x93, 0x0c, 0x4b, 0x99, 0x11, 0x48, 0x99, 0x10, 0x3d, 0x91, 0x08, 0x45, 0x98, 0x16, 0x45, 0x95, 0x18, 0x41, 0x91, 0x0e, 0x49, 0x9a, 0x0d, 0x3f, 0x6e, 0x28, 0x02, 0x2b, 0x00, 0x00, 0x1b, 0x00, 0x0e, 0x20, 0x10, 0xa0, 0xab, 0xa5, 0xfa, 0xff, 0xfe, 0xfc, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xfa, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xfc, 0xfa, 0xfe, 0xff, 0xff, 0xfe, 0xfa, 0xfb, 0xfb, 0xff, 0xfb, 0x6f, 0x81, 0x71, 0x00, 0x18, 0x00, 0x05, 0x1d, 0x05, 0x0a, 0x30, 0x00, 0x3f, 0x83, 0x0c, 0x44, 0x9c, 0x12, 0x4b, 0x97, 0x11, 0x44, 0x96, 0x0d, 0x3f, 0x95, 0x0e, 0x4a, 0x9c, 0x16, 0x45, 0x8e, 0x09, 0x4b, 0x94, 0x11, 0x48, 0x97, 0x18, 0x40, 0x96, 0x17, 0x46, 0x9a, 0x11, 0x48, 0x96, 0x1e, 0x49, 0x95, 0x0e, 0x46, 0x90, 0x17, 0x49, 0x96, 0x24, 0x43, 0x96, 0x08, 0x44, 0x96, 0x0e, 0x43, 0x95, 0x0f, 0x43, 0x95, 0x0f, 0x44, 0x96, 0x0e, 0x43, 0x96, 0x08, 0x49, 0x96, 0x24, 0x46, 0x90, 0x17, 0x49, 0x95, 0x0e, 0x48, 0x96, 0x1e, 0x46, 0x9a, 0x11, 0x40, 0x96, 0x17, 0x48, 0x97, 0x18, 0x4b, 0x94, 0x11, 0x45, 0x8e, 0x09, 0x4a, 0x9c, 0x16, 0x3f, 0x95, 0x0e, 0x44, 0x96, 0x0d, 0x4b, 0x97, 0x11, 0x44, 0x9c, 0x12, 0x3f, 0x83, 0x0c, 0x0a, 0x30, 0x00, 0x05, 0x1d, 0x05, 0x00, 0x18, 0x00, 0x6f, 0x81, 0x71, 0xfb, 0xff, 0xfb, 0xfe, 0xfa, 0xfb, 0xfe, 0xff, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfe, 0xfd, 0xff, 0xfe, 0xff, 0xfa, 0xfb, 0xff, 0xfb, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 
-    0xfd, 0xfc, 0xf8, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfd, 0xf9, 0xf8, 0xff, 0xff, 0xfd, 0xf8, 0xfa, 0xf9, 0xfb, 0xff, 0xfb, 0x4d, 0x59, 0x4f, 0x04, 0x1a, 0x03, 0x00, 0x1c, 0x04, 0x1d, 0x4c, 0x06, 0x4c, 0x8d, 0x15, 0x4a, 0x93, 0x1e, 0x45, 0x97, 0x11, 0x3e, 0x92, 0x16, 0x45, 0x96, 0x16, 0x4a, 0x98, 0x0e, 0x49, 0x96, 0x0c, 0x4c, 0x99, 0x19, 0x49, 0x98, 0x18, 0x3f, 0x92, 0x02, 0x49, 0x9e, 0x05, 0x45, 0x97, 0x04, 0x4b, 0x93, 0x16, 0x40, 0x82, 0x07, 0x2b, 0x64, 0x03, 0x24, 0x5a, 0x06, 0x1e, 0x52, 0x00, 0x16, 0x41, 0x09, 0x11, 0x37, 0x08, 0x11, 0x37, 0x08, 0x16, 0x41, 0x09, 0x1e, 0x52, 0x00, 0x24, 0x5a, 0x06, 0x2b, 0x64, 0x03, 0x40, 0x82, 0x07, 0x4b, 0x93, 0x16, 0x45, 0x97, 0x04, 0x49, 0x9e, 0x05, 0x3f, 0x92, 0x02, 0x49, 0x98, 0x18, 0x4c, 0x99, 0x19, 0x49, 0x96, 0x0c, 0x4a, 0x98, 0x0e, 0x45, 0x96, 0x16, 0x3e, 0x92, 0x16, 0x45, 0x97, 0x11, 0x4a, 0x93, 0x1e, 0x4c, 0x8d, 0x15, 0x1d, 0x4c, 0x06, 0x00, 0x1c, 0x04, 0x04, 0x1a, 0x03, 0x4d, 0x59, 0x4f, 0xfb, 0xff, 0xfb, 0xf8, 0xfa, 0xf9, 0xff, 0xff, 0xfd, 0xfd, 0xf9, 0xf8, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfd, 0xfc, 0xf8, 
-    0xff, 0xff, 0xfb, 0xf8, 0xfa, 0xf5, 0xfe, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xfc, 0xf8, 0xf5, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xfe, 0xfb, 0xff, 0xff, 0x6e, 0x80, 0x70, 0x04, 0x1a, 0x03, 0x01, 0x1e, 0x0a, 0x21, 0x56, 0x06, 0x43, 0x91, 0x0a, 0x43, 0x96, 0x14, 0x49, 0x9b, 0x15, 0x43, 0x91, 0x0a, 0x45, 0x9b, 0x12, 0x47, 0x96, 0x16, 0x49, 0x93, 0x18, 0x42, 0x91, 0x11, 0x43, 0x9a, 0x0f, 0x40, 0x94, 0x0a, 0x4e, 0x96, 0x19, 0x3f, 0x79, 0x0b, 0x27, 0x5c, 0x0c, 0x0b, 0x38, 0x01, 0x01, 0x26, 0x00, 0x04, 0x22, 0x0a, 0x00, 0x1b, 0x00, 0x00, 0x1d, 0x00, 0x01, 0x18, 0x04, 0x01, 0x15, 0x00, 0x01, 0x15, 0x00, 0x01, 0x18, 0x04, 0x00, 0x1d, 0x00, 0x00, 0x1b, 0x00, 0x04, 0x22, 0x0a, 0x01, 0x26, 0x00, 0x0b, 0x38, 0x01, 0x27, 0x5c, 0x0c, 0x3f, 0x79, 0x0b, 0x4e, 0x96, 0x19, 0x40, 0x94, 0x0a, 0x43, 0x9a, 0x0f, 0x42, 0x91, 0x11, 0x49, 0x93, 0x18, 0x47, 0x96, 0x16, 0x45, 0x9b, 0x12, 0x43, 0x91, 0x0a, 0x49, 0x9b, 0x15, 0x43, 0x96, 0x14, 0x43, 0x91, 0x0a, 0x21, 0x56, 0x06, 0x01, 0x1e, 0x0a, 0x04, 0x1a, 0x03, 0x6e, 0x80, 0x70, 0xfb, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfc, 0xf8, 0xf5, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xfb, 0xf8, 0xfa, 0xf5, 0xff, 0xff, 0xfb, 
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfc, 0xfe, 0xf9, 0xfd, 0xfe, 0xf9, 0xff, 0xff, 0xfd, 0xfe, 0xfc, 0xfd, 0xfb, 0xff, 0xfe, 0x9c, 0xa7, 0xa3, 0x00, 0x18, 0x00, 0x00, 0x1e, 0x06, 0x25, 0x5a, 0x0a, 0x4b, 0x97, 0x11, 0x43, 0x9a, 0x0b, 0x41, 0x99, 0x0f, 0x46, 0x97, 0x14, 0x4c, 0x9a, 0x10, 0x45, 0x93, 0x09, 0x47, 0x98, 0x0f, 0x43, 0x94, 0x14, 0x49, 0x9b, 0x1b, 0x42, 0x96, 0x0c, 0x42, 0x88, 0x18, 0x12, 0x3d, 0x07, 0x08, 0x20, 0x0a, 0x00, 0x19, 0x00, 0x02, 0x1a, 0x00, 0x00, 0x17, 0x00, 0x01, 0x20, 0x00, 0x13, 0x3b, 0x06, 0x23, 0x51, 0x10, 0x2f, 0x5c, 0x19, 0x45, 0x72, 0x1d, 0x45, 0x72, 0x1d, 0x2f, 0x5c, 0x19, 0x23, 0x51, 0x10, 0x13, 0x3b, 0x06, 0x01, 0x20, 0x00, 0x00, 0x17, 0x00, 0x02, 0x1a, 0x00, 0x00, 0x19, 0x00, 0x08, 0x20, 0x0a, 0x12, 0x3d, 0x07, 0x42, 0x88, 0x18, 0x42, 0x96, 0x0c, 0x49, 0x9b, 0x1b, 0x43, 0x94, 0x14, 0x47, 0x98, 0x0f, 0x45, 0x93, 0x09, 0x4c, 0x9a, 0x10, 0x46, 0x97, 0x14, 0x41, 0x99, 0x0f, 0x43, 0x9a, 0x0b, 0x4b, 0x97, 0x11, 0x25, 0x5a, 0x0a, 0x00, 0x1e, 0x06, 0x00, 0x18, 0x00, 0x9c, 0xa7, 0xa3, 0xfb, 0xff, 0xfe, 0xfe, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xf9, 0xfc, 0xfe, 0xf9, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfa, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xc3, 0xce, 0xc8, 0x11, 0x23, 0x15, 0x02, 0x1a, 0x02, 0x1c, 0x4b, 0x05, 0x45, 0x93, 0x0c, 0x40, 0x97, 0x08, 0x46, 0x99, 0x17, 0x42, 0x91, 0x04, 0x49, 0x97, 0x0d, 0x41, 0x8f, 0x17, 0x47, 0x97, 0x14, 0x46, 0x97, 0x17, 0x41, 0x92, 0x05, 0x41, 0x87, 0x0a, 0x19, 0x49, 0x0b, 0x00, 0x1e, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x14, 0x06, 0x0b, 0x2c, 0x0d, 0x31, 0x5a, 0x18, 0x66, 0x97, 0x2a, 0x85, 0xc5, 0x30, 0x83, 0xcf, 0x24, 0x7b, 0xcd, 0x20, 0x7e, 0xd0, 0x23, 0x7c, 0xcb, 0x20, 0x7c, 0xcb, 0x20, 0x7e, 0xd0, 0x23, 0x7b, 0xcd, 0x20, 0x83, 0xcf, 0x24, 0x85, 0xc5, 0x30, 0x66, 0x97, 0x2a, 0x31, 0x5a, 0x18, 0x0b, 0x2c, 0x0d, 0x00, 0x14, 0x06, 0x00, 0x1c, 0x00, 0x00, 0x1e, 0x00, 0x19, 0x49, 0x0b, 0x41, 0x87, 0x0a, 0x41, 0x92, 0x05, 0x46, 0x97, 0x17, 0x47, 0x97, 0x14, 0x41, 0x8f, 0x17, 0x49, 0x97, 0x0d, 0x42, 0x91, 0x04, 0x46, 0x99, 0x17, 0x40, 0x97, 0x08, 0x45, 0x93, 0x0c, 0x1c, 0x4b, 0x05, 0x02, 0x1a, 0x02, 0x11, 0x23, 0x15, 0xc3, 0xce, 0xc8, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xfc, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 
-    0xfc, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfe, 0xf9, 0xf8, 0xfd, 0xe9, 0xef, 0xed, 0x18, 0x2b, 0x18, 0x00, 0x18, 0x00, 0x0c, 0x32, 0x00, 0x49, 0x8a, 0x12, 0x44, 0x97, 0x15, 0x41, 0x99, 0x0f, 0x48, 0x97, 0x0a, 0x4e, 0x95, 0x15, 0x4c, 0x98, 0x14, 0x49, 0x98, 0x21, 0x40, 0x92, 0x12, 0x4b, 0x9c, 0x0f, 0x32, 0x6e, 0x14, 0x00, 0x21, 0x04, 0x05, 0x16, 0x06, 0x03, 0x15, 0x05, 0x14, 0x3c, 0x08, 0x4d, 0x92, 0x15, 0x7b, 0xca, 0x23, 0x84, 0xd4, 0x27, 0x7d, 0xcc, 0x21, 0x7a, 0xcd, 0x23, 0x7e, 0xd2, 0x36, 0x75, 0xca, 0x24, 0x82, 0xd6, 0x1c, 0x7f, 0xca, 0x29, 0x7f, 0xca, 0x29, 0x82, 0xd6, 0x1c, 0x75, 0xca, 0x24, 0x7e, 0xd2, 0x36, 0x7a, 0xcd, 0x23, 0x7d, 0xcc, 0x21, 0x84, 0xd4, 0x27, 0x7b, 0xca, 0x23, 0x4d, 0x92, 0x15, 0x14, 0x3c, 0x08, 0x03, 0x15, 0x05, 0x05, 0x16, 0x06, 0x00, 0x21, 0x04, 0x32, 0x6e, 0x14, 0x4b, 0x9c, 0x0f, 0x40, 0x92, 0x12, 0x49, 0x98, 0x21, 0x4c, 0x98, 0x14, 0x4e, 0x95, 0x15, 0x48, 0x97, 0x0a, 0x41, 0x99, 0x0f, 0x44, 0x97, 0x15, 0x49, 0x8a, 0x12, 0x0c, 0x32, 0x00, 0x00, 0x18, 0x00, 0x18, 0x2b, 0x18, 0xe9, 0xef, 0xed, 0xf9, 0xf8, 0xfd, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xfb, 0xff, 
-    0xff, 0xfe, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x45, 0x52, 0x48, 0x00, 0x19, 0x00, 0x06, 0x2f, 0x00, 0x44, 0x88, 0x11, 0x46, 0x8f, 0x1a, 0x49, 0x9b, 0x15, 0x43, 0x94, 0x11, 0x4c, 0x9a, 0x10, 0x49, 0x95, 0x11, 0x47, 0x91, 0x22, 0x42, 0x93, 0x06, 0x4c, 0x93, 0x11, 0x22, 0x57, 0x11, 0x00, 0x20, 0x00, 0x02, 0x1e, 0x05, 0x0a, 0x24, 0x07, 0x4b, 0x79, 0x1f, 0x7c, 0xc3, 0x27, 0x7d, 0xd3, 0x2a, 0x79, 0xd2, 0x2c, 0x7a, 0xd1, 0x2a, 0x79, 0xcf, 0x24, 0x75, 0xcc, 0x1d, 0x7a, 0xcd, 0x35, 0x82, 0xcf, 0x31, 0x7e, 0xc3, 0x2a, 0x1f, 0x50, 0x0e, 0x1f, 0x50, 0x0e, 0x7e, 0xc3, 0x2a, 0x82, 0xcf, 0x31, 0x7a, 0xcd, 0x35, 0x75, 0xcc, 0x1d, 0x79, 0xcf, 0x24, 0x7a, 0xd1, 0x2a, 0x79, 0xd2, 0x2c, 0x7d, 0xd3, 0x2a, 0x7c, 0xc3, 0x27, 0x4b, 0x79, 0x1f, 0x0a, 0x24, 0x07, 0x02, 0x1e, 0x05, 0x00, 0x20, 0x00, 0x22, 0x57, 0x11, 0x4c, 0x93, 0x11, 0x42, 0x93, 0x06, 0x47, 0x91, 0x22, 0x49, 0x95, 0x11, 0x4c, 0x9a, 0x10, 0x43, 0x94, 0x11, 0x49, 0x9b, 0x15, 0x46, 0x8f, 0x1a, 0x44, 0x88, 0x11, 0x06, 0x2f, 0x00, 0x00, 0x19, 0x00, 0x45, 0x52, 0x48, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xff, 
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xf9, 0xfe, 0xfe, 0xfe, 0xb7, 0xbb, 0xba, 0x0a, 0x1b, 0x09, 0x00, 0x1c, 0x00, 0x40, 0x6f, 0x27, 0x40, 0x98, 0x0e, 0x45, 0x96, 0x13, 0x49, 0x97, 0x10, 0x49, 0x97, 0x0d, 0x42, 0x90, 0x18, 0x46, 0x95, 0x1e, 0x46, 0x97, 0x0a, 0x48, 0x97, 0x08, 0x1b, 0x42, 0x0d, 0x00, 0x1f, 0x00, 0x00, 0x1a, 0x03, 0x16, 0x40, 0x01, 0x76, 0xbb, 0x2d, 0x7d, 0xd2, 0x1c, 0x7e, 0xd2, 0x24, 0x7e, 0xcb, 0x2d, 0x7d, 0xce, 0x2b, 0x7d, 0xca, 0x2e, 0x80, 0xce, 0x2a, 0x7f, 0xd2, 0x22, 0x83, 0xd0, 0x34, 0x7e, 0xca, 0x20, 0x75, 0xb6, 0x1e, 0x00, 0x1e, 0x08, 0x00, 0x1e, 0x08, 0x75, 0xb6, 0x1e, 0x7e, 0xca, 0x20, 0x83, 0xd0, 0x34, 0x7f, 0xd2, 0x22, 0x80, 0xce, 0x2a, 0x7d, 0xca, 0x2e, 0x7d, 0xce, 0x2b, 0x7e, 0xcb, 0x2d, 0x7e, 0xd2, 0x24, 0x7d, 0xd2, 0x1c, 0x76, 0xbb, 0x2d, 0x16, 0x40, 0x01, 0x00, 0x1a, 0x03, 0x00, 0x1f, 0x00, 0x1b, 0x42, 0x0d, 0x48, 0x97, 0x08, 0x46, 0x97, 0x0a, 0x46, 0x95, 0x1e, 0x42, 0x90, 0x18, 0x49, 0x97, 0x0d, 0x49, 0x97, 0x10, 0x45, 0x96, 0x13, 0x40, 0x98, 0x0e, 0x40, 0x6f, 0x27, 0x00, 0x1c, 0x00, 0x0a, 0x1b, 0x09, 0xb7, 0xbb, 0xba, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xf9, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xfc, 0xff, 0xfb, 0xfe, 0xf3, 0x35, 0x44, 0x3d, 0x00, 0x1d, 0x0b, 0x09, 0x41, 0x00, 0x51, 0x9a, 0x15, 0x4b, 0x97, 0x11, 0x3f, 0x93, 0x17, 0x42, 0x98, 0x0f, 0x48, 0x96, 0x0c, 0x42, 0x92, 0x0f, 0x45, 0x97, 0x17, 0x4b, 0x92, 0x10, 0x1b, 0x42, 0x0d, 0x04, 0x17, 0x01, 0x00, 0x1a, 0x00, 0x31, 0x68, 0x0d, 0x78, 0xc4, 0x23, 0x83, 0xd4, 0x2d, 0x7c, 0xcf, 0x25, 0x7b, 0xce, 0x28, 0x7a, 0xce, 0x2e, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7b, 0xcd, 0x2b, 0x82, 0xce, 0x26, 0x7b, 0xce, 0x28, 0x6e, 0xb7, 0x28, 0x01, 0x1b, 0x00, 0x01, 0x1b, 0x00, 0x6e, 0xb7, 0x28, 0x7b, 0xce, 0x28, 0x82, 0xce, 0x26, 0x7b, 0xcd, 0x2b, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7d, 0xce, 0x2b, 0x83, 0xd1, 0x2d, 0x7d, 0xcc, 0x21, 0x7b, 0xcb, 0x1e, 0x81, 0xcd, 0x2f, 0x27, 0x5d, 0x12, 0x00, 0x20, 0x0a, 0x00, 0x1a, 0x03, 0x1b, 0x42, 0x0d, 0x4b, 0x92, 0x10, 0x45, 0x97, 0x17, 0x42, 0x92, 0x0f, 0x48, 0x96, 0x0c, 0x42, 0x98, 0x0f, 0x3f, 0x93, 0x17, 0x4b, 0x97, 0x11, 0x51, 0x9a, 0x15, 0x09, 0x41, 0x00, 0x00, 0x1d, 0x0b, 0x35, 0x44, 0x3d, 0xfb, 0xfe, 0xf3, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xfd, 0xff, 
-    0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf8, 0xab, 0xb2, 0xaa, 0x02, 0x17, 0x04, 0x00, 0x1e, 0x00, 0x41, 0x80, 0x18, 0x44, 0x8f, 0x0e, 0x42, 0x94, 0x0b, 0x44, 0x95, 0x15, 0x48, 0x97, 0x17, 0x49, 0x9a, 0x11, 0x47, 0x98, 0x18, 0x49, 0x9a, 0x0d, 0x23, 0x58, 0x12, 0x00, 0x20, 0x00, 0x01, 0x1e, 0x0c, 0x42, 0x75, 0x18, 0x7e, 0xc6, 0x26, 0x7f, 0xce, 0x37, 0x74, 0xc7, 0x1f, 0x79, 0xc9, 0x2a, 0x82, 0xd4, 0x2a, 0x7e, 0xcf, 0x2c, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7b, 0xcd, 0x2b, 0x82, 0xce, 0x26, 0x7b, 0xce, 0x28, 0x6e, 0xb7, 0x28, 0x01, 0x1b, 0x00, 0x01, 0x1b, 0x00, 0x6e, 0xb7, 0x28, 0x7b, 0xce, 0x28, 0x82, 0xce, 0x26, 0x7b, 0xcd, 0x2b, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7b, 0xcb, 0x36, 0x79, 0xcb, 0x1f, 0x80, 0xd2, 0x26, 0x81, 0xd4, 0x24, 0x7c, 0xca, 0x29, 0x82, 0xcc, 0x1d, 0x44, 0x79, 0x0f, 0x00, 0x1b, 0x09, 0x00, 0x20, 0x00, 0x23, 0x58, 0x12, 0x49, 0x9a, 0x0d, 0x47, 0x98, 0x18, 0x49, 0x9a, 0x11, 0x48, 0x97, 0x17, 0x44, 0x95, 0x15, 0x42, 0x94, 0x0b, 0x44, 0x8f, 0x0e, 0x41, 0x80, 0x18, 0x00, 0x1e, 0x00, 0x02, 0x17, 0x04, 0xab, 0xb2, 0xaa, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 
-    0xff, 0xff, 0xf2, 0xfe, 0xfb, 0xff, 0xf3, 0xfa, 0xe8, 0x24, 0x32, 0x21, 0x03, 0x1f, 0x06, 0x13, 0x45, 0x00, 0x54, 0x9b, 0x17, 0x44, 0x93, 0x13, 0x44, 0x9a, 0x11, 0x4a, 0x98, 0x0e, 0x49, 0x93, 0x18, 0x3d, 0x8e, 0x0e, 0x46, 0x98, 0x08, 0x2f, 0x6b, 0x11, 0x00, 0x20, 0x00, 0x00, 0x18, 0x01, 0x29, 0x5e, 0x10, 0x86, 0xce, 0x3a, 0x81, 0xd2, 0x2d, 0x77, 0xcd, 0x24, 0x82, 0xd3, 0x36, 0x83, 0xd3, 0x22, 0x7e, 0xcc, 0x28, 0x7b, 0xcb, 0x1c, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7b, 0xcd, 0x2b, 0x82, 0xce, 0x26, 0x7b, 0xce, 0x28, 0x6e, 0xb7, 0x28, 0x01, 0x1b, 0x00, 0x01, 0x1b, 0x00, 0x6e, 0xb7, 0x28, 0x7b, 0xce, 0x28, 0x82, 0xce, 0x26, 0x7b, 0xcd, 0x2b, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7b, 0xcf, 0x21, 0x7d, 0xd0, 0x2a, 0x7a, 0xcc, 0x22, 0x7d, 0xcc, 0x3f, 0x7b, 0xcc, 0x2f, 0x81, 0xd0, 0x25, 0x81, 0xc7, 0x29, 0x2c, 0x60, 0x0d, 0x00, 0x18, 0x01, 0x00, 0x20, 0x00, 0x2f, 0x6b, 0x11, 0x46, 0x98, 0x08, 0x3d, 0x8e, 0x0e, 0x49, 0x93, 0x18, 0x4a, 0x98, 0x0e, 0x44, 0x9a, 0x11, 0x44, 0x93, 0x13, 0x54, 0x9b, 0x17, 0x13, 0x45, 0x00, 0x03, 0x1f, 0x06, 0x24, 0x32, 0x21, 0xf3, 0xfa, 0xe8, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xf2, 
-    0xff, 0xff, 0xf2, 0xfe, 0xfe, 0xff, 0x97, 0xa3, 0x97, 0x00, 0x19, 0x00, 0x00, 0x24, 0x03, 0x4b, 0x8a, 0x18, 0x44, 0x92, 0x08, 0x45, 0x98, 0x12, 0x44, 0x96, 0x10, 0x46, 0x93, 0x09, 0x47, 0x96, 0x17, 0x47, 0x99, 0x19, 0x46, 0x8c, 0x0f, 0x00, 0x1e, 0x01, 0x04, 0x20, 0x07, 0x1a, 0x44, 0x05, 0x7c, 0xc8, 0x1e, 0x7b, 0xca, 0x21, 0x79, 0xd0, 0x21, 0x76, 0xcd, 0x28, 0x7e, 0xd1, 0x2b, 0x78, 0xc9, 0x26, 0x7d, 0xcc, 0x23, 0x81, 0xd1, 0x32, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7b, 0xcd, 0x2b, 0x82, 0xce, 0x26, 0x7b, 0xce, 0x28, 0x6e, 0xb7, 0x28, 0x01, 0x1b, 0x00, 0x01, 0x1b, 0x00, 0x6e, 0xb7, 0x28, 0x7b, 0xce, 0x28, 0x82, 0xce, 0x26, 0x7b, 0xcd, 0x2b, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7d, 0xd0, 0x2a, 0x7f, 0xcf, 0x2e, 0x7e, 0xcd, 0x36, 0x7a, 0xcc, 0x29, 0x76, 0xcb, 0x25, 0x7c, 0xcf, 0x27, 0x84, 0xd1, 0x35, 0x7f, 0xc6, 0x28, 0x1a, 0x44, 0x05, 0x04, 0x20, 0x07, 0x00, 0x1e, 0x01, 0x46, 0x8c, 0x0f, 0x47, 0x99, 0x19, 0x47, 0x96, 0x17, 0x46, 0x93, 0x09, 0x44, 0x96, 0x10, 0x45, 0x98, 0x12, 0x44, 0x92, 0x08, 0x4b, 0x8a, 0x18, 0x00, 0x24, 0x03, 0x00, 0x19, 0x00, 0x97, 0xa3, 0x97, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xf2, 
-    0xfd, 0xfc, 0xf8, 0xfc, 0xff, 0xff, 0x3e, 0x4e, 0x44, 0x00, 0x1b, 0x00, 0x1f, 0x51, 0x12, 0x48, 0x90, 0x08, 0x47, 0x97, 0x12, 0x42, 0x96, 0x0d, 0x49, 0x95, 0x0f, 0x4e, 0x9a, 0x1c, 0x44, 0x9b, 0x10, 0x3d, 0x91, 0x07, 0x1b, 0x4b, 0x0d, 0x04, 0x15, 0x05, 0x0b, 0x25, 0x08, 0x72, 0xb7, 0x29, 0x81, 0xcc, 0x29, 0x85, 0xd3, 0x2f, 0x79, 0xcc, 0x24, 0x7f, 0xd1, 0x2f, 0x7e, 0xd0, 0x24, 0x81, 0xcf, 0x2b, 0x7c, 0xcd, 0x26, 0x78, 0xcb, 0x25, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7b, 0xcd, 0x2b, 0x82, 0xce, 0x26, 0x7b, 0xce, 0x28, 0x6e, 0xb7, 0x28, 0x01, 0x1b, 0x00, 0x01, 0x1b, 0x00, 0x6e, 0xb7, 0x28, 0x7b, 0xce, 0x28, 0x82, 0xce, 0x26, 0x7b, 0xcd, 0x2b, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7e, 0xce, 0x1d, 0x7b, 0xc8, 0x20, 0x86, 0xd3, 0x2f, 0x7f, 0xd2, 0x1e, 0x7a, 0xd1, 0x22, 0x7e, 0xd4, 0x27, 0x77, 0xc9, 0x26, 0x7c, 0xca, 0x28, 0x72, 0xb7, 0x29, 0x0b, 0x25, 0x08, 0x04, 0x15, 0x05, 0x1b, 0x4b, 0x0d, 0x3d, 0x91, 0x07, 0x44, 0x9b, 0x10, 0x4e, 0x9a, 0x1c, 0x49, 0x95, 0x0f, 0x42, 0x96, 0x0d, 0x47, 0x97, 0x12, 0x48, 0x90, 0x08, 0x1f, 0x51, 0x12, 0x00, 0x1b, 0x00, 0x3e, 0x4e, 0x44, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xf8, 
-    0xfe, 0xfc, 0xff, 0xeb, 0xf1, 0xed, 0x06, 0x1d, 0x09, 0x00, 0x1c, 0x00, 0x3f, 0x7e, 0x15, 0x44, 0x91, 0x0d, 0x41, 0x92, 0x0f, 0x47, 0x9b, 0x12, 0x47, 0x90, 0x0d, 0x45, 0x94, 0x14, 0x44, 0x98, 0x0e, 0x44, 0x8a, 0x1a, 0x00, 0x1c, 0x00, 0x02, 0x14, 0x04, 0x4f, 0x7d, 0x23, 0x7c, 0xd1, 0x1b, 0x82, 0xcc, 0x37, 0x79, 0xc7, 0x26, 0x7f, 0xcc, 0x42, 0x7c, 0xcb, 0x20, 0x81, 0xce, 0x1c, 0x7c, 0xc2, 0x2e, 0x5a, 0x9d, 0x33, 0x83, 0xd0, 0x32, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7b, 0xcd, 0x2b, 0x82, 0xce, 0x26, 0x7b, 0xce, 0x28, 0x6e, 0xb7, 0x28, 0x01, 0x1b, 0x00, 0x01, 0x1b, 0x00, 0x6e, 0xb7, 0x28, 0x7b, 0xce, 0x28, 0x82, 0xce, 0x26, 0x7b, 0xcd, 0x2b, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x74, 0xb7, 0x29, 0x44, 0x81, 0x1a, 0x75, 0xb9, 0x26, 0x83, 0xcf, 0x25, 0x7a, 0xcb, 0x28, 0x7d, 0xcf, 0x3f, 0x79, 0xcd, 0x1f, 0x82, 0xd3, 0x30, 0x7c, 0xd1, 0x1b, 0x4f, 0x7d, 0x23, 0x02, 0x14, 0x04, 0x00, 0x1c, 0x00, 0x44, 0x8a, 0x1a, 0x44, 0x98, 0x0e, 0x45, 0x94, 0x14, 0x47, 0x90, 0x0d, 0x47, 0x9b, 0x12, 0x41, 0x92, 0x0f, 0x44, 0x91, 0x0d, 0x3f, 0x7e, 0x15, 0x00, 0x1c, 0x00, 0x06, 0x1d, 0x09, 0xeb, 0xf1, 0xed, 0xfe, 0xfc, 0xff, 
-    0xff, 0xfe, 0xff, 0x98, 0xa3, 0x95, 0x00, 0x18, 0x03, 0x02, 0x31, 0x00, 0x47, 0x8e, 0x0c, 0x48, 0x98, 0x15, 0x46, 0x97, 0x14, 0x45, 0x97, 0x0f, 0x4b, 0x9a, 0x1b, 0x3d, 0x90, 0x00, 0x4f, 0x97, 0x1a, 0x0f, 0x3a, 0x04, 0x00, 0x1c, 0x00, 0x13, 0x3b, 0x07, 0x7e, 0xc5, 0x29, 0x7b, 0xcf, 0x21, 0x7f, 0xd3, 0x1d, 0x7c, 0xce, 0x22, 0x83, 0xd1, 0x2f, 0x7e, 0xc8, 0x2d, 0x78, 0xb9, 0x1d, 0x0a, 0x39, 0x03, 0x00, 0x1d, 0x00, 0x5c, 0x9a, 0x1f, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7b, 0xcd, 0x2b, 0x82, 0xce, 0x26, 0x7b, 0xce, 0x28, 0x6e, 0xb7, 0x28, 0x01, 0x1b, 0x00, 0x01, 0x1b, 0x00, 0x6e, 0xb7, 0x28, 0x7b, 0xce, 0x28, 0x82, 0xce, 0x26, 0x7b, 0xcd, 0x2b, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x37, 0x6a, 0x1f, 0x00, 0x24, 0x0c, 0x1d, 0x4a, 0x0f, 0x7f, 0xc3, 0x1e, 0x87, 0xd1, 0x36, 0x7a, 0xca, 0x29, 0x79, 0xcc, 0x22, 0x79, 0xcc, 0x1c, 0x7b, 0xcf, 0x21, 0x7e, 0xc5, 0x29, 0x13, 0x3b, 0x07, 0x00, 0x1c, 0x00, 0x0f, 0x3a, 0x04, 0x4f, 0x97, 0x1a, 0x3d, 0x90, 0x00, 0x4b, 0x9a, 0x1b, 0x45, 0x97, 0x0f, 0x46, 0x97, 0x14, 0x48, 0x98, 0x15, 0x47, 0x8e, 0x0c, 0x02, 0x31, 0x00, 0x00, 0x18, 0x03, 0x98, 0xa3, 0x95, 0xff, 0xfe, 0xff, 
-    0xfd, 0xfb, 0xff, 0x52, 0x5e, 0x48, 0x01, 0x1c, 0x0d, 0x15, 0x4a, 0x00, 0x4e, 0x96, 0x16, 0x44, 0x94, 0x0d, 0x47, 0x98, 0x17, 0x44, 0x95, 0x0c, 0x40, 0x96, 0x17, 0x49, 0x9e, 0x05, 0x43, 0x7d, 0x0f, 0x03, 0x1b, 0x05, 0x00, 0x1c, 0x0e, 0x49, 0x8e, 0x11, 0x7e, 0xd4, 0x2b, 0x7f, 0xcc, 0x2e, 0x79, 0xcd, 0x3a, 0x7a, 0xd2, 0x1e, 0x7c, 0xd0, 0x1a, 0x84, 0xc9, 0x30, 0x22, 0x4f, 0x0a, 0x00, 0x19, 0x11, 0x00, 0x25, 0x00, 0x7d, 0xb5, 0x1e, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7b, 0xcd, 0x2b, 0x82, 0xce, 0x26, 0x7b, 0xce, 0x28, 0x6e, 0xb7, 0x28, 0x01, 0x1b, 0x00, 0x01, 0x1b, 0x00, 0x6e, 0xb7, 0x28, 0x7b, 0xce, 0x28, 0x82, 0xce, 0x26, 0x7b, 0xcd, 0x2b, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x73, 0xa9, 0x20, 0x00, 0x21, 0x00, 0x00, 0x1c, 0x02, 0x32, 0x68, 0x0a, 0x81, 0xc8, 0x2c, 0x85, 0xd4, 0x2d, 0x7c, 0xcd, 0x26, 0x7f, 0xce, 0x34, 0x7f, 0xcc, 0x2e, 0x7e, 0xd4, 0x2b, 0x49, 0x8e, 0x11, 0x00, 0x1c, 0x0e, 0x03, 0x1b, 0x05, 0x43, 0x7d, 0x0f, 0x49, 0x9e, 0x05, 0x40, 0x96, 0x17, 0x44, 0x95, 0x0c, 0x47, 0x98, 0x17, 0x44, 0x94, 0x0d, 0x4e, 0x96, 0x16, 0x15, 0x4a, 0x00, 0x01, 0x1c, 0x0d, 0x52, 0x5e, 0x48, 0xfd, 0xfb, 0xff, 
-    0xf3, 0xf5, 0xf4, 0x11, 0x25, 0x0c, 0x00, 0x1c, 0x00, 0x30, 0x74, 0x00, 0x49, 0x93, 0x20, 0x45, 0x96, 0x0b, 0x49, 0x9b, 0x12, 0x43, 0x94, 0x13, 0x43, 0x96, 0x10, 0x46, 0x98, 0x08, 0x28, 0x5a, 0x1b, 0x01, 0x1a, 0x05, 0x09, 0x2d, 0x00, 0x83, 0xd1, 0x23, 0x75, 0xc9, 0x2b, 0x83, 0xd0, 0x28, 0x7e, 0xcf, 0x2c, 0x7a, 0xcd, 0x25, 0x84, 0xd3, 0x2c, 0x49, 0x7e, 0x12, 0x04, 0x19, 0x0a, 0x04, 0x1c, 0x04, 0x3a, 0x75, 0x09, 0x7a, 0xd3, 0x2b, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7b, 0xcd, 0x2b, 0x82, 0xce, 0x26, 0x7b, 0xce, 0x28, 0x6e, 0xb7, 0x28, 0x01, 0x1b, 0x00, 0x01, 0x1b, 0x00, 0x6e, 0xb7, 0x28, 0x7b, 0xce, 0x28, 0x82, 0xce, 0x26, 0x7b, 0xcd, 0x2b, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x79, 0xd2, 0x2a, 0x3a, 0x72, 0x0d, 0x00, 0x14, 0x08, 0x05, 0x1f, 0x00, 0x62, 0x9f, 0x1d, 0x7b, 0xcc, 0x31, 0x74, 0xc9, 0x26, 0x83, 0xd2, 0x21, 0x83, 0xd0, 0x28, 0x75, 0xc9, 0x2b, 0x83, 0xd1, 0x23, 0x09, 0x2d, 0x00, 0x01, 0x1a, 0x05, 0x28, 0x5a, 0x1b, 0x46, 0x98, 0x08, 0x43, 0x96, 0x10, 0x44, 0x95, 0x14, 0x49, 0x9b, 0x12, 0x46, 0x97, 0x0c, 0x49, 0x93, 0x20, 0x30, 0x74, 0x00, 0x00, 0x1c, 0x00, 0x10, 0x24, 0x0b, 0xf2, 0xf4, 0xf3, 
-    0xb8, 0xbd, 0xb9, 0x04, 0x18, 0x00, 0x02, 0x2c, 0x06, 0x43, 0x89, 0x0d, 0x4a, 0x95, 0x1f, 0x45, 0x96, 0x0b, 0x44, 0x96, 0x0d, 0x46, 0x97, 0x16, 0x47, 0x98, 0x15, 0x49, 0x95, 0x0f, 0x0c, 0x3b, 0x07, 0x00, 0x19, 0x03, 0x32, 0x5c, 0x12, 0x7f, 0xce, 0x23, 0x7b, 0xcf, 0x31, 0x7f, 0xce, 0x25, 0x7c, 0xcf, 0x27, 0x80, 0xd1, 0x2a, 0x7a, 0xbf, 0x24, 0x0c, 0x32, 0x0d, 0x00, 0x1b, 0x00, 0x11, 0x37, 0x00, 0x83, 0xc8, 0x2d, 0x76, 0xcc, 0x29, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7b, 0xcd, 0x2b, 0x82, 0xce, 0x26, 0x7b, 0xce, 0x28, 0x6e, 0xb7, 0x28, 0x01, 0x1b, 0x00, 0x01, 0x1b, 0x00, 0x6e, 0xb7, 0x28, 0x7b, 0xce, 0x28, 0x82, 0xce, 0x26, 0x7b, 0xcd, 0x2b, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x76, 0xce, 0x24, 0x7f, 0xc2, 0x34, 0x15, 0x37, 0x05, 0x01, 0x1f, 0x00, 0x15, 0x42, 0x09, 0x7e, 0xcb, 0x27, 0x84, 0xd4, 0x33, 0x77, 0xc9, 0x1c, 0x7f, 0xce, 0x25, 0x7b, 0xcf, 0x31, 0x7f, 0xce, 0x23, 0x32, 0x5c, 0x12, 0x00, 0x19, 0x03, 0x0c, 0x3b, 0x07, 0x49, 0x95, 0x0f, 0x47, 0x98, 0x15, 0x46, 0x97, 0x16, 0x44, 0x96, 0x0d, 0x45, 0x96, 0x0b, 0x4a, 0x95, 0x1f, 0x43, 0x89, 0x0d, 0x02, 0x2c, 0x06, 0x04, 0x18, 0x00, 0xb8, 0xbd, 0xb9, 
-    0x90, 0x97, 0x8f, 0x00, 0x17, 0x00, 0x0b, 0x36, 0x08, 0x4e, 0x94, 0x18, 0x48, 0x94, 0x1a, 0x49, 0x9a, 0x0d, 0x44, 0x95, 0x0c, 0x45, 0x96, 0x13, 0x47, 0x98, 0x15, 0x40, 0x85, 0x0e, 0x00, 0x1f, 0x00, 0x01, 0x1e, 0x02, 0x63, 0x98, 0x24, 0x7c, 0xcd, 0x28, 0x7a, 0xd0, 0x2f, 0x7f, 0xce, 0x25, 0x76, 0xcd, 0x28, 0x81, 0xcd, 0x22, 0x4f, 0x81, 0x22, 0x00, 0x1a, 0x05, 0x01, 0x24, 0x04, 0x69, 0xa7, 0x22, 0x7e, 0xcc, 0x21, 0x7e, 0xcf, 0x2c, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7b, 0xcd, 0x2b, 0x82, 0xce, 0x26, 0x7b, 0xce, 0x28, 0x6e, 0xb7, 0x28, 0x01, 0x1b, 0x00, 0x01, 0x1b, 0x00, 0x6e, 0xb7, 0x28, 0x7b, 0xce, 0x28, 0x82, 0xce, 0x26, 0x7b, 0xcd, 0x2b, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7f, 0xd3, 0x26, 0x83, 0xcd, 0x32, 0x6a, 0xa5, 0x25, 0x00, 0x1b, 0x00, 0x00, 0x1e, 0x00, 0x5e, 0x99, 0x21, 0x81, 0xcf, 0x23, 0x79, 0xcd, 0x2d, 0x7f, 0xce, 0x25, 0x7a, 0xd0, 0x2f, 0x7c, 0xcd, 0x28, 0x63, 0x98, 0x24, 0x01, 0x1e, 0x02, 0x00, 0x1f, 0x00, 0x40, 0x85, 0x0e, 0x47, 0x98, 0x15, 0x45, 0x96, 0x13, 0x43, 0x94, 0x0b, 0x48, 0x99, 0x0c, 0x48, 0x94, 0x1a, 0x4e, 0x94, 0x18, 0x0b, 0x36, 0x08, 0x00, 0x17, 0x00, 0x90, 0x97, 0x8f, 
-    0x7c, 0x86, 0x7b, 0x03, 0x1d, 0x02, 0x10, 0x40, 0x04, 0x4b, 0x93, 0x15, 0x45, 0x94, 0x15, 0x4a, 0x9b, 0x0e, 0x45, 0x95, 0x0e, 0x46, 0x96, 0x11, 0x46, 0x96, 0x13, 0x2f, 0x6b, 0x09, 0x00, 0x1a, 0x05, 0x09, 0x29, 0x04, 0x7f, 0xc0, 0x26, 0x7d, 0xcf, 0x2d, 0x76, 0xca, 0x2a, 0x7f, 0xd1, 0x27, 0x7c, 0xd5, 0x2d, 0x80, 0xc4, 0x2f, 0x21, 0x43, 0x10, 0x00, 0x14, 0x00, 0x2e, 0x61, 0x14, 0x81, 0xce, 0x28, 0x7c, 0xcc, 0x2b, 0x80, 0xcd, 0x27, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7b, 0xcd, 0x2b, 0x82, 0xce, 0x26, 0x7b, 0xce, 0x28, 0x6e, 0xb7, 0x28, 0x01, 0x1b, 0x00, 0x01, 0x1b, 0x00, 0x6e, 0xb7, 0x28, 0x7b, 0xce, 0x28, 0x82, 0xce, 0x26, 0x7b, 0xcd, 0x2b, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7d, 0xcc, 0x25, 0x80, 0xcd, 0x2f, 0x82, 0xcd, 0x28, 0x2b, 0x5b, 0x11, 0x00, 0x1b, 0x00, 0x2f, 0x58, 0x14, 0x7f, 0xc8, 0x23, 0x7e, 0xd3, 0x37, 0x7f, 0xd1, 0x27, 0x76, 0xca, 0x2a, 0x7d, 0xcf, 0x2d, 0x7f, 0xc0, 0x26, 0x09, 0x29, 0x04, 0x00, 0x1a, 0x05, 0x2f, 0x6b, 0x09, 0x46, 0x96, 0x13, 0x45, 0x95, 0x10, 0x44, 0x94, 0x0d, 0x4a, 0x9b, 0x0e, 0x44, 0x93, 0x14, 0x4b, 0x93, 0x15, 0x10, 0x40, 0x04, 0x03, 0x1d, 0x02, 0x7c, 0x86, 0x7b, 
-    0x5d, 0x6b, 0x5a, 0x00, 0x1d, 0x01, 0x1b, 0x4f, 0x05, 0x49, 0x94, 0x13, 0x47, 0x97, 0x14, 0x45, 0x98, 0x0a, 0x45, 0x95, 0x10, 0x47, 0x97, 0x12, 0x45, 0x95, 0x12, 0x22, 0x57, 0x07, 0x01, 0x1c, 0x0d, 0x14, 0x3a, 0x07, 0x85, 0xcf, 0x20, 0x7b, 0xcf, 0x2f, 0x78, 0xcc, 0x2c, 0x7e, 0xd0, 0x26, 0x78, 0xd2, 0x23, 0x7d, 0xbb, 0x36, 0x02, 0x1b, 0x00, 0x06, 0x22, 0x00, 0x4a, 0x85, 0x1b, 0x79, 0xcf, 0x22, 0x82, 0xd3, 0x39, 0x7f, 0xcb, 0x20, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7b, 0xcd, 0x2b, 0x82, 0xce, 0x26, 0x7b, 0xce, 0x28, 0x6e, 0xb7, 0x28, 0x01, 0x1b, 0x00, 0x01, 0x1b, 0x00, 0x6e, 0xb7, 0x28, 0x7b, 0xce, 0x28, 0x82, 0xce, 0x26, 0x7b, 0xcd, 0x2b, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7e, 0xca, 0x29, 0x7d, 0xcf, 0x2c, 0x7c, 0xce, 0x22, 0x4c, 0x86, 0x16, 0x04, 0x23, 0x03, 0x06, 0x22, 0x09, 0x89, 0xcd, 0x2a, 0x77, 0xce, 0x29, 0x7e, 0xd0, 0x26, 0x78, 0xcc, 0x2c, 0x7b, 0xcf, 0x2f, 0x85, 0xcf, 0x20, 0x14, 0x3a, 0x07, 0x01, 0x1c, 0x0d, 0x22, 0x57, 0x07, 0x45, 0x95, 0x12, 0x47, 0x97, 0x12, 0x45, 0x95, 0x10, 0x44, 0x97, 0x09, 0x47, 0x97, 0x14, 0x49, 0x94, 0x13, 0x1b, 0x4f, 0x05, 0x00, 0x1d, 0x01, 0x5e, 0x6c, 0x5b, 
-    0x41, 0x52, 0x3f, 0x00, 0x1d, 0x03, 0x25, 0x5c, 0x08, 0x48, 0x93, 0x12, 0x48, 0x9a, 0x14, 0x43, 0x96, 0x0a, 0x47, 0x97, 0x14, 0x47, 0x97, 0x12, 0x46, 0x98, 0x12, 0x1e, 0x4c, 0x0e, 0x01, 0x18, 0x04, 0x23, 0x4e, 0x09, 0x7f, 0xcf, 0x20, 0x78, 0xcd, 0x29, 0x81, 0xd3, 0x33, 0x7d, 0xcc, 0x23, 0x76, 0xce, 0x1a, 0x5c, 0x96, 0x1b, 0x03, 0x1b, 0x01, 0x00, 0x19, 0x00, 0x6e, 0xad, 0x3b, 0x7a, 0xd2, 0x24, 0x76, 0xcb, 0x28, 0x80, 0xce, 0x20, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7b, 0xcd, 0x2b, 0x82, 0xce, 0x26, 0x7b, 0xce, 0x28, 0x6e, 0xb7, 0x28, 0x01, 0x1b, 0x00, 0x01, 0x1b, 0x00, 0x6e, 0xb7, 0x28, 0x7b, 0xce, 0x28, 0x82, 0xce, 0x26, 0x7b, 0xcd, 0x2b, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x80, 0xce, 0x2c, 0x7a, 0xd1, 0x22, 0x7c, 0xcf, 0x27, 0x68, 0xa6, 0x27, 0x00, 0x16, 0x00, 0x00, 0x19, 0x0c, 0x6f, 0xb3, 0x10, 0x78, 0xce, 0x23, 0x7d, 0xcc, 0x23, 0x81, 0xd3, 0x33, 0x78, 0xcd, 0x29, 0x7f, 0xcf, 0x20, 0x23, 0x4e, 0x09, 0x01, 0x18, 0x04, 0x1e, 0x4c, 0x0e, 0x46, 0x98, 0x12, 0x47, 0x97, 0x12, 0x46, 0x96, 0x13, 0x43, 0x96, 0x0a, 0x48, 0x9a, 0x14, 0x48, 0x93, 0x12, 0x25, 0x5c, 0x08, 0x00, 0x1d, 0x03, 0x41, 0x52, 0x3f, 
-    0x29, 0x3c, 0x28, 0x00, 0x1f, 0x07, 0x2b, 0x66, 0x0a, 0x47, 0x94, 0x14, 0x46, 0x98, 0x10, 0x44, 0x96, 0x0d, 0x48, 0x97, 0x17, 0x45, 0x95, 0x10, 0x44, 0x98, 0x0f, 0x17, 0x41, 0x0f, 0x00, 0x17, 0x00, 0x34, 0x64, 0x10, 0x7a, 0xcc, 0x29, 0x79, 0xcf, 0x26, 0x80, 0xd0, 0x31, 0x7d, 0xcc, 0x21, 0x7e, 0xd1, 0x21, 0x4a, 0x80, 0x22, 0x00, 0x15, 0x00, 0x00, 0x1f, 0x07, 0x82, 0xc6, 0x31, 0x79, 0xce, 0x2a, 0x76, 0xcd, 0x1e, 0x83, 0xd1, 0x30, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7b, 0xcd, 0x2b, 0x82, 0xce, 0x26, 0x7b, 0xce, 0x28, 0x6e, 0xb7, 0x28, 0x01, 0x1b, 0x00, 0x01, 0x1b, 0x00, 0x6e, 0xb7, 0x28, 0x7b, 0xce, 0x28, 0x82, 0xce, 0x26, 0x7b, 0xcd, 0x2b, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7a, 0xcc, 0x29, 0x7d, 0xd5, 0x21, 0x7c, 0xcb, 0x32, 0x7f, 0xc3, 0x22, 0x04, 0x23, 0x11, 0x00, 0x18, 0x00, 0x59, 0x98, 0x16, 0x7c, 0xcf, 0x27, 0x7d, 0xcc, 0x21, 0x80, 0xd0, 0x31, 0x79, 0xcf, 0x26, 0x7a, 0xcc, 0x29, 0x34, 0x64, 0x10, 0x00, 0x17, 0x00, 0x17, 0x41, 0x0f, 0x44, 0x98, 0x0f, 0x45, 0x95, 0x10, 0x48, 0x97, 0x17, 0x44, 0x96, 0x0d, 0x46, 0x98, 0x10, 0x47, 0x94, 0x14, 0x2b, 0x66, 0x0a, 0x00, 0x1f, 0x07, 0x29, 0x3c, 0x28, 
-    0x0e, 0x24, 0x0d, 0x00, 0x1f, 0x06, 0x32, 0x70, 0x0f, 0x4c, 0x99, 0x19, 0x43, 0x95, 0x0d, 0x43, 0x95, 0x0c, 0x46, 0x95, 0x16, 0x45, 0x95, 0x10, 0x41, 0x95, 0x0c, 0x11, 0x38, 0x0c, 0x04, 0x1c, 0x00, 0x41, 0x74, 0x17, 0x77, 0xca, 0x32, 0x7d, 0xd3, 0x28, 0x7a, 0xc7, 0x2b, 0x82, 0xd0, 0x24, 0x82, 0xd0, 0x2c, 0x38, 0x6b, 0x1c, 0x01, 0x20, 0x10, 0x16, 0x3f, 0x00, 0x82, 0xc8, 0x2a, 0x7e, 0xd2, 0x18, 0x7f, 0xd1, 0x31, 0x7a, 0xc9, 0x30, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x7b, 0xcd, 0x2b, 0x82, 0xce, 0x26, 0x7b, 0xce, 0x28, 0x6e, 0xb7, 0x28, 0x01, 0x1b, 0x00, 0x01, 0x1b, 0x00, 0x6e, 0xb7, 0x28, 0x7b, 0xce, 0x28, 0x82, 0xce, 0x26, 0x7b, 0xcd, 0x2b, 0x7c, 0xcf, 0x27, 0x7f, 0xcd, 0x2c, 0x7c, 0xcf, 0x27, 0x79, 0xce, 0x28, 0x7d, 0xcd, 0x36, 0x7f, 0xce, 0x23, 0x87, 0xca, 0x25, 0x13, 0x3b, 0x00, 0x02, 0x23, 0x10, 0x4b, 0x86, 0x18, 0x82, 0xce, 0x36, 0x82, 0xd0, 0x24, 0x7a, 0xc7, 0x2b, 0x7d, 0xd3, 0x28, 0x77, 0xca, 0x32, 0x41, 0x74, 0x17, 0x04, 0x1c, 0x00, 0x11, 0x38, 0x0c, 0x41, 0x95, 0x0c, 0x46, 0x96, 0x11, 0x47, 0x96, 0x17, 0x44, 0x96, 0x0d, 0x43, 0x95, 0x0d, 0x4c, 0x99, 0x19, 0x32, 0x70, 0x0f, 0x00, 0x1f, 0x06, 0x0e, 0x24, 0x0d, 
-    0x0e, 0x24, 0x0d, 0x00, 0x1f, 0x06, 0x32, 0x70, 0x0f, 0x4c, 0x99, 0x19, 0x43, 0x95, 0x0d, 0x43, 0x95, 0x0c, 0x46, 0x95, 0x16, 0x45, 0x95, 0x10, 0x41, 0x95, 0x0c, 0x11, 0x38, 0x0c, 0x04, 0x1c, 0x00, 0x41, 0x74, 0x17, 0x77, 0xca, 0x32, 0x7d, 0xd3, 0x28, 0x7a, 0xc7, 0x2b, 0x82, 0xd0, 0x24, 0x7c, 0xd2, 0x29, 0x3b, 0x6e, 0x07, 0x04, 0x1b, 0x11, 0x16, 0x43, 0x0c, 0x83, 0xce, 0x29, 0x83, 0xcf, 0x31, 0x7b, 0xcb, 0x1c, 0x78, 0xd0, 0x24, 0x83, 0xd1, 0x2d, 0x78, 0xca, 0x1d, 0x7d, 0xce, 0x27, 0x81, 0xd1, 0x30, 0x7b, 0xce, 0x1e, 0x81, 0xd1, 0x1a, 0x7f, 0xc3, 0x3a, 0x0b, 0x43, 0x00, 0x0b, 0x43, 0x00, 0x7f, 0xc3, 0x3a, 0x81, 0xd1, 0x1a, 0x7b, 0xce, 0x1e, 0x81, 0xd1, 0x30, 0x7d, 0xce, 0x27, 0x78, 0xca, 0x1d, 0x83, 0xd1, 0x2d, 0x7d, 0xcd, 0x1e, 0x7b, 0xcc, 0x31, 0x81, 0xd4, 0x2a, 0x82, 0xc8, 0x29, 0x19, 0x42, 0x08, 0x00, 0x1f, 0x0c, 0x4b, 0x86, 0x12, 0x7e, 0xcc, 0x28, 0x82, 0xd0, 0x24, 0x7a, 0xc7, 0x2b, 0x7d, 0xd3, 0x28, 0x77, 0xca, 0x32, 0x41, 0x74, 0x17, 0x04, 0x1c, 0x00, 0x11, 0x38, 0x0c, 0x41, 0x95, 0x0c, 0x46, 0x96, 0x11, 0x47, 0x96, 0x17, 0x44, 0x96, 0x0d, 0x43, 0x95, 0x0d, 0x4c, 0x99, 0x19, 0x32, 0x70, 0x0f, 0x00, 0x1f, 0x06, 0x0e, 0x24, 0x0d, 
-    0x29, 0x3c, 0x28, 0x00, 0x1f, 0x07, 0x2b, 0x66, 0x0a, 0x47, 0x94, 0x14, 0x46, 0x98, 0x10, 0x44, 0x96, 0x0d, 0x48, 0x97, 0x17, 0x45, 0x95, 0x10, 0x44, 0x98, 0x0f, 0x17, 0x41, 0x0f, 0x00, 0x17, 0x00, 0x34, 0x64, 0x10, 0x7a, 0xcc, 0x29, 0x79, 0xcf, 0x26, 0x80, 0xd0, 0x31, 0x7d, 0xcc, 0x21, 0x7b, 0xd0, 0x2d, 0x53, 0x88, 0x12, 0x00, 0x0f, 0x02, 0x13, 0x3b, 0x07, 0x82, 0xcc, 0x2f, 0x7a, 0xca, 0x1d, 0x81, 0xd0, 0x25, 0x7f, 0xd0, 0x35, 0x7d, 0xcb, 0x29, 0x81, 0xd2, 0x2b, 0x7c, 0xcc, 0x2b, 0x78, 0xc8, 0x31, 0x80, 0xd0, 0x31, 0x7b, 0xcb, 0x1c, 0x86, 0xd1, 0x2e, 0x7c, 0xc0, 0x37, 0x7c, 0xc0, 0x37, 0x86, 0xd1, 0x2e, 0x7b, 0xcb, 0x1c, 0x80, 0xd0, 0x31, 0x78, 0xc8, 0x31, 0x7c, 0xcc, 0x2b, 0x81, 0xd2, 0x2b, 0x7d, 0xcb, 0x29, 0x84, 0xd0, 0x30, 0x7b, 0xcd, 0x2a, 0x77, 0xcd, 0x20, 0x84, 0xcb, 0x2d, 0x0f, 0x36, 0x01, 0x00, 0x19, 0x07, 0x5a, 0x98, 0x11, 0x80, 0xd0, 0x31, 0x7d, 0xcc, 0x21, 0x80, 0xd0, 0x31, 0x79, 0xcf, 0x26, 0x7a, 0xcc, 0x29, 0x34, 0x64, 0x10, 0x00, 0x17, 0x00, 0x17, 0x41, 0x0f, 0x44, 0x98, 0x0f, 0x45, 0x95, 0x10, 0x48, 0x97, 0x17, 0x44, 0x96, 0x0d, 0x46, 0x98, 0x10, 0x47, 0x94, 0x14, 0x2b, 0x66, 0x0a, 0x00, 0x1f, 0x07, 0x29, 0x3c, 0x28, 
-    0x41, 0x52, 0x3f, 0x00, 0x1d, 0x03, 0x25, 0x5c, 0x08, 0x48, 0x93, 0x12, 0x48, 0x9a, 0x14, 0x43, 0x96, 0x0a, 0x47, 0x97, 0x14, 0x47, 0x97, 0x12, 0x46, 0x98, 0x12, 0x1e, 0x4c, 0x0e, 0x01, 0x18, 0x04, 0x23, 0x4e, 0x09, 0x7f, 0xcf, 0x20, 0x78, 0xcd, 0x29, 0x81, 0xd3, 0x33, 0x7d, 0xcc, 0x23, 0x75, 0xce, 0x28, 0x5a, 0x92, 0x13, 0x08, 0x1e, 0x07, 0x00, 0x21, 0x00, 0x7b, 0xc5, 0x28, 0x7e, 0xd2, 0x25, 0x7b, 0xcc, 0x27, 0x7f, 0xcb, 0x35, 0x7f, 0xcd, 0x2b, 0x7c, 0xcd, 0x28, 0x7c, 0xcd, 0x28, 0x79, 0xca, 0x2d, 0x7f, 0xd0, 0x35, 0x7f, 0xcf, 0x2e, 0x7c, 0xcc, 0x1d, 0x85, 0xd5, 0x1e, 0x85, 0xd5, 0x1e, 0x7c, 0xcc, 0x1d, 0x7f, 0xcf, 0x2e, 0x7f, 0xd0, 0x35, 0x79, 0xca, 0x2d, 0x7c, 0xcd, 0x28, 0x7c, 0xcd, 0x28, 0x7f, 0xcd, 0x2b, 0x81, 0xca, 0x33, 0x76, 0xcc, 0x1f, 0x7c, 0xd2, 0x31, 0x7d, 0xc6, 0x21, 0x03, 0x22, 0x00, 0x03, 0x1d, 0x04, 0x69, 0xa8, 0x19, 0x77, 0xcc, 0x28, 0x7d, 0xcc, 0x23, 0x81, 0xd3, 0x33, 0x78, 0xcd, 0x29, 0x7f, 0xcf, 0x20, 0x23, 0x4e, 0x09, 0x01, 0x18, 0x04, 0x1e, 0x4c, 0x0e, 0x46, 0x98, 0x12, 0x47, 0x97, 0x12, 0x46, 0x96, 0x13, 0x43, 0x96, 0x0a, 0x48, 0x9a, 0x14, 0x48, 0x93, 0x12, 0x25, 0x5c, 0x08, 0x00, 0x1d, 0x03, 0x41, 0x52, 0x3f, 
-    0x5d, 0x6b, 0x5a, 0x00, 0x1d, 0x01, 0x1b, 0x4f, 0x05, 0x49, 0x94, 0x13, 0x47, 0x97, 0x14, 0x45, 0x98, 0x0a, 0x45, 0x95, 0x10, 0x47, 0x97, 0x12, 0x45, 0x95, 0x12, 0x22, 0x57, 0x07, 0x01, 0x1c, 0x0d, 0x14, 0x3a, 0x07, 0x85, 0xcf, 0x20, 0x7b, 0xcf, 0x2f, 0x78, 0xcc, 0x2c, 0x7e, 0xd0, 0x26, 0x78, 0xd1, 0x27, 0x74, 0xb1, 0x25, 0x03, 0x1b, 0x05, 0x00, 0x1c, 0x00, 0x5a, 0x9b, 0x1d, 0x7d, 0xd1, 0x24, 0x7f, 0xd0, 0x33, 0x7e, 0xcb, 0x25, 0x80, 0xce, 0x2a, 0x7a, 0xcb, 0x26, 0x80, 0xd2, 0x26, 0x7f, 0xd4, 0x21, 0x75, 0xc8, 0x20, 0x7f, 0xd0, 0x35, 0x7c, 0xcc, 0x2d, 0x78, 0xcb, 0x1b, 0x78, 0xcb, 0x1b, 0x7c, 0xcc, 0x2d, 0x7f, 0xd0, 0x35, 0x75, 0xc8, 0x20, 0x7f, 0xd4, 0x21, 0x80, 0xd2, 0x26, 0x7a, 0xcb, 0x26, 0x80, 0xce, 0x2a, 0x81, 0xca, 0x23, 0x7d, 0xd0, 0x2a, 0x7d, 0xd1, 0x33, 0x59, 0x9b, 0x15, 0x00, 0x1f, 0x00, 0x02, 0x1c, 0x00, 0x83, 0xc5, 0x2f, 0x76, 0xd0, 0x21, 0x7e, 0xd0, 0x26, 0x78, 0xcc, 0x2c, 0x7b, 0xcf, 0x2f, 0x85, 0xcf, 0x20, 0x14, 0x3a, 0x07, 0x01, 0x1c, 0x0d, 0x22, 0x57, 0x07, 0x45, 0x95, 0x12, 0x47, 0x97, 0x12, 0x45, 0x95, 0x10, 0x44, 0x97, 0x09, 0x47, 0x97, 0x14, 0x49, 0x94, 0x13, 0x1b, 0x4f, 0x05, 0x00, 0x1d, 0x01, 0x5e, 0x6c, 0x5b, 
-    0x7c, 0x86, 0x7b, 0x03, 0x1d, 0x02, 0x10, 0x40, 0x04, 0x4b, 0x93, 0x15, 0x45, 0x94, 0x15, 0x4a, 0x9b, 0x0e, 0x45, 0x95, 0x0e, 0x46, 0x96, 0x11, 0x46, 0x96, 0x13, 0x2f, 0x6b, 0x09, 0x00, 0x1a, 0x05, 0x09, 0x29, 0x04, 0x7f, 0xc0, 0x26, 0x7d, 0xcf, 0x2d, 0x76, 0xca, 0x2a, 0x7f, 0xd1, 0x27, 0x7e, 0xd4, 0x33, 0x80, 0xc7, 0x1f, 0x18, 0x38, 0x0f, 0x03, 0x1e, 0x00, 0x30, 0x5e, 0x1d, 0x7b, 0xca, 0x23, 0x81, 0xd1, 0x34, 0x7f, 0xce, 0x1b, 0x7f, 0xce, 0x25, 0x80, 0xd0, 0x2f, 0x7a, 0xcb, 0x26, 0x7d, 0xd2, 0x1c, 0x7a, 0xcf, 0x1c, 0x7d, 0xce, 0x31, 0x7b, 0xcb, 0x34, 0x84, 0xd4, 0x33, 0x84, 0xd4, 0x33, 0x7b, 0xcb, 0x34, 0x7d, 0xce, 0x31, 0x7a, 0xcf, 0x1c, 0x7d, 0xd2, 0x1c, 0x7a, 0xcb, 0x26, 0x80, 0xd0, 0x2f, 0x7f, 0xce, 0x25, 0x82, 0xd0, 0x1a, 0x7d, 0xca, 0x2c, 0x80, 0xce, 0x2c, 0x2e, 0x61, 0x1c, 0x00, 0x18, 0x00, 0x2d, 0x53, 0x18, 0x80, 0xc7, 0x23, 0x7e, 0xd7, 0x2d, 0x7f, 0xd1, 0x27, 0x76, 0xca, 0x2a, 0x7d, 0xcf, 0x2d, 0x7f, 0xc0, 0x26, 0x09, 0x29, 0x04, 0x00, 0x1a, 0x05, 0x2f, 0x6b, 0x09, 0x46, 0x96, 0x13, 0x45, 0x95, 0x10, 0x44, 0x94, 0x0d, 0x4a, 0x9b, 0x0e, 0x44, 0x93, 0x14, 0x4b, 0x93, 0x15, 0x10, 0x40, 0x04, 0x03, 0x1d, 0x02, 0x7c, 0x86, 0x7b, 
-    0x90, 0x97, 0x8f, 0x00, 0x17, 0x00, 0x0b, 0x36, 0x08, 0x4e, 0x94, 0x18, 0x48, 0x94, 0x1a, 0x49, 0x9a, 0x0d, 0x44, 0x95, 0x0c, 0x45, 0x96, 0x13, 0x47, 0x98, 0x15, 0x40, 0x85, 0x0e, 0x00, 0x1f, 0x00, 0x01, 0x1e, 0x02, 0x63, 0x98, 0x24, 0x7c, 0xcd, 0x28, 0x7a, 0xd0, 0x2f, 0x7f, 0xce, 0x25, 0x7b, 0xcc, 0x32, 0x80, 0xd0, 0x1f, 0x44, 0x7c, 0x11, 0x00, 0x1a, 0x0d, 0x01, 0x23, 0x00, 0x68, 0xa5, 0x2e, 0x7f, 0xce, 0x27, 0x81, 0xd0, 0x25, 0x7b, 0xcd, 0x21, 0x82, 0xd1, 0x37, 0x78, 0xc7, 0x2e, 0x7e, 0xcf, 0x2a, 0x80, 0xd2, 0x26, 0x7e, 0xcf, 0x2a, 0x79, 0xc9, 0x28, 0x79, 0xca, 0x23, 0x79, 0xca, 0x23, 0x79, 0xc9, 0x28, 0x7e, 0xcf, 0x2a, 0x80, 0xd2, 0x26, 0x7e, 0xcf, 0x2a, 0x78, 0xc7, 0x2e, 0x82, 0xd1, 0x37, 0x7b, 0xcd, 0x21, 0x83, 0xd3, 0x26, 0x7e, 0xc9, 0x24, 0x6c, 0xa8, 0x2e, 0x00, 0x24, 0x00, 0x00, 0x1f, 0x0c, 0x5a, 0x92, 0x15, 0x7f, 0xcc, 0x24, 0x77, 0xcd, 0x2c, 0x7f, 0xce, 0x25, 0x7a, 0xd0, 0x2f, 0x7c, 0xcd, 0x28, 0x63, 0x98, 0x24, 0x01, 0x1e, 0x02, 0x00, 0x1f, 0x00, 0x40, 0x85, 0x0e, 0x47, 0x98, 0x15, 0x45, 0x96, 0x13, 0x43, 0x94, 0x0b, 0x48, 0x99, 0x0c, 0x48, 0x94, 0x1a, 0x4e, 0x94, 0x18, 0x0b, 0x36, 0x08, 0x00, 0x17, 0x00, 0x90, 0x97, 0x8f, 
-    0xb8, 0xbd, 0xb9, 0x04, 0x18, 0x00, 0x02, 0x2c, 0x06, 0x43, 0x89, 0x0d, 0x4a, 0x95, 0x1f, 0x45, 0x96, 0x0b, 0x44, 0x96, 0x0d, 0x46, 0x97, 0x16, 0x47, 0x98, 0x15, 0x49, 0x95, 0x0f, 0x0c, 0x3b, 0x07, 0x00, 0x19, 0x03, 0x32, 0x5c, 0x12, 0x7f, 0xce, 0x23, 0x7b, 0xcf, 0x31, 0x7f, 0xce, 0x25, 0x80, 0xce, 0x2d, 0x7a, 0xd0, 0x23, 0x73, 0xbf, 0x1f, 0x02, 0x24, 0x03, 0x07, 0x1f, 0x00, 0x15, 0x3e, 0x04, 0x7c, 0xc6, 0x31, 0x7c, 0xcd, 0x2a, 0x7a, 0xcc, 0x22, 0x80, 0xd0, 0x31, 0x81, 0xd0, 0x36, 0x80, 0xd0, 0x2f, 0x78, 0xc9, 0x24, 0x7b, 0xcc, 0x27, 0x81, 0xd2, 0x2b, 0x7d, 0xcf, 0x22, 0x7d, 0xcf, 0x22, 0x81, 0xd2, 0x2b, 0x7b, 0xcc, 0x27, 0x78, 0xc9, 0x24, 0x80, 0xd0, 0x2f, 0x81, 0xd0, 0x36, 0x80, 0xd0, 0x31, 0x7a, 0xcc, 0x22, 0x79, 0xcd, 0x2d, 0x81, 0xc5, 0x30, 0x17, 0x3e, 0x00, 0x00, 0x1d, 0x00, 0x11, 0x3c, 0x06, 0x79, 0xc2, 0x19, 0x83, 0xd4, 0x2f, 0x79, 0xcb, 0x2b, 0x7f, 0xce, 0x25, 0x7b, 0xcf, 0x31, 0x7f, 0xce, 0x23, 0x32, 0x5c, 0x12, 0x00, 0x19, 0x03, 0x0c, 0x3b, 0x07, 0x49, 0x95, 0x0f, 0x47, 0x98, 0x15, 0x46, 0x97, 0x16, 0x44, 0x96, 0x0d, 0x45, 0x96, 0x0b, 0x4a, 0x95, 0x1f, 0x43, 0x89, 0x0d, 0x02, 0x2c, 0x06, 0x04, 0x18, 0x00, 0xb8, 0xbd, 0xb9, 
-    0xf3, 0xf5, 0xf4, 0x11, 0x25, 0x0c, 0x00, 0x1c, 0x00, 0x30, 0x74, 0x00, 0x49, 0x93, 0x20, 0x45, 0x96, 0x0b, 0x49, 0x9b, 0x12, 0x43, 0x94, 0x13, 0x43, 0x96, 0x10, 0x46, 0x98, 0x08, 0x28, 0x5a, 0x1b, 0x01, 0x1a, 0x05, 0x09, 0x2d, 0x00, 0x83, 0xd1, 0x23, 0x75, 0xc9, 0x2b, 0x83, 0xd0, 0x28, 0x80, 0xcc, 0x24, 0x79, 0xd3, 0x24, 0x7a, 0xce, 0x30, 0x50, 0x7d, 0x22, 0x03, 0x14, 0x04, 0x00, 0x1c, 0x00, 0x3b, 0x79, 0x14, 0x79, 0xcc, 0x24, 0x7e, 0xd0, 0x26, 0x7b, 0xcd, 0x23, 0x7c, 0xce, 0x22, 0x7e, 0xcd, 0x24, 0x80, 0xce, 0x2a, 0x81, 0xcf, 0x2d, 0x7d, 0xcb, 0x29, 0x80, 0xce, 0x2a, 0x80, 0xce, 0x2a, 0x7d, 0xcb, 0x29, 0x81, 0xcf, 0x2d, 0x80, 0xce, 0x2a, 0x7e, 0xcd, 0x24, 0x7c, 0xce, 0x22, 0x7b, 0xcd, 0x23, 0x7e, 0xd0, 0x26, 0x76, 0xcc, 0x2d, 0x3e, 0x78, 0x0a, 0x00, 0x1b, 0x00, 0x00, 0x15, 0x03, 0x5f, 0x9a, 0x1c, 0x81, 0xd1, 0x34, 0x78, 0xcf, 0x20, 0x7d, 0xcd, 0x2c, 0x83, 0xd0, 0x28, 0x75, 0xc9, 0x2b, 0x83, 0xd1, 0x23, 0x09, 0x2d, 0x00, 0x01, 0x1a, 0x05, 0x28, 0x5a, 0x1b, 0x46, 0x98, 0x08, 0x43, 0x96, 0x10, 0x44, 0x95, 0x14, 0x49, 0x9b, 0x12, 0x46, 0x97, 0x0c, 0x49, 0x93, 0x20, 0x30, 0x74, 0x00, 0x00, 0x1c, 0x00, 0x10, 0x24, 0x0b, 0xf2, 0xf4, 0xf3, 
-    0xfd, 0xfb, 0xff, 0x52, 0x5e, 0x48, 0x01, 0x1c, 0x0d, 0x15, 0x4a, 0x00, 0x4e, 0x96, 0x16, 0x44, 0x94, 0x0d, 0x47, 0x98, 0x17, 0x44, 0x95, 0x0c, 0x40, 0x96, 0x17, 0x49, 0x9e, 0x05, 0x43, 0x7d, 0x0f, 0x03, 0x1b, 0x05, 0x00, 0x1c, 0x0e, 0x49, 0x8e, 0x11, 0x7e, 0xd4, 0x2b, 0x7f, 0xcc, 0x2e, 0x82, 0xcf, 0x1f, 0x76, 0xcc, 0x2d, 0x78, 0xd5, 0x2e, 0x7a, 0xc8, 0x27, 0x1c, 0x43, 0x00, 0x04, 0x15, 0x0b, 0x00, 0x1f, 0x00, 0x66, 0xa2, 0x30, 0x7b, 0xce, 0x26, 0x7c, 0xcd, 0x2a, 0x7f, 0xce, 0x23, 0x7f, 0xce, 0x1b, 0x81, 0xce, 0x28, 0x80, 0xcc, 0x36, 0x7e, 0xcf, 0x34, 0x78, 0xd0, 0x24, 0x77, 0xce, 0x27, 0x7e, 0xd2, 0x36, 0x7b, 0xca, 0x31, 0x7e, 0xcb, 0x23, 0x84, 0xd3, 0x1f, 0x81, 0xd0, 0x25, 0x77, 0xc9, 0x29, 0x7c, 0xd1, 0x2e, 0x66, 0xa3, 0x2e, 0x00, 0x19, 0x00, 0x07, 0x18, 0x0e, 0x2c, 0x54, 0x0b, 0x7e, 0xcb, 0x2f, 0x75, 0xd2, 0x2b, 0x7d, 0xd3, 0x30, 0x7e, 0xca, 0x22, 0x7f, 0xcc, 0x2e, 0x7e, 0xd4, 0x2b, 0x49, 0x8e, 0x11, 0x00, 0x1c, 0x0e, 0x03, 0x1b, 0x05, 0x43, 0x7d, 0x0f, 0x49, 0x9e, 0x05, 0x40, 0x96, 0x17, 0x44, 0x95, 0x0c, 0x47, 0x98, 0x17, 0x44, 0x94, 0x0d, 0x4e, 0x96, 0x16, 0x15, 0x4a, 0x00, 0x01, 0x1c, 0x0d, 0x52, 0x5e, 0x48, 0xfd, 0xfb, 0xff, 
-    0xff, 0xfe, 0xff, 0x98, 0xa3, 0x95, 0x00, 0x18, 0x03, 0x02, 0x31, 0x00, 0x47, 0x8e, 0x0c, 0x48, 0x98, 0x15, 0x46, 0x97, 0x14, 0x45, 0x97, 0x0f, 0x4b, 0x9a, 0x1b, 0x3d, 0x90, 0x00, 0x4f, 0x97, 0x1a, 0x0f, 0x3a, 0x04, 0x00, 0x1c, 0x00, 0x13, 0x3b, 0x07, 0x7e, 0xc5, 0x29, 0x7b, 0xcf, 0x21, 0x81, 0xcb, 0x2e, 0x7d, 0xce, 0x2b, 0x7a, 0xd0, 0x25, 0x7d, 0xce, 0x29, 0x7e, 0xbf, 0x2d, 0x09, 0x31, 0x00, 0x01, 0x22, 0x03, 0x00, 0x1a, 0x00, 0x36, 0x74, 0x0f, 0x80, 0xc8, 0x36, 0x81, 0xd0, 0x29, 0x7d, 0xcd, 0x30, 0x7e, 0xcf, 0x32, 0x7c, 0xcd, 0x28, 0x80, 0xcf, 0x24, 0x7d, 0xcd, 0x1e, 0x7e, 0xce, 0x1f, 0x7e, 0xd0, 0x24, 0x7d, 0xd0, 0x28, 0x7d, 0xcf, 0x2f, 0x76, 0xc7, 0x2a, 0x81, 0xd0, 0x29, 0x83, 0xcd, 0x3a, 0x31, 0x72, 0x0c, 0x00, 0x19, 0x00, 0x02, 0x24, 0x00, 0x12, 0x3c, 0x00, 0x87, 0xca, 0x2f, 0x7c, 0xcd, 0x2a, 0x77, 0xcc, 0x29, 0x7e, 0xce, 0x2f, 0x83, 0xce, 0x29, 0x7b, 0xcf, 0x21, 0x7e, 0xc5, 0x29, 0x13, 0x3b, 0x07, 0x00, 0x1c, 0x00, 0x0f, 0x3a, 0x04, 0x4f, 0x97, 0x1a, 0x3d, 0x90, 0x00, 0x4b, 0x9a, 0x1b, 0x45, 0x97, 0x0f, 0x46, 0x97, 0x14, 0x48, 0x98, 0x15, 0x47, 0x8e, 0x0c, 0x02, 0x31, 0x00, 0x00, 0x18, 0x03, 0x98, 0xa3, 0x95, 0xff, 0xfe, 0xff, 
-    0xfe, 0xfc, 0xff, 0xeb, 0xf1, 0xed, 0x06, 0x1d, 0x09, 0x00, 0x1c, 0x00, 0x3f, 0x7e, 0x15, 0x44, 0x91, 0x0d, 0x41, 0x92, 0x0f, 0x47, 0x9b, 0x12, 0x47, 0x90, 0x0d, 0x45, 0x94, 0x14, 0x44, 0x98, 0x0e, 0x44, 0x8a, 0x1a, 0x00, 0x1c, 0x00, 0x02, 0x14, 0x04, 0x4f, 0x7d, 0x23, 0x7c, 0xd1, 0x1b, 0x7c, 0xc8, 0x32, 0x83, 0xd0, 0x28, 0x83, 0xcf, 0x25, 0x7f, 0xd0, 0x29, 0x77, 0xcb, 0x2d, 0x66, 0xb2, 0x1c, 0x07, 0x2f, 0x00, 0x08, 0x19, 0x0f, 0x00, 0x1a, 0x00, 0x18, 0x41, 0x07, 0x6b, 0xa8, 0x31, 0x7b, 0xca, 0x23, 0x7d, 0xd1, 0x24, 0x7c, 0xd0, 0x23, 0x77, 0xc7, 0x1a, 0x83, 0xcf, 0x31, 0x83, 0xcf, 0x31, 0x7a, 0xcc, 0x1f, 0x7b, 0xcf, 0x22, 0x7c, 0xd2, 0x27, 0x84, 0xd3, 0x2c, 0x67, 0xa7, 0x2d, 0x0e, 0x3a, 0x00, 0x02, 0x22, 0x00, 0x0d, 0x1e, 0x14, 0x0c, 0x36, 0x00, 0x70, 0xbd, 0x21, 0x77, 0xcb, 0x2f, 0x7c, 0xcf, 0x1b, 0x83, 0xd0, 0x22, 0x7f, 0xcb, 0x2a, 0x80, 0xcd, 0x31, 0x7c, 0xd1, 0x1b, 0x4f, 0x7d, 0x23, 0x02, 0x14, 0x04, 0x00, 0x1c, 0x00, 0x44, 0x8a, 0x1a, 0x44, 0x98, 0x0e, 0x45, 0x94, 0x14, 0x47, 0x90, 0x0d, 0x47, 0x9b, 0x12, 0x41, 0x92, 0x0f, 0x44, 0x91, 0x0d, 0x3f, 0x7e, 0x15, 0x00, 0x1c, 0x00, 0x06, 0x1d, 0x09, 0xeb, 0xf1, 0xed, 0xfe, 0xfc, 0xff, 
-    0xfd, 0xfc, 0xf8, 0xfc, 0xff, 0xff, 0x3e, 0x4e, 0x44, 0x00, 0x1b, 0x00, 0x1f, 0x51, 0x12, 0x48, 0x90, 0x08, 0x47, 0x97, 0x12, 0x42, 0x96, 0x0d, 0x49, 0x95, 0x0f, 0x4e, 0x9a, 0x1c, 0x44, 0x9b, 0x10, 0x3d, 0x91, 0x07, 0x1b, 0x4b, 0x0d, 0x04, 0x15, 0x05, 0x0b, 0x25, 0x08, 0x72, 0xb7, 0x29, 0x7d, 0xd0, 0x2a, 0x7e, 0xcc, 0x20, 0x7d, 0xc9, 0x28, 0x7d, 0xce, 0x33, 0x73, 0xce, 0x2b, 0x7a, 0xd0, 0x31, 0x7f, 0xc0, 0x2e, 0x1b, 0x40, 0x00, 0x08, 0x19, 0x09, 0x04, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x30, 0x5e, 0x1d, 0x60, 0xa1, 0x23, 0x7e, 0xc8, 0x2b, 0x82, 0xcc, 0x2f, 0x86, 0xd1, 0x2c, 0x7e, 0xcb, 0x23, 0x7f, 0xcb, 0x2b, 0x7f, 0xc9, 0x2c, 0x5d, 0x9d, 0x22, 0x28, 0x59, 0x18, 0x00, 0x1e, 0x00, 0x07, 0x21, 0x00, 0x05, 0x17, 0x00, 0x23, 0x49, 0x00, 0x83, 0xc6, 0x2b, 0x7d, 0xd2, 0x36, 0x71, 0xcb, 0x2b, 0x7b, 0xcd, 0x2a, 0x7f, 0xcc, 0x26, 0x7d, 0xca, 0x22, 0x7d, 0xcf, 0x2c, 0x72, 0xb7, 0x29, 0x0b, 0x25, 0x08, 0x04, 0x15, 0x05, 0x1b, 0x4b, 0x0d, 0x3d, 0x91, 0x07, 0x44, 0x9b, 0x10, 0x4e, 0x9a, 0x1c, 0x49, 0x95, 0x0f, 0x42, 0x96, 0x0d, 0x47, 0x97, 0x12, 0x48, 0x90, 0x08, 0x1f, 0x51, 0x12, 0x00, 0x1b, 0x00, 0x3e, 0x4e, 0x44, 0xfc, 0xff, 0xff, 0xfd, 0xfc, 0xf8, 
-    0xff, 0xff, 0xf2, 0xfe, 0xfe, 0xff, 0x97, 0xa3, 0x97, 0x00, 0x19, 0x00, 0x00, 0x24, 0x03, 0x4b, 0x8a, 0x18, 0x44, 0x92, 0x08, 0x45, 0x98, 0x12, 0x44, 0x96, 0x10, 0x46, 0x93, 0x09, 0x47, 0x96, 0x17, 0x47, 0x99, 0x19, 0x46, 0x8c, 0x0f, 0x00, 0x1e, 0x01, 0x04, 0x20, 0x07, 0x1a, 0x44, 0x05, 0x7a, 0xcb, 0x26, 0x82, 0xd1, 0x38, 0x7a, 0xcf, 0x19, 0x7c, 0xce, 0x2b, 0x7e, 0xcf, 0x32, 0x7c, 0xcd, 0x26, 0x7b, 0xcc, 0x27, 0x7c, 0xca, 0x29, 0x4c, 0x79, 0x1e, 0x04, 0x26, 0x05, 0x04, 0x1e, 0x11, 0x01, 0x1c, 0x00, 0x00, 0x17, 0x00, 0x00, 0x21, 0x00, 0x13, 0x3b, 0x07, 0x10, 0x3d, 0x06, 0x1a, 0x47, 0x0e, 0x11, 0x39, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x1c, 0x00, 0x03, 0x20, 0x01, 0x05, 0x21, 0x12, 0x0c, 0x2f, 0x07, 0x57, 0x86, 0x20, 0x82, 0xcf, 0x33, 0x7a, 0xcb, 0x28, 0x79, 0xcc, 0x18, 0x81, 0xd3, 0x30, 0x7d, 0xcd, 0x36, 0x78, 0xcb, 0x21, 0x86, 0xd5, 0x3e, 0x78, 0xc9, 0x22, 0x1a, 0x44, 0x05, 0x04, 0x20, 0x07, 0x00, 0x1e, 0x01, 0x46, 0x8c, 0x0f, 0x47, 0x99, 0x19, 0x47, 0x96, 0x17, 0x46, 0x93, 0x09, 0x44, 0x96, 0x10, 0x45, 0x98, 0x12, 0x44, 0x92, 0x08, 0x4b, 0x8a, 0x18, 0x00, 0x24, 0x03, 0x00, 0x19, 0x00, 0x97, 0xa3, 0x97, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xf2, 
-    0xff, 0xff, 0xf2, 0xfe, 0xfb, 0xff, 0xf3, 0xfa, 0xe8, 0x24, 0x32, 0x21, 0x03, 0x1f, 0x06, 0x13, 0x45, 0x00, 0x54, 0x9b, 0x17, 0x44, 0x93, 0x13, 0x44, 0x9a, 0x11, 0x4a, 0x98, 0x0e, 0x49, 0x93, 0x18, 0x3d, 0x8e, 0x0e, 0x46, 0x98, 0x08, 0x2f, 0x6b, 0x11, 0x00, 0x20, 0x00, 0x00, 0x18, 0x01, 0x27, 0x5e, 0x0b, 0x7c, 0xc9, 0x23, 0x7e, 0xd2, 0x24, 0x7a, 0xcf, 0x19, 0x7c, 0xc8, 0x27, 0x83, 0xd1, 0x26, 0x7c, 0xd2, 0x27, 0x73, 0xd0, 0x29, 0x7a, 0xce, 0x30, 0x74, 0xc0, 0x20, 0x43, 0x7b, 0x10, 0x17, 0x37, 0x0e, 0x05, 0x1d, 0x07, 0x08, 0x1e, 0x07, 0x00, 0x10, 0x03, 0x08, 0x1f, 0x15, 0x03, 0x1b, 0x0e, 0x00, 0x15, 0x05, 0x09, 0x1f, 0x08, 0x00, 0x18, 0x02, 0x17, 0x3a, 0x10, 0x49, 0x81, 0x14, 0x75, 0xc2, 0x1e, 0x79, 0xce, 0x2b, 0x73, 0xd0, 0x29, 0x79, 0xce, 0x2b, 0x80, 0xce, 0x20, 0x83, 0xd0, 0x2a, 0x7b, 0xce, 0x24, 0x78, 0xca, 0x27, 0x81, 0xcf, 0x24, 0x27, 0x5e, 0x0d, 0x00, 0x18, 0x01, 0x00, 0x20, 0x00, 0x2f, 0x6b, 0x11, 0x46, 0x98, 0x08, 0x3d, 0x8e, 0x0e, 0x49, 0x93, 0x18, 0x4a, 0x98, 0x0e, 0x44, 0x9a, 0x11, 0x44, 0x93, 0x13, 0x54, 0x9b, 0x17, 0x13, 0x45, 0x00, 0x03, 0x1f, 0x06, 0x24, 0x32, 0x21, 0xf3, 0xfa, 0xe8, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xf2, 
-    0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf8, 0xab, 0xb2, 0xaa, 0x02, 0x17, 0x04, 0x00, 0x1e, 0x00, 0x41, 0x80, 0x18, 0x44, 0x8f, 0x0e, 0x42, 0x94, 0x0b, 0x44, 0x95, 0x15, 0x48, 0x97, 0x17, 0x49, 0x9a, 0x11, 0x47, 0x98, 0x18, 0x49, 0x9a, 0x0d, 0x23, 0x58, 0x12, 0x00, 0x20, 0x00, 0x02, 0x1e, 0x07, 0x42, 0x75, 0x18, 0x7f, 0xcc, 0x26, 0x83, 0xd2, 0x39, 0x7c, 0xca, 0x1e, 0x81, 0xce, 0x26, 0x80, 0xd1, 0x2e, 0x79, 0xcf, 0x30, 0x7b, 0xd5, 0x26, 0x7a, 0xd0, 0x23, 0x7f, 0xcf, 0x1e, 0x83, 0xca, 0x22, 0x77, 0xb4, 0x28, 0x59, 0x91, 0x12, 0x50, 0x85, 0x0f, 0x3c, 0x6f, 0x08, 0x40, 0x73, 0x0e, 0x48, 0x7d, 0x07, 0x5b, 0x93, 0x14, 0x83, 0xc2, 0x33, 0x84, 0xce, 0x23, 0x7f, 0xd0, 0x1c, 0x7f, 0xd5, 0x28, 0x78, 0xd2, 0x25, 0x77, 0xcd, 0x2a, 0x7f, 0xcf, 0x30, 0x81, 0xcd, 0x2c, 0x7e, 0xcb, 0x23, 0x84, 0xd3, 0x3c, 0x7c, 0xca, 0x1f, 0x41, 0x74, 0x15, 0x04, 0x1f, 0x0c, 0x00, 0x20, 0x00, 0x23, 0x58, 0x12, 0x49, 0x9a, 0x0d, 0x47, 0x98, 0x18, 0x49, 0x9a, 0x11, 0x48, 0x97, 0x17, 0x44, 0x95, 0x15, 0x42, 0x94, 0x0b, 0x44, 0x8f, 0x0e, 0x41, 0x80, 0x18, 0x00, 0x1e, 0x00, 0x02, 0x17, 0x04, 0xab, 0xb2, 0xaa, 0xff, 0xff, 0xf8, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xfc, 0xff, 0xfb, 0xfe, 0xf3, 0x35, 0x44, 0x3d, 0x00, 0x1d, 0x0b, 0x09, 0x41, 0x00, 0x51, 0x9a, 0x15, 0x4b, 0x97, 0x11, 0x3f, 0x93, 0x17, 0x42, 0x98, 0x0f, 0x48, 0x96, 0x0c, 0x42, 0x92, 0x0f, 0x45, 0x97, 0x17, 0x4b, 0x92, 0x10, 0x1b, 0x42, 0x0d, 0x06, 0x12, 0x08, 0x03, 0x1f, 0x08, 0x27, 0x5e, 0x0b, 0x76, 0xc7, 0x22, 0x81, 0xd4, 0x2e, 0x7c, 0xc8, 0x32, 0x7f, 0xc9, 0x2c, 0x81, 0xce, 0x1c, 0x7f, 0xcb, 0x23, 0x7f, 0xcd, 0x2c, 0x7b, 0xcc, 0x32, 0x7c, 0xd2, 0x31, 0x76, 0xcf, 0x25, 0x76, 0xcf, 0x29, 0x7d, 0xd2, 0x2f, 0x7a, 0xd0, 0x27, 0x7a, 0xcf, 0x2b, 0x7c, 0xd2, 0x31, 0x77, 0xd0, 0x28, 0x75, 0xcf, 0x20, 0x7a, 0xd1, 0x2c, 0x7b, 0xcc, 0x31, 0x81, 0xce, 0x32, 0x81, 0xcc, 0x2b, 0x81, 0xcd, 0x25, 0x82, 0xcd, 0x28, 0x7d, 0xca, 0x2e, 0x7b, 0xcd, 0x2a, 0x78, 0xc9, 0x22, 0x2b, 0x62, 0x11, 0x00, 0x19, 0x06, 0x08, 0x16, 0x00, 0x1b, 0x42, 0x0d, 0x4b, 0x92, 0x10, 0x45, 0x97, 0x17, 0x42, 0x92, 0x0f, 0x48, 0x96, 0x0c, 0x42, 0x98, 0x0f, 0x3f, 0x93, 0x17, 0x4b, 0x97, 0x11, 0x51, 0x9a, 0x15, 0x09, 0x41, 0x00, 0x00, 0x1d, 0x0b, 0x35, 0x44, 0x3d, 0xfb, 0xfe, 0xf3, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xfd, 0xff, 
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xf9, 0xfe, 0xfe, 0xfe, 0xb7, 0xbb, 0xba, 0x0a, 0x1b, 0x09, 0x00, 0x1c, 0x00, 0x40, 0x6f, 0x27, 0x40, 0x98, 0x0e, 0x45, 0x96, 0x13, 0x49, 0x97, 0x10, 0x49, 0x97, 0x0d, 0x42, 0x90, 0x18, 0x46, 0x95, 0x1e, 0x46, 0x97, 0x0a, 0x48, 0x97, 0x08, 0x1b, 0x42, 0x0d, 0x00, 0x1f, 0x00, 0x00, 0x1a, 0x03, 0x16, 0x40, 0x01, 0x76, 0xbb, 0x2d, 0x7d, 0xd2, 0x1c, 0x7e, 0xd2, 0x24, 0x7e, 0xcb, 0x2d, 0x82, 0xcf, 0x27, 0x80, 0xcf, 0x26, 0x7f, 0xce, 0x25, 0x7d, 0xcf, 0x25, 0x7c, 0xce, 0x24, 0x7e, 0xcd, 0x24, 0x7e, 0xcd, 0x22, 0x7f, 0xcd, 0x21, 0x7f, 0xcd, 0x21, 0x7e, 0xcd, 0x22, 0x7e, 0xcd, 0x24, 0x7c, 0xce, 0x24, 0x7d, 0xcf, 0x25, 0x7f, 0xce, 0x25, 0x80, 0xcf, 0x26, 0x82, 0xcf, 0x27, 0x7e, 0xcb, 0x2d, 0x7e, 0xd2, 0x24, 0x7d, 0xd2, 0x1c, 0x76, 0xbb, 0x2d, 0x16, 0x40, 0x01, 0x00, 0x1a, 0x03, 0x00, 0x1f, 0x00, 0x1b, 0x42, 0x0d, 0x48, 0x97, 0x08, 0x46, 0x97, 0x0a, 0x46, 0x95, 0x1e, 0x42, 0x90, 0x18, 0x49, 0x97, 0x0d, 0x49, 0x97, 0x10, 0x45, 0x96, 0x13, 0x40, 0x98, 0x0e, 0x40, 0x6f, 0x27, 0x00, 0x1c, 0x00, 0x0a, 0x1b, 0x09, 0xb7, 0xbb, 0xba, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xf9, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 
-    0xff, 0xfe, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x45, 0x52, 0x48, 0x00, 0x19, 0x00, 0x06, 0x2f, 0x00, 0x44, 0x88, 0x11, 0x46, 0x8f, 0x1a, 0x49, 0x9b, 0x15, 0x43, 0x94, 0x11, 0x4c, 0x9a, 0x10, 0x49, 0x95, 0x11, 0x47, 0x91, 0x22, 0x42, 0x93, 0x06, 0x4c, 0x93, 0x11, 0x22, 0x57, 0x11, 0x00, 0x20, 0x00, 0x02, 0x1e, 0x05, 0x0a, 0x24, 0x07, 0x4b, 0x79, 0x1f, 0x7c, 0xc3, 0x27, 0x7d, 0xd3, 0x2a, 0x78, 0xcc, 0x2e, 0x79, 0xcd, 0x2f, 0x78, 0xce, 0x2d, 0x78, 0xcc, 0x2c, 0x7a, 0xce, 0x2e, 0x7f, 0xd1, 0x31, 0x7f, 0xcf, 0x30, 0x7e, 0xcb, 0x2f, 0x7e, 0xcb, 0x2f, 0x7f, 0xcf, 0x30, 0x7f, 0xd1, 0x31, 0x7a, 0xce, 0x2e, 0x78, 0xcc, 0x2c, 0x78, 0xce, 0x2d, 0x79, 0xcd, 0x2f, 0x78, 0xcc, 0x2e, 0x7d, 0xd3, 0x2a, 0x7c, 0xc3, 0x27, 0x4b, 0x79, 0x1f, 0x0a, 0x24, 0x07, 0x02, 0x1e, 0x05, 0x00, 0x20, 0x00, 0x22, 0x57, 0x11, 0x4c, 0x93, 0x11, 0x42, 0x93, 0x06, 0x47, 0x91, 0x22, 0x49, 0x95, 0x11, 0x4c, 0x9a, 0x10, 0x43, 0x94, 0x11, 0x49, 0x9b, 0x15, 0x46, 0x8f, 0x1a, 0x44, 0x88, 0x11, 0x06, 0x2f, 0x00, 0x00, 0x19, 0x00, 0x45, 0x52, 0x48, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xff, 
-    0xfc, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xfe, 0xf9, 0xf8, 0xfd, 0xe9, 0xef, 0xed, 0x18, 0x2b, 0x18, 0x00, 0x18, 0x00, 0x0c, 0x32, 0x00, 0x49, 0x8a, 0x12, 0x44, 0x97, 0x15, 0x41, 0x99, 0x0f, 0x48, 0x97, 0x0a, 0x4e, 0x95, 0x15, 0x4c, 0x98, 0x14, 0x49, 0x98, 0x21, 0x40, 0x92, 0x12, 0x4b, 0x9c, 0x0f, 0x32, 0x6e, 0x14, 0x00, 0x21, 0x04, 0x05, 0x16, 0x06, 0x03, 0x15, 0x05, 0x14, 0x3c, 0x08, 0x4d, 0x92, 0x15, 0x84, 0xd2, 0x24, 0x7f, 0xce, 0x23, 0x7c, 0xcd, 0x28, 0x7e, 0xd0, 0x2e, 0x7c, 0xd0, 0x30, 0x7a, 0xcf, 0x2b, 0x79, 0xcf, 0x26, 0x7b, 0xd1, 0x26, 0x7b, 0xd1, 0x26, 0x79, 0xcf, 0x26, 0x7a, 0xcf, 0x2b, 0x7c, 0xd0, 0x30, 0x7e, 0xd0, 0x2e, 0x7c, 0xcd, 0x28, 0x7f, 0xce, 0x23, 0x84, 0xd2, 0x24, 0x4d, 0x92, 0x15, 0x14, 0x3c, 0x08, 0x03, 0x15, 0x05, 0x05, 0x16, 0x06, 0x00, 0x21, 0x04, 0x32, 0x6e, 0x14, 0x4b, 0x9c, 0x0f, 0x40, 0x92, 0x12, 0x49, 0x98, 0x21, 0x4c, 0x98, 0x14, 0x4e, 0x95, 0x15, 0x48, 0x97, 0x0a, 0x41, 0x99, 0x0f, 0x44, 0x97, 0x15, 0x49, 0x8a, 0x12, 0x0c, 0x32, 0x00, 0x00, 0x18, 0x00, 0x18, 0x2b, 0x18, 0xe9, 0xef, 0xed, 0xf9, 0xf8, 0xfd, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xfb, 0xff, 
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfa, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xc3, 0xce, 0xc8, 0x11, 0x23, 0x15, 0x02, 0x1a, 0x02, 0x1c, 0x4b, 0x05, 0x45, 0x93, 0x0c, 0x40, 0x97, 0x08, 0x46, 0x99, 0x17, 0x42, 0x91, 0x04, 0x49, 0x97, 0x0d, 0x41, 0x8f, 0x17, 0x47, 0x97, 0x14, 0x46, 0x97, 0x17, 0x41, 0x92, 0x05, 0x41, 0x87, 0x0a, 0x19, 0x49, 0x0b, 0x00, 0x1e, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x14, 0x06, 0x09, 0x2d, 0x00, 0x33, 0x5d, 0x13, 0x63, 0x98, 0x24, 0x7c, 0xbd, 0x23, 0x83, 0xcd, 0x1e, 0x82, 0xd2, 0x23, 0x7e, 0xd0, 0x2d, 0x77, 0xca, 0x32, 0x77, 0xca, 0x32, 0x7e, 0xd0, 0x2d, 0x82, 0xd2, 0x23, 0x83, 0xcd, 0x1e, 0x7c, 0xbd, 0x23, 0x63, 0x98, 0x24, 0x33, 0x5d, 0x13, 0x09, 0x2d, 0x00, 0x00, 0x14, 0x06, 0x00, 0x1c, 0x00, 0x00, 0x1e, 0x00, 0x19, 0x49, 0x0b, 0x41, 0x87, 0x0a, 0x41, 0x92, 0x05, 0x46, 0x97, 0x17, 0x47, 0x97, 0x14, 0x41, 0x8f, 0x17, 0x49, 0x97, 0x0d, 0x42, 0x91, 0x04, 0x46, 0x99, 0x17, 0x40, 0x97, 0x08, 0x45, 0x93, 0x0c, 0x1c, 0x4b, 0x05, 0x02, 0x1a, 0x02, 0x11, 0x23, 0x15, 0xc3, 0xce, 0xc8, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xfc, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfc, 0xfe, 0xf9, 0xfd, 0xfe, 0xf9, 0xff, 0xff, 0xfd, 0xfe, 0xfc, 0xfd, 0xfb, 0xff, 0xfe, 0x9c, 0xa7, 0xa3, 0x00, 0x18, 0x00, 0x00, 0x1e, 0x06, 0x25, 0x5a, 0x0a, 0x4b, 0x97, 0x11, 0x43, 0x9a, 0x0b, 0x41, 0x99, 0x0f, 0x46, 0x97, 0x14, 0x4c, 0x9a, 0x10, 0x45, 0x93, 0x09, 0x47, 0x98, 0x0f, 0x43, 0x94, 0x14, 0x49, 0x9b, 0x1b, 0x42, 0x96, 0x0c, 0x42, 0x88, 0x18, 0x12, 0x3d, 0x07, 0x08, 0x20, 0x0a, 0x00, 0x19, 0x04, 0x00, 0x17, 0x01, 0x01, 0x1e, 0x02, 0x0c, 0x2c, 0x07, 0x15, 0x3b, 0x08, 0x20, 0x4b, 0x06, 0x30, 0x60, 0x0c, 0x40, 0x73, 0x16, 0x40, 0x73, 0x16, 0x30, 0x60, 0x0c, 0x20, 0x4b, 0x06, 0x15, 0x3b, 0x08, 0x0c, 0x2c, 0x07, 0x01, 0x1e, 0x02, 0x00, 0x17, 0x01, 0x00, 0x19, 0x04, 0x08, 0x20, 0x0a, 0x12, 0x3d, 0x07, 0x42, 0x88, 0x18, 0x42, 0x96, 0x0c, 0x49, 0x9b, 0x1b, 0x43, 0x94, 0x14, 0x47, 0x98, 0x0f, 0x45, 0x93, 0x09, 0x4c, 0x9a, 0x10, 0x46, 0x97, 0x14, 0x41, 0x99, 0x0f, 0x43, 0x9a, 0x0b, 0x4b, 0x97, 0x11, 0x25, 0x5a, 0x0a, 0x00, 0x1e, 0x06, 0x00, 0x18, 0x00, 0x9c, 0xa7, 0xa3, 0xfb, 0xff, 0xfe, 0xfe, 0xfc, 0xfd, 0xff, 0xff, 0xfd, 0xfd, 0xfe, 0xf9, 0xfc, 0xfe, 0xf9, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xfb, 0xf8, 0xfa, 0xf5, 0xfe, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xfc, 0xf8, 0xf5, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xfe, 0xfb, 0xff, 0xff, 0x6e, 0x80, 0x70, 0x04, 0x1a, 0x03, 0x01, 0x1e, 0x0a, 0x21, 0x56, 0x06, 0x43, 0x91, 0x0a, 0x43, 0x96, 0x14, 0x49, 0x9b, 0x15, 0x43, 0x91, 0x0a, 0x45, 0x9b, 0x12, 0x47, 0x96, 0x16, 0x49, 0x93, 0x18, 0x42, 0x91, 0x11, 0x43, 0x9a, 0x0f, 0x40, 0x94, 0x0a, 0x4e, 0x96, 0x19, 0x3f, 0x79, 0x0b, 0x2a, 0x5c, 0x1d, 0x0c, 0x3b, 0x07, 0x00, 0x1d, 0x00, 0x00, 0x19, 0x04, 0x01, 0x1c, 0x0d, 0x01, 0x18, 0x04, 0x01, 0x18, 0x00, 0x06, 0x1e, 0x00, 0x06, 0x1e, 0x00, 0x01, 0x18, 0x00, 0x01, 0x18, 0x04, 0x01, 0x1c, 0x0d, 0x00, 0x19, 0x04, 0x00, 0x1d, 0x00, 0x0c, 0x3b, 0x07, 0x2a, 0x5c, 0x1d, 0x3f, 0x79, 0x0b, 0x4e, 0x96, 0x19, 0x40, 0x94, 0x0a, 0x43, 0x9a, 0x0f, 0x42, 0x91, 0x11, 0x49, 0x93, 0x18, 0x47, 0x96, 0x16, 0x45, 0x9b, 0x12, 0x43, 0x91, 0x0a, 0x49, 0x9b, 0x15, 0x43, 0x96, 0x14, 0x43, 0x91, 0x0a, 0x21, 0x56, 0x06, 0x01, 0x1e, 0x0a, 0x04, 0x1a, 0x03, 0x6e, 0x80, 0x70, 0xfb, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfd, 0xfc, 0xf8, 0xf5, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xfb, 0xf8, 0xfa, 0xf5, 0xff, 0xff, 0xfb, 
-    0xfd, 0xfc, 0xf8, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfd, 0xf9, 0xf8, 0xff, 0xff, 0xfd, 0xf8, 0xfa, 0xf9, 0xfb, 0xff, 0xfb, 0x4d, 0x59, 0x4f, 0x04, 0x1a, 0x03, 0x00, 0x1c, 0x04, 0x1d, 0x4c, 0x06, 0x4c, 0x8d, 0x15, 0x4a, 0x93, 0x1e, 0x45, 0x97, 0x11, 0x3e, 0x92, 0x16, 0x45, 0x96, 0x16, 0x4a, 0x98, 0x0e, 0x49, 0x96, 0x0c, 0x4c, 0x99, 0x19, 0x49, 0x98, 0x18, 0x3f, 0x92, 0x02, 0x49, 0x9e, 0x05, 0x44, 0x96, 0x06, 0x4a, 0x96, 0x10, 0x42, 0x87, 0x10, 0x2d, 0x69, 0x07, 0x21, 0x56, 0x06, 0x22, 0x50, 0x12, 0x19, 0x43, 0x11, 0x0c, 0x33, 0x07, 0x0c, 0x33, 0x07, 0x19, 0x43, 0x11, 0x22, 0x50, 0x12, 0x21, 0x56, 0x06, 0x2d, 0x69, 0x07, 0x42, 0x87, 0x10, 0x4a, 0x96, 0x10, 0x44, 0x96, 0x06, 0x49, 0x9e, 0x05, 0x3f, 0x92, 0x02, 0x49, 0x98, 0x18, 0x4c, 0x99, 0x19, 0x49, 0x96, 0x0c, 0x4a, 0x98, 0x0e, 0x45, 0x96, 0x16, 0x3e, 0x92, 0x16, 0x45, 0x97, 0x11, 0x4a, 0x93, 0x1e, 0x4c, 0x8d, 0x15, 0x1d, 0x4c, 0x06, 0x00, 0x1c, 0x04, 0x04, 0x1a, 0x03, 0x4d, 0x59, 0x4f, 0xfb, 0xff, 0xfb, 0xf8, 0xfa, 0xf9, 0xff, 0xff, 0xfd, 0xfd, 0xf9, 0xf8, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfd, 0xfc, 0xf8, 
-    0xff, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xfa, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xfc, 0xfa, 0xfe, 0xff, 0xff, 0xfe, 0xfa, 0xfb, 0xfb, 0xff, 0xfb, 0x6f, 0x81, 0x71, 0x00, 0x18, 0x00, 0x05, 0x1d, 0x05, 0x0a, 0x30, 0x00, 0x3f, 0x83, 0x0c, 0x44, 0x9c, 0x12, 0x4b, 0x97, 0x11, 0x44, 0x96, 0x0d, 0x3f, 0x95, 0x0e, 0x4a, 0x9c, 0x16, 0x45, 0x8e, 0x09, 0x4b, 0x94, 0x11, 0x48, 0x97, 0x18, 0x40, 0x96, 0x17, 0x45, 0x98, 0x12, 0x46, 0x97, 0x14, 0x46, 0x97, 0x14, 0x47, 0x97, 0x14, 0x46, 0x96, 0x13, 0x44, 0x96, 0x10, 0x43, 0x97, 0x0e, 0x43, 0x97, 0x0e, 0x43, 0x97, 0x0e, 0x43, 0x97, 0x0e, 0x44, 0x96, 0x10, 0x46, 0x96, 0x13, 0x47, 0x97, 0x14, 0x46, 0x97, 0x14, 0x46, 0x97, 0x14, 0x45, 0x98, 0x12, 0x40, 0x96, 0x17, 0x48, 0x97, 0x18, 0x4b, 0x94, 0x11, 0x45, 0x8e, 0x09, 0x4a, 0x9c, 0x16, 0x3f, 0x95, 0x0e, 0x44, 0x96, 0x0d, 0x4b, 0x97, 0x11, 0x44, 0x9c, 0x12, 0x3f, 0x83, 0x0c, 0x0a, 0x30, 0x00, 0x05, 0x1d, 0x05, 0x00, 0x18, 0x00, 0x6f, 0x81, 0x71, 0xfb, 0xff, 0xfb, 0xfe, 0xfa, 0xfb, 0xfe, 0xff, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfe, 0xfd, 0xff, 0xfe, 0xff, 0xfa, 0xfb, 0xff, 0xfb, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xfd, 0xfa, 0xff, 0xfe, 0xa0, 0xab, 0xa5, 0x0e, 0x20, 0x10, 0x00, 0x1b, 0x00, 0x02, 0x2b, 0x00, 0x3f, 0x6e, 0x28, 0x49, 0x9a, 0x0d, 0x41, 0x91, 0x0e, 0x46, 0x96, 0x19, 0x46, 0x99, 0x17, 0x3e, 0x92, 0x09, 0x48, 0x99, 0x10, 0x4a, 0x98, 0x10, 0x46, 0x92, 0x0b, 0x45, 0x96, 0x15, 0x44, 0x95, 0x14, 0x44, 0x95, 0x12, 0x46, 0x96, 0x11, 0x45, 0x95, 0x10, 0x46, 0x96, 0x11, 0x46, 0x96, 0x11, 0x45, 0x95, 0x10, 0x45, 0x95, 0x10, 0x46, 0x96, 0x11, 0x46, 0x96, 0x11, 0x45, 0x95, 0x10, 0x46, 0x96, 0x11, 0x44, 0x95, 0x12, 0x44, 0x95, 0x14, 0x45, 0x96, 0x15, 0x47, 0x93, 0x0c, 0x4b, 0x99, 0x11, 0x48, 0x99, 0x10, 0x3d, 0x91, 0x08, 0x45, 0x98, 0x16, 0x45, 0x95, 0x18, 0x41, 0x91, 0x0e, 0x49, 0x9a, 0x0d, 0x3f, 0x6e, 0x28, 0x02, 0x2b, 0x00, 0x00, 0x1b, 0x00, 0x0e, 0x20, 0x10, 0xa0, 0xab, 0xa5, 0xfa, 0xff, 0xfe, 0xfc, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfb, 0xfb, 0xff, 0xfc, 0xc3, 0xce, 0xc6, 0x17, 0x2a, 0x17, 0x00, 0x1c, 0x00, 0x00, 0x1e, 0x00, 0x10, 0x43, 0x0a, 0x40, 0x7e, 0x19, 0x50, 0x99, 0x0a, 0x45, 0x95, 0x00, 0x4c, 0x9c, 0x15, 0x41, 0x92, 0x12, 0x43, 0x94, 0x14, 0x4b, 0x9c, 0x1c, 0x45, 0x97, 0x0e, 0x45, 0x97, 0x0e, 0x46, 0x97, 0x0e, 0x47, 0x97, 0x10, 0x47, 0x97, 0x12, 0x46, 0x96, 0x13, 0x47, 0x96, 0x16, 0x48, 0x97, 0x18, 0x48, 0x97, 0x18, 0x47, 0x96, 0x16, 0x46, 0x96, 0x13, 0x47, 0x97, 0x12, 0x47, 0x97, 0x10, 0x46, 0x97, 0x0e, 0x45, 0x97, 0x0e, 0x45, 0x97, 0x0e, 0x49, 0x9a, 0x1a, 0x42, 0x93, 0x13, 0x42, 0x93, 0x13, 0x4e, 0x9e, 0x17, 0x46, 0x96, 0x01, 0x51, 0x9a, 0x0b, 0x3f, 0x7d, 0x18, 0x0e, 0x41, 0x08, 0x00, 0x1e, 0x00, 0x00, 0x1c, 0x00, 0x17, 0x2a, 0x17, 0xc3, 0xce, 0xc6, 0xfb, 0xff, 0xfc, 0xfd, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfd, 0xf9, 0xf8, 0xff, 0xff, 0xfd, 0xfa, 0xf8, 0xf9, 0xfc, 0xfd, 0xff, 0xe7, 0xed, 0xeb, 0x49, 0x56, 0x4c, 0x05, 0x16, 0x04, 0x01, 0x1b, 0x00, 0x00, 0x22, 0x01, 0x16, 0x43, 0x0a, 0x48, 0x85, 0x1e, 0x4b, 0x94, 0x0f, 0x46, 0x97, 0x0e, 0x44, 0x98, 0x0f, 0x3d, 0x94, 0x09, 0x46, 0x97, 0x0c, 0x47, 0x98, 0x0d, 0x45, 0x96, 0x09, 0x45, 0x96, 0x09, 0x45, 0x98, 0x0a, 0x44, 0x97, 0x0b, 0x43, 0x95, 0x0c, 0x45, 0x97, 0x0e, 0x45, 0x97, 0x0e, 0x43, 0x95, 0x0c, 0x44, 0x97, 0x0b, 0x45, 0x98, 0x0a, 0x45, 0x96, 0x09, 0x45, 0x96, 0x09, 0x47, 0x98, 0x0d, 0x46, 0x97, 0x0c, 0x40, 0x97, 0x0c, 0x45, 0x99, 0x10, 0x45, 0x96, 0x0d, 0x48, 0x91, 0x0c, 0x45, 0x82, 0x1b, 0x15, 0x42, 0x09, 0x01, 0x23, 0x02, 0x04, 0x1e, 0x01, 0x05, 0x16, 0x04, 0x49, 0x56, 0x4c, 0xe7, 0xed, 0xeb, 0xfc, 0xfd, 0xff, 0xfa, 0xf8, 0xf9, 0xff, 0xff, 0xfd, 0xfd, 0xf9, 0xf8, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xfb, 0xf7, 0xf4, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xfc, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xbb, 0xbf, 0xbe, 0x34, 0x3e, 0x3f, 0x06, 0x17, 0x07, 0x03, 0x1d, 0x00, 0x00, 0x1f, 0x00, 0x1d, 0x4f, 0x10, 0x3c, 0x7d, 0x15, 0x44, 0x8f, 0x0e, 0x4e, 0x9b, 0x19, 0x46, 0x90, 0x1d, 0x4b, 0x96, 0x20, 0x4a, 0x96, 0x1c, 0x46, 0x95, 0x16, 0x47, 0x97, 0x14, 0x46, 0x98, 0x12, 0x44, 0x96, 0x0e, 0x45, 0x97, 0x0f, 0x45, 0x97, 0x0f, 0x44, 0x96, 0x0e, 0x46, 0x98, 0x12, 0x47, 0x97, 0x14, 0x46, 0x95, 0x16, 0x4a, 0x96, 0x1c, 0x4b, 0x96, 0x20, 0x46, 0x90, 0x1d, 0x4b, 0x98, 0x16, 0x43, 0x8e, 0x0d, 0x3e, 0x7f, 0x17, 0x20, 0x52, 0x13, 0x00, 0x23, 0x00, 0x04, 0x1e, 0x01, 0x05, 0x16, 0x06, 0x30, 0x3a, 0x3b, 0xbb, 0xbf, 0xbe, 0xfe, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfb, 0xf7, 0xf4, 0xff, 0xfe, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfb, 0xfa, 0xff, 0xfa, 0xa9, 0xb3, 0xaa, 0x24, 0x36, 0x20, 0x05, 0x1f, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x1b, 0x01, 0x02, 0x2e, 0x00, 0x14, 0x48, 0x00, 0x37, 0x7b, 0x02, 0x43, 0x89, 0x0d, 0x4c, 0x92, 0x16, 0x4a, 0x92, 0x14, 0x46, 0x91, 0x10, 0x49, 0x94, 0x13, 0x4a, 0x97, 0x17, 0x4b, 0x98, 0x18, 0x4b, 0x98, 0x18, 0x4a, 0x97, 0x17, 0x49, 0x94, 0x13, 0x46, 0x91, 0x10, 0x4a, 0x92, 0x14, 0x4c, 0x92, 0x16, 0x43, 0x89, 0x0d, 0x37, 0x7b, 0x02, 0x17, 0x4b, 0x00, 0x04, 0x30, 0x00, 0x00, 0x19, 0x00, 0x00, 0x1b, 0x00, 0x02, 0x1c, 0x00, 0x23, 0x35, 0x1f, 0xaa, 0xb4, 0xab, 0xfb, 0xff, 0xfb, 0xfd, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfa, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xf9, 0xfb, 0xfa, 0xfe, 0xff, 0xfb, 0xfd, 0xff, 0xfa, 0xfe, 0xfe, 0xfc, 0xfa, 0xfa, 0xfa, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfa, 0xfc, 0xff, 0xfb, 0xfc, 0xff, 0xf6, 0xf2, 0xf9, 0xf1, 0x9a, 0xa4, 0xa3, 0x3a, 0x49, 0x42, 0x03, 0x16, 0x00, 0x02, 0x18, 0x01, 0x0a, 0x20, 0x13, 0x00, 0x1a, 0x00, 0x00, 0x29, 0x03, 0x11, 0x3c, 0x0e, 0x19, 0x49, 0x0d, 0x1b, 0x4f, 0x05, 0x23, 0x5a, 0x06, 0x2c, 0x67, 0x0b, 0x2f, 0x6d, 0x0c, 0x2f, 0x6d, 0x0c, 0x2c, 0x67, 0x0b, 0x23, 0x5a, 0x06, 0x1b, 0x4f, 0x05, 0x19, 0x49, 0x0d, 0x11, 0x3c, 0x0e, 0x00, 0x29, 0x03, 0x00, 0x1a, 0x00, 0x08, 0x1e, 0x11, 0x01, 0x17, 0x00, 0x05, 0x18, 0x02, 0x3d, 0x4c, 0x45, 0x9d, 0xa7, 0xa6, 0xf3, 0xfa, 0xf2, 0xfb, 0xff, 0xf5, 0xf9, 0xfe, 0xf8, 0xff, 0xff, 0xfa, 0xff, 0xff, 0xfd, 0xfa, 0xfa, 0xfa, 0xfe, 0xfe, 0xfc, 0xfd, 0xff, 0xfa, 0xfe, 0xff, 0xfb, 0xf9, 0xfb, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xfd, 0xf8, 0xfc, 0xfa, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xef, 0xf5, 0xf5, 0x9b, 0xa2, 0x9a, 0x4d, 0x59, 0x43, 0x11, 0x25, 0x0c, 0x02, 0x16, 0x00, 0x00, 0x16, 0x00, 0x03, 0x1d, 0x02, 0x00, 0x1c, 0x00, 0x00, 0x1d, 0x03, 0x00, 0x20, 0x08, 0x00, 0x1d, 0x04, 0x00, 0x1d, 0x04, 0x00, 0x20, 0x08, 0x00, 0x1d, 0x03, 0x00, 0x1c, 0x00, 0x03, 0x1d, 0x02, 0x00, 0x16, 0x00, 0x02, 0x16, 0x00, 0x11, 0x25, 0x0c, 0x4f, 0x5b, 0x45, 0x9c, 0xa3, 0x9b, 0xee, 0xf4, 0xf4, 0xfb, 0xff, 0xfe, 0xfc, 0xfe, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfd, 0xfb, 0xfc, 0xfc, 0xfd, 0xf8, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfd, 0xfe, 0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xfa, 0xfa, 0xf8, 0xff, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xfd, 0xf4, 0xff, 0xfd, 0xf6, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xfb, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xf1, 0xf3, 0xf2, 0xb8, 0xbd, 0xb9, 0x8f, 0x96, 0x8e, 0x79, 0x83, 0x78, 0x5d, 0x6b, 0x5a, 0x40, 0x51, 0x3e, 0x29, 0x3c, 0x28, 0x11, 0x27, 0x12, 0x11, 0x27, 0x12, 0x29, 0x3c, 0x28, 0x40, 0x51, 0x3e, 0x5d, 0x6b, 0x5a, 0x79, 0x83, 0x78, 0x8f, 0x96, 0x8e, 0xb8, 0xbd, 0xb9, 0xf1, 0xf3, 0xf2, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xf7, 0xff, 0xfd, 0xf4, 0xff, 0xfd, 0xfd, 0xff, 0xfa, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xf8, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+static const uint16_t image_data_ON[4096] = {
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 
+    0xffdf, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xfffe, 0xfffe, 0xffff, 0xffdf, 0xffff, 0xffff, 
+    0xf79e, 0xbdf7, 0x8cb1, 0x7c0f, 0x5b4b, 0x4287, 0x29e5, 0x1122, 0x1122, 0x29e5, 0x4287, 0x5b4b, 
+    0x7c0f, 0x8cb1, 0xbdf7, 0xf79e, 0xffff, 0xffff, 0xffdf, 0xffff, 0xfffe, 0xfffe, 0xffff, 0xffdf, 
+    0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xefbe, 0x9d13, 0x4ac8, 0x1121, 0x00a0, 0x00a0, 0x00e0, 0x00e0, 0x00e0, 0x0101, 0x00e0, 
+    0x00e0, 0x0101, 0x00e0, 0x00e0, 0x00e0, 0x00a0, 0x00a0, 0x1121, 0x4ac8, 0x9d13, 0xefbe, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 
+    0xffff, 0xfffe, 0xf7de, 0x9d34, 0x3a48, 0x00a0, 0x00c0, 0x0902, 0x00c0, 0x0140, 0x11e1, 0x1a41, 
+    0x1a60, 0x22c0, 0x2b21, 0x2b61, 0x2b61, 0x2b21, 0x22c0, 0x1a60, 0x1a41, 0x11e1, 0x0140, 0x00c0, 
+    0x08e2, 0x00a0, 0x00c0, 0x3a68, 0x9d34, 0xf7de, 0xfffe, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 
+    0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad95, 0x21a4, 0x00e0, 0x00e0, 0x00c0, 0x0160, 0x1240, 
+    0x33c0, 0x4441, 0x4c82, 0x4c82, 0x4482, 0x4ca2, 0x4ca2, 0x4cc3, 0x4cc3, 0x4ca2, 0x4ca2, 0x4482, 
+    0x4c82, 0x4c82, 0x4441, 0x33c0, 0x1240, 0x0180, 0x00c0, 0x00c0, 0x00e0, 0x21a3, 0xadb5, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffbe, 0xffff, 0xffff, 0xffdf, 0xffff, 0xbdf7, 0x31e7, 0x00a0, 0x00e0, 0x00e0, 
+    0x1a62, 0x3be2, 0x4461, 0x4cc3, 0x4483, 0x4ca4, 0x4ca3, 0x44a2, 0x44a2, 0x44c2, 0x44a1, 0x44a1, 
+    0x44a1, 0x44a1, 0x44c2, 0x44a2, 0x44a2, 0x4ca3, 0x4ca4, 0x4483, 0x4cc2, 0x4461, 0x3be2, 0x2282, 
+    0x0100, 0x00e0, 0x00a0, 0x31c7, 0xbdf7, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffbe, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffdf, 0xffff, 0xe77d, 0x4aa9, 0x00a0, 
+    0x00c0, 0x0100, 0x1201, 0x4c23, 0x4ca1, 0x44a1, 0x44c1, 0x3ca1, 0x44a1, 0x44c1, 0x44a1, 0x44a1, 
+    0x44c1, 0x44a1, 0x44a1, 0x44a1, 0x44a1, 0x44a1, 0x44a1, 0x44c1, 0x44a1, 0x44a1, 0x44c1, 0x44a1, 
+    0x44a1, 0x44c2, 0x44a1, 0x4c81, 0x4403, 0x1201, 0x0100, 0x00e0, 0x00a0, 0x4aa9, 0xe77d, 0xffff, 
+    0xffdf, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xc678, 0x1142, 0x00e0, 0x00e0, 0x1201, 0x43e3, 0x54c1, 0x44a0, 0x4ce2, 0x4482, 0x44a2, 0x4ce3, 
+    0x44a1, 0x44a1, 0x44a1, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 0x4ca3, 0x4ca3, 0x44a2, 0x44a2, 0x44a2, 
+    0x44a2, 0x44a1, 0x44a1, 0x44a1, 0x4cc3, 0x4482, 0x4482, 0x4ce2, 0x44a0, 0x54c1, 0x3be3, 0x0a01, 
+    0x00e0, 0x00e0, 0x1142, 0xc678, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xa554, 0x0902, 0x00c0, 0x0140, 0x3b65, 0x4cc1, 0x4481, 0x44a3, 0x44c2, 
+    0x3c81, 0x4cc2, 0x4cc2, 0x4481, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 
+    0x44a2, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 0x4481, 0x4cc2, 0x4cc2, 0x3c81, 
+    0x44c2, 0x44a3, 0x4481, 0x4cc1, 0x3b65, 0x0140, 0x00c0, 0x0902, 0xa554, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0x6c0e, 0x00c0, 0x00e0, 0x0980, 0x3c01, 0x44e2, 
+    0x4ca2, 0x44a1, 0x3ca1, 0x4ce2, 0x4461, 0x4ca2, 0x4ca3, 0x44a2, 0x44c2, 0x4ca3, 0x4ca1, 0x4482, 
+    0x4ca4, 0x44a1, 0x44a1, 0x44a1, 0x44a1, 0x44a1, 0x44a1, 0x4ca4, 0x4482, 0x4ca1, 0x4ca3, 0x44c2, 
+    0x44a2, 0x4ca3, 0x4ca2, 0x4461, 0x4ce2, 0x3ca1, 0x44a1, 0x4ca2, 0x44e2, 0x3c01, 0x0980, 0x00e0, 
+    0x00c0, 0x6c0e, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffdf, 0xffff, 0x4ac9, 0x00c0, 0x00e0, 
+    0x1a60, 0x4c62, 0x4c83, 0x44a2, 0x3c82, 0x44a2, 0x4cc1, 0x4ca1, 0x4cc3, 0x4cc3, 0x3c80, 0x4ce0, 
+    0x44a0, 0x4c82, 0x4400, 0x2b20, 0x22c0, 0x1a80, 0x1201, 0x11a1, 0x11a1, 0x1201, 0x1a80, 0x22c0, 
+    0x2b20, 0x4400, 0x4c82, 0x44a0, 0x4ce0, 0x3c80, 0x4cc3, 0x4cc3, 0x4ca1, 0x4cc1, 0x44a2, 0x3c82, 
+    0x44a2, 0x4c83, 0x4c62, 0x1a60, 0x00e0, 0x00c0, 0x4ac9, 0xffff, 0xffdf, 0xffff, 0xffdf, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffde, 0xffff, 0xffff, 0xffde, 0xffff, 0xffff, 0xffff, 
+    0x6c0e, 0x00c0, 0x00e1, 0x22a0, 0x4481, 0x44a2, 0x4cc2, 0x4481, 0x44c2, 0x44a2, 0x4c83, 0x4482, 
+    0x44c1, 0x44a1, 0x4ca3, 0x3bc1, 0x22e1, 0x09c0, 0x0120, 0x0101, 0x00c0, 0x00e0, 0x00c0, 0x00a0, 
+    0x00a0, 0x00c0, 0x00e0, 0x00c0, 0x0101, 0x0120, 0x09c0, 0x22e1, 0x3bc1, 0x4ca3, 0x44a1, 0x44c1, 
+    0x4482, 0x4c83, 0x44a2, 0x44c2, 0x4481, 0x4cc2, 0x44a2, 0x4481, 0x22a0, 0x00e1, 0x00c0, 0x6c0e, 
+    0xffff, 0xffff, 0xffff, 0xffde, 0xffff, 0xffff, 0xffde, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0x9d34, 0x00c0, 0x00e0, 0x22c1, 0x4ca2, 0x44c1, 0x44c1, 0x44a2, 0x4cc2, 
+    0x4481, 0x44c1, 0x44a2, 0x4cc3, 0x44a1, 0x4443, 0x11e0, 0x0901, 0x00c0, 0x00c0, 0x00a0, 0x0100, 
+    0x11c0, 0x2282, 0x2ae3, 0x4383, 0x4383, 0x2ae3, 0x2282, 0x11c0, 0x0100, 0x00a0, 0x00c0, 0x00c0, 
+    0x0901, 0x11e0, 0x4443, 0x44a1, 0x4cc3, 0x44a2, 0x44c1, 0x4481, 0x4cc2, 0x44a2, 0x44c1, 0x44c1, 
+    0x4ca2, 0x22c1, 0x00e0, 0x00c0, 0x9d34, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc679, 0x1102, 0x00c0, 0x1a40, 0x4481, 0x44a1, 
+    0x44c2, 0x4480, 0x4ca1, 0x4462, 0x44a2, 0x44a2, 0x4480, 0x4421, 0x1a41, 0x00e0, 0x00e0, 0x00a0, 
+    0x0961, 0x32c3, 0x64a5, 0x8626, 0x8664, 0x7e64, 0x7e84, 0x7e44, 0x7e44, 0x7e84, 0x7e64, 0x8664, 
+    0x8626, 0x64a5, 0x32c3, 0x0961, 0x00a0, 0x00e0, 0x00e0, 0x1a41, 0x4421, 0x4480, 0x44a2, 0x44a2, 
+    0x4462, 0x4ca1, 0x4480, 0x44c2, 0x44a1, 0x4481, 0x1a40, 0x00c0, 0x1102, 0xc679, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffdf, 0xef7d, 0x1943, 0x00c0, 
+    0x0980, 0x4c42, 0x44a2, 0x44c1, 0x4ca1, 0x4ca2, 0x4cc2, 0x4cc4, 0x4482, 0x4ce1, 0x3362, 0x0100, 
+    0x00a0, 0x00a0, 0x11e1, 0x4c82, 0x7e44, 0x86a4, 0x7e64, 0x7e64, 0x7e86, 0x7644, 0x86a3, 0x7e45, 
+    0x7e45, 0x86a3, 0x7644, 0x7e86, 0x7e64, 0x7e64, 0x86a4, 0x7e44, 0x4c82, 0x11e1, 0x00a0, 0x00a0, 
+    0x0100, 0x3362, 0x4ce1, 0x4482, 0x4cc4, 0x4cc2, 0x4ca2, 0x4ca1, 0x44c1, 0x44a2, 0x4c42, 0x0980, 
+    0x00c0, 0x1943, 0xef7d, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0x4289, 0x00c0, 0x0160, 0x4442, 0x4463, 0x4cc2, 0x44a2, 0x4cc2, 0x4ca2, 0x4484, 0x4480, 
+    0x4c82, 0x22a2, 0x0100, 0x00e0, 0x0920, 0x4bc3, 0x7e04, 0x7e85, 0x7e85, 0x7e85, 0x7e64, 0x7663, 
+    0x7e66, 0x8666, 0x7e05, 0x1a81, 0x1a81, 0x7e05, 0x8666, 0x7e66, 0x7663, 0x7e64, 0x7e85, 0x7e85, 
+    0x7e85, 0x7e04, 0x4bc3, 0x0920, 0x00e0, 0x0100, 0x22a2, 0x4c82, 0x4480, 0x4484, 0x4ca2, 0x4cc2, 
+    0x44a2, 0x4cc2, 0x4463, 0x4442, 0x0160, 0x00c0, 0x4289, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xb5d7, 0x08c1, 0x00e0, 0x4364, 0x44c1, 0x44a2, 0x4ca2, 0x4ca1, 
+    0x4483, 0x44a3, 0x44a1, 0x4ca1, 0x1a01, 0x00e0, 0x00c0, 0x1200, 0x75c5, 0x7e83, 0x7e84, 0x7e45, 
+    0x7e65, 0x7e45, 0x8665, 0x7e84, 0x8686, 0x7e44, 0x75a3, 0x00e1, 0x00e1, 0x75a3, 0x7e44, 0x8686, 
+    0x7e84, 0x8665, 0x7e45, 0x7e65, 0x7e45, 0x7e84, 0x7e83, 0x75c5, 0x1200, 0x00c0, 0x00e0, 0x1a01, 
+    0x4ca1, 0x44a1, 0x44a3, 0x4483, 0x4ca1, 0x4ca2, 0x44a2, 0x44c1, 0x4364, 0x00e0, 0x08c1, 0xb5d7, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffe, 0xffff, 0xfffe, 0x3227, 0x00e1, 0x0a00, 0x54c2, 
+    0x4ca2, 0x3c82, 0x44c1, 0x4ca1, 0x4481, 0x44a2, 0x4c82, 0x1a01, 0x00a0, 0x00c0, 0x3341, 0x7e24, 
+    0x86a5, 0x7e64, 0x7e65, 0x7e65, 0x7e64, 0x7e65, 0x7e64, 0x7e65, 0x8664, 0x7e65, 0x6da5, 0x00c0, 
+    0x00c0, 0x6da5, 0x7e65, 0x8664, 0x7e65, 0x7e64, 0x7e65, 0x7e64, 0x7e65, 0x8685, 0x7e64, 0x7e43, 
+    0x8665, 0x22e2, 0x0101, 0x00c0, 0x1a01, 0x4c82, 0x44a2, 0x4481, 0x4ca1, 0x44c1, 0x3c82, 0x4ca2, 
+    0x54c2, 0x0a00, 0x00e1, 0x3227, 0xfffe, 0xffff, 0xfffe, 0xffff, 0xffff, 0xffff, 0xffff, 0xad95, 
+    0x00a0, 0x00e0, 0x4403, 0x4461, 0x44a1, 0x44a2, 0x4ca2, 0x4cc2, 0x44c3, 0x4cc1, 0x22c2, 0x0100, 
+    0x00e1, 0x43a3, 0x7e24, 0x7e66, 0x7623, 0x7e45, 0x86a5, 0x7e65, 0x7e64, 0x7e65, 0x7e64, 0x7e65, 
+    0x8664, 0x7e65, 0x6da5, 0x00c0, 0x00c0, 0x6da5, 0x7e65, 0x8664, 0x7e65, 0x7e64, 0x7e65, 0x7e64, 
+    0x7e46, 0x7e43, 0x8684, 0x86a4, 0x7e45, 0x8663, 0x43c1, 0x00c1, 0x0100, 0x22c2, 0x4cc1, 0x44c3, 
+    0x4cc2, 0x4ca2, 0x44a2, 0x44a1, 0x4461, 0x4403, 0x00e0, 0x00a0, 0xad95, 0xffff, 0xffff, 0xffff, 
+    0xfffe, 0xffdf, 0xf7dd, 0x2184, 0x00e0, 0x1220, 0x54c2, 0x4482, 0x44c2, 0x4cc1, 0x4c83, 0x3c61, 
+    0x44c1, 0x2b42, 0x0100, 0x00c0, 0x2ae2, 0x8667, 0x8685, 0x7664, 0x8686, 0x8684, 0x7e65, 0x7e43, 
+    0x7e64, 0x7e65, 0x7e64, 0x7e65, 0x8664, 0x7e65, 0x6da5, 0x00c0, 0x00c0, 0x6da5, 0x7e65, 0x8664, 
+    0x7e65, 0x7e64, 0x7e65, 0x7e64, 0x7e64, 0x7e85, 0x7e64, 0x7e67, 0x7e65, 0x8684, 0x8625, 0x2b01, 
+    0x00c0, 0x0100, 0x2b42, 0x44c1, 0x3c61, 0x4c83, 0x4cc1, 0x44c2, 0x4482, 0x54c2, 0x1220, 0x00e0, 
+    0x2184, 0xf7dd, 0xffdf, 0xfffe, 0xfffe, 0xffff, 0x9512, 0x00c0, 0x0120, 0x4c43, 0x4481, 0x44c2, 
+    0x44a2, 0x4481, 0x44a2, 0x44c3, 0x4461, 0x00e0, 0x0100, 0x1a20, 0x7e43, 0x7e44, 0x7e84, 0x7665, 
+    0x7e85, 0x7e44, 0x7e64, 0x8686, 0x7e64, 0x7e65, 0x7e64, 0x7e65, 0x8664, 0x7e65, 0x6da5, 0x00c0, 
+    0x00c0, 0x6da5, 0x7e65, 0x8664, 0x7e65, 0x7e64, 0x7e65, 0x7e64, 0x7e85, 0x7e65, 0x7e66, 0x7e65, 
+    0x7644, 0x7e64, 0x8686, 0x7e25, 0x1a20, 0x0100, 0x00e0, 0x4461, 0x44c3, 0x44a2, 0x4481, 0x44a2, 
+    0x44c2, 0x4481, 0x4c43, 0x0120, 0x00c0, 0x9512, 0xffff, 0xfffe, 0xffff, 0xffff, 0x3a68, 0x00c0, 
+    0x1a82, 0x4c81, 0x44a2, 0x44a1, 0x4ca1, 0x4cc3, 0x44c2, 0x3c80, 0x1a41, 0x00a0, 0x0921, 0x75a5, 
+    0x8665, 0x8685, 0x7e64, 0x7e85, 0x7e84, 0x8665, 0x7e64, 0x7e44, 0x7e64, 0x7e65, 0x7e64, 0x7e65, 
+    0x8664, 0x7e65, 0x6da5, 0x00c0, 0x00c0, 0x6da5, 0x7e65, 0x8664, 0x7e65, 0x7e64, 0x7e65, 0x7e64, 
+    0x7e63, 0x7e44, 0x8685, 0x7e83, 0x7e84, 0x7ea4, 0x7644, 0x7e45, 0x75a5, 0x0921, 0x00a0, 0x1a41, 
+    0x3c80, 0x44c2, 0x4cc3, 0x4ca1, 0x44a1, 0x44a2, 0x4c81, 0x1a82, 0x00c0, 0x3a68, 0xffff, 0xffff, 
+    0xffff, 0xef9d, 0x00e1, 0x00e0, 0x3be2, 0x4481, 0x4481, 0x44c2, 0x4481, 0x44a2, 0x44c1, 0x4443, 
+    0x00e0, 0x00a0, 0x4be4, 0x7e83, 0x8666, 0x7e24, 0x7e68, 0x7e44, 0x8663, 0x7e05, 0x5ce6, 0x8686, 
+    0x7e64, 0x7e65, 0x7e64, 0x7e65, 0x8664, 0x7e65, 0x6da5, 0x00c0, 0x00c0, 0x6da5, 0x7e65, 0x8664, 
+    0x7e65, 0x7e64, 0x7e65, 0x7e64, 0x75a5, 0x4403, 0x75c4, 0x8664, 0x7e45, 0x7e67, 0x7e63, 0x8686, 
+    0x7e83, 0x4be4, 0x00a0, 0x00e0, 0x4443, 0x44c1, 0x44a2, 0x4481, 0x44c2, 0x4481, 0x4481, 0x3be2, 
+    0x00e0, 0x00e1, 0xef9d, 0xffff, 0xffff, 0x9d12, 0x00c0, 0x0180, 0x4461, 0x4cc2, 0x44a2, 0x44a1, 
+    0x4cc3, 0x3c80, 0x4ca3, 0x09c0, 0x00e0, 0x11c0, 0x7e25, 0x7e64, 0x7e83, 0x7e64, 0x8685, 0x7e45, 
+    0x7dc3, 0x09c0, 0x00e0, 0x5cc3, 0x7e64, 0x7e65, 0x7e64, 0x7e65, 0x8664, 0x7e65, 0x6da5, 0x00c0, 
+    0x00c0, 0x6da5, 0x7e65, 0x8664, 0x7e65, 0x7e64, 0x7e65, 0x7e64, 0x3343, 0x0121, 0x1a41, 0x7e03, 
+    0x8686, 0x7e45, 0x7e64, 0x7e63, 0x7e64, 0x7e25, 0x11c0, 0x00e0, 0x09c0, 0x4ca3, 0x3c80, 0x4cc3, 
+    0x44a1, 0x44a2, 0x4cc2, 0x4461, 0x0180, 0x00c0, 0x9d12, 0xffff, 0xffdf, 0x52e9, 0x00e1, 0x1240, 
+    0x4ca2, 0x44a1, 0x44c2, 0x44a1, 0x44a2, 0x4ce0, 0x43e1, 0x00c0, 0x00e1, 0x4c62, 0x7ea5, 0x7e65, 
+    0x7e67, 0x7e83, 0x7e83, 0x8646, 0x2261, 0x00c2, 0x0120, 0x7da3, 0x7e64, 0x7e65, 0x7e64, 0x7e65, 
+    0x8664, 0x7e65, 0x6da5, 0x00c0, 0x00c0, 0x6da5, 0x7e65, 0x8664, 0x7e65, 0x7e64, 0x7e65, 0x7e64, 
+    0x7544, 0x0100, 0x00e0, 0x3341, 0x8645, 0x86a5, 0x7e64, 0x7e66, 0x7e65, 0x7ea5, 0x4c62, 0x00e1, 
+    0x00c0, 0x43e1, 0x4ce0, 0x44a2, 0x44a1, 0x44c2, 0x44a1, 0x4ca2, 0x1240, 0x00e1, 0x52e9, 0xffdf, 
+    0xf7be, 0x1121, 0x00e0, 0x33a0, 0x4c84, 0x44a1, 0x4cc2, 0x44a2, 0x44a2, 0x44c1, 0x2ac3, 0x00c0, 
+    0x0960, 0x8684, 0x7645, 0x8685, 0x7e65, 0x7e64, 0x8685, 0x4be2, 0x00c1, 0x00e0, 0x3ba1, 0x7e85, 
+    0x7e64, 0x7e65, 0x7e64, 0x7e65, 0x8664, 0x7e65, 0x6da5, 0x00c0, 0x00c0, 0x6da5, 0x7e65, 0x8664, 
+    0x7e65, 0x7e64, 0x7e65, 0x7e64, 0x7e85, 0x3b81, 0x00a1, 0x00e0, 0x64e3, 0x7e66, 0x7644, 0x8684, 
+    0x8685, 0x7645, 0x8684, 0x0960, 0x00c0, 0x2ac3, 0x44c1, 0x44a2, 0x44a2, 0x4cc2, 0x44a1, 0x4c84, 
+    0x33a0, 0x00e0, 0x1121, 0xf7be, 0xbdf7, 0x00c0, 0x0160, 0x4441, 0x4ca3, 0x44a1, 0x44a1, 0x44a2, 
+    0x44c2, 0x4ca1, 0x09c0, 0x00c0, 0x32e2, 0x7e64, 0x7e66, 0x7e64, 0x7e64, 0x8685, 0x7de4, 0x0981, 
+    0x00c0, 0x11a0, 0x8645, 0x7665, 0x7e64, 0x7e65, 0x7e64, 0x7e65, 0x8664, 0x7e65, 0x6da5, 0x00c0, 
+    0x00c0, 0x6da5, 0x7e65, 0x8664, 0x7e65, 0x7e64, 0x7e65, 0x7e64, 0x7664, 0x7e06, 0x11a0, 0x00e0, 
+    0x1201, 0x7e44, 0x86a6, 0x7643, 0x7e64, 0x7e66, 0x7e64, 0x32e2, 0x00c0, 0x09c0, 0x4ca1, 0x44c2, 
+    0x44a2, 0x44a1, 0x44a1, 0x4ca3, 0x4441, 0x0160, 0x00c0, 0xbdf7, 0x94b1, 0x00a0, 0x09a1, 0x4ca3, 
+    0x4ca3, 0x4cc1, 0x44a1, 0x44a2, 0x44c2, 0x4421, 0x00e0, 0x00e0, 0x64c4, 0x7e65, 0x7e85, 0x7e64, 
+    0x7665, 0x8664, 0x4c04, 0x00c0, 0x0120, 0x6d24, 0x7e64, 0x7e65, 0x7e64, 0x7e65, 0x7e64, 0x7e65, 
+    0x8664, 0x7e65, 0x6da5, 0x00c0, 0x00c0, 0x6da5, 0x7e65, 0x8664, 0x7e65, 0x7e64, 0x7e65, 0x7e64, 
+    0x7e84, 0x8666, 0x6d24, 0x00c0, 0x00e0, 0x5cc4, 0x8664, 0x7e65, 0x7e64, 0x7e85, 0x7e65, 0x64c4, 
+    0x00e0, 0x00e0, 0x4421, 0x44c2, 0x44a2, 0x44a1, 0x4cc1, 0x4ca3, 0x4ca3, 0x09a1, 0x00a0, 0x94b1, 
+    0x7c2f, 0x00e0, 0x1200, 0x4c82, 0x44a2, 0x4cc1, 0x44a1, 0x44a2, 0x44a2, 0x2b41, 0x00c0, 0x0940, 
+    0x7e04, 0x7e65, 0x7645, 0x7e84, 0x7ea5, 0x8625, 0x2202, 0x00a0, 0x2b02, 0x8665, 0x7e65, 0x8664, 
+    0x7e64, 0x7e65, 0x7e64, 0x7e65, 0x8664, 0x7e65, 0x6da5, 0x00c0, 0x00c0, 0x6da5, 0x7e65, 0x8664, 
+    0x7e65, 0x7e64, 0x7e65, 0x7e64, 0x7e64, 0x8665, 0x8665, 0x2ac2, 0x00c0, 0x2ac2, 0x7e44, 0x7e86, 
+    0x7e84, 0x7645, 0x7e65, 0x7e04, 0x0940, 0x00c0, 0x2b41, 0x44a2, 0x44a2, 0x44a1, 0x4cc1, 0x4482, 
+    0x4c82, 0x1200, 0x00e0, 0x7c2f, 0x5b4b, 0x00e0, 0x1a60, 0x4ca2, 0x44a2, 0x44c1, 0x44a2, 0x44a2, 
+    0x44a2, 0x22a0, 0x00e1, 0x11c0, 0x8664, 0x7e65, 0x7e65, 0x7e84, 0x7e84, 0x7dc6, 0x00c0, 0x0100, 
+    0x4c23, 0x7e64, 0x8687, 0x7e44, 0x7e64, 0x7e65, 0x7e64, 0x7e65, 0x8664, 0x7e65, 0x6da5, 0x00c0, 
+    0x00c0, 0x6da5, 0x7e65, 0x8664, 0x7e65, 0x7e64, 0x7e65, 0x7e64, 0x7e45, 0x7e65, 0x7e64, 0x4c22, 
+    0x0100, 0x0101, 0x8e65, 0x7665, 0x7e84, 0x7e65, 0x7e65, 0x8664, 0x11c0, 0x00e1, 0x22a0, 0x44a2, 
+    0x44a2, 0x44a2, 0x44a1, 0x44a2, 0x4ca2, 0x1a60, 0x00e0, 0x5b6b, 0x4287, 0x00e0, 0x22e1, 0x4c82, 
+    0x4cc2, 0x44a1, 0x44a2, 0x44a2, 0x44c2, 0x1a61, 0x00c0, 0x2261, 0x7e64, 0x7e65, 0x8686, 0x7e64, 
+    0x7663, 0x5ca3, 0x00c0, 0x00c0, 0x6d67, 0x7e84, 0x7645, 0x8664, 0x7e64, 0x7e65, 0x7e64, 0x7e65, 
+    0x8664, 0x7e65, 0x6da5, 0x00c0, 0x00c0, 0x6da5, 0x7e65, 0x8664, 0x7e65, 0x7e64, 0x7e65, 0x7e64, 
+    0x8665, 0x7e84, 0x7e64, 0x6d24, 0x00a0, 0x00c1, 0x6d82, 0x7e64, 0x7e64, 0x8686, 0x7e65, 0x7e64, 
+    0x2261, 0x00c0, 0x1a61, 0x44c2, 0x44a2, 0x44a2, 0x44a1, 0x4cc2, 0x4c82, 0x22e1, 0x00e0, 0x4287, 
+    0x29e5, 0x00e0, 0x2b21, 0x44a2, 0x44c2, 0x44a1, 0x4ca2, 0x44a2, 0x44c1, 0x1201, 0x00a0, 0x3322, 
+    0x7e65, 0x7e64, 0x8686, 0x7e64, 0x7e84, 0x4c04, 0x00a0, 0x00e0, 0x8626, 0x7e65, 0x7663, 0x8686, 
+    0x7e64, 0x7e65, 0x7e64, 0x7e65, 0x8664, 0x7e65, 0x6da5, 0x00c0, 0x00c0, 0x6da5, 0x7e65, 0x8664, 
+    0x7e65, 0x7e64, 0x7e65, 0x7e64, 0x7e65, 0x7ea4, 0x7e46, 0x7e04, 0x0102, 0x00c0, 0x5cc2, 0x7e64, 
+    0x7e64, 0x8686, 0x7e64, 0x7e65, 0x3322, 0x00a0, 0x1201, 0x44c1, 0x44a2, 0x4ca2, 0x44a1, 0x44c2, 
+    0x44a2, 0x2b21, 0x00e0, 0x29e5, 0x0921, 0x00e0, 0x3381, 0x4cc3, 0x44a1, 0x44a1, 0x44a2, 0x44a2, 
+    0x44a1, 0x11c1, 0x00e0, 0x43a2, 0x7646, 0x7e85, 0x7e25, 0x8684, 0x8685, 0x3b43, 0x0102, 0x11e0, 
+    0x8645, 0x7e83, 0x7e86, 0x7e46, 0x7e64, 0x7e65, 0x7e64, 0x7e65, 0x8664, 0x7e65, 0x6da5, 0x00c0, 
+    0x00c0, 0x6da5, 0x7e65, 0x8664, 0x7e65, 0x7e64, 0x7e65, 0x7e64, 0x7e65, 0x7e66, 0x7e64, 0x8644, 
+    0x11c0, 0x0102, 0x4c23, 0x8666, 0x8684, 0x7e25, 0x7e85, 0x7646, 0x43a2, 0x00e0, 0x11c1, 0x44a1, 
+    0x44a2, 0x44a2, 0x44a1, 0x44a1, 0x4cc3, 0x3381, 0x00e0, 0x0921, 0x0921, 0x00e0, 0x3381, 0x4cc3, 
+    0x44a1, 0x44a1, 0x44a2, 0x44a2, 0x44a1, 0x11c1, 0x00e0, 0x43a2, 0x7646, 0x7e85, 0x7e25, 0x8684, 
+    0x7e85, 0x3b60, 0x00c2, 0x1201, 0x8665, 0x8666, 0x7e43, 0x7e84, 0x8685, 0x7e43, 0x7e64, 0x8686, 
+    0x7e63, 0x8683, 0x7e07, 0x0a00, 0x0a00, 0x7e07, 0x8683, 0x7e63, 0x8686, 0x7e64, 0x7e43, 0x8685, 
+    0x7e63, 0x7e66, 0x86a5, 0x8645, 0x1a01, 0x00e1, 0x4c22, 0x7e65, 0x8684, 0x7e25, 0x7e85, 0x7646, 
+    0x43a2, 0x00e0, 0x11c1, 0x44a1, 0x44a2, 0x44a2, 0x44a1, 0x44a1, 0x4cc3, 0x3381, 0x00e0, 0x0921, 
+    0x29e5, 0x00e0, 0x2b21, 0x44a2, 0x44c2, 0x44a1, 0x4ca2, 0x44a2, 0x44c1, 0x1201, 0x00a0, 0x3322, 
+    0x7e65, 0x7e64, 0x8686, 0x7e64, 0x7e85, 0x5442, 0x0060, 0x11c0, 0x8665, 0x7e43, 0x8684, 0x7e86, 
+    0x7e45, 0x8685, 0x7e65, 0x7e46, 0x8686, 0x7e43, 0x8685, 0x7e06, 0x7e06, 0x8685, 0x7e43, 0x8686, 
+    0x7e46, 0x7e65, 0x8685, 0x7e45, 0x8686, 0x7e65, 0x7664, 0x8645, 0x09a0, 0x00c0, 0x5cc2, 0x8686, 
+    0x7e64, 0x8686, 0x7e64, 0x7e65, 0x3322, 0x00a0, 0x1201, 0x44c1, 0x44a2, 0x4ca2, 0x44a1, 0x44c2, 
+    0x44a2, 0x2b21, 0x00e0, 0x29e5, 0x4287, 0x00e0, 0x22e1, 0x4c82, 0x4cc2, 0x44a1, 0x44a2, 0x44a2, 
+    0x44c2, 0x1a61, 0x00c0, 0x2261, 0x7e64, 0x7e65, 0x8686, 0x7e64, 0x7665, 0x5c82, 0x08e0, 0x0100, 
+    0x7e25, 0x7e84, 0x7e64, 0x7e46, 0x7e65, 0x7e65, 0x7e65, 0x7e45, 0x7e86, 0x7e65, 0x7e63, 0x86a3, 
+    0x86a3, 0x7e63, 0x7e65, 0x7e86, 0x7e45, 0x7e65, 0x7e65, 0x7e65, 0x8646, 0x7663, 0x7e86, 0x7e24, 
+    0x0100, 0x00e0, 0x6d43, 0x7665, 0x7e64, 0x8686, 0x7e65, 0x7e64, 0x2261, 0x00c0, 0x1a61, 0x44c2, 
+    0x44a2, 0x44a2, 0x44a1, 0x4cc2, 0x4c82, 0x22e1, 0x00e0, 0x4287, 0x5b4b, 0x00e0, 0x1a60, 0x4ca2, 
+    0x44a2, 0x44c1, 0x44a2, 0x44a2, 0x44a2, 0x22a0, 0x00e1, 0x11c0, 0x8664, 0x7e65, 0x7e65, 0x7e84, 
+    0x7e84, 0x7584, 0x00c0, 0x00e0, 0x5cc3, 0x7e84, 0x7e86, 0x7e44, 0x8665, 0x7e44, 0x8684, 0x7ea4, 
+    0x7644, 0x7e86, 0x7e65, 0x7e43, 0x7e43, 0x7e65, 0x7e86, 0x7644, 0x7ea4, 0x8684, 0x7e44, 0x8665, 
+    0x8644, 0x7e85, 0x7e86, 0x5cc2, 0x00e0, 0x00e0, 0x8625, 0x7684, 0x7e84, 0x7e65, 0x7e65, 0x8664, 
+    0x11c0, 0x00e1, 0x22a0, 0x44a2, 0x44a2, 0x44a2, 0x44a1, 0x44a2, 0x4ca2, 0x1a60, 0x00e0, 0x5b6b, 
+    0x7c2f, 0x00e0, 0x1200, 0x4c82, 0x44a2, 0x4cc1, 0x44a1, 0x44a2, 0x44a2, 0x2b41, 0x00c0, 0x0940, 
+    0x7e04, 0x7e65, 0x7645, 0x7e84, 0x7ea6, 0x8623, 0x19c1, 0x00e0, 0x32e3, 0x7e44, 0x8686, 0x7e63, 
+    0x7e64, 0x8685, 0x7e44, 0x7e83, 0x7e63, 0x7e66, 0x7e46, 0x86a6, 0x86a6, 0x7e46, 0x7e66, 0x7e63, 
+    0x7e83, 0x7e44, 0x8685, 0x7e64, 0x8683, 0x7e45, 0x8665, 0x2b03, 0x00c0, 0x2a83, 0x8624, 0x7ea5, 
+    0x7e84, 0x7645, 0x7e65, 0x7e04, 0x0940, 0x00c0, 0x2b41, 0x44a2, 0x44a2, 0x44a1, 0x4cc1, 0x4482, 
+    0x4c82, 0x1200, 0x00e0, 0x7c2f, 0x94b1, 0x00a0, 0x09a1, 0x4ca3, 0x4ca3, 0x4cc1, 0x44a1, 0x44a2, 
+    0x44c2, 0x4421, 0x00e0, 0x00e0, 0x64c4, 0x7e65, 0x7e85, 0x7e64, 0x7e66, 0x8683, 0x43e2, 0x00c1, 
+    0x0100, 0x6d25, 0x7e64, 0x8684, 0x7e64, 0x8686, 0x7e25, 0x7e65, 0x8684, 0x7e65, 0x7e45, 0x7e44, 
+    0x7e44, 0x7e45, 0x7e65, 0x8684, 0x7e65, 0x7e25, 0x8686, 0x7e64, 0x8684, 0x7e44, 0x6d45, 0x0120, 
+    0x00e1, 0x5c82, 0x7e64, 0x7665, 0x7e64, 0x7e85, 0x7e65, 0x64c4, 0x00e0, 0x00e0, 0x4421, 0x44c2, 
+    0x44a2, 0x44a1, 0x4cc1, 0x4ca3, 0x4ca3, 0x09a1, 0x00a0, 0x94b1, 0xbdf7, 0x00c0, 0x0160, 0x4441, 
+    0x4ca3, 0x44a1, 0x44a1, 0x44a2, 0x44c2, 0x4ca1, 0x09c0, 0x00c0, 0x32e2, 0x7e64, 0x7e66, 0x7e64, 
+    0x8665, 0x7e84, 0x75e3, 0x0120, 0x00e0, 0x11e0, 0x7e26, 0x7e65, 0x7e64, 0x8686, 0x8686, 0x8685, 
+    0x7e44, 0x7e64, 0x8685, 0x7e64, 0x7e64, 0x8685, 0x7e64, 0x7e44, 0x8685, 0x8686, 0x8686, 0x7e64, 
+    0x7e65, 0x8626, 0x11e0, 0x00e0, 0x11e0, 0x7e03, 0x86a5, 0x7e45, 0x7e64, 0x7e66, 0x7e64, 0x32e2, 
+    0x00c0, 0x09c0, 0x4ca1, 0x44c2, 0x44a2, 0x44a1, 0x44a1, 0x4ca3, 0x4441, 0x0160, 0x00c0, 0xbdf7, 
+    0xf7be, 0x1121, 0x00e0, 0x33a0, 0x4c84, 0x44a1, 0x4cc2, 0x44a2, 0x44a2, 0x44c1, 0x2ac3, 0x00c0, 
+    0x0960, 0x8684, 0x7645, 0x8685, 0x8664, 0x7e84, 0x7e66, 0x53e4, 0x00a0, 0x00e0, 0x3bc2, 0x7e64, 
+    0x7e84, 0x7e64, 0x7e64, 0x7e64, 0x8665, 0x8665, 0x7e45, 0x8665, 0x8665, 0x7e45, 0x8665, 0x8665, 
+    0x7e64, 0x7e64, 0x7e64, 0x7e84, 0x7665, 0x3bc1, 0x00c0, 0x00a0, 0x5cc3, 0x8686, 0x7e64, 0x7e65, 
+    0x8685, 0x7645, 0x8684, 0x0960, 0x00c0, 0x2ac3, 0x44c1, 0x44a2, 0x44a2, 0x4cc2, 0x44a1, 0x4c84, 
+    0x33a0, 0x00e0, 0x1121, 0xf7be, 0xffdf, 0x52e9, 0x00e1, 0x1240, 0x4ca2, 0x44a1, 0x44c2, 0x44a1, 
+    0x44a2, 0x4ce0, 0x43e1, 0x00c0, 0x00e1, 0x4c62, 0x7ea5, 0x7e65, 0x8663, 0x7665, 0x7ea5, 0x7e44, 
+    0x1a00, 0x00a1, 0x00e0, 0x6506, 0x7e64, 0x7e65, 0x7e64, 0x7e63, 0x8665, 0x8666, 0x7e66, 0x7e84, 
+    0x7664, 0x7e86, 0x7e46, 0x7e44, 0x8683, 0x8684, 0x7645, 0x7e85, 0x6505, 0x00c0, 0x00c1, 0x2aa1, 
+    0x7e45, 0x7685, 0x7e86, 0x7e44, 0x7e65, 0x7ea5, 0x4c62, 0x00e1, 0x00c0, 0x43e1, 0x4ce0, 0x44a2, 
+    0x44a1, 0x44c2, 0x44a1, 0x4ca2, 0x1240, 0x00e1, 0x52e9, 0xffdf, 0xffff, 0x9d12, 0x00c0, 0x0180, 
+    0x4461, 0x4cc2, 0x44a2, 0x44a1, 0x4cc3, 0x3c80, 0x4ca3, 0x09c0, 0x00e0, 0x11c0, 0x7e25, 0x7e64, 
+    0x8645, 0x7e65, 0x7e84, 0x7e65, 0x7de5, 0x0980, 0x0100, 0x00c0, 0x33a1, 0x8646, 0x8685, 0x7e66, 
+    0x7e66, 0x7e65, 0x8664, 0x7e63, 0x7e63, 0x7e84, 0x7e85, 0x7e65, 0x7625, 0x8685, 0x8667, 0x3381, 
+    0x00c0, 0x0120, 0x11e0, 0x8645, 0x7e65, 0x7665, 0x7e65, 0x8665, 0x7e64, 0x7e25, 0x11c0, 0x00e0, 
+    0x09c0, 0x4ca3, 0x3c80, 0x4cc3, 0x44a1, 0x44a2, 0x4cc2, 0x4461, 0x0180, 0x00c0, 0x9d12, 0xffff, 
+    0xffff, 0xef9d, 0x00e1, 0x00e0, 0x3be2, 0x4481, 0x4481, 0x44c2, 0x4481, 0x44a2, 0x44c1, 0x4443, 
+    0x00e0, 0x00a0, 0x4be4, 0x7e83, 0x7e46, 0x8685, 0x8664, 0x7e85, 0x7645, 0x6583, 0x0160, 0x08c1, 
+    0x00c0, 0x1a00, 0x6d46, 0x7e44, 0x7e84, 0x7e84, 0x7623, 0x8666, 0x8666, 0x7e63, 0x7e64, 0x7e84, 
+    0x8685, 0x6525, 0x09c0, 0x0100, 0x08e2, 0x09a0, 0x75e4, 0x7645, 0x7e63, 0x8684, 0x7e45, 0x8666, 
+    0x7e83, 0x4be4, 0x00a0, 0x00e0, 0x4443, 0x44c1, 0x44a2, 0x4481, 0x44c2, 0x4481, 0x4481, 0x3be2, 
+    0x00e0, 0x00e1, 0xef9d, 0xffff, 0xffff, 0xffff, 0x3a68, 0x00c0, 0x1a82, 0x4c81, 0x44a2, 0x44a1, 
+    0x4ca1, 0x4cc3, 0x44c2, 0x3c80, 0x1a41, 0x00a0, 0x0921, 0x75a5, 0x7e85, 0x7e64, 0x7e45, 0x7e66, 
+    0x7665, 0x7e86, 0x7e05, 0x1a00, 0x08c1, 0x00e0, 0x00e0, 0x32e3, 0x6504, 0x7e45, 0x8665, 0x8685, 
+    0x7e44, 0x7e45, 0x7e45, 0x5ce4, 0x2ac3, 0x00e0, 0x0100, 0x00a0, 0x2240, 0x8625, 0x7e86, 0x7645, 
+    0x7e65, 0x7e64, 0x7e44, 0x7e65, 0x75a5, 0x0921, 0x00a0, 0x1a41, 0x3c80, 0x44c2, 0x4cc3, 0x4ca1, 
+    0x44a1, 0x44a2, 0x4c81, 0x1a82, 0x00c0, 0x3a68, 0xffff, 0xffff, 0xfffe, 0xffff, 0x9512, 0x00c0, 
+    0x0120, 0x4c43, 0x4481, 0x44c2, 0x44a2, 0x4481, 0x44a2, 0x44c3, 0x4461, 0x00e0, 0x0100, 0x1a20, 
+    0x7e44, 0x8687, 0x7e63, 0x7e65, 0x7e66, 0x7e64, 0x7e64, 0x7e45, 0x4bc3, 0x0120, 0x00e2, 0x00e0, 
+    0x00a0, 0x0100, 0x11c0, 0x11e0, 0x1a21, 0x11c0, 0x00e0, 0x00e0, 0x0100, 0x0102, 0x0960, 0x5424, 
+    0x8666, 0x7e45, 0x7e63, 0x8686, 0x7e66, 0x7e44, 0x86a7, 0x7e44, 0x1a20, 0x0100, 0x00e0, 0x4461, 
+    0x44c3, 0x44a2, 0x4481, 0x44a2, 0x44c2, 0x4481, 0x4c43, 0x0120, 0x00c0, 0x9512, 0xffff, 0xfffe, 
+    0xfffe, 0xffdf, 0xf7dd, 0x2184, 0x00e0, 0x1220, 0x54c2, 0x4482, 0x44c2, 0x4cc1, 0x4c83, 0x3c61, 
+    0x44c1, 0x2b42, 0x0100, 0x00c0, 0x22e1, 0x7e44, 0x7e84, 0x7e63, 0x7e44, 0x8684, 0x7e84, 0x7685, 
+    0x7e66, 0x7604, 0x43c2, 0x11a1, 0x00e0, 0x08e0, 0x0080, 0x08e2, 0x00c1, 0x00a0, 0x08e1, 0x00c0, 
+    0x11c2, 0x4c02, 0x7603, 0x7e65, 0x7685, 0x7e65, 0x8664, 0x8685, 0x7e64, 0x7e44, 0x8664, 0x22e1, 
+    0x00c0, 0x0100, 0x2b42, 0x44c1, 0x3c61, 0x4c83, 0x4cc1, 0x44c2, 0x4482, 0x54c2, 0x1220, 0x00e0, 
+    0x2184, 0xf7dd, 0xffdf, 0xfffe, 0xffff, 0xffff, 0xffff, 0xad95, 0x00a0, 0x00e0, 0x4403, 0x4461, 
+    0x44a1, 0x44a2, 0x4ca2, 0x4cc2, 0x44c3, 0x4cc1, 0x22c2, 0x0100, 0x00e0, 0x43a3, 0x7e64, 0x8687, 
+    0x7e43, 0x8664, 0x8685, 0x7e66, 0x7ea4, 0x7e84, 0x7e63, 0x8644, 0x75a5, 0x5c82, 0x5421, 0x3b61, 
+    0x4381, 0x4be0, 0x5c82, 0x8606, 0x8664, 0x7e83, 0x7ea5, 0x7e84, 0x7665, 0x7e66, 0x8665, 0x7e44, 
+    0x8687, 0x7e43, 0x43a2, 0x00e1, 0x0100, 0x22c2, 0x4cc1, 0x44c3, 0x4cc2, 0x4ca2, 0x44a2, 0x44a1, 
+    0x4461, 0x4403, 0x00e0, 0x00a0, 0xad95, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffe, 0xffff, 0xfffe, 
+    0x3227, 0x00e1, 0x0a00, 0x54c2, 0x4ca2, 0x3c82, 0x44c1, 0x4ca1, 0x4481, 0x44a2, 0x4c82, 0x1a01, 
+    0x0081, 0x00e1, 0x22e1, 0x7624, 0x86a5, 0x7e46, 0x7e45, 0x8663, 0x7e44, 0x7e65, 0x7e66, 0x7e86, 
+    0x7664, 0x7665, 0x7e85, 0x7e84, 0x7e65, 0x7e86, 0x7685, 0x7664, 0x7e85, 0x7e66, 0x8666, 0x8665, 
+    0x8664, 0x8665, 0x7e45, 0x7e65, 0x7e44, 0x2b02, 0x00c0, 0x08a0, 0x1a01, 0x4c82, 0x44a2, 0x4481, 
+    0x4ca1, 0x44c1, 0x3c82, 0x4ca2, 0x54c2, 0x0a00, 0x00e1, 0x3227, 0xfffe, 0xffff, 0xfffe, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xb5d7, 0x08c1, 0x00e0, 0x4364, 0x44c1, 0x44a2, 0x4ca2, 0x4ca1, 
+    0x4483, 0x44a3, 0x44a1, 0x4ca1, 0x1a01, 0x00e0, 0x00c0, 0x1200, 0x75c5, 0x7e83, 0x7e84, 0x7e45, 
+    0x8664, 0x8664, 0x7e64, 0x7e64, 0x7e64, 0x7e64, 0x7e64, 0x7e64, 0x7e64, 0x7e64, 0x7e64, 0x7e64, 
+    0x7e64, 0x7e64, 0x8664, 0x8664, 0x7e45, 0x7e84, 0x7e83, 0x75c5, 0x1200, 0x00c0, 0x00e0, 0x1a01, 
+    0x4ca1, 0x44a1, 0x44a3, 0x4483, 0x4ca1, 0x4ca2, 0x44a2, 0x44c1, 0x4364, 0x00e0, 0x08c1, 0xb5d7, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x4289, 0x00c0, 0x0160, 
+    0x4442, 0x4463, 0x4cc2, 0x44a2, 0x4cc2, 0x4ca2, 0x4484, 0x4480, 0x4c82, 0x22a2, 0x0100, 0x00e0, 
+    0x0920, 0x4bc3, 0x7e04, 0x7e85, 0x7e65, 0x7e65, 0x7e65, 0x7e65, 0x7e65, 0x7e86, 0x7e66, 0x7e45, 
+    0x7e45, 0x7e66, 0x7e86, 0x7e65, 0x7e65, 0x7e65, 0x7e65, 0x7e65, 0x7e85, 0x7e04, 0x4bc3, 0x0920, 
+    0x00e0, 0x0100, 0x22a2, 0x4c82, 0x4480, 0x4484, 0x4ca2, 0x4cc2, 0x44a2, 0x4cc2, 0x4463, 0x4442, 
+    0x0160, 0x00c0, 0x4289, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 
+    0xffdf, 0xef7d, 0x1943, 0x00c0, 0x0980, 0x4c42, 0x44a2, 0x44c1, 0x4ca1, 0x4ca2, 0x4cc2, 0x4cc4, 
+    0x4482, 0x4ce1, 0x3362, 0x0100, 0x00a0, 0x00a0, 0x11e1, 0x4c82, 0x8684, 0x7e64, 0x7e65, 0x7e85, 
+    0x7e86, 0x7e65, 0x7e64, 0x7e84, 0x7e84, 0x7e64, 0x7e65, 0x7e86, 0x7e85, 0x7e65, 0x7e64, 0x8684, 
+    0x4c82, 0x11e1, 0x00a0, 0x00a0, 0x0100, 0x3362, 0x4ce1, 0x4482, 0x4cc4, 0x4cc2, 0x4ca2, 0x4ca1, 
+    0x44c1, 0x44a2, 0x4c42, 0x0980, 0x00c0, 0x1943, 0xef7d, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffdf, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xc679, 0x1102, 0x00c0, 0x1a40, 0x4481, 0x44a1, 
+    0x44c2, 0x4480, 0x4ca1, 0x4462, 0x44a2, 0x44a2, 0x4480, 0x4421, 0x1a41, 0x00e0, 0x00e0, 0x00a0, 
+    0x0960, 0x32e2, 0x64c4, 0x7de4, 0x8663, 0x8684, 0x7e85, 0x7646, 0x7646, 0x7e85, 0x8684, 0x8663, 
+    0x7de4, 0x64c4, 0x32e2, 0x0960, 0x00a0, 0x00e0, 0x00e0, 0x1a41, 0x4421, 0x4480, 0x44a2, 0x44a2, 
+    0x4462, 0x4ca1, 0x4480, 0x44c2, 0x44a1, 0x4481, 0x1a40, 0x00c0, 0x1102, 0xc679, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x9d34, 
+    0x00c0, 0x00e0, 0x22c1, 0x4ca2, 0x44c1, 0x44c1, 0x44a2, 0x4cc2, 0x4481, 0x44c1, 0x44a2, 0x4cc3, 
+    0x44a1, 0x4443, 0x11e0, 0x0901, 0x00c0, 0x00a0, 0x00e0, 0x0960, 0x11c1, 0x2240, 0x3301, 0x4382, 
+    0x4382, 0x3301, 0x2240, 0x11c1, 0x0960, 0x00e0, 0x00a0, 0x00c0, 0x0901, 0x11e0, 0x4443, 0x44a1, 
+    0x4cc3, 0x44a2, 0x44c1, 0x4481, 0x4cc2, 0x44a2, 0x44c1, 0x44c1, 0x4ca2, 0x22c1, 0x00e0, 0x00c0, 
+    0x9d34, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffde, 0xffff, 0xffff, 
+    0xffde, 0xffff, 0xffff, 0xffff, 0x6c0e, 0x00c0, 0x00e1, 0x22a0, 0x4481, 0x44a2, 0x4cc2, 0x4481, 
+    0x44c2, 0x44a2, 0x4c83, 0x4482, 0x44c1, 0x44a1, 0x4ca3, 0x3bc1, 0x2ae3, 0x09c0, 0x00e0, 0x00c0, 
+    0x00e1, 0x00c0, 0x00c0, 0x00e0, 0x00e0, 0x00c0, 0x00c0, 0x00e1, 0x00c0, 0x00e0, 0x09c0, 0x2ae3, 
+    0x3bc1, 0x4ca3, 0x44a1, 0x44c1, 0x4482, 0x4c83, 0x44a2, 0x44c2, 0x4481, 0x4cc2, 0x44a2, 0x4481, 
+    0x22a0, 0x00e1, 0x00c0, 0x6c0e, 0xffff, 0xffff, 0xffff, 0xffde, 0xffff, 0xffff, 0xffde, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffdf, 0xffff, 0x4ac9, 0x00c0, 0x00e0, 
+    0x1a60, 0x4c62, 0x4c83, 0x44a2, 0x3c82, 0x44a2, 0x4cc1, 0x4ca1, 0x4cc3, 0x4cc3, 0x3c80, 0x4ce0, 
+    0x44a0, 0x4ca2, 0x4422, 0x2b40, 0x22a0, 0x2282, 0x1a02, 0x0980, 0x0980, 0x1a02, 0x2282, 0x22a0, 
+    0x2b40, 0x4422, 0x4ca2, 0x44a0, 0x4ce0, 0x3c80, 0x4cc3, 0x4cc3, 0x4ca1, 0x4cc1, 0x44a2, 0x3c82, 
+    0x44a2, 0x4c83, 0x4c62, 0x1a60, 0x00e0, 0x00c0, 0x4ac9, 0xffff, 0xffdf, 0xffff, 0xffdf, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffdf, 0xffff, 0x6c0e, 0x00c0, 0x00e0, 0x0980, 0x3c01, 0x44e2, 0x4ca2, 0x44a1, 0x3ca1, 0x4ce2, 
+    0x4461, 0x4ca2, 0x4ca3, 0x44a2, 0x44c2, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 0x44a1, 0x44a1, 
+    0x44a1, 0x44a1, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 0x44c2, 0x44a2, 0x4ca3, 0x4ca2, 0x4461, 
+    0x4ce2, 0x3ca1, 0x44a1, 0x4ca2, 0x44e2, 0x3c01, 0x0980, 0x00e0, 0x00c0, 0x6c0e, 0xffff, 0xffdf, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xa554, 0x0902, 0x00c0, 0x0140, 0x3b65, 
+    0x4cc1, 0x4481, 0x44a3, 0x44c2, 0x3c81, 0x4cc2, 0x4cc2, 0x4481, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 
+    0x44a2, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 
+    0x4481, 0x4cc2, 0x4cc2, 0x3c81, 0x44c2, 0x44a3, 0x4481, 0x4cc1, 0x3b65, 0x0140, 0x00c0, 0x0902, 
+    0xa554, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xc678, 0x1142, 0x00e0, 0x00e0, 0x1201, 0x43e3, 0x54c1, 0x44a0, 0x4ce2, 0x4482, 0x44a2, 0x4ce3, 
+    0x44a1, 0x44a1, 0x44a1, 0x44a2, 0x44a2, 0x44a2, 0x44a2, 0x4ca3, 0x4ca3, 0x44a2, 0x44a2, 0x44a2, 
+    0x44a2, 0x44a1, 0x44a1, 0x44a1, 0x4cc3, 0x4482, 0x4482, 0x4ce2, 0x44a0, 0x54c1, 0x3be3, 0x0a01, 
+    0x00e0, 0x00e0, 0x1142, 0xc678, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffdf, 0xffff, 0xffdf, 0xffff, 0xe77d, 0x4aa9, 0x00a0, 0x00c0, 0x0100, 0x1201, 0x4c23, 
+    0x4ca1, 0x44a1, 0x44c1, 0x3ca1, 0x44a1, 0x44c1, 0x44a1, 0x44a1, 0x44c1, 0x44a1, 0x44a1, 0x44a1, 
+    0x44a1, 0x44a1, 0x44a1, 0x44c1, 0x44a1, 0x44a1, 0x44c1, 0x44a1, 0x44a1, 0x44c2, 0x44a1, 0x4c81, 
+    0x4403, 0x1201, 0x0100, 0x00e0, 0x00a0, 0x4aa9, 0xe77d, 0xffff, 0xffdf, 0xffff, 0xffdf, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffbe, 0xffff, 0xffff, 0xffdf, 0xffff, 0xbdf7, 
+    0x31e7, 0x00a0, 0x00e0, 0x00e0, 0x1a62, 0x3be2, 0x4461, 0x4cc3, 0x4483, 0x4ca4, 0x4ca3, 0x44a2, 
+    0x44a2, 0x44c2, 0x44a1, 0x44a1, 0x44a1, 0x44a1, 0x44c2, 0x44a2, 0x44a2, 0x4ca3, 0x4ca4, 0x4483, 
+    0x4cc2, 0x4461, 0x3be2, 0x2282, 0x0100, 0x00e0, 0x00a0, 0x31c7, 0xbdf7, 0xffff, 0xffdf, 0xffff, 
+    0xffff, 0xffbe, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xad95, 0x21a4, 0x00e0, 0x00e0, 0x00c0, 0x0160, 0x1240, 
+    0x33c0, 0x4441, 0x4c82, 0x4c82, 0x4482, 0x4ca2, 0x4ca2, 0x4cc3, 0x4cc3, 0x4ca2, 0x4ca2, 0x4482, 
+    0x4c82, 0x4c82, 0x4441, 0x33c0, 0x1240, 0x0180, 0x00c0, 0x00c0, 0x00e0, 0x21a3, 0xadb5, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xfffe, 0xf7de, 0x9d34, 
+    0x3a48, 0x00a0, 0x00c0, 0x0902, 0x00c0, 0x0140, 0x11e1, 0x1a41, 0x1a60, 0x22c0, 0x2b21, 0x2b61, 
+    0x2b61, 0x2b21, 0x22c0, 0x1a60, 0x1a41, 0x11e1, 0x0140, 0x00c0, 0x08e2, 0x00a0, 0x00c0, 0x3a68, 
+    0x9d34, 0xf7de, 0xfffe, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xefbe, 0x9d13, 0x4ac8, 0x1121, 0x00a0, 0x00a0, 0x00e0, 
+    0x00e0, 0x00e0, 0x0101, 0x00e0, 0x00e0, 0x0101, 0x00e0, 0x00e0, 0x00e0, 0x00a0, 0x00a0, 0x1121, 
+    0x4ac8, 0x9d13, 0xefbe, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 
+    0xffdf, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xfffe, 0xfffe, 0xffff, 0xffdf, 0xffff, 0xffff, 
+    0xf79e, 0xbdf7, 0x8cb1, 0x7c0f, 0x5b4b, 0x4287, 0x29e5, 0x1122, 0x1122, 0x29e5, 0x4287, 0x5b4b, 
+    0x7c0f, 0x8cb1, 0xbdf7, 0xf79e, 0xffff, 0xffff, 0xffdf, 0xffff, 0xfffe, 0xfffe, 0xffff, 0xffdf, 
+    0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 
+    0xffff, 0xffff, 0xffff, 0xffff, 
 };
-const tImage ON = { image_data_ON, 64, 64,
-    8 };
+const tImage ON = { (const uint8_t *)image_data_ON,
+    64, 64, 16, TIMAGE_RGB565 };
 
@@ -0,0 +1,402 @@
+
+/*******************************************************************************
+* animation
+* filename: cent.h
+* name: drum
+*
+* preset name: asset_compiler --frames 8 --turn -120
+* size: 43x43, 16 colors
+* frames: 8, 7439 pixels changed per turn
+*
+* Needs tAnim, from anim.h
+*******************************************************************************/
+
+#include <stdint.h>
+
+
+
+static const uint8_t anim_data_drum[6005] = {
+    0x0f, 0xff, 0xff, 0x7d, 0xef, 0xfb, 0xde, 0x79, 0xce, 0xd7, 0xbd, 0x55, 0xad, 0xd3, 0x9c, 0x51, 
+    0x8c, 0xae, 0x73, 0x2c, 0x63, 0xaa, 0x52, 0x28, 0x42, 0x86, 0x31, 0x04, 0x21, 0x82, 0x10, 0x00, 
+    0x00, 0x01, 0x20, 0x02, 0x5a, 0x02, 0x1f, 0x03, 0x6f, 0xe0, 0x03, 0x1e, 0x04, 0x5f, 0xfd, 0x04, 
+    0x1d, 0x05, 0x4f, 0xff, 0xb0, 0x05, 0x11, 0x04, 0x38, 0xba, 0x05, 0x1c, 0x06, 0x2e, 0xff, 0xf9, 
+    0x06, 0x0a, 0x09, 0x10, 0x00, 0x04, 0xb9, 0x40, 0x06, 0x1b, 0x07, 0x1c, 0xff, 0xff, 0x60, 0x07, 
+    0x0a, 0x07, 0xa0, 0x02, 0xb9, 0x10, 0x07, 0x1b, 0x07, 0xaf, 0xff, 0xff, 0x30, 0x08, 0x09, 0x06, 
+    0x1f, 0x55, 0xc3, 0x08, 0x1a, 0x07, 0x6f, 0xff, 0xff, 0xf0, 0x09, 0x09, 0x05, 0x5f, 0xdc, 0x10, 
+    0x09, 0x19, 0x08, 0x3f, 0xff, 0xff, 0xfc, 0x0a, 0x09, 0x07, 0x9f, 0xff, 0xfb, 0x10, 0x0a, 0x18, 
+    0x09, 0x1d, 0xff, 0xff, 0xff, 0x80, 0x0b, 0x09, 0x05, 0xcf, 0xfe, 0x60, 0x0b, 0x18, 0x0d, 0x9f, 
+    0xff, 0xff, 0xff, 0x40, 0x00, 0x10, 0x0c, 0x08, 0x05, 0x1f, 0xfa, 0x10, 0x0c, 0x17, 0x0f, 0x5f, 
+    0xff, 0xff, 0xff, 0xf1, 0x00, 0x07, 0x70, 0x0d, 0x08, 0x03, 0x5d, 0x40, 0x0d, 0x17, 0x10, 0xef, 
+    0xff, 0xff, 0xff, 0xb0, 0x00, 0x06, 0xf8, 0x0e, 0x08, 0x01, 0x20, 0x0e, 0x16, 0x12, 0x1f, 0xff, 
+    0xff, 0xff, 0xf7, 0x00, 0x00, 0x5f, 0xfa, 0x0f, 0x17, 0x13, 0xef, 0xff, 0xff, 0xff, 0x30, 0x00, 
+    0x04, 0xff, 0xfc, 0x10, 0x10, 0x17, 0x14, 0xbf, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x03, 0xff, 0xff, 
+    0xd2, 0x11, 0x0c, 0x1f, 0x24, 0x67, 0x30, 0x00, 0x00, 0x04, 0x9e, 0xff, 0xff, 0x60, 0x00, 0x00, 
+    0x2f, 0xba, 0x01, 0x10, 0x12, 0x06, 0x22, 0x25, 0x8a, 0xdf, 0xff, 0xff, 0xf8, 0x00, 0x04, 0xac, 
+    0x93, 0xcf, 0xb3, 0x00, 0x00, 0x00, 0x1e, 0x1c, 0x13, 0x01, 0x1b, 0x15, 0x8c, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xfb, 0x05, 0xff, 0xff, 0xd3, 0x30, 0x13, 0x25, 0x04, 0x40, 0xb1, 0x14, 0x00, 
+    0x1b, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xdf, 0xff, 0xff, 0x80, 0x14, 
+    0x27, 0x02, 0x92, 0x15, 0x00, 0x1b, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 
+    0xff, 0xff, 0xff, 0xb0, 0x15, 0x27, 0x02, 0x93, 0x16, 0x01, 0x1a, 0x29, 0xef, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xff, 0xfa, 0x16, 0x27, 0x02, 0x93, 0x17, 0x04, 0x19, 0x49, 
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x8f, 0xff, 0xff, 0x48, 0x50, 0x17, 0x27, 0x02, 0xa1, 
+    0x18, 0x07, 0x18, 0x26, 0xae, 0xff, 0xff, 0xff, 0xe5, 0x00, 0x8e, 0xfd, 0x49, 0xff, 0xe6, 0x18, 
+    0x27, 0x01, 0xc0, 0x19, 0x0b, 0x1d, 0x26, 0x9d, 0xf9, 0x20, 0x00, 0x00, 0x13, 0xcf, 0xff, 0xff, 
+    0xb0, 0x00, 0x00, 0x01, 0xb0, 0x1a, 0x18, 0x10, 0x9f, 0xff, 0xff, 0xff, 0x30, 0x00, 0x00, 0x57, 
+    0x1b, 0x18, 0x10, 0xbf, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0xa2, 0x1c, 0x18, 0x0f, 0xcf, 0xff, 
+    0xff, 0xff, 0xc0, 0x00, 0x02, 0xb0, 0x1d, 0x09, 0x01, 0x10, 0x1d, 0x18, 0x0f, 0xaf, 0xff, 0xff, 
+    0xff, 0xf2, 0x00, 0x09, 0x40, 0x1e, 0x08, 0x02, 0x1c, 0x1e, 0x18, 0x0e, 0x1e, 0xff, 0xff, 0xff, 
+    0xf6, 0x00, 0x05, 0x1f, 0x09, 0x02, 0x69, 0x1f, 0x19, 0x09, 0x4f, 0xff, 0xff, 0xff, 0xa0, 0x20, 
+    0x0a, 0x02, 0x96, 0x20, 0x1a, 0x08, 0x7f, 0xff, 0xff, 0xfe, 0x21, 0x0b, 0x02, 0xa7, 0x21, 0x1b, 
+    0x08, 0xaf, 0xff, 0xff, 0xf4, 0x22, 0x0c, 0x07, 0x99, 0x10, 0x01, 0x50, 0x22, 0x1b, 0x08, 0x1c, 
+    0xff, 0xff, 0xf8, 0x23, 0x0d, 0x08, 0x5c, 0x40, 0x0a, 0xc5, 0x23, 0x1c, 0x07, 0x2e, 0xff, 0xff, 
+    0xb0, 0x24, 0x0e, 0x15, 0x19, 0xb5, 0x4f, 0xfc, 0x40, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf0, 0x25, 
+    0x10, 0x14, 0x17, 0xbf, 0xff, 0xfc, 0x40, 0x00, 0x00, 0x6f, 0xff, 0xf3, 0x26, 0x12, 0x12, 0x5f, 
+    0xff, 0xd8, 0x40, 0x00, 0x00, 0x07, 0xff, 0xf6, 0x27, 0x11, 0x05, 0x2e, 0xc8, 0x30, 0x27, 0x20, 
+    0x04, 0x8f, 0xf8, 0x28, 0x11, 0x02, 0x32, 0x28, 0x21, 0x03, 0x7f, 0x80, 0x29, 0x22, 0x02, 0x43, 
+    0x00, 0x1a, 0x03, 0xaf, 0xc0, 0x01, 0x19, 0x09, 0x4f, 0xfd, 0x00, 0x00, 0x00, 0x02, 0x19, 0x09, 
+    0x9f, 0xff, 0x00, 0x00, 0x00, 0x03, 0x18, 0x0a, 0x3f, 0xff, 0xf2, 0x00, 0x00, 0x04, 0x18, 0x0a, 
+    0xaf, 0xff, 0xf3, 0x00, 0x00, 0x05, 0x10, 0x12, 0x40, 0x00, 0x00, 0x02, 0xef, 0xff, 0xf4, 0x00, 
+    0x00, 0x06, 0x0a, 0x18, 0x00, 0x00, 0x3b, 0x70, 0x00, 0x00, 0x06, 0xff, 0xff, 0xf4, 0x00, 0x00, 
+    0x07, 0x0a, 0x18, 0x00, 0x19, 0xb0, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x08, 
+    0x09, 0x06, 0x00, 0x29, 0x50, 0x08, 0x16, 0x0e, 0x5f, 0xff, 0xff, 0xf6, 0x00, 0x04, 0x61, 0x09, 
+    0x09, 0x05, 0x01, 0xa5, 0x00, 0x09, 0x16, 0x0f, 0xaf, 0xff, 0xff, 0xf5, 0x00, 0x01, 0xfd, 0x60, 
+    0x0a, 0x06, 0x22, 0x16, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xf6, 0x00, 
+    0x00, 0xaf, 0xfe, 0x61, 0x0b, 0x07, 0x07, 0xf5, 0xa5, 0x00, 0x00, 0x0b, 0x15, 0x14, 0x6f, 0xff, 
+    0xff, 0xff, 0x50, 0x00, 0x06, 0xff, 0xff, 0xd3, 0x0c, 0x06, 0x07, 0x1f, 0xfd, 0x8b, 0x40, 0x0c, 
+    0x15, 0x12, 0xdf, 0xff, 0xff, 0xff, 0x60, 0x00, 0x01, 0xdf, 0xe3, 0x0d, 0x06, 0x06, 0x1f, 0xff, 
+    0xf8, 0x0d, 0x15, 0x12, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0xae, 0x76, 0x0e, 0x07, 0x04, 
+    0xef, 0xf8, 0x0e, 0x15, 0x13, 0xcf, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x6a, 0x1a, 0x10, 0x0f, 
+    0x07, 0x03, 0xef, 0x90, 0x0f, 0x15, 0x15, 0x6f, 0xff, 0xff, 0xfd, 0x10, 0x00, 0x00, 0x04, 0x0a, 
+    0x40, 0x00, 0x10, 0x07, 0x02, 0xd9, 0x10, 0x15, 0x16, 0x1c, 0xee, 0xff, 0xd3, 0x00, 0x00, 0x00, 
+    0x00, 0x04, 0x80, 0x00, 0x11, 0x07, 0x24, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x55, 
+    0x9c, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x12, 0x06, 0x23, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x2a, 0xff, 0xf8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x10, 0x13, 0x01, 
+    0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5c, 0xe9, 0x20, 0x0b, 0xff, 0xff, 0xf5, 0x00, 0x13, 
+    0x25, 0x04, 0x00, 0xa3, 0x14, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xef, 0xff, 0xff, 
+    0xb2, 0xff, 0xff, 0xff, 0xb0, 0x14, 0x27, 0x02, 0xa3, 0x15, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 
+    0x4b, 0xe0, 0x15, 0x13, 0x01, 0x40, 0x15, 0x1b, 0x04, 0x25, 0x31, 0x15, 0x27, 0x02, 0x82, 0x16, 
+    0x01, 0x07, 0x00, 0x00, 0x04, 0xb0, 0x16, 0x13, 0x0e, 0x6b, 0xff, 0xff, 0xf6, 0xaf, 0xff, 0xd4, 
+    0x17, 0x04, 0x03, 0x5d, 0xf0, 0x17, 0x13, 0x15, 0xc4, 0xdf, 0xff, 0xb5, 0xff, 0xff, 0xff, 0x30, 
+    0x00, 0x00, 0xb0, 0x18, 0x02, 0x20, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x02, 
+    0x58, 0x63, 0xdf, 0xff, 0xff, 0xfb, 0x19, 0x00, 0x28, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xc1, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x28, 0x1a, 0x00, 0x28, 
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 
+    0xff, 0xd2, 0x00, 0x00, 0x1b, 0x01, 0x27, 0x13, 0x57, 0x98, 0x99, 0xa9, 0x98, 0x88, 0x76, 0x20, 
+    0x00, 0x00, 0x00, 0x1e, 0xff, 0xff, 0xff, 0xff, 0x90, 0x00, 0x00, 0x1c, 0x18, 0x0f, 0x00, 0xaf, 
+    0xff, 0xff, 0xff, 0xff, 0x30, 0x00, 0x1d, 0x09, 0x01, 0x00, 0x1d, 0x18, 0x0f, 0x00, 0x06, 0xff, 
+    0xff, 0xff, 0xff, 0xc0, 0x00, 0x1e, 0x08, 0x02, 0x00, 0x1e, 0x18, 0x0e, 0x00, 0x00, 0x2e, 0xff, 
+    0xff, 0xff, 0xf6, 0x1f, 0x09, 0x02, 0x00, 0x1f, 0x19, 0x0e, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xff, 
+    0xd1, 0x20, 0x0a, 0x03, 0x00, 0x20, 0x20, 0x1a, 0x0d, 0x00, 0x00, 0x16, 0xff, 0xff, 0xff, 0x60, 
+    0x21, 0x0b, 0x03, 0x4a, 0x30, 0x21, 0x1b, 0x0d, 0x00, 0x00, 0x04, 0xcf, 0xff, 0xfd, 0x20, 0x22, 
+    0x0c, 0x1c, 0x3a, 0x70, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7f, 0xff, 0xf7, 
+    0x23, 0x0d, 0x1b, 0x08, 0x96, 0x00, 0x00, 0x3e, 0xa7, 0x53, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xff, 
+    0xd0, 0x24, 0x0e, 0x1b, 0x02, 0x9c, 0x84, 0x20, 0x4f, 0xff, 0xfd, 0xa1, 0x00, 0x00, 0x00, 0x07, 
+    0xdf, 0x20, 0x25, 0x10, 0x18, 0x00, 0x58, 0xac, 0xbe, 0xff, 0xea, 0x10, 0x00, 0x00, 0x00, 0x00, 
+    0x04, 0x26, 0x12, 0x12, 0x00, 0x00, 0x1c, 0xfd, 0x50, 0x00, 0x00, 0x00, 0x00, 0x27, 0x11, 0x13, 
+    0x00, 0x00, 0x01, 0xf8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x11, 0x07, 0x00, 0x00, 0x05, 
+    0x40, 0x28, 0x21, 0x03, 0x00, 0x00, 0x29, 0x22, 0x02, 0x00, 0x00, 0x14, 0x09, 0x6f, 0xfa, 0x00, 
+    0x00, 0x00, 0x01, 0x14, 0x09, 0xaf, 0xff, 0x10, 0x00, 0x00, 0x02, 0x14, 0x09, 0xcf, 0xff, 0x70, 
+    0x00, 0x00, 0x03, 0x14, 0x0a, 0xef, 0xff, 0xc0, 0x00, 0x00, 0x04, 0x13, 0x0b, 0x1f, 0xff, 0xff, 
+    0x10, 0x00, 0x00, 0x05, 0x10, 0x10, 0x00, 0x03, 0xff, 0xff, 0xf4, 0x00, 0x02, 0x73, 0x06, 0x0e, 
+    0x18, 0x00, 0x00, 0x05, 0xff, 0xff, 0xfa, 0x00, 0x00, 0xaf, 0xfc, 0x97, 0x32, 0x07, 0x0c, 0x1a, 
+    0x50, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0x10, 0x00, 0x1d, 0xff, 0xff, 0x92, 0x08, 0x0b, 0x19, 
+    0x88, 0x00, 0x00, 0x00, 0x9f, 0xff, 0xff, 0xf3, 0x00, 0x00, 0x6f, 0xff, 0x30, 0x09, 0x0a, 0x1b, 
+    0x88, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x9f, 0x8c, 0x10, 0x0a, 0x06, 
+    0x06, 0x00, 0x04, 0x90, 0x0a, 0x13, 0x15, 0xdf, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x01, 0xc6, 0x49, 
+    0x10, 0x00, 0x0b, 0x07, 0x04, 0x01, 0xc2, 0x0b, 0x13, 0x16, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x00, 
+    0x00, 0x44, 0x08, 0x60, 0x00, 0x0c, 0x06, 0x21, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 
+    0xff, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x10, 0x1b, 0x20, 0x0d, 0x06, 0x21, 0x02, 0xc0, 0x00, 0x00, 
+    0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x0e, 0x04, 0x07, 
+    0x54, 0x08, 0x50, 0x20, 0x0e, 0x13, 0x15, 0xbf, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0b, 0x00, 0x0f, 0x04, 0x07, 0x1f, 0x9b, 0x6d, 0x30, 0x0f, 0x13, 0x14, 0x2e, 0xff, 0xff, 0xf4, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x05, 0x05, 0xcf, 0xff, 0xa0, 0x10, 0x14, 0x09, 0x2a, 
+    0x85, 0x96, 0x00, 0x00, 0x10, 0x27, 0x01, 0xa0, 0x11, 0x05, 0x05, 0x8f, 0xfe, 0x30, 0x11, 0x15, 
+    0x07, 0x5b, 0xb9, 0x10, 0x00, 0x11, 0x26, 0x02, 0x1c, 0x12, 0x05, 0x04, 0x3f, 0xf9, 0x12, 0x14, 
+    0x06, 0x8f, 0xff, 0xfd, 0x12, 0x27, 0x02, 0xd0, 0x13, 0x06, 0x1b, 0xdf, 0x10, 0x00, 0x00, 0x00, 
+    0x00, 0x01, 0xff, 0xff, 0xff, 0x70, 0x35, 0x65, 0x30, 0x13, 0x28, 0x01, 0x00, 0x14, 0x06, 0x0d, 
+    0xa8, 0x00, 0x00, 0x00, 0x25, 0x32, 0x00, 0x14, 0x1a, 0x0f, 0x98, 0xff, 0xff, 0xf7, 0x00, 0x00, 
+    0x0a, 0x20, 0x15, 0x06, 0x23, 0x40, 0x00, 0x00, 0x07, 0xef, 0xff, 0xd3, 0xff, 0xff, 0xff, 0x7b, 
+    0xff, 0xff, 0xff, 0x80, 0x00, 0x02, 0x00, 0x16, 0x06, 0x23, 0x00, 0x00, 0x01, 0xaf, 0xff, 0xff, 
+    0xf8, 0xaf, 0xff, 0xfe, 0x4d, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x17, 0x04, 0x08, 0x00, 
+    0x00, 0x00, 0x2d, 0x17, 0x13, 0x16, 0xe4, 0x8f, 0xec, 0x28, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x00, 
+    0x00, 0x18, 0x02, 0x09, 0x00, 0x00, 0x00, 0x04, 0xe0, 0x18, 0x13, 0x15, 0xfa, 0x00, 0x00, 0x06, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x19, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x70, 0x19, 
+    0x12, 0x16, 0xff, 0x50, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x1a, 0x00, 0x08, 
+    0x00, 0x00, 0x00, 0x1a, 0x1a, 0x11, 0x17, 0xff, 0xc1, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xa0, 0x1b, 0x01, 0x28, 0x00, 0x00, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 
+    0x00, 0x00, 0x00, 0x03, 0xae, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x1c, 0x04, 0x0f, 0x1d, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xfa, 0x50, 0x1c, 0x1a, 0x10, 0x00, 0x00, 0x07, 0xcf, 0xff, 0xff, 0xff, 0xf6, 
+    0x1d, 0x03, 0x0e, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x51, 0x1d, 0x1b, 0x10, 0x00, 0x00, 0x00, 
+    0x3a, 0xff, 0xff, 0xff, 0xf5, 0x1e, 0x03, 0x0a, 0xdf, 0xff, 0xff, 0xec, 0x72, 0x1e, 0x1c, 0x0f, 
+    0x00, 0x00, 0x00, 0x01, 0x5a, 0xff, 0xff, 0xa0, 0x1f, 0x02, 0x08, 0x4e, 0xec, 0xa6, 0x41, 0x1f, 
+    0x1d, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x49, 0xba, 0x20, 0x03, 0x02, 0x11, 0x20, 0x0c, 0x01, 
+    0x00, 0x20, 0x1e, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x0b, 0x03, 0x00, 0x00, 0x21, 0x1f, 
+    0x09, 0x11, 0x00, 0x00, 0x00, 0x00, 0x22, 0x0c, 0x1c, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x18, 
+    0xbd, 0xdf, 0xef, 0x70, 0x00, 0x00, 0x00, 0x23, 0x0e, 0x1a, 0x19, 0xb5, 0x00, 0x00, 0x00, 0x00, 
+    0x9f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x24, 0x0f, 0x1a, 0x03, 0x7a, 0xb8, 0x75, 0x55, 0x8a, 
+    0xdf, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x12, 0x0c, 0x02, 0x47, 0x68, 0x65, 0x28, 0xfb, 
+    0x25, 0x27, 0x01, 0x00, 0x26, 0x16, 0x08, 0x00, 0x00, 0x06, 0xb1, 0x27, 0x16, 0x07, 0x00, 0x00, 
+    0x06, 0x10, 0x28, 0x16, 0x02, 0x00, 0x00, 0x0f, 0x09, 0xbf, 0xe2, 0x00, 0x00, 0x00, 0x01, 0x0f, 
+    0x0a, 0xbf, 0xfc, 0x10, 0x00, 0x00, 0x02, 0x0f, 0x0a, 0xaf, 0xff, 0x60, 0x00, 0x00, 0x03, 0x0f, 
+    0x13, 0x9f, 0xff, 0xe2, 0x00, 0x00, 0x34, 0x56, 0x78, 0x98, 0x20, 0x04, 0x0f, 0x12, 0x8f, 0xff, 
+    0xfc, 0x10, 0x00, 0x2c, 0xff, 0xff, 0xd2, 0x05, 0x0f, 0x12, 0x6f, 0xff, 0xff, 0x80, 0x00, 0x01, 
+    0xaf, 0xff, 0x61, 0x06, 0x0f, 0x17, 0x5f, 0xff, 0xff, 0xe1, 0x00, 0x00, 0x08, 0xff, 0x9b, 0x20, 
+    0x00, 0x00, 0x07, 0x0c, 0x1a, 0x00, 0x02, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x07, 0xe2, 0x3c, 
+    0x30, 0x00, 0x08, 0x0b, 0x18, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0x30, 0x00, 0x00, 0x05, 0x40, 
+    0x1c, 0x09, 0x0a, 0x1b, 0x00, 0x00, 0x00, 0xdf, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x1c, 0x20, 0x0a, 0x08, 0x1d, 0x19, 0x00, 0x00, 0x00, 0xcf, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 
+    0x00, 0x00, 0x03, 0xb0, 0x0b, 0x08, 0x1e, 0x74, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xff, 0xd1, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x0c, 0x07, 0x1f, 0x2b, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 
+    0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x0d, 0x07, 0x02, 0x94, 0x0d, 0x10, 0x0c, 
+    0x5f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x0d, 0x25, 0x02, 0x55, 0x0e, 0x04, 0x17, 0x00, 0x1c, 0x00, 
+    0x00, 0x00, 0x00, 0x1e, 0xff, 0xff, 0xff, 0x90, 0x00, 0x0e, 0x25, 0x02, 0x1c, 0x0f, 0x04, 0x17, 
+    0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x03, 0xdf, 0xff, 0xee, 0x30, 0x00, 0x0f, 0x26, 0x02, 0xa3, 
+    0x10, 0x05, 0x05, 0x07, 0x40, 0x00, 0x10, 0x12, 0x0e, 0x1a, 0xc3, 0x34, 0x00, 0x00, 0x00, 0x02, 
+    0x10, 0x27, 0x01, 0x20, 0x11, 0x05, 0x05, 0x0a, 0x11, 0x10, 0x11, 0x14, 0x14, 0x5d, 0xff, 0xd3, 
+    0x00, 0x5b, 0xdf, 0xc4, 0x00, 0x00, 0x00, 0x12, 0x03, 0x07, 0x21, 0x0c, 0x3c, 0x20, 0x12, 0x13, 
+    0x15, 0x2e, 0xff, 0xff, 0xd1, 0xcf, 0xff, 0xff, 0xfc, 0x20, 0x00, 0x00, 0x13, 0x03, 0x06, 0x5d, 
+    0x7d, 0xed, 0x13, 0x13, 0x15, 0x6f, 0xff, 0xff, 0xf5, 0xdf, 0xff, 0xff, 0xff, 0xf8, 0x20, 0x00, 
+    0x14, 0x04, 0x25, 0xcf, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0x4d, 0xff, 
+    0xff, 0xff, 0xff, 0xfe, 0x71, 0x00, 0x15, 0x04, 0x0f, 0x2e, 0xff, 0x40, 0x00, 0x00, 0x00, 0x11, 
+    0x30, 0x15, 0x1a, 0x0f, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x16, 0x05, 0x17, 0x6f, 
+    0xf3, 0x00, 0x00, 0x03, 0xde, 0xff, 0x87, 0xff, 0xff, 0x61, 0xe0, 0x16, 0x23, 0x08, 0xff, 0xff, 
+    0xff, 0x92, 0x17, 0x05, 0x17, 0x1d, 0xe0, 0x00, 0x00, 0x2e, 0xff, 0xff, 0xf8, 0x38, 0x83, 0x00, 
+    0x50, 0x17, 0x24, 0x07, 0xff, 0xff, 0xff, 0x90, 0x18, 0x06, 0x17, 0x49, 0x00, 0x00, 0x1c, 0xff, 
+    0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x70, 0x18, 0x25, 0x06, 0xff, 0xff, 0xfa, 0x19, 0x07, 0x06, 
+    0x30, 0x00, 0x0b, 0x19, 0x14, 0x17, 0xf6, 0x00, 0x00, 0x00, 0x01, 0x56, 0x79, 0xbd, 0xdf, 0xff, 
+    0xff, 0xa0, 0x1a, 0x06, 0x06, 0x00, 0x00, 0x07, 0x1a, 0x13, 0x18, 0xff, 0x50, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x24, 0x32, 0x1b, 0x05, 0x07, 0x00, 0x00, 0x02, 0xe0, 0x1b, 0x13, 
+    0x02, 0xfe, 0x1b, 0x1c, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x04, 0x11, 0x00, 
+    0x00, 0x00, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x90, 0x1c, 0x1f, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x1d, 0x03, 0x11, 0x00, 0x00, 0x00, 0x9f, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x1d, 0x21, 0x0a, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x03, 0x10, 0x00, 0x00, 0x03, 0xef, 0xff, 0xff, 0xff, 0xa2, 
+    0x1e, 0x22, 0x09, 0x24, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x02, 0x0f, 0x00, 0x00, 0x00, 0xcf, 0xff, 
+    0xff, 0xfe, 0x50, 0x1f, 0x1f, 0x0c, 0x16, 0xcf, 0x50, 0x00, 0x00, 0x00, 0x20, 0x03, 0x0d, 0x00, 
+    0x00, 0x8f, 0xff, 0xff, 0xf8, 0x10, 0x20, 0x1c, 0x07, 0x28, 0xcf, 0xff, 0xc0, 0x21, 0x06, 0x08, 
+    0x4f, 0xff, 0xff, 0xa2, 0x21, 0x1c, 0x07, 0x48, 0xef, 0xfe, 0x30, 0x22, 0x06, 0x0a, 0xaf, 0xff, 
+    0xc3, 0x00, 0x00, 0x22, 0x18, 0x0a, 0x00, 0x00, 0x02, 0xad, 0xfb, 0x23, 0x05, 0x1d, 0x1e, 0xec, 
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x13, 0x6c, 0x84, 0x6f, 0x30, 0x24, 0x06, 0x02, 
+    0x41, 0x24, 0x10, 0x11, 0x00, 0x2a, 0xbb, 0xab, 0xcb, 0xa6, 0x20, 0x05, 0xb0, 0x25, 0x13, 0x0e, 
+    0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x26, 0x1b, 0x03, 0x00, 0x00, 0x27, 0x1b, 0x02, 0x00, 
+    0x00, 0x09, 0x0a, 0x15, 0x00, 0x00, 0x00, 0x00, 0x01, 0x09, 0x13, 0x2f, 0xc4, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x5a, 0xa0, 0x02, 0x0a, 0x12, 0xff, 0xe6, 0x00, 0x00, 0x00, 0x01, 0x49, 0xdf, 
+    0xf3, 0x03, 0x0a, 0x18, 0xbf, 0xff, 0x90, 0x00, 0x00, 0x2d, 0xff, 0xff, 0xd4, 0x10, 0x00, 0x00, 
+    0x04, 0x0a, 0x17, 0x6f, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x4d, 0xff, 0xb6, 0xca, 0x20, 0x00, 0x05, 
+    0x0a, 0x16, 0x1f, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x5c, 0xe5, 0x03, 0xb8, 0x06, 0x0b, 0x17, 
+    0xaf, 0xff, 0xff, 0xb2, 0x00, 0x00, 0x00, 0x14, 0x60, 0x00, 0x6b, 0x30, 0x07, 0x0b, 0x18, 0x6f, 
+    0xff, 0xff, 0xfb, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xb4, 0x08, 0x0b, 0x19, 0x1d, 0xff, 
+    0xff, 0xff, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x20, 0x09, 0x0c, 0x0c, 0x8f, 0xff, 
+    0xff, 0xff, 0xd1, 0x00, 0x09, 0x24, 0x01, 0x10, 0x0a, 0x08, 0x11, 0x00, 0x00, 0x2f, 0xff, 0xff, 
+    0xff, 0xfc, 0x10, 0x00, 0x0a, 0x23, 0x03, 0x4b, 0x00, 0x0b, 0x08, 0x12, 0x00, 0x00, 0x0a, 0xff, 
+    0xff, 0xff, 0xff, 0x80, 0x00, 0x0b, 0x25, 0x01, 0x40, 0x0c, 0x07, 0x13, 0x00, 0x00, 0x00, 0x3f, 
+    0xff, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x0c, 0x25, 0x02, 0x00, 0x0d, 0x06, 0x13, 0x22, 0x00, 0x00, 
+    0x00, 0xbf, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x0d, 0x25, 0x02, 0x00, 0x0e, 0x06, 0x21, 0x76, 0x00, 
+    0x00, 0x00, 0x6f, 0xff, 0xff, 0xff, 0x90, 0x00, 0x00, 0x05, 0x86, 0x20, 0x00, 0x00, 0x00, 0x0f, 
+    0x06, 0x02, 0xa2, 0x0f, 0x0f, 0x19, 0xcf, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x3d, 0xff, 0xff, 0xfb, 
+    0x83, 0x00, 0x00, 0x10, 0x06, 0x02, 0xa0, 0x10, 0x0f, 0x1a, 0x28, 0xef, 0xd3, 0x8a, 0x83, 0x05, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x73, 0x11, 0x05, 0x05, 0x19, 0x00, 0x00, 0x11, 0x11, 0x1a, 
+    0x26, 0x3d, 0xff, 0xfd, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x12, 0x03, 0x07, 
+    0x00, 0x28, 0x00, 0x00, 0x12, 0x13, 0x18, 0x8f, 0xff, 0xff, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xfa, 0x13, 0x03, 0x06, 0x00, 0x47, 0x00, 0x13, 0x13, 0x01, 0xd0, 0x13, 0x1b, 0x01, 
+    0xf0, 0x13, 0x24, 0x07, 0xff, 0xff, 0xff, 0xa0, 0x14, 0x04, 0x05, 0x03, 0x80, 0x00, 0x14, 0x13, 
+    0x01, 0xb0, 0x14, 0x1b, 0x01, 0xf0, 0x14, 0x25, 0x06, 0xff, 0xff, 0xf8, 0x15, 0x04, 0x05, 0x03, 
+    0x80, 0x80, 0x15, 0x10, 0x0d, 0x00, 0x04, 0xff, 0xff, 0xf8, 0x06, 0xe0, 0x15, 0x24, 0x06, 0xdc, 
+    0x97, 0x41, 0x16, 0x05, 0x26, 0x0a, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x26, 0x68, 0xef, 0xfa, 0x00, 
+    0x03, 0xac, 0xa9, 0x65, 0x21, 0x00, 0x00, 0x00, 0x17, 0x03, 0x28, 0x57, 0x5d, 0xed, 0x00, 0x00, 
+    0x00, 0x19, 0xef, 0xf9, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 
+    0x03, 0x28, 0x1c, 0xff, 0xfd, 0x00, 0x00, 0x01, 0xdf, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x04, 0x27, 0x1a, 0xff, 0xd0, 0x00, 0x00, 0x4f, 0xff, 
+    0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x05, 0x12, 
+    0x19, 0xff, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xf9, 0x1a, 0x24, 0x07, 0x13, 0x00, 0x00, 0x00, 
+    0x1b, 0x06, 0x11, 0x19, 0xd0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x1b, 0x23, 0x03, 0x2c, 
+    0x70, 0x1c, 0x08, 0x0f, 0x90, 0x00, 0x08, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1c, 0x22, 0x04, 0x8f, 
+    0xf4, 0x1d, 0x09, 0x0e, 0x00, 0x01, 0xef, 0xff, 0xff, 0xff, 0xb1, 0x1d, 0x20, 0x06, 0x3c, 0xff, 
+    0xe2, 0x1e, 0x08, 0x0e, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xc2, 0x1e, 0x1f, 0x06, 0x9f, 0xff, 
+    0xfb, 0x1f, 0x08, 0x0d, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xfe, 0x20, 0x1f, 0x1f, 0x06, 0x01, 0x8c, 
+    0xf8, 0x20, 0x07, 0x0d, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xfe, 0x20, 0x20, 0x1c, 0x09, 0x00, 0x01, 
+    0x9a, 0x2e, 0x60, 0x21, 0x06, 0x0d, 0x00, 0x00, 0x07, 0xff, 0xff, 0xfe, 0x20, 0x21, 0x1c, 0x09, 
+    0x00, 0x2a, 0x60, 0x09, 0x20, 0x22, 0x06, 0x0c, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xe3, 0x22, 0x1b, 
+    0x0a, 0x13, 0xaa, 0x20, 0x00, 0x11, 0x23, 0x05, 0x1d, 0x00, 0x00, 0x01, 0xff, 0xff, 0xe2, 0x00, 
+    0x00, 0x00, 0x23, 0x69, 0xc9, 0x20, 0x00, 0x00, 0x24, 0x06, 0x1b, 0x00, 0x00, 0x6f, 0xff, 0xd2, 
+    0x00, 0x00, 0x00, 0x29, 0x86, 0x30, 0x00, 0x00, 0x00, 0x25, 0x0a, 0x05, 0xaf, 0xfc, 0x20, 0x25, 
+    0x17, 0x01, 0x00, 0x25, 0x20, 0x01, 0x00, 0x26, 0x0a, 0x03, 0xcf, 0x90, 0x27, 0x0a, 0x02, 0x85, 
+    0x00, 0x09, 0x02, 0x00, 0x00, 0x15, 0x02, 0x97, 0x01, 0x09, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x3c, 0xf2, 0x00, 0x00, 0x00, 0x02, 0x0a, 0x12, 0x00, 0x00, 0x00, 0x01, 0x8f, 0xff, 0x54, 0x21, 
+    0x00, 0x03, 0x0a, 0x12, 0x00, 0x00, 0x00, 0x4c, 0xff, 0xff, 0x88, 0x9a, 0xc7, 0x04, 0x04, 0x1b, 
+    0x1c, 0xa5, 0x10, 0x00, 0x00, 0x00, 0x58, 0xae, 0xff, 0xd0, 0x00, 0x14, 0xb9, 0x40, 0x05, 0x05, 
+    0x1c, 0xbf, 0xfd, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x47, 0x80, 0x00, 0x00, 0x3b, 0x80, 0x06, 
+    0x05, 0x1d, 0x3f, 0xff, 0xff, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 
+    0x10, 0x07, 0x06, 0x0e, 0xaf, 0xff, 0xff, 0xd6, 0x10, 0x00, 0x00, 0x07, 0x21, 0x02, 0xc1, 0x08, 
+    0x07, 0x0e, 0xef, 0xff, 0xff, 0xfd, 0x50, 0x00, 0x00, 0x08, 0x21, 0x03, 0x22, 0x00, 0x09, 0x07, 
+    0x0f, 0x3f, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x00, 0x00, 0x09, 0x22, 0x03, 0x00, 0x00, 0x0a, 0x08, 
+    0x0f, 0x9f, 0xff, 0xff, 0xff, 0xff, 0x81, 0x00, 0x00, 0x0a, 0x23, 0x02, 0x00, 0x0b, 0x09, 0x0e, 
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x00, 0x0b, 0x20, 0x06, 0x10, 0x00, 0x00, 0x0c, 0x09, 0x22, 
+    0x1d, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x4b, 0xde, 0xee, 0xee, 0xee, 0xee, 0xfd, 
+    0xc8, 0x0d, 0x06, 0x25, 0x00, 0x00, 0x4e, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x6e, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0e, 0x06, 0x25, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 
+    0xff, 0xc0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0f, 0x06, 0x25, 
+    0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xfe, 0x80, 0x00, 0x0d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+    0xff, 0xd7, 0x10, 0x10, 0x06, 0x15, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xe6, 0x7d, 0xeb, 0x2d, 
+    0xf0, 0x10, 0x25, 0x04, 0xfd, 0x91, 0x11, 0x05, 0x16, 0x40, 0x00, 0x00, 0x00, 0x2c, 0xff, 0xf7, 
+    0xaf, 0xff, 0xfe, 0x3f, 0x11, 0x24, 0x07, 0xc7, 0x10, 0x00, 0x00, 0x12, 0x05, 0x02, 0x91, 0x12, 
+    0x10, 0x1b, 0x33, 0x2f, 0xff, 0xff, 0xf6, 0xbf, 0xff, 0xff, 0xfe, 0xc6, 0x00, 0x00, 0x00, 0x00, 
+    0x13, 0x05, 0x02, 0xa1, 0x13, 0x12, 0x19, 0x5f, 0xff, 0xff, 0xf9, 0x5d, 0xff, 0xfe, 0x93, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x14, 0x05, 0x02, 0xa1, 0x14, 0x12, 0x19, 0x2f, 0xff, 0xff, 0xf6, 0x00, 
+    0x38, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x05, 0x04, 0xa3, 0x00, 0x15, 0x13, 0x17, 
+    0xaf, 0xff, 0xfd, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x05, 0x04, 0x85, 
+    0x00, 0x16, 0x11, 0x16, 0x00, 0x17, 0xdd, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x17, 
+    0x03, 0x14, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xd9, 0x65, 0x17, 0x24, 0x03, 0x1c, 
+    0x70, 0x18, 0x03, 0x15, 0x00, 0x0c, 0x02, 0x20, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x50, 0x18, 
+    0x24, 0x03, 0xcf, 0x80, 0x19, 0x04, 0x14, 0x00, 0xb4, 0x88, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 
+    0xfc, 0x19, 0x23, 0x04, 0xbf, 0xfa, 0x1a, 0x05, 0x14, 0x02, 0xac, 0xc0, 0x00, 0x00, 0x1e, 0xff, 
+    0xff, 0xff, 0xf1, 0x1a, 0x22, 0x05, 0x9f, 0xff, 0xa0, 0x1b, 0x05, 0x14, 0x35, 0xdf, 0xe1, 0x00, 
+    0x00, 0x1f, 0xff, 0xff, 0xff, 0xf5, 0x1b, 0x21, 0x06, 0x7d, 0xbf, 0xfb, 0x1c, 0x04, 0x15, 0x3a, 
+    0xff, 0xff, 0x60, 0x00, 0x02, 0xff, 0xff, 0xff, 0xff, 0x30, 0x1c, 0x21, 0x06, 0x10, 0x77, 0xab, 
+    0x1d, 0x06, 0x12, 0x5c, 0xff, 0xa0, 0x00, 0x05, 0xff, 0xff, 0xff, 0xfc, 0x1d, 0x20, 0x07, 0x00, 
+    0x5a, 0x01, 0x90, 0x1e, 0x08, 0x10, 0x6e, 0xe1, 0x00, 0x07, 0xff, 0xff, 0xff, 0xf2, 0x1e, 0x1f, 
+    0x06, 0x00, 0x3b, 0x20, 0x1f, 0x09, 0x0e, 0x18, 0x30, 0x00, 0x8f, 0xff, 0xff, 0xfa, 0x1f, 0x20, 
+    0x05, 0x4b, 0x20, 0x00, 0x20, 0x0b, 0x0c, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xf2, 0x20, 0x1f, 0x06, 
+    0x7a, 0x20, 0x00, 0x21, 0x0b, 0x0b, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x90, 0x21, 0x1d, 0x08, 0x3a, 
+    0x81, 0x00, 0x00, 0x22, 0x0b, 0x1a, 0x00, 0x00, 0xef, 0xff, 0xfd, 0x10, 0x00, 0x00, 0x69, 0xa2, 
+    0x00, 0x00, 0x00, 0x23, 0x0a, 0x14, 0x00, 0x00, 0x0e, 0xff, 0xff, 0x70, 0x00, 0x00, 0x47, 0x30, 
+    0x24, 0x0a, 0x11, 0x00, 0x00, 0x1f, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x25, 0x0a, 0x0a, 0x00, 
+    0x00, 0x1f, 0xff, 0xf3, 0x26, 0x0a, 0x09, 0x00, 0x00, 0x2f, 0xff, 0x80, 0x27, 0x0a, 0x09, 0x00, 
+    0x00, 0x3f, 0xfd, 0x10, 0x28, 0x0e, 0x04, 0x1f, 0xd4, 0x29, 0x0f, 0x02, 0xb4, 0x00, 0x10, 0x07, 
+    0x51, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x08, 0x4f, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x0b, 0x2e, 0xe0, 
+    0x36, 0x78, 0x86, 0x40, 0x03, 0x0d, 0x0d, 0x1d, 0xff, 0xc8, 0x64, 0x44, 0x57, 0xb0, 0x04, 0x04, 
+    0x1b, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xfe, 0x50, 0x00, 0x00, 0x00, 0x15, 0xb9, 0x10, 0x05, 
+    0x05, 0x1b, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xed, 0xcb, 0x40, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 
+    0x06, 0x05, 0x09, 0x00, 0x00, 0x00, 0x12, 0x10, 0x06, 0x1f, 0x03, 0x00, 0x00, 0x07, 0x06, 0x09, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x20, 0x0a, 0x00, 0x01, 0x58, 0xbd, 0xd5, 0x08, 0x01, 0x0f, 
+    0x24, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1f, 0x0b, 0x15, 0x9d, 0xff, 0xff, 0xfe, 
+    0x20, 0x09, 0x01, 0x11, 0xbf, 0xff, 0xeb, 0x85, 0x20, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1c, 0x0d, 
+    0x27, 0xbf, 0xff, 0xff, 0xff, 0xfe, 0x30, 0x0a, 0x01, 0x27, 0x2e, 0xff, 0xff, 0xff, 0xfd, 0x95, 
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x30, 0x0b, 0x02, 
+    0x25, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x40, 0x00, 0x00, 0x00, 0x1e, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xfe, 0x30, 0x0c, 0x03, 0x28, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 
+    0x00, 0x09, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x00, 0x00, 0x0d, 0x04, 0x18, 0x1b, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x02, 0xff, 0xff, 0x0d, 0x23, 0x08, 0xb1, 0x00, 0x00, 
+    0x00, 0x0e, 0x06, 0x14, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x07, 0xff, 0x0e, 0x22, 
+    0x09, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x07, 0x24, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 
+    0x10, 0x6f, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x21, 0x2c, 0xff, 
+    0xff, 0xff, 0xff, 0x85, 0xdf, 0xe8, 0x5f, 0xff, 0xff, 0xfd, 0x30, 0x00, 0x00, 0x00, 0x00, 0x11, 
+    0x05, 0x21, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xf8, 0x9f, 0xff, 0xfa, 0x10, 
+    0x00, 0x00, 0x10, 0x12, 0x05, 0x22, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xff, 0x8a, 0xff, 0xff, 0xfe, 
+    0x14, 0x67, 0x50, 0x00, 0x00, 0x00, 0x75, 0x13, 0x05, 0x22, 0x00, 0x00, 0x00, 0x01, 0x9b, 0x96, 
+    0x2c, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0xea, 0x14, 0x05, 0x02, 0x00, 0x14, 
+    0x12, 0x15, 0x9f, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xe0, 0x15, 0x05, 0x02, 
+    0x30, 0x15, 0x12, 0x08, 0x2e, 0xff, 0xff, 0x50, 0x15, 0x23, 0x05, 0x1e, 0xff, 0x50, 0x16, 0x05, 
+    0x02, 0xc0, 0x16, 0x13, 0x06, 0x29, 0xba, 0x30, 0x16, 0x23, 0x05, 0x7f, 0xff, 0x90, 0x17, 0x05, 
+    0x02, 0xb1, 0x17, 0x12, 0x06, 0x03, 0x97, 0x89, 0x17, 0x22, 0x06, 0x1e, 0xde, 0xee, 0x18, 0x05, 
+    0x05, 0x76, 0x00, 0x00, 0x18, 0x11, 0x08, 0x02, 0xef, 0xff, 0xf9, 0x18, 0x22, 0x07, 0x55, 0x2a, 
+    0x2b, 0x40, 0x19, 0x05, 0x15, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0x40, 
+    0x19, 0x23, 0x06, 0x07, 0x50, 0x02, 0x1a, 0x06, 0x14, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 
+    0xff, 0xff, 0xfc, 0x1a, 0x22, 0x05, 0x01, 0xc0, 0x00, 0x1b, 0x05, 0x15, 0x02, 0xb0, 0x04, 0x00, 
+    0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xf0, 0x1b, 0x21, 0x06, 0x00, 0x76, 0x00, 0x1c, 0x04, 0x16, 
+    0x00, 0x08, 0x60, 0xd1, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0xfc, 0x1c, 0x21, 0x06, 0x02, 0xc0, 
+    0x00, 0x1d, 0x06, 0x14, 0x00, 0xb4, 0xf9, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xf8, 0x1d, 0x21, 
+    0x06, 0x1c, 0x20, 0x00, 0x1e, 0x08, 0x12, 0x2d, 0xff, 0x30, 0x00, 0x01, 0xff, 0xff, 0xff, 0xf5, 
+    0x1e, 0x21, 0x03, 0xb5, 0x00, 0x1f, 0x07, 0x1c, 0x3a, 0xff, 0xfc, 0x00, 0x00, 0x0e, 0xff, 0xff, 
+    0xff, 0x10, 0x00, 0x00, 0x1b, 0x50, 0x20, 0x06, 0x1c, 0x17, 0xbf, 0xff, 0xf7, 0x00, 0x00, 0xcf, 
+    0xff, 0xff, 0xc0, 0x00, 0x00, 0x3c, 0x40, 0x21, 0x0a, 0x17, 0x47, 0xbe, 0x20, 0x00, 0x9f, 0xff, 
+    0xff, 0x90, 0x00, 0x01, 0xa2, 0x00, 0x22, 0x0e, 0x11, 0x10, 0x00, 0x7f, 0xff, 0xff, 0x50, 0x00, 
+    0x00, 0x00, 0x23, 0x0f, 0x0e, 0x00, 0x04, 0xff, 0xff, 0xf1, 0x00, 0x00, 0x24, 0x0e, 0x0a, 0x00, 
+    0x00, 0x1f, 0xff, 0xfb, 0x25, 0x0e, 0x0a, 0x00, 0x00, 0x0e, 0xff, 0xf7, 0x26, 0x0e, 0x0a, 0x00, 
+    0x00, 0x0a, 0xff, 0xf2, 0x27, 0x0e, 0x09, 0x00, 0x00, 0x07, 0xff, 0xc0, 0x28, 0x0e, 0x09, 0x00, 
+    0x00, 0x03, 0xff, 0x70, 0x29, 0x0f, 0x08, 0x00, 0x00, 0x0d, 0xe1, 0x2a, 0x14, 0x02, 0x45, 0x00, 
+    0x10, 0x02, 0x00, 0x01, 0x0f, 0x02, 0x00, 0x02, 0x0b, 0x0f, 0x60, 0x00, 0x00, 0x35, 0x78, 0x78, 
+    0x63, 0x00, 0x02, 0x23, 0x03, 0x36, 0x10, 0x03, 0x0a, 0x1c, 0x3f, 0x00, 0x28, 0xc9, 0x75, 0x53, 
+    0x46, 0x9a, 0x00, 0x00, 0x00, 0x04, 0xcf, 0xf4, 0x04, 0x0a, 0x09, 0x8f, 0x7a, 0xa5, 0x00, 0x00, 
+    0x04, 0x1a, 0x0b, 0x00, 0x00, 0x05, 0xbf, 0xff, 0xb0, 0x05, 0x09, 0x0b, 0x2f, 0xff, 0x70, 0x00, 
+    0x00, 0x00, 0x05, 0x1d, 0x08, 0x2b, 0xff, 0xff, 0xe4, 0x06, 0x09, 0x07, 0x9f, 0xff, 0xff, 0x40, 
+    0x06, 0x1b, 0x09, 0x28, 0xff, 0xff, 0xff, 0x90, 0x07, 0x08, 0x07, 0x2e, 0xfe, 0xa5, 0x10, 0x07, 
+    0x1a, 0x10, 0x5d, 0xff, 0xff, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x08, 0x01, 0x0b, 0x00, 0x00, 0x00, 
+    0x07, 0xb5, 0x20, 0x08, 0x18, 0x12, 0x2c, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x09, 
+    0x01, 0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x17, 0x12, 0x8e, 0xff, 0xff, 0xff, 0xff, 0x90, 
+    0x00, 0x00, 0x00, 0x0a, 0x01, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x16, 0x12, 
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x00, 0x00, 0x00, 0x0b, 0x02, 0x25, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0xff, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x0c, 
+    0x03, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xff, 0xff, 
+    0x50, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x25, 0x24, 0x57, 0x89, 0x9a, 0xba, 0xba, 0xba, 0xa4, 0x00, 
+    0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x00, 0x00, 0x40, 0x0e, 0x00, 0x07, 0xff, 0xff, 0xff, 
+    0xf0, 0x0e, 0x10, 0x16, 0x50, 0x00, 0x04, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0xc3, 0x0f, 
+    0x00, 0x09, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0x11, 0x15, 0x50, 0x01, 0x25, 0xdf, 0xff, 0xff, 
+    0x20, 0x00, 0x00, 0x1e, 0xc0, 0x10, 0x00, 0x0a, 0x5d, 0xff, 0xff, 0xff, 0xff, 0x10, 0x11, 0x16, 
+    0xd2, 0xaf, 0xfb, 0x4a, 0xfe, 0xa5, 0x00, 0x00, 0x00, 0x4f, 0xf8, 0x11, 0x02, 0x26, 0x4d, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xff, 0xfd, 0x21, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 
+    0xf3, 0x12, 0x04, 0x24, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xff, 0xff, 0xff, 0x60, 0x00, 
+    0x00, 0x00, 0x00, 0x09, 0xff, 0xfc, 0x13, 0x06, 0x14, 0x29, 0xef, 0xff, 0xff, 0xff, 0xd6, 0xff, 
+    0xff, 0xff, 0x80, 0x13, 0x23, 0x06, 0xcd, 0xe8, 0xb7, 0x14, 0x08, 0x11, 0x15, 0xbf, 0xff, 0xfe, 
+    0x82, 0xff, 0xff, 0xff, 0x50, 0x14, 0x22, 0x07, 0x2c, 0x1a, 0x00, 0x20, 0x15, 0x05, 0x14, 0x00, 
+    0x00, 0x00, 0x18, 0xa7, 0x20, 0x07, 0xff, 0xff, 0xa0, 0x15, 0x22, 0x06, 0x10, 0x0c, 0x00, 0x16, 
+    0x05, 0x01, 0x00, 0x16, 0x13, 0x06, 0x6c, 0xb6, 0x51, 0x16, 0x23, 0x05, 0x02, 0xa0, 0x00, 0x17, 
+    0x05, 0x02, 0x00, 0x17, 0x13, 0x07, 0x02, 0x8a, 0xef, 0x40, 0x17, 0x22, 0x06, 0x00, 0x78, 0x00, 
+    0x18, 0x05, 0x02, 0x00, 0x18, 0x12, 0x09, 0x00, 0xef, 0xff, 0xff, 0x50, 0x18, 0x22, 0x07, 0x00, 
+    0x82, 0x00, 0x00, 0x19, 0x06, 0x01, 0x20, 0x19, 0x12, 0x0a, 0x05, 0xff, 0xff, 0xff, 0xf4, 0x19, 
+    0x23, 0x06, 0x1b, 0x00, 0x00, 0x1a, 0x05, 0x03, 0x3a, 0x00, 0x1a, 0x11, 0x0b, 0x00, 0xaf, 0xff, 
+    0xff, 0xff, 0x70, 0x1a, 0x23, 0x02, 0x77, 0x1b, 0x06, 0x1f, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x0d, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x1c, 0x06, 0x1e, 0x2c, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x09, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x85, 0x1d, 0x07, 0x1d, 0x59, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xff, 0x90, 0x00, 0x00, 0x79, 0x00, 0x1e, 0x08, 
+    0x1b, 0x79, 0x00, 0x82, 0x00, 0x00, 0x00, 0xcf, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x2a, 0x00, 0x1f, 
+    0x07, 0x1b, 0x01, 0x79, 0x0a, 0xb0, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x10, 
+    0x20, 0x06, 0x1b, 0x00, 0x00, 0x6a, 0x9f, 0xd0, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xf9, 0x00, 0x00, 
+    0x00, 0x21, 0x0a, 0x16, 0x05, 0xdf, 0xfd, 0x20, 0x00, 0x08, 0xff, 0xff, 0xf9, 0x00, 0x00, 0x22, 
+    0x0b, 0x11, 0xaf, 0xff, 0xfd, 0x20, 0x00, 0x2e, 0xff, 0xff, 0xa0, 0x23, 0x0a, 0x12, 0x7a, 0xab, 
+    0x99, 0x86, 0x00, 0x00, 0xaf, 0xff, 0xf9, 0x24, 0x12, 0x0a, 0x00, 0x00, 0x1f, 0xff, 0xf9, 0x25, 
+    0x13, 0x09, 0x00, 0x00, 0xbf, 0xff, 0x70, 0x26, 0x13, 0x09, 0x00, 0x00, 0x2f, 0xff, 0x70, 0x27, 
+    0x13, 0x09, 0x00, 0x00, 0x0a, 0xff, 0x50, 0x28, 0x13, 0x09, 0x00, 0x00, 0x02, 0xdf, 0x20, 0x29, 
+    0x14, 0x07, 0x00, 0x00, 0x05, 0xd0, 0x2a, 0x14, 0x02, 0x00, 0x01, 0x20, 0x02, 0x5a, 0x02, 0x0b, 
+    0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xe0, 0x00, 0x00, 0x03, 
+    0x0a, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xfd, 0x00, 0x00, 
+    0x04, 0x0a, 0x06, 0x00, 0x00, 0x00, 0x04, 0x1d, 0x08, 0x4f, 0xff, 0xb0, 0x00, 0x05, 0x09, 0x0c, 
+    0x00, 0x00, 0x00, 0x00, 0x38, 0xba, 0x05, 0x1c, 0x09, 0x2e, 0xff, 0xf9, 0x00, 0x00, 0x06, 0x09, 
+    0x0a, 0x01, 0x00, 0x00, 0x4b, 0x94, 0x06, 0x1b, 0x09, 0x1c, 0xff, 0xff, 0x60, 0x00, 0x07, 0x08, 
+    0x09, 0x00, 0xa0, 0x02, 0xb9, 0x10, 0x07, 0x1a, 0x0a, 0x0a, 0xff, 0xff, 0xf3, 0x00, 0x08, 0x08, 
+    0x07, 0x01, 0xf5, 0x5c, 0x30, 0x08, 0x18, 0x0b, 0x00, 0x6f, 0xff, 0xff, 0xf0, 0x00, 0x09, 0x08, 
+    0x06, 0x05, 0xfd, 0xc1, 0x09, 0x17, 0x0b, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x0a, 0x09, 0x19, 
+    0x9f, 0xff, 0xfb, 0x10, 0x00, 0x00, 0x00, 0x01, 0xdf, 0xff, 0xff, 0xf8, 0x00, 0x0b, 0x09, 0x05, 
+    0xcf, 0xfe, 0x60, 0x0b, 0x16, 0x03, 0x00, 0x90, 0x0b, 0x20, 0x05, 0x40, 0x00, 0x10, 0x0c, 0x08, 
+    0x05, 0x1f, 0xfa, 0x10, 0x0c, 0x15, 0x03, 0x00, 0x50, 0x0c, 0x1f, 0x07, 0xf1, 0x00, 0x07, 0x70, 
+    0x0d, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 
+    0xff, 0xff, 0xfb, 0x00, 0x00, 0x6f, 0x80, 0x0e, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x5f, 0xfa, 0x0f, 0x00, 
+    0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xff, 
+    0xf3, 0x00, 0x00, 0x4f, 0xff, 0xc1, 0x10, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x3f, 0xff, 0xfd, 0x20, 0x11, 
+    0x02, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x67, 0x30, 0x00, 0x00, 0x04, 0x9e, 0xff, 0xff, 
+    0x60, 0x00, 0x00, 0x2f, 0xba, 0x01, 0x10, 0x12, 0x04, 0x23, 0x00, 0x25, 0x8a, 0xdf, 0xff, 0xff, 
+    0xf8, 0x00, 0x04, 0xac, 0x93, 0xcf, 0xb3, 0x00, 0x00, 0x00, 0x1e, 0x10, 0x13, 0x01, 0x08, 0x15, 
+    0x8c, 0xff, 0xff, 0x13, 0x10, 0x0c, 0xff, 0xb0, 0x5f, 0xff, 0xfd, 0x33, 0x13, 0x23, 0x06, 0x00, 
+    0x40, 0xb1, 0x14, 0x00, 0x1b, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xdf, 
+    0xff, 0xff, 0x80, 0x14, 0x22, 0x06, 0x00, 0x00, 0x09, 0x15, 0x00, 0x1b, 0x9f, 0xff, 0xff, 0xff, 
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xb0, 0x15, 0x22, 0x07, 0x00, 0x00, 0x09, 
+    0x30, 0x16, 0x01, 0x1a, 0x29, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xff, 0xff, 
+    0xfa, 0x16, 0x24, 0x05, 0x00, 0x09, 0x30, 0x17, 0x04, 0x19, 0x49, 0xdf, 0xff, 0xff, 0xff, 0xff, 
+    0xff, 0xf4, 0x8f, 0xff, 0xff, 0x48, 0x50, 0x17, 0x24, 0x05, 0x00, 0x0a, 0x10, 0x18, 0x07, 0x21, 
+    0x26, 0xae, 0xff, 0xff, 0xff, 0xe5, 0x00, 0x8e, 0xfd, 0x49, 0xff, 0xe6, 0x00, 0x00, 0x00, 0x00, 
+    0xc0, 0x19, 0x05, 0x23, 0x00, 0x00, 0x00, 0x26, 0x9d, 0xf9, 0x20, 0x00, 0x00, 0x13, 0xcf, 0xff, 
+    0xff, 0xb0, 0x00, 0x00, 0x01, 0xb0, 0x1a, 0x05, 0x02, 0x00, 0x1a, 0x13, 0x15, 0x00, 0x00, 0x09, 
+    0xff, 0xff, 0xff, 0xf3, 0x00, 0x00, 0x05, 0x70, 0x1b, 0x06, 0x02, 0x00, 0x1b, 0x13, 0x15, 0x00, 
+    0x00, 0x0b, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x0a, 0x20, 0x1c, 0x06, 0x02, 0x00, 0x1c, 0x13, 
+    0x14, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x2b, 0x1d, 0x07, 0x03, 0x00, 0x10, 
+    0x1d, 0x13, 0x14, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0xff, 0x20, 0x00, 0x94, 0x1e, 0x08, 0x1e, 
+    0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x05, 0x1f, 
+    0x08, 0x1a, 0x06, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0xfa, 0x20, 
+    0x0a, 0x18, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xfe, 0x21, 0x0b, 
+    0x18, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xf4, 0x22, 0x0b, 0x18, 
+    0x09, 0x91, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xff, 0xf8, 0x23, 0x0a, 0x19, 0x00, 
+    0x05, 0xc4, 0x00, 0xac, 0x50, 0x00, 0x00, 0x00, 0x2e, 0xff, 0xff, 0xb0, 0x24, 0x0e, 0x15, 0x19, 
+    0xb5, 0x4f, 0xfc, 0x40, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf0, 0x25, 0x10, 0x14, 0x17, 0xbf, 0xff, 
+    0xfc, 0x40, 0x00, 0x00, 0x6f, 0xff, 0xf3, 0x26, 0x12, 0x12, 0x5f, 0xff, 0xd8, 0x40, 0x00, 0x00, 
+    0x07, 0xff, 0xf6, 0x27, 0x11, 0x13, 0x2e, 0xc8, 0x30, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x80, 
+    0x28, 0x11, 0x13, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x29, 0x19, 0x02, 
+    0x00, 0x29, 0x22, 0x02, 0x43, 
+};
+static const uint32_t anim_frames_drum[10] = {
+    33, 592, 1258, 1926, 2592, 3264, 3933, 4607, 
+    5290, 6005, 
+};
+const tAnim drum = { anim_data_drum, anim_frames_drum,
+    43, 43, 8, -120 };
+
@@ -0,0 +1,171 @@
+/**
+ * \file
+ *
+ * \brief List of items scrolled with the vertical scrolling of the LCD.
+ *
+ * The list keeps l_pos, the content row shown on its first screen row.
+ * Content row r belongs to item r / us_item_height (modulo ul_count when
+ * wrapping), so an item starts on screen row
+ * us_top + index * us_item_height - l_pos.
+ */
+
+#include <asf.h>
+#include "listview.h"
+#include "compositor.h"
+
+/**
+ * \brief Division rounding towards minus infinity.
+ */
+static int32_t listview_floor_div(int32_t l_num, int32_t l_den)
+{
+	return (l_num >= 0) ? (l_num / l_den) : -((l_den - 1 - l_num) / l_den);
+}
+
+/**
+ * \brief Bring a position into the range of a list that does not wrap.
+ */
+static int32_t listview_clamp(const struct listview *p_list, int32_t l_pos)
+{
+	int32_t l_max;
+
+	if (p_list->b_wrap) {
+		return l_pos;
+	}
+	l_max = (int32_t)(p_list->ul_count * p_list->us_item_height)
+			- (int32_t)p_list->us_height;
+	return Max(Min(l_pos, l_max), 0);
+}
+
+/**
+ * \brief Draw screen rows of the list from its content.
+ *
+ * \param ul_y1 first screen row, inside the list.
+ * \param ul_y2 last screen row, inside the list.
+ */
+static void listview_draw_rows(const struct listview *p_list, uint32_t ul_y1,
+		uint32_t ul_y2)
+{
+	int32_t l_first, l_last, l_item, l_index;
+	int32_t l_count = (int32_t)p_list->ul_count;
+
+	l_first = listview_floor_div(p_list->l_pos + (int32_t)(ul_y1 - p_list->us_top),
+			p_list->us_item_height);
+	l_last = listview_floor_div(p_list->l_pos + (int32_t)(ul_y2 - p_list->us_top),
+			p_list->us_item_height);
+
+	compositor_set_clip(0, ul_y1, COMPOSITOR_WIDTH - 1, ul_y2);
+	compositor_fill_rect(0, ul_y1, COMPOSITOR_WIDTH - 1, ul_y2,
+			p_list->ul_background);
+	for (l_item = l_first; (l_item <= l_last) && l_count; l_item++) {
+		if (p_list->b_wrap) {
+			l_index = l_item % l_count;
+			l_index += (l_index < 0) ? l_count : 0;
+		} else if ((l_item < 0) || (l_item >= l_count)) {
+			continue;
+		} else {
+			l_index = l_item;
+		}
+		p_list->draw(p_list, (uint32_t)l_index, (int32_t)p_list->us_top
+				+ l_item * p_list->us_item_height - p_list->l_pos);
+	}
+	compositor_reset_clip();
+}
+
+/**
+ * \brief Move the list content now, drawing only the exposed rows.
+ */
+static void listview_shift(struct listview *p_list, int32_t l_rows)
+{
+	uint32_t top = p_list->us_top, height = p_list->us_height;
+
+	p_list->l_pos += l_rows;
+	if ((uint32_t)abs(l_rows) >= height) {
+		listview_draw_rows(p_list, top, top + height - 1);
+		return;
+	}
+
+	compositor_scroll(l_rows);
+	if (l_rows > 0) {
+		listview_draw_rows(p_list, top + height - l_rows, top + height - 1);
+	} else if (l_rows < 0) {
+		listview_draw_rows(p_list, top, top - l_rows - 1);
+	}
+}
+
+/**
+ * \brief Make the list rows the scroll area and draw the list.
+ *
+ * l_pos is kept, so the list can start anywhere in its content.
+ */
+void listview_init(struct listview *p_list)
+{
+	compositor_scroll_area(p_list->us_top, p_list->us_height);
+	p_list->l_pos = listview_clamp(p_list, p_list->l_pos);
+	p_list->l_target = p_list->l_pos;
+	listview_redraw(p_list);
+}
+
+/**
+ * \brief Scroll the list now.
+ *
+ * \param l_rows rows to move the content up (towards the next items),
+ * negative to move it down.
+ */
+void listview_scroll(struct listview *p_list, int32_t l_rows)
+{
+	int32_t l_pos = listview_clamp(p_list, p_list->l_pos + l_rows);
+
+	p_list->l_target = l_pos;
+	listview_shift(p_list, l_pos - p_list->l_pos);
+}
+
+/**
+ * \brief Scroll the list over the next calls of listview_poll().
+ *
+ * Adds to a move in progress.
+ *
+ * \param l_rows rows to move the content up, negative to move it down.
+ */
+void listview_move(struct listview *p_list, int32_t l_rows)
+{
+	p_list->l_target = listview_clamp(p_list, p_list->l_target + l_rows);
+}
+
+/**
+ * \brief Run one step of a move.
+ *
+ * Call once per frame, after the previous step has been flushed.
+ *
+ * \return true if the list moved.
+ */
+bool listview_poll(struct listview *p_list)
+{
+	int32_t l_rows = p_list->l_target - p_list->l_pos;
+
+	if (!l_rows) {
+		return false;
+	}
+	if (p_list->us_step) {
+		l_rows = Max(Min(l_rows, (int32_t)p_list->us_step),
+				-(int32_t)p_list->us_step);
+	}
+	listview_shift(p_list, l_rows);
+	return true;
+}
+
+/**
+ * \brief Check if a move is in progress.
+ */
+bool listview_is_moving(const struct listview *p_list)
+{
+	return p_list->l_pos != p_list->l_target;
+}
+
+/**
+ * \brief Draw every row of the list again, after its items changed.
+ */
+void listview_redraw(struct listview *p_list)
+{
+	listview_draw_rows(p_list, p_list->us_top,
+			p_list->us_top + p_list->us_height - 1);
+}
@@ -0,0 +1,62 @@
+/**
+ * \file
+ *
+ * \brief List of items scrolled with the vertical scrolling of the LCD.
+ *
+ * The list owns a band of whole screen rows, the scroll area of the
+ * compositor. Moving the list by N rows moves the band content in the
+ * panel by changing its scroll start address, and only the N rows that
+ * come into view are drawn, so a scroll costs N rows on the bus whatever
+ * the height of the list.
+ *
+ * Items are drawn by a callback, clipped to the rows being exposed. The
+ * content is ul_count items of us_item_height rows; a wrapping list (a
+ * ring such as the wash cycles) follows the last item with the first,
+ * otherwise the content stops at both ends and rows past the last item are
+ * painted with the background color (a log that fills up).
+ *
+ * listview_move() animates: each listview_poll() moves the list by at most
+ * us_step rows, so a page turn is spread over frames at the cost of one
+ * page.
+ */
+
+#ifndef LISTVIEW_H_
+#define LISTVIEW_H_
+
+#include "compiler.h"
+
+struct listview;
+
+/**
+ * Draw item ul_index with its first row at screen row l_y, which may be
+ * above the list. Drawing is clipped to the rows being exposed.
+ */
+typedef void (*listview_draw_t)(const struct listview *p_list,
+		uint32_t ul_index, int32_t l_y);
+
+/**
+ * A list. Set the public fields, then call listview_init().
+ */
+struct listview {
+	uint16_t us_top;          //!< first screen row of the list
+	uint16_t us_height;       //!< rows of the list
+	uint16_t us_item_height;  //!< rows of one item
+	uint16_t us_step;         //!< most rows moved by one listview_poll()
+	uint32_t ul_count;        //!< items
+	bool b_wrap;              //!< the last item is followed by the first
+	uint32_t ul_background;   //!< 24-bit color of the rows without items
+	listview_draw_t draw;
+	void *p_arg;              //!< for the callback
+
+	int32_t l_pos;            //!< content row at the top of the list
+	int32_t l_target;         //!< content row being moved to
+};
+
+void listview_init(struct listview *p_list);
+void listview_scroll(struct listview *p_list, int32_t l_rows);
+void listview_move(struct listview *p_list, int32_t l_rows);
+bool listview_poll(struct listview *p_list);
+bool listview_is_moving(const struct listview *p_list);
+void listview_redraw(struct listview *p_list);
+
+#endif /* LISTVIEW_H_ */
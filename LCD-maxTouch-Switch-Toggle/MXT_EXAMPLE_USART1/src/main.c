@@ -95,8 +95,10 @@
 #include "conf_uart_serial.h"
 
 #include "tfont.h"
+#include "anim.h"
 #include "sourcecodepro_28.h"
-#include "calibri_36.h"
+/* Só os caracteres que a interface desenha, ver tools/font_subset.py */
+#include "fonts/calibri_36.h"
 #include "ioport.h"
 
 #include "icons/Play.h"
@@ -112,7 +114,21 @@
 #include "icons/lock.h"
 #include "icons/unlock.h"
 #include "icons/ON.h"
+#include "icons/drum.h"
 #include "maquina1.h"
+#include "compositor.h"
+#include "displaylist.h"
+#include "text.h"
+#include "ili9488_prof.h"
+#include "ili9488_te.h"
+#include "ili9488_bus.h"
+#include "ili9488_pixel.h"
+#include "mxt_async.h"
+#include "gesture.h"
+#include "listview.h"
+#include "displaypm.h"
+#include "capture.h"
+#include "scene.h"
 
 /* DEFINES */
 
@@ -145,6 +161,10 @@
 #define SECOND      0
 
 
+// Base de tempo dos gestos: RTT a 32768/32 = 1024 Hz
+#define GESTURE_RTT_PRESCALER  32
+#define GESTURE_RTT_HZ         (32768 / GESTURE_RTT_PRESCALER)
+
 #define STRING_EOL    "\r\n"
 #define STRING_HEADER "-- SAME70 LCD DEMO --"STRING_EOL	\
 "-- "BOARD_NAME " --"STRING_EOL	\
@@ -153,11 +173,16 @@
 
 struct ili9488_opt_t g_ili9488_display_opt;
 
-const uint32_t LOCK_W = 80;
-const uint32_t LOCK_H = 80;
+const uint32_t LOCK_W = 64;
+const uint32_t LOCK_H = 64;
 const uint32_t LOCK_BORDER = 2;
 const uint32_t LOCK_X = 280;
-const uint32_t LOCK_Y = 240;
+const uint32_t LOCK_Y = 360;
+
+/* Lista dos ciclos: linhas inteiras da tela, um ciclo por pagina */
+const uint32_t LIST_Y = 100;
+const uint32_t LIST_H = 220;
+const uint32_t LIST_STEP = 22;
 
 const uint32_t NEXT_W = 80;
 const uint32_t NEXT_H = 80;
@@ -177,16 +202,36 @@ const uint32_t PLAY_BORDER = 2;
 const uint32_t PLAY_X = 160;
 const uint32_t PLAY_Y = 440;
 
+/* Economia da tela: sem toque escurece, e travada com ciclo rodando mostra
+ * so' a faixa de status (linhas acima da lista) em 8 cores */
+#define DISPLAY_DIM_MS      30000
+#define DISPLAY_BAND_MS     10000
+#define DISPLAY_BRIGHT      0xFF
+#define DISPLAY_DIM         0x20
+#define DISPLAY_BAND_END    99      // ultima linha antes de LIST_Y
+
+/* Captura da tela pelo console (tools/capture_decode.py decodifica): 3/4
+ * da banda da USART para os quadros, o resto para o texto */
+//#define SCREEN_CAPTURE
+#define CAPTURE_BYTES_PER_S (USART_SERIAL_EXAMPLE_BAUDRATE / 10 * 3 / 4)
+#define CAPTURE_KEY_MS      60000
+
+/* Tambor girando durante o ciclo, entre o icone de ligado e o relogio. Gira
+ * na velocidade da centrifugacao dividida por DRUM_RPM_DIV */
+#define DRUM_X              104
+#define DRUM_Y              8
+#define DRUM_RPM_DIV        20      // 1200 rpm -> uma volta por segundo
+
 uint32_t convert_axis_system_x(uint32_t touch_y);
 uint32_t convert_axis_system_y(uint32_t touch_x);
-void update_screen(uint32_t tx, uint32_t ty, uint32_t status);
+void play_clicked(void);
+uint32_t get_time_ms(void);
 static void RTT_init(uint16_t pllPreScale, uint32_t IrqNPulses);
 void update_timer();
 void led_update();
 void TC_init(Tc * TC, int ID_TC, int TC_CHANNEL, int freq);
 void RTC_init(void);
-void draw_play_pause(Bool is_on);
-void font_draw_text(tFont *font, const char *text, int x, int y, int spacing);
+void ui_set_running(Bool b_on);
 
 /************************************************************************/
 /* variaveis globais                                                  */
@@ -196,7 +241,37 @@ volatile t_ciclo *ciclo; /* Inicia os ciclos */
 volatile Bool is_on = 0;
 volatile Bool is_locked =0;
 volatile Bool safety = 0;
-volatile Bool flag = 0;
+struct listview ciclo_list;
+struct anim drum_anim;
+
+/* Nos da cena que mudam com o estado: os handlers so' mudam os nos, o loop
+ * principal desenha o que mudou */
+struct ui_scene {
+	struct scene_node *p_status;     // ligado ou porta aberta
+	struct scene_node *p_running;    // grupo: relogio, total e progresso
+	struct scene_node *p_timer;
+	struct scene_node *p_total;
+	struct scene_node *p_progress;
+	struct scene_node *p_done;       // grupo: LAVAGEM CONCLUÍDA!
+	struct scene_node *p_lock;
+	struct scene_node *p_play;
+};
+struct ui_scene ui;
+
+/* Boot: LCD e touch sobem juntos, cada passo quando vence sua espera.
+ * Instantes em ms do RTT, que comeca com o main() */
+struct boot_state {
+	bool b_lcd_done;              // sequencia do LCD terminada, com ou sem erro
+	bool b_lcd_ready;             // LCD configurado e ligado
+	bool b_touch_ready;           // touch configurado, lendo toques
+	bool b_first_frame;           // primeiro quadro enviado ao LCD
+	bool b_reported;
+	uint32_t ul_touch_reset_ms;   // fim do reset do touch
+	uint32_t ul_lcd_ms;
+	uint32_t ul_touch_ms;
+	uint32_t ul_first_frame_ms;
+};
+struct boot_state boot;
 volatile Bool f_rtt_alarme = false;
 volatile int seg=0;
 volatile int minu=0;
@@ -250,17 +325,13 @@ void TC1_Handler(void){
 
 	if (minu==tempo)
 	{
-		Bool temp=is_locked;
-		is_locked =0;
-		update_screen(PLAY_X,PLAY_Y,0x20);
-		is_locked =temp;
-		font_draw_text(&calibri_36, "LAVAGEM ", 60, 10, 2);
-		font_draw_text(&calibri_36, "CONCLUIDA!", 60, 45, 2);
+		play_clicked();
+		scene_set_visible(ui.p_done, true);
 	}
 	}
 }
 
-void mxt_handler(struct mxt_device *device)
+void mxt_handler(void)
 {
 	/* USART tx buffer initialized to 0 */
 	char tx_buf[STRING_LENGTH * MAX_ENTRIES] = {0};
@@ -269,17 +340,12 @@ void mxt_handler(struct mxt_device *device)
 	/* Temporary touch event data struct */
 	struct mxt_touch_event touch_event;
 
-	/* Collect touch events and put the data in a string,
-	* maximum 2 events at the time */
-	do {
+	/* Collect the touch events decoded by the interrupt reader and put the
+	* data in a string, maximum MAX_ENTRIES events at the time */
+	while ((i < MAX_ENTRIES) && mxt_async_get_event(&touch_event)) {
 		/* Temporary buffer for each new touch event line */
 		char buf[STRING_LENGTH];
 		
-		/* Read next next touch event in the queue, discard if read fails */
-		if (mxt_read_touch_event(device, &touch_event) != STATUS_OK) {
-			continue;
-		}
-		
 		// eixos trocados (quando na vertical LCD)
 		uint32_t conv_x = convert_axis_system_x(touch_event.y);
 		uint32_t conv_y = convert_axis_system_y(touch_event.x);
@@ -288,19 +354,19 @@ void mxt_handler(struct mxt_device *device)
 		sprintf(buf, "Nr: %1d, X:%4d, Y:%4d, Status:0x%2x conv X:%3d Y:%3d\n\r",
 		touch_event.id, touch_event.x, touch_event.y,
 		touch_event.status, conv_x, conv_y);
-		update_screen(conv_x, conv_y,touch_event.status);
+		gesture_touch(touch_event.id, touch_event.status, conv_x, conv_y,
+		get_time_ms());
 
 		/* Add the new string to the string buffer */
 		strcat(tx_buf, buf);
 		i++;
-
-		/* Check if there is still messages in the queue and
-		* if we have reached the maximum numbers of events */
-	} while ((mxt_is_message_pending(device)) & (i < MAX_ENTRIES));
+	}
 
 	/* If there is any entries in the buffer, send them over USART */
 	if (i > 0) {
-		usart_serial_write_packet(USART_SERIAL_EXAMPLE, (uint8_t *)tx_buf, strlen(tx_buf));
+		/* Qualquer toque volta a tela ao normal */
+		displaypm_activity(get_time_ms());
+		capture_console_write((uint8_t *)tx_buf, strlen(tx_buf));
 	}
 }
 
@@ -324,12 +390,7 @@ void RTT_Handler(void)
 void PORTA_callback(void){
 	if (!is_on){
 		porta_aberta = !porta_aberta;
-		if (!flag){
-			ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
-			ili9488_draw_filled_rectangle(0, 0, 64,64);
-			//flag=!flag;
-		}
-		
+		scene_set_visible(ui.p_status, false);
 	}
 }
 
@@ -432,15 +493,45 @@ static void configure_lcd(void){
 	g_ili9488_display_opt.foreground_color = COLOR_CONVERT(COLOR_WHITE);
 	g_ili9488_display_opt.background_color = COLOR_CONVERT(COLOR_WHITE);
 
-	/* Initialize LCD */
-	ili9488_init(&g_ili9488_display_opt);
-	
+	/* Reset do LCD; o resto da configuracao roda em boot_poll() quando
+	 * vencem as esperas do painel */
+	ili9488_init_start(&g_ili9488_display_opt, get_time_ms());
+
+	/* Shadow framebuffer, sent on the first flush */
+	compositor_init(COLOR_WHITE);
 }
 
 static void mxt_init(struct mxt_device *device)
 {
 	enum status_code status;
 
+	/* TWI configuration */
+	twihs_master_options_t twi_opt = {
+		.speed = MXT_TWI_SPEED,
+		.chip  = MAXTOUCH_TWI_ADDRESS,
+	};
+
+	status = (enum status_code)twihs_master_setup(MAXTOUCH_TWI_INTERFACE, &twi_opt);
+	Assert(status == STATUS_OK);
+
+	/* Initialize the maXTouch device */
+	status = mxt_init_device(device, MAXTOUCH_TWI_INTERFACE,
+	MAXTOUCH_TWI_ADDRESS, MAXTOUCH_XPRO_CHG_PIO);
+	Assert(status == STATUS_OK);
+
+	/* Issue soft reset of maXTouch device by writing a non-zero value to
+	* the reset register */
+	mxt_write_config_reg(device, mxt_get_object_address(device,
+	MXT_GEN_COMMANDPROCESSOR_T6, 0)
+	+ MXT_GEN_COMMANDPROCESSOR_RESET, 0x01);
+
+	/* O fim do reset e' esperado por boot_poll(), que chama mxt_configure();
+	 * +1 porque o ms lido pode estar quase virando */
+	boot.ul_touch_reset_ms = get_time_ms() + MXT_RESET_TIME + 1;
+}
+
+static void mxt_configure(struct mxt_device *device)
+{
 	/* T8 configuration object data */
 	uint8_t t8_object[] = {
 		0x0d, 0x00, 0x05, 0x0a, 0x4b, 0x00, 0x00,
@@ -472,29 +563,6 @@ static void mxt_init(struct mxt_device *device)
 		0x00, 0x00, 0x00, 0x00, 0x00
 	};
 
-	/* TWI configuration */
-	twihs_master_options_t twi_opt = {
-		.speed = MXT_TWI_SPEED,
-		.chip  = MAXTOUCH_TWI_ADDRESS,
-	};
-
-	status = (enum status_code)twihs_master_setup(MAXTOUCH_TWI_INTERFACE, &twi_opt);
-	Assert(status == STATUS_OK);
-
-	/* Initialize the maXTouch device */
-	status = mxt_init_device(device, MAXTOUCH_TWI_INTERFACE,
-	MAXTOUCH_TWI_ADDRESS, MAXTOUCH_XPRO_CHG_PIO);
-	Assert(status == STATUS_OK);
-
-	/* Issue soft reset of maXTouch device by writing a non-zero value to
-	* the reset register */
-	mxt_write_config_reg(device, mxt_get_object_address(device,
-	MXT_GEN_COMMANDPROCESSOR_T6, 0)
-	+ MXT_GEN_COMMANDPROCESSOR_RESET, 0x01);
-
-	/* Wait for the reset of the device to complete */
-	delay_ms(MXT_RESET_TIME);
-
 	/* Write data to configuration registers in T7 configuration object */
 	mxt_write_config_reg(device, mxt_get_object_address(device,
 	MXT_GEN_POWERCONFIG_T7, 0) + 0, 0x20);
@@ -522,6 +590,116 @@ static void mxt_init(struct mxt_device *device)
 	+ MXT_GEN_COMMANDPROCESSOR_CALIBRATE, 0x01);
 }
 
+/* Mostra os tempos do boot quando o primeiro quadro e o touch estao prontos */
+static void boot_report(void)
+{
+	if (boot.b_reported || !boot.b_first_frame || !boot.b_touch_ready) {
+		return;
+	}
+	boot.b_reported = true;
+	printf("boot: lcd %lu ms, first frame %lu ms, touch %lu ms\r\n",
+			(unsigned long)boot.ul_lcd_ms, (unsigned long)boot.ul_first_frame_ms,
+			(unsigned long)boot.ul_touch_ms);
+}
+
+/* Mostra no console cada troca de modo do gerenciador de energia do LCD */
+static void display_event(const struct displaypm_event *p_event)
+{
+	printf("display: %s -> %s (%s) t=%lu ms\r\n",
+			displaypm_mode_name(p_event->from), displaypm_mode_name(p_event->to),
+			displaypm_reason_name(p_event->reason), (unsigned long)p_event->ul_ms);
+}
+
+static const struct displaypm_config display_pm = {
+	.ul_dim_ms = DISPLAY_DIM_MS,
+	.ul_band_ms = DISPLAY_BAND_MS,
+	.uc_bright = DISPLAY_BRIGHT,
+	.uc_dim = DISPLAY_DIM,
+	.us_band_start = 0,
+	.us_band_end = DISPLAY_BAND_END,
+	.event = display_event,
+};
+
+static const struct capture_config screen_capture = {
+	.ul_bytes_per_s = CAPTURE_BYTES_PER_S,
+	.ul_key_ms = CAPTURE_KEY_MS,
+};
+
+/* Tempo por quadro do tambor para a centrifugacao do ciclo, 0 parado */
+static uint32_t drum_period(int rpm)
+{
+	uint32_t ul_turn = (uint32_t)abs(drum.turn);
+
+	if (rpm <= 0) {
+		return 0;
+	}
+	return (uint32_t)(60000ULL * DRUM_RPM_DIV * ul_turn
+			/ (360ULL * drum.count * (uint32_t)rpm));
+}
+
+/* Um quadro do tambor quando vence; devolve o instante do proximo */
+static uint32_t drum_poll(uint32_t ul_now_ms)
+{
+	uint32_t ul_due_ms = ANIM_NO_DEADLINE;
+
+	/* O TC1 pausa o ciclo e limpa a area do tambor: fica de fora do
+	 * quadro, o resto (o touch) nao */
+	NVIC_DisableIRQ((IRQn_Type)ID_TC1);
+	if (!is_on) {
+		/* A area ja foi limpa junto com o botao de play */
+		anim_init(&drum_anim, &drum, DRUM_X, DRUM_Y);
+	} else {
+		/* Parado na faixa de status, que so' mostra o relogio */
+		anim_set_period(&drum_anim, (displaypm_get_mode() == DISPLAYPM_BAND) ? 0
+				: drum_period(ciclo->centrifugacaoRPM), ul_now_ms);
+		ul_due_ms = anim_poll(&drum_anim, ul_now_ms);
+	}
+	NVIC_EnableIRQ((IRQn_Type)ID_TC1);
+	return ul_due_ms;
+}
+
+/* Roda os passos do boot que venceram; devolve o instante do proximo */
+static uint32_t boot_poll(struct mxt_device *device, uint32_t ul_now_ms)
+{
+	uint32_t ul_due_ms = ili9488_init_poll(ul_now_ms);
+
+	if (!boot.b_lcd_done && (ili9488_init_get_state() != ILI9488_INIT_BUSY)) {
+		boot.b_lcd_done = true;
+		if (ili9488_init_get_state() == ILI9488_INIT_DONE) {
+#ifdef ILI9488_BUS_BENCH
+			/* Tempo de preencher e copiar a tela inteira pelo barramento;
+			 * o primeiro flush do compositor redesenha tudo depois */
+			ili9488_bus_bench(&g_ili9488_display_opt);
+#endif
+			/* Um quadro por varredura do painel, cada retangulo fora da
+			 * linha sendo varrida */
+			ili9488_te_init();
+			displaypm_init(&display_pm, ul_now_ms);
+#ifdef SCREEN_CAPTURE
+			capture_start();
+#endif
+			boot.b_lcd_ready = true;
+			boot.ul_lcd_ms = ul_now_ms;
+		} else {
+			printf("boot: LCD not found\r\n");
+		}
+	}
+
+	if (!boot.b_touch_ready) {
+		if ((int32_t)(ul_now_ms - boot.ul_touch_reset_ms) < 0) {
+			return Min(ul_due_ms, boot.ul_touch_reset_ms);
+		}
+		mxt_configure(device);
+
+		/* Mensagens do touch lidas por interrupcao do /CHG */
+		mxt_async_init(device);
+		boot.b_touch_ready = true;
+		boot.ul_touch_ms = get_time_ms();
+		boot_report();
+	}
+	return ul_due_ms;
+}
+
 void io_init(void)
 {
 	
@@ -588,118 +766,109 @@ static float get_time_rtt(){
 	uint ul_previous_time = rtt_read_timer_value(RTT);
 }
 
-void font_draw_text(tFont *font, const char *text, int x, int y, int spacing) {
-	char *p = text;
-	while(*p != NULL) {
-		char letter = *p;
-		int letter_offset = letter - font->start_char;
-		if(letter <= font->end_char) {
-			tChar *current_char = font->chars + letter_offset;
-			ili9488_draw_pixmap(x, y, current_char->image->width, current_char->image->height, current_char->image->data);
-			x += current_char->image->width + spacing;
-		}
-		p++;
-	}
+/* Tela fixa: o que nao muda com o estado e' criado e esquecido. Relogio,
+ * total e progresso ficam na faixa de status (ate' DISPLAY_BAND_END) */
+void ui_scene_init(void) {
+	struct text_style label = {&calibri_36, COLOR_WHITE, 2, TEXT_ALIGN_LEFT, false, COLOR_BLACK};
+	/* digitos de largura fixa: a string nao muda de largura */
+	struct text_style timer = {&calibri_36, COLOR_WHITE, 2, TEXT_ALIGN_CENTER, true, COLOR_BLACK};
+	struct scene_node *p_node;
+	uint32_t h = text_get_height(&label, "0");
+
+	scene_init(COLOR_WHITE);
+
+	ui.p_status = scene_icon_new(NULL, 0, 0, &ON);
+	scene_set_visible(ui.p_status, false);
+
+	ui.p_running = scene_group_new(NULL);
+	scene_set_visible(ui.p_running, false);
+	ui.p_timer = scene_label_new(ui.p_running, &timer, 175, 20, 300, 20 + h - 1);
+	ui.p_total = scene_label_new(ui.p_running, &label, 100, 60,
+			ILI9488_LCD_WIDTH - 1, 60 + h - 1);
+	ui.p_progress = scene_bar_new(ui.p_running, 0, 60 + h, ILI9488_LCD_WIDTH - 1,
+			DISPLAY_BAND_END, COLOR_BLACK, COLOR_WHITE);
+
+	/* A segunda linha fica por cima da primeira */
+	ui.p_done = scene_group_new(NULL);
+	scene_set_visible(ui.p_done, false);
+	p_node = scene_label_new(ui.p_done, &label, 60, 10,
+			60 + text_get_width(&label, "LAVAGEM ") - 1, 10 + h - 1);
+	scene_label_set_text(p_node, "LAVAGEM ");
+	p_node = scene_label_new(ui.p_done, &label, 60, 45,
+			60 + text_get_width(&label, "CONCLUÍDA!") - 1, 45 + h - 1);
+	scene_label_set_text(p_node, "CONCLUÍDA!");
+
+	ui.p_lock = scene_button_new(NULL, LOCK_X-32, LOCK_Y-32, &unlock, &lock);
+	scene_button_new(NULL, 13, 410, &prev, NULL);
+	ui.p_play = scene_button_new(NULL, 128, 410, &Play, &pause);
+	scene_button_new(NULL, 245, 410, &next, NULL);
 }
 
-void draw_screen(void) {
-	ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
-	ili9488_draw_filled_rectangle(0, 0, ILI9488_LCD_WIDTH-1, ILI9488_LCD_HEIGHT-1);
-	
+void ciclo_next(void) {
+	ciclo = ciclo->next;
+	listview_move(&ciclo_list, LIST_H);
 }
 
-void draw_lock(uint32_t is_locked) {
+void ciclo_prev(void) {
+	ciclo = ciclo->previous;
+	listview_move(&ciclo_list, -(int32_t)LIST_H);
+}
 
-	//-LOCK_W/2+LOCK_BORDER
-	//ili9488_set_foreground_color(COLOR_CONVERT(COLOR_BLACK));
-	//ili9488_draw_filled_rectangle(LOCK_X-LOCK_W/2, LOCK_Y-LOCK_H/2, LOCK_X+LOCK_W/2, LOCK_Y+LOCK_H/2);
-	if(is_locked) {
-		ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
-		ili9488_draw_filled_rectangle(LOCK_X-LOCK_W/2, LOCK_Y-LOCK_H/2, LOCK_X+LOCK_W/2, LOCK_Y+LOCK_H/2);
-		ili9488_draw_pixmap(LOCK_X-32, LOCK_Y-32, unlock.width, unlock.height, unlock.data);
-		
-		} else {
-		ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
-		ili9488_draw_filled_rectangle(LOCK_X-LOCK_W/2, LOCK_Y-LOCK_H/2, LOCK_X+LOCK_W/2, LOCK_Y+LOCK_H/2);
-		ili9488_draw_pixmap(LOCK_X-32, LOCK_Y-32, lock.width, lock.height, lock.data);
+/* Desenha o ciclo index da lista (contado a partir do primeiro do anel)
+ * com o topo da pagina na linha y da tela */
+void draw_ciclo(const struct listview *p_list, uint32_t index, int32_t y){
+	struct text_style style = {&calibri_36, COLOR_WHITE, 1, TEXT_ALIGN_LEFT, false, COLOR_BLACK};
+	const t_ciclo *p_ciclo = p_list->p_arg;
+	uint32_t h;
+
+	while (index--) {
+		p_ciclo = p_ciclo->next;
+	}
+	h = text_get_height(&style, p_ciclo->nome);
+
+	compositor_draw_image(50, y + 10, p_ciclo->icone);
+	if (y + 180 >= 0) {
+		text_draw(&style, p_ciclo->nome, 30, y + 180, 200, y + 180 + h - 1);
 	}
-	
 }
 
-void draw_next(uint32_t clicked) {
-	//static uint32_t last_state = 255; // undefined
-	//if(clicked == last_state) return;
-	
-	ciclo = ciclo->next;
-	
-	ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
-	ili9488_draw_filled_rectangle(NEXT_X-NEXT_W/2, NEXT_Y-NEXT_H/2, NEXT_X+NEXT_W/2, NEXT_Y+NEXT_H/2);
-	ili9488_draw_pixmap(245, 410, next.width, next.height, next.data);
-	//if(clicked) {
-	//ili9488_set_foreground_color(COLOR_CONVERT(COLOR_GREEN));
-	//ili9488_draw_filled_rectangle(NEXT_X-NEXT_W/2, NEXT_Y-NEXT_H/2, NEXT_X+NEXT_W/2, NEXT_Y+NEXT_H/2);
-	//} else {
-	//ili9488_set_foreground_color(COLOR_CONVERT(COLOR_TOMATO));
-	//ili9488_draw_filled_rectangle(NEXT_X-NEXT_W/2, NEXT_Y-NEXT_H/2, NEXT_X+NEXT_W/2, NEXT_Y+NEXT_H/2);
-	//}
-	////last_state = clicked;
-}
-
-void draw_prev(uint32_t clicked) {
-	//static uint32_t last_state = 255; // undefined
-	//if(clicked == last_state) return;
-	
-	ciclo = ciclo->previous;
-	
-	ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
-	ili9488_draw_filled_rectangle(PREV_X-PREV_W/2, PREV_Y-PREV_H/2, PREV_X+PREV_W/2, PREV_Y+PREV_H/2);
-	ili9488_draw_pixmap(13, 410, prev.width, prev.height, prev.data);
-	//if(clicked) {
-	//ili9488_set_foreground_color(COLOR_CONVERT(COLOR_GREEN));
-	//ili9488_draw_filled_rectangle(PREV_X-PREV_W/2, PREV_Y-PREV_H/2, PREV_X+PREV_W/2, PREV_Y+PREV_H/2);
-	//} else {
-	//ili9488_set_foreground_color(COLOR_CONVERT(COLOR_TOMATO));
-	//ili9488_draw_filled_rectangle(PREV_X-PREV_W/2, PREV_Y-PREV_H/2, PREV_X+PREV_W/2, PREV_Y+PREV_H/2);
-	//}
-	//last_state = clicked;
-}
-
-void draw_mode(uint32_t clicked){
-	ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
-	ili9488_draw_filled_rectangle(50, 330, 30+170, 330+40);
-	font_draw_text(&calibri_36, ciclo->nome , 30, 330, 1);
-	
-	
-	ili9488_draw_pixmap(50, 160, ciclo->icone->width,ciclo->icone->height, ciclo->icone->data);
+/* A lista ocupa a area de scroll do LCD: trocar de ciclo so' envia as
+ * linhas que entram na tela */
+void ui_list_init(t_ciclo *p_first){
+	const t_ciclo *p_ciclo = p_first;
+
+	ciclo_list.us_top = LIST_Y;
+	ciclo_list.us_height = LIST_H;
+	ciclo_list.us_item_height = LIST_H;
+	ciclo_list.us_step = LIST_STEP;
+	ciclo_list.ul_count = 0;
+	do {
+		ciclo_list.ul_count++;
+		p_ciclo = p_ciclo->next;
+	} while (p_ciclo != p_first);
+	ciclo_list.b_wrap = true;
+	ciclo_list.ul_background = COLOR_WHITE;
+	ciclo_list.draw = draw_ciclo;
+	ciclo_list.p_arg = p_first;
+	ciclo_list.l_pos = 0;
+	listview_init(&ciclo_list);
 }
 
-void draw_play_pause(Bool is_on){
-	
-	
-	if (!is_on){
-		ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
-		ili9488_draw_filled_rectangle(100, 0, 320, 92);
-		ili9488_draw_pixmap(128, 410, Play.width, Play.height, Play.data);
-		
-	}
-	else {
-		
-		ili9488_draw_pixmap(128, 410, pause.width, pause.height, pause.data);
+/* Relogio, total e progresso do ciclo rodando; parado, o tambor sai */
+void ui_set_running(Bool b_on){
+	char buffer[32];
+
+	scene_button_set_state(ui.p_play, b_on);
+	scene_set_visible(ui.p_running, b_on);
+	if (b_on) {
 		tempo=ciclo->enxagueTempo+ciclo->centrifugacaoTempo;
-		
-		ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
-		ili9488_draw_filled_rectangle(100, 60, 320, 52);
-		char buffer[32];
-		sprintf(buffer, "%d",tempo);
-		font_draw_text(&calibri_36, "Total:", 100, 60, 2);
-		font_draw_text(&calibri_36, buffer, 215, 60, 2);
-		font_draw_text(&calibri_36, "min", 260, 60, 2);
-		
+		sprintf(buffer, "Total: %d min",tempo);
+		scene_label_set_text(ui.p_total, buffer);
+		update_timer();
+	} else {
+		scene_invalidate(DRUM_X, DRUM_Y, DRUM_X + drum.width - 1,
+				DRUM_Y + drum.height - 1);
 	}
-	
-	
-	
-	
 }
 
 uint32_t convert_axis_system_x(uint32_t touch_y) {
@@ -715,84 +884,157 @@ uint32_t convert_axis_system_y(uint32_t touch_x) {
 }
 
 void update_timer(){
-	char bufferSeg[32];
-	char bufferMin[32];
+	char buffer[32];
 	
-	sprintf(bufferSeg, "%d",seg);
-	sprintf(bufferMin, "%d",minu);
-	
-	ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
-	ili9488_draw_filled_rectangle(175, 20, 300, 52);
-	
-	font_draw_text(&calibri_36, bufferMin, 175, 20, 2);
-	font_draw_text(&calibri_36, ":", 220, 20, 2);
-	font_draw_text(&calibri_36, bufferSeg, 245, 20, 2);
+	sprintf(buffer, "%02d:%02d", minu, seg);
+	scene_label_set_text(ui.p_timer, buffer);
+	scene_bar_set_value(ui.p_progress, minu*60 + seg, tempo*60);
+}
+
+void play_clicked(void) {
+	if (!is_on){
+		if (porta_aberta){
+			scene_icon_set_image(ui.p_status, &porta);
+			scene_set_visible(ui.p_status, true);
+		}
+		else{
+			seg=0;
+			minu=0;
+			scene_set_visible(ui.p_done, false);
+			scene_icon_set_image(ui.p_status, &ON);
+			scene_set_visible(ui.p_status, true);
+			is_on =!is_on;
+			ui_set_running(is_on);
+		}
+		
 	}
+	else {
+		/*PAUSE*/
+		is_on =!is_on;
+		scene_set_visible(ui.p_status, false);
+		ui_set_running(is_on);
 
-void update_screen(uint32_t tx, uint32_t ty, uint32_t status) {
-	if(status==0x20){
-		if(tx >= LOCK_X-LOCK_W/2 && tx <= LOCK_X + LOCK_W/2){
-			if(ty >= LOCK_Y-LOCK_H/2 &&  ty <= LOCK_Y + LOCK_H/2){
-				if( safety )
-				{
-					draw_lock(is_locked);
-					is_locked = !is_locked;
-				}
-			}
+	}
+}
+
+/************************************************************************/
+/* alvos de toque                                                       */
+/************************************************************************/
+
+enum ui_target {
+	UI_BACKGROUND,   // tela inteira: swipe troca o ciclo
+	UI_LIST,         // lista dos ciclos: swipe vertical troca o ciclo
+	UI_LOCK,         // toque longo trava/destrava
+	UI_NEXT,
+	UI_PREV,
+	UI_PLAY,
+	UI_TARGETS
+};
+
+static const char *const ui_target_name[UI_TARGETS] = {
+	"background", "list", "lock", "next", "prev", "play",
+};
+
+static const char *const ui_gesture_name[] = {
+	"press", "tap", "long press", "swipe left", "swipe right",
+	"swipe up", "swipe down", "cancel",
+};
+
+static struct gesture_widget ui_widgets[UI_TARGETS];
+
+static void ui_gesture(const struct gesture_widget *p_widget,
+		const struct gesture_event *p_event) {
+	enum ui_target target = (enum ui_target)(uintptr_t)p_widget->p_arg;
+
+	printf("gesture: %s %s\r\n", ui_gesture_name[p_event->type],
+			ui_target_name[target]);
+
+	/* O gesto so' muda a cena; ela e' desenhada no loop */
+	switch (target) {
+	case UI_LOCK:
+		if (safety) {
+			is_locked = !is_locked;
+			scene_button_set_state(ui.p_lock, is_locked);
 		}
-		if (!is_locked){
-			/*PRINT DO MODO DE LAVAGEM*/
-			
-			
-			if(tx >= NEXT_X-NEXT_W/2 && tx <= NEXT_X + NEXT_W/2){
-				if(ty >= NEXT_Y-NEXT_H/2 &&  ty <= NEXT_Y + NEXT_H/2){
-					if (!is_on){
-						draw_next(1);
-						draw_mode(1);
-					}
-				}
-			}
-			
-			if(tx >= PREV_X-PREV_W/2 && tx <= PREV_X + PREV_W/2){
-				if(ty >= PREV_Y-PREV_H/2 &&  ty <= PREV_Y + PREV_H/2){
-					if (!is_on){
-						draw_prev(1);
-						draw_mode(1);
-					}
-				}
+		break;
+	case UI_NEXT:
+		if (!is_locked && !is_on) {
+			ciclo_next();
+		}
+		break;
+	case UI_PREV:
+		if (!is_locked && !is_on) {
+			ciclo_prev();
+		}
+		break;
+	case UI_PLAY:
+		if (!is_locked) {
+			play_clicked();
+		}
+		break;
+	case UI_BACKGROUND:
+		/* Arrastar para a esquerda mostra o proximo ciclo */
+		if (!is_locked && !is_on) {
+			if (p_event->type == GESTURE_SWIPE_LEFT) {
+				ciclo_next();
+			} else {
+				ciclo_prev();
 			}
-
-			if((tx >= PLAY_X-PLAY_W/2 && tx <=PLAY_X + PLAY_W/2) && (ty >= PLAY_Y-PLAY_H/2 &&  ty <= PLAY_Y + PLAY_H/2)){
-				if (!is_on){
-					if (porta_aberta){
-						ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
-						ili9488_draw_filled_rectangle(0, 0, 64,64);
-						ili9488_draw_pixmap(0, 0, porta.width, porta.height, porta.data);
-					}
-					else{
-						seg=0;
-						minu=0;
-						ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
-						ili9488_draw_filled_rectangle(0, 0,320, 90);
-						
-						ili9488_draw_pixmap(0, 0, ON.width, ON.height, ON.data);
-						flag=!flag;
-						is_on =!is_on;
-						draw_play_pause(is_on);
-					}
-					
-				}
-				else {
-					/*PAUSE*/
-					flag=!flag;
-					is_on =!is_on;
-					ili9488_set_foreground_color(COLOR_CONVERT(COLOR_WHITE));
-					ili9488_draw_filled_rectangle(0, 0,64, 64);
-					draw_play_pause(is_on);
-
-				}
+		}
+		break;
+	case UI_LIST:
+		/* Arrastar para cima sobe a lista e mostra o proximo ciclo */
+		if (!is_locked && !is_on) {
+			if (p_event->type == GESTURE_SWIPE_UP) {
+				ciclo_next();
+			} else {
+				ciclo_prev();
 			}
 		}
+		break;
+	default:
+		break;
+	}
+}
+
+static void ui_set_widget(enum ui_target target, uint32_t x, uint32_t y,
+		uint32_t w, uint32_t h, uint16_t flags) {
+	struct gesture_widget *p_widget = &ui_widgets[target];
+
+	p_widget->x1 = x - w/2;
+	p_widget->y1 = y - h/2;
+	p_widget->x2 = x + w/2;
+	p_widget->y2 = y + h/2;
+	p_widget->us_flags = flags;
+	p_widget->handler = ui_gesture;
+	p_widget->p_arg = (void *)(uintptr_t)target;
+	gesture_add_widget(p_widget);
+}
+
+void ui_init(void) {
+	gesture_init();
+
+	/* O fundo vem primeiro: os botoes ficam por cima dele */
+	ui_set_widget(UI_BACKGROUND, ILI9488_LCD_WIDTH/2, ILI9488_LCD_HEIGHT/2,
+			ILI9488_LCD_WIDTH, ILI9488_LCD_HEIGHT, GESTURE_WANT_SWIPE_H);
+	ui_set_widget(UI_LIST, ILI9488_LCD_WIDTH/2, LIST_Y + LIST_H/2,
+			ILI9488_LCD_WIDTH, LIST_H, GESTURE_WANT_SWIPE_V);
+	ui_set_widget(UI_LOCK, LOCK_X, LOCK_Y, LOCK_W, LOCK_H, GESTURE_WANT_LONG_PRESS);
+	ui_set_widget(UI_NEXT, NEXT_X, NEXT_Y, NEXT_W, NEXT_H, GESTURE_WANT_TAP);
+	ui_set_widget(UI_PREV, PREV_X, PREV_Y, PREV_W, PREV_H, GESTURE_WANT_TAP);
+	ui_set_widget(UI_PLAY, PLAY_X, PLAY_Y, PLAY_W, PLAY_H, GESTURE_WANT_TAP);
+}
+
+/* Milissegundos do RTT, que roda livre desde o boot */
+uint32_t get_time_ms(void) {
+	return (uint32_t)((uint64_t)rtt_read_timer_value(RTT) * 1000 / GESTURE_RTT_HZ);
+}
+
+/* Acorda o loop principal pelo alarme do RTT no instante pedido */
+static void rtt_alarm(uint32_t ul_deadline_ms) {
+	if (ul_deadline_ms != GESTURE_NO_DEADLINE) {
+		rtt_write_alarm_time(RTT, (uint32_t)(((uint64_t)ul_deadline_ms
+				* GESTURE_RTT_HZ + 999) / 1000));
 	}
 }
 
@@ -824,29 +1066,40 @@ int main(void)
 		.stopbits     = USART_SERIAL_STOP_BIT
 	};
 	uint8_t stingLCD[256];
+	uint32_t ul_due_ms;
 	
 	sysclk_init(); /* Initialize system clocks */
 	board_init();  /* Initialize board */
 	io_init();
 	ioport_init();
 	
+	/* Base de tempo do boot e dos gestos */
+	RTT_init(GESTURE_RTT_PRESCALER, 1);
+	
 	ciclo = initMenuOrder();
 	
+	/* LCD e touch comecam o reset juntos; o resto roda no loop por
+	 * boot_poll() enquanto o console e a tela sobem */
 	configure_lcd();
+	mxt_init(&device);
 	configure_console();
+#ifdef ILI9488_PIXEL_BENCH
+	/* Ciclos dos kernels de pixel contra as referencias, no console */
+	ili9488_pixel_bench();
+#endif
 	
-	draw_screen();
-	draw_lock(1);
-	draw_next(0);
-	draw_prev(0);
-	draw_play_pause(0);
-	draw_mode(0);
-	
-	/* Initialize the mXT touch device */
-	mxt_init(&device);
+	/* A lista dos ciclos desenha direto no compositor: o fundo vai antes */
+	ui_scene_init();
+	scene_render();
+	ui_list_init((t_ciclo *)ciclo);
+
+	/* Gestos: alvos de toque */
+	ui_init();
+	anim_init(&drum_anim, &drum, DRUM_X, DRUM_Y);
 	
 	/* Initialize stdio on USART */
 	stdio_serial_init(USART_SERIAL_EXAMPLE, &usart_serial_options);
+	capture_init(&screen_capture);
 
 	rtc_set_date_alarm(RTC, 1, MOUNT, 1, DAY);
 	rtc_set_time_alarm(RTC, 1, HOUR, 1, MINUTE, 1, SECOND+2);
@@ -865,11 +1118,78 @@ int main(void)
 		
 		//led_update(porta_aberta);
 		
-		if (mxt_is_message_pending(&device)) {
-			mxt_handler(&device);
+		/* Passos do boot cuja espera venceu */
+		ul_due_ms = boot_poll(&device, get_time_ms());
+
+		/* Touch events decoded by the /CHG interrupt since the last pass */
+		if (boot.b_touch_ready) {
+			mxt_async_poll();
+			if (mxt_async_pending()) {
+				mxt_handler();
+			}
+		}
+
+		/* Modo da tela: as flags mudam nos handlers, os comandos ao LCD
+		 * so' saem daqui, fora do envio de um quadro */
+		if (boot.b_lcd_ready) {
+			displaypm_set_machine(is_locked, is_on, get_time_ms());
+			ul_due_ms = Min(ul_due_ms, displaypm_poll(get_time_ms()));
 		}
+
+		ul_due_ms = Min(ul_due_ms, gesture_poll(get_time_ms()));
+
+		/* O que os handlers mudaram na cena desde a ultima passada */
+		scene_render();
+
+		/* Um passo da animacao da lista por quadro, depois de enviado o
+		 * anterior */
+		if (!compositor_is_dirty()) {
+			listview_poll(&ciclo_list);
+		}
+
+		/* Quadro do tambor, so' os pixels que mudam */
+		if (boot.b_lcd_ready) {
+			ul_due_ms = Min(ul_due_ms, drum_poll(get_time_ms()));
+		}
+
+		/* Send everything drawn since the last pass, at most once per
+		 * refresh of the panel */
+		if (boot.b_lcd_ready && compositor_is_dirty() && ili9488_te_frame_begin()) {
+			compositor_flush();
+			ili9488_te_frame_end();
+			if (!boot.b_first_frame) {
+				boot.b_first_frame = true;
+				boot.ul_first_frame_ms = get_time_ms();
+				boot_report();
+			}
+		}
+
+		/* Pacotes da captura que o orcamento e o anel deixam, com o que
+		 * foi enviado agora */
+		ul_due_ms = Min(ul_due_ms, capture_poll(get_time_ms()));
+
+		/* Toque longo sem eventos novos, espera do boot, da tela, do
+		 * tambor ou da captura: o alarme do RTT acorda o loop */
+		rtt_alarm(ul_due_ms);
+
+		/* Bus traffic of the frame, debug builds only */
+		ili9488_prof_frame();
 		
-		//pmc_sleep(SAM_PM_SMODE_SLEEP_WFI);
+		/* Dorme ate a proxima interrupcao (/CHG, TWIHS, timers); a checagem
+		 * e o WFI ficam com as interrupcoes mascaradas para nao perder um
+		 * toque ou desenho de um handler que chegue entre os dois. Um
+		 * desenho pendente espera o proximo vsync dormindo, e a lista
+		 * em movimento so' dorme depois de enviado o passo. Antes do LCD
+		 * pronto nada e' enviado. Uma mudanca na cena feita por um handler
+		 * depois do scene_render() acorda o loop de novo */
+		cpu_irq_disable();
+		if (!mxt_async_pending() && !scene_is_dirty() && !(boot.b_lcd_ready
+				&& (compositor_is_dirty() ? ili9488_te_frame_due()
+				: listview_is_moving(&ciclo_list)))) {
+			__DSB();
+			__WFI();
+		}
+		cpu_irq_enable();
 	}
 
 	return 0;
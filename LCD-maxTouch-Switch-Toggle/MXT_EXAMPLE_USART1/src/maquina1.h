@@ -18,7 +18,7 @@ struct ciclo{
   
 };
 
-t_ciclo c_rapido = {.nome = "Rapido",
+t_ciclo c_rapido = {.nome = "Rápido",
                     .enxagueTempo = 5,
                     .enxagueQnt = 3,
                     .centrifugacaoRPM = 900,
@@ -29,7 +29,7 @@ t_ciclo c_rapido = {.nome = "Rapido",
 					.icone = &fast,
                   };
 
-t_ciclo c_diario = {.nome = "Diario",
+t_ciclo c_diario = {.nome = "Diário",
                     .enxagueTempo = 15,
                     .enxagueQnt = 2,
                     .centrifugacaoRPM = 1200,
@@ -52,7 +52,7 @@ t_ciclo c_pesado = {.nome = "Pesado",
 					 .icone = &strong,
                   };
 
-t_ciclo c_enxague = {.nome = "Enxague",
+t_ciclo c_enxague = {.nome = "Enxágue",
                      .enxagueTempo = 10,
                      .enxagueQnt = 1,
                      .centrifugacaoRPM = 0,
@@ -64,7 +64,7 @@ t_ciclo c_enxague = {.nome = "Enxague",
 
                   };
 
-t_ciclo c_centrifuga = {.nome = "Centrifuga",
+t_ciclo c_centrifuga = {.nome = "Centrífuga",
                      .enxagueTempo = 0,
                      .enxagueQnt = 0,
                      .centrifugacaoRPM = 1200,
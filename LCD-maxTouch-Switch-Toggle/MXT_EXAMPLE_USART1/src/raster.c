@@ -0,0 +1,561 @@
+/**
+ * \file
+ *
+ * \brief Scanline rasteriser for circles, arcs, rounded rectangles and lines.
+ *
+ * A circle is the rounded rectangle of its bounding box with the radius as
+ * corner radius, and an outline is a rounded rectangle minus the one inset
+ * by the thickness, so every shape but the line comes down to the row of a
+ * rounded rectangle. Arcs keep the pixels of a circle outline that are
+ * inside the sector between two directions, tested with cross products.
+ * Lines are the quadrilateral around the segment, cut at the pixel centers
+ * of each row.
+ */
+
+#include <asf.h>
+#include <math.h>
+#include <string.h>
+#include "raster.h"
+#include "compositor.h"
+#include "ili9488_pixel.h"
+
+/* Directions of the arc ends: 1.0 is 1 << RASTER_DIR_SHIFT */
+#define RASTER_DIR_SHIFT 12
+
+#define RASTER_PI 3.14159265f
+
+enum raster_kind {
+	RASTER_ROUND_RECT,
+	RASTER_FRAME,
+	RASTER_ARC,
+	RASTER_QUAD,
+};
+
+struct raster_span {
+	int32_t x1;
+	int32_t x2;
+};
+
+struct raster_rrect {
+	int32_t x1, y1, x2, y2;
+	int32_t r;
+	bool b_empty;
+};
+
+struct raster_shape {
+	uint8_t uc_kind;
+	int32_t x1, y1, x2, y2;        /* bounding box */
+	struct raster_rrect outer;     /* rounded rectangles, frames and arcs */
+	struct raster_rrect inner;     /* frames and arcs */
+	int32_t l_cx, l_cy;            /* arcs: center and end directions */
+	int32_t l_ax, l_ay, l_bx, l_by;
+	bool b_wide;                   /* arcs over 180 degrees */
+	float f_x[4], f_y[4];          /* quadrilaterals: corners, in turn */
+};
+
+/**
+ * \brief Integer square root, rounded down.
+ */
+static uint32_t raster_isqrt(uint32_t ul_n)
+{
+	uint32_t ul_root = 0, ul_bit = 1ul << 30;
+
+	while (ul_bit > ul_n) {
+		ul_bit >>= 2;
+	}
+	while (ul_bit) {
+		if (ul_n >= ul_root + ul_bit) {
+			ul_n -= ul_root + ul_bit;
+			ul_root = (ul_root >> 1) + ul_bit;
+		} else {
+			ul_root >>= 1;
+		}
+		ul_bit >>= 2;
+	}
+	return ul_root;
+}
+
+/**
+ * \brief Set a rounded rectangle, the radius limited to half its size.
+ */
+static void raster_rrect_set(struct raster_rrect *p_rr, int32_t l_x1,
+		int32_t l_y1, int32_t l_x2, int32_t l_y2, int32_t l_r)
+{
+	p_rr->x1 = Min(l_x1, l_x2);
+	p_rr->y1 = Min(l_y1, l_y2);
+	p_rr->x2 = Max(l_x1, l_x2);
+	p_rr->y2 = Max(l_y1, l_y2);
+	l_r = Min(l_r, (p_rr->x2 - p_rr->x1) / 2);
+	p_rr->r = Max(Min(l_r, (p_rr->y2 - p_rr->y1) / 2), 0);
+	p_rr->b_empty = false;
+}
+
+/**
+ * \brief Set the inside of a frame of the given thickness.
+ */
+static void raster_rrect_inset(struct raster_rrect *p_inner,
+		const struct raster_rrect *p_outer, uint32_t ul_thickness)
+{
+	int32_t t = Max(ul_thickness, 1);
+
+	p_inner->x1 = p_outer->x1 + t;
+	p_inner->y1 = p_outer->y1 + t;
+	p_inner->x2 = p_outer->x2 - t;
+	p_inner->y2 = p_outer->y2 - t;
+	p_inner->r = Max(p_outer->r - t, 0);
+	p_inner->b_empty = (p_inner->x1 > p_inner->x2) || (p_inner->y1 > p_inner->y2);
+}
+
+/**
+ * \brief Span of a rounded rectangle on a row.
+ *
+ * The corners are quarters of the circle of the driver: dx * dx + dy * dy
+ * <= r * r + r around the corner center.
+ *
+ * \return false if the row misses it.
+ */
+static bool raster_rrect_row(const struct raster_rrect *p_rr, int32_t l_y,
+		struct raster_span *p_span)
+{
+	int32_t dy, e;
+
+	if (p_rr->b_empty || (l_y < p_rr->y1) || (l_y > p_rr->y2)) {
+		return false;
+	}
+	if (l_y < p_rr->y1 + p_rr->r) {
+		dy = p_rr->y1 + p_rr->r - l_y;
+	} else if (l_y > p_rr->y2 - p_rr->r) {
+		dy = l_y - (p_rr->y2 - p_rr->r);
+	} else {
+		dy = 0;
+	}
+	e = raster_isqrt(p_rr->r * p_rr->r + p_rr->r - dy * dy);
+	p_span->x1 = p_rr->x1 + p_rr->r - e;
+	p_span->x2 = p_rr->x2 - p_rr->r + e;
+	return true;
+}
+
+/**
+ * \brief Spans of a frame on a row: the outer span minus the inner one.
+ */
+static uint32_t raster_frame_row(const struct raster_shape *p_shape,
+		int32_t l_y, struct raster_span *p_span)
+{
+	struct raster_span outer, inner;
+	uint32_t n = 0;
+
+	if (!raster_rrect_row(&p_shape->outer, l_y, &outer)) {
+		return 0;
+	}
+	if (!raster_rrect_row(&p_shape->inner, l_y, &inner)) {
+		p_span[0] = outer;
+		return 1;
+	}
+	if (inner.x1 > outer.x1) {
+		p_span[n].x1 = outer.x1;
+		p_span[n++].x2 = inner.x1 - 1;
+	}
+	if (inner.x2 < outer.x2) {
+		p_span[n].x1 = inner.x2 + 1;
+		p_span[n++].x2 = outer.x2;
+	}
+	return n;
+}
+
+/**
+ * \brief Keep the parts of the spans inside the sector of an arc.
+ *
+ * A point is after the start direction a when a x p >= 0 and before the
+ * end direction b when p x b >= 0 (y down, clockwise); over 180 degrees
+ * the sector is the complement of the one from b to a, so either is
+ * enough. Each test cuts a row once, so a span gives at most two runs.
+ */
+static uint32_t raster_sector_row(const struct raster_shape *p_shape,
+		int32_t l_y, struct raster_span *p_span, uint32_t ul_count)
+{
+	struct raster_span in[RASTER_MAX_SPANS];
+	int32_t x, dx, dy = l_y - p_shape->l_cy;
+	bool b_in, b_run;
+	uint32_t i, n = 0;
+
+	memcpy(in, p_span, ul_count * sizeof(in[0]));
+	for (i = 0; i < ul_count; i++) {
+		b_run = false;
+		for (x = in[i].x1; x <= in[i].x2; x++) {
+			dx = x - p_shape->l_cx;
+			if (p_shape->b_wide) {
+				b_in = (p_shape->l_ax * dy - p_shape->l_ay * dx >= 0)
+						|| (dx * p_shape->l_by - dy * p_shape->l_bx >= 0);
+			} else {
+				b_in = (p_shape->l_ax * dy - p_shape->l_ay * dx >= 0)
+						&& (dx * p_shape->l_by - dy * p_shape->l_bx >= 0);
+			}
+			if (b_in && !b_run && (n < RASTER_MAX_SPANS)) {
+				p_span[n].x1 = x;
+				p_span[n++].x2 = x;
+				b_run = true;
+			} else if (b_in && b_run) {
+				p_span[n - 1].x2 = x;
+			} else {
+				b_run = false;
+			}
+		}
+	}
+	return n;
+}
+
+/**
+ * \brief Span of a quadrilateral on a row.
+ *
+ * Pixels are inside when their center is, the left edge included and the
+ * right one not, like the rows in the bounding box of the line.
+ */
+static uint32_t raster_quad_row(const struct raster_shape *p_shape,
+		int32_t l_y, struct raster_span *p_span)
+{
+	float yc = (float)l_y + 0.5f, xl = 1e9f, xr = -1e9f, x;
+	float ya, yb;
+	uint32_t i, j;
+
+	for (i = 0; i < 4; i++) {
+		j = (i + 1) & 3;
+		ya = p_shape->f_y[i];
+		yb = p_shape->f_y[j];
+		if ((ya == yb) || (yc < Min(ya, yb)) || (yc > Max(ya, yb))) {
+			continue;
+		}
+		x = p_shape->f_x[i]
+				+ (yc - ya) * (p_shape->f_x[j] - p_shape->f_x[i]) / (yb - ya);
+		xl = Min(xl, x);
+		xr = Max(xr, x);
+	}
+	if (xl > xr) {
+		return 0;
+	}
+	p_span->x1 = (int32_t)ceilf(xl - 0.5f);
+	p_span->x2 = (int32_t)ceilf(xr - 0.5f) - 1;
+	return (p_span->x1 <= p_span->x2) ? 1 : 0;
+}
+
+/**
+ * \brief Spans of a shape on a row, left to right.
+ */
+static uint32_t raster_row(const struct raster_shape *p_shape, int32_t l_y,
+		struct raster_span *p_span)
+{
+	uint32_t n;
+
+	switch (p_shape->uc_kind) {
+	case RASTER_ROUND_RECT:
+		return raster_rrect_row(&p_shape->outer, l_y, p_span) ? 1 : 0;
+	case RASTER_FRAME:
+		return raster_frame_row(p_shape, l_y, p_span);
+	case RASTER_ARC:
+		n = raster_frame_row(p_shape, l_y, p_span);
+		return raster_sector_row(p_shape, l_y, p_span, n);
+	case RASTER_QUAD:
+		return raster_quad_row(p_shape, l_y, p_span);
+	default:
+		return 0;
+	}
+}
+
+/**
+ * \brief Draw the rows of a shape inside its bounding box.
+ */
+static void raster_render(const struct raster_style *p_style,
+		const struct raster_shape *p_shape)
+{
+	uint16_t us_row[ILI9488_LCD_WIDTH];
+	uint16_t us_color = COMPOSITOR_RGB565(p_style->ul_color);
+	uint16_t us_bg = COMPOSITOR_RGB565(p_style->ul_background);
+	struct raster_span span[RASTER_MAX_SPANS];
+	int32_t x1, y1, x2, y2, y, a, b;
+	uint32_t i, n, width;
+
+	x1 = Max(p_shape->x1, 0);
+	y1 = Max(p_shape->y1, 0);
+	x2 = Min(p_shape->x2, ILI9488_LCD_WIDTH - 1);
+	y2 = Min(p_shape->y2, ILI9488_LCD_HEIGHT - 1);
+	if ((x1 > x2) || (y1 > y2)) {
+		return;
+	}
+	width = x2 - x1 + 1;
+
+	if (p_style->b_lcd) {
+		ili9488_draw_prepare(x1, y1, width, y2 - y1 + 1);
+	}
+	for (y = y1; y <= y2; y++) {
+		n = raster_row(p_shape, y, span);
+		if (p_style->b_lcd) {
+			ili9488_pixel_fill16(us_row, us_bg, width);
+		}
+		for (i = 0; i < n; i++) {
+			a = Max(span[i].x1, x1);
+			b = Min(span[i].x2, x2);
+			if (a > b) {
+				continue;
+			}
+			if (!p_style->b_lcd) {
+				compositor_fill_rect(a, y, b, y, p_style->ul_color);
+				continue;
+			}
+			ili9488_pixel_fill16(&us_row[a - x1], us_color, b - a + 1);
+		}
+		if (p_style->b_lcd) {
+			ili9488_draw_stream_rgb565(us_row, width);
+		}
+	}
+}
+
+static void raster_set_box(struct raster_shape *p_shape,
+		const struct raster_rrect *p_rr)
+{
+	p_shape->x1 = p_rr->x1;
+	p_shape->y1 = p_rr->y1;
+	p_shape->x2 = p_rr->x2;
+	p_shape->y2 = p_rr->y2;
+}
+
+/**
+ * \brief Draw a filled circle.
+ *
+ * \param p_style color, and the background for the LCD.
+ * \param l_x X coordinate of the center.
+ * \param l_y Y coordinate of the center.
+ * \param ul_r radius.
+ */
+void raster_fill_circle(const struct raster_style *p_style, int32_t l_x,
+		int32_t l_y, uint32_t ul_r)
+{
+	struct raster_shape shape;
+
+	shape.uc_kind = RASTER_ROUND_RECT;
+	raster_rrect_set(&shape.outer, l_x - (int32_t)ul_r, l_y - (int32_t)ul_r,
+			l_x + (int32_t)ul_r, l_y + (int32_t)ul_r, ul_r);
+	raster_set_box(&shape, &shape.outer);
+	raster_render(p_style, &shape);
+}
+
+/**
+ * \brief Draw a circle outline, us_thickness pixels thick inwards.
+ *
+ * \param p_style color, thickness, and the background for the LCD.
+ * \param l_x X coordinate of the center.
+ * \param l_y Y coordinate of the center.
+ * \param ul_r outer radius.
+ */
+void raster_draw_circle(const struct raster_style *p_style, int32_t l_x,
+		int32_t l_y, uint32_t ul_r)
+{
+	struct raster_shape shape;
+
+	shape.uc_kind = RASTER_FRAME;
+	raster_rrect_set(&shape.outer, l_x - (int32_t)ul_r, l_y - (int32_t)ul_r,
+			l_x + (int32_t)ul_r, l_y + (int32_t)ul_r, ul_r);
+	raster_rrect_inset(&shape.inner, &shape.outer, p_style->us_thickness);
+	raster_set_box(&shape, &shape.outer);
+	raster_render(p_style, &shape);
+}
+
+/**
+ * \brief Check if a direction is inside a sector.
+ *
+ * \param l_angle direction, in degrees.
+ * \param l_start start of the sector, in degrees.
+ * \param l_sweep size of the sector, in degrees from 1 to 359.
+ */
+static bool raster_in_sweep(int32_t l_angle, int32_t l_start, int32_t l_sweep)
+{
+	int32_t l_d = (l_angle - l_start) % 360;
+
+	return ((l_d < 0) ? l_d + 360 : l_d) <= l_sweep;
+}
+
+/**
+ * \brief Draw an arc of a circle outline, us_thickness pixels thick inwards.
+ *
+ * The arc goes clockwise from l_start to l_end; a whole turn or more draws
+ * the whole outline.
+ *
+ * \param p_style color, thickness, and the background for the LCD.
+ * \param l_x X coordinate of the center.
+ * \param l_y Y coordinate of the center.
+ * \param ul_r outer radius.
+ * \param l_start start angle, in degrees clockwise from 3 o'clock.
+ * \param l_end end angle, in degrees clockwise from 3 o'clock.
+ */
+void raster_draw_arc(const struct raster_style *p_style, int32_t l_x,
+		int32_t l_y, uint32_t ul_r, int32_t l_start, int32_t l_end)
+{
+	struct raster_shape shape;
+	int32_t l_sweep = l_end - l_start, l_angle, l_px, l_py;
+	float f_a, f_radius[2];
+	uint32_t i, k;
+
+	if (l_sweep == 0) {
+		return;
+	}
+	if ((l_sweep >= 360) || (l_sweep <= -360)) {
+		raster_draw_circle(p_style, l_x, l_y, ul_r);
+		return;
+	}
+	l_sweep = (l_sweep < 0) ? l_sweep + 360 : l_sweep;
+
+	shape.uc_kind = RASTER_ARC;
+	raster_rrect_set(&shape.outer, l_x - (int32_t)ul_r, l_y - (int32_t)ul_r,
+			l_x + (int32_t)ul_r, l_y + (int32_t)ul_r, ul_r);
+	raster_rrect_inset(&shape.inner, &shape.outer, p_style->us_thickness);
+	shape.l_cx = l_x;
+	shape.l_cy = l_y;
+	shape.b_wide = (l_sweep > 180);
+	f_a = (float)l_start * RASTER_PI / 180.0f;
+	shape.l_ax = lroundf(cosf(f_a) * (1 << RASTER_DIR_SHIFT));
+	shape.l_ay = lroundf(sinf(f_a) * (1 << RASTER_DIR_SHIFT));
+	f_a = (float)l_end * RASTER_PI / 180.0f;
+	shape.l_bx = lroundf(cosf(f_a) * (1 << RASTER_DIR_SHIFT));
+	shape.l_by = lroundf(sinf(f_a) * (1 << RASTER_DIR_SHIFT));
+
+	/* Box of the ends on both edges and of the axis points swept, a pixel
+	 * wider for the rounding; the spans are exact anyway */
+	shape.x1 = shape.y1 = INT32_MAX;
+	shape.x2 = shape.y2 = INT32_MIN;
+	f_radius[0] = (float)ul_r;
+	f_radius[1] = (float)Max(shape.inner.r, 0);
+	for (i = 0; i < 2; i++) {
+		for (k = 0; k < 2; k++) {
+			f_a = (float)(k ? l_end : l_start) * RASTER_PI / 180.0f;
+			l_px = l_x + lroundf(cosf(f_a) * f_radius[i]);
+			l_py = l_y + lroundf(sinf(f_a) * f_radius[i]);
+			shape.x1 = Min(shape.x1, l_px - 1);
+			shape.y1 = Min(shape.y1, l_py - 1);
+			shape.x2 = Max(shape.x2, l_px + 1);
+			shape.y2 = Max(shape.y2, l_py + 1);
+		}
+	}
+	for (l_angle = 0; l_angle < 360; l_angle += 90) {
+		if (raster_in_sweep(l_angle, l_start, l_sweep)) {
+			l_px = l_x + ((l_angle == 0) ? (int32_t)ul_r
+					: (l_angle == 180) ? -(int32_t)ul_r : 0);
+			l_py = l_y + ((l_angle == 90) ? (int32_t)ul_r
+					: (l_angle == 270) ? -(int32_t)ul_r : 0);
+			shape.x1 = Min(shape.x1, l_px);
+			shape.y1 = Min(shape.y1, l_py);
+			shape.x2 = Max(shape.x2, l_px);
+			shape.y2 = Max(shape.y2, l_py);
+		}
+	}
+	shape.x1 = Max(shape.x1, shape.outer.x1);
+	shape.y1 = Max(shape.y1, shape.outer.y1);
+	shape.x2 = Min(shape.x2, shape.outer.x2);
+	shape.y2 = Min(shape.y2, shape.outer.y2);
+	raster_render(p_style, &shape);
+}
+
+/**
+ * \brief Draw a filled rectangle with rounded corners.
+ *
+ * \param p_style color, and the background for the LCD.
+ * \param l_x1 X coordinate of upper-left corner.
+ * \param l_y1 Y coordinate of upper-left corner.
+ * \param l_x2 X coordinate of lower-right corner.
+ * \param l_y2 Y coordinate of lower-right corner.
+ * \param ul_r corner radius, at most half the width and the height.
+ */
+void raster_fill_round_rect(const struct raster_style *p_style,
+		int32_t l_x1, int32_t l_y1, int32_t l_x2, int32_t l_y2, uint32_t ul_r)
+{
+	struct raster_shape shape;
+
+	shape.uc_kind = RASTER_ROUND_RECT;
+	raster_rrect_set(&shape.outer, l_x1, l_y1, l_x2, l_y2, ul_r);
+	raster_set_box(&shape, &shape.outer);
+	raster_render(p_style, &shape);
+}
+
+/**
+ * \brief Draw the outline of a rectangle with rounded corners,
+ * us_thickness pixels thick inwards.
+ *
+ * \param p_style color, thickness, and the background for the LCD.
+ * \param l_x1 X coordinate of upper-left corner.
+ * \param l_y1 Y coordinate of upper-left corner.
+ * \param l_x2 X coordinate of lower-right corner.
+ * \param l_y2 Y coordinate of lower-right corner.
+ * \param ul_r outer corner radius, at most half the width and the height.
+ */
+void raster_draw_round_rect(const struct raster_style *p_style,
+		int32_t l_x1, int32_t l_y1, int32_t l_x2, int32_t l_y2, uint32_t ul_r)
+{
+	struct raster_shape shape;
+
+	shape.uc_kind = RASTER_FRAME;
+	raster_rrect_set(&shape.outer, l_x1, l_y1, l_x2, l_y2, ul_r);
+	raster_rrect_inset(&shape.inner, &shape.outer, p_style->us_thickness);
+	raster_set_box(&shape, &shape.outer);
+	raster_render(p_style, &shape);
+}
+
+/**
+ * \brief Draw a line us_thickness pixels wide.
+ *
+ * The line is the rectangle around the segment between the two pixel
+ * centers, half a pixel longer at both ends so that the end pixels are
+ * drawn whatever the width.
+ *
+ * \param p_style color, width, and the background for the LCD.
+ * \param l_x1 X coordinate of line start.
+ * \param l_y1 Y coordinate of line start.
+ * \param l_x2 X coordinate of line end.
+ * \param l_y2 Y coordinate of line end.
+ */
+void raster_draw_line(const struct raster_style *p_style, int32_t l_x1,
+		int32_t l_y1, int32_t l_x2, int32_t l_y2)
+{
+	struct raster_shape shape;
+	float dx = (float)(l_x2 - l_x1), dy = (float)(l_y2 - l_y1);
+	float len = sqrtf(dx * dx + dy * dy);
+	float h = (float)Max(p_style->us_thickness, 1) / 2.0f;
+	float ux, uy, nx, ny, x0, y0, x1, y1;
+	float xmin, ymin, xmax, ymax;
+	uint32_t i;
+
+	if (len > 0.0f) {
+		ux = dx / len;
+		uy = dy / len;
+	} else {
+		ux = 1.0f;
+		uy = 0.0f;
+	}
+	nx = -uy * h;
+	ny = ux * h;
+	x0 = (float)l_x1 + 0.5f - ux * 0.5f;
+	y0 = (float)l_y1 + 0.5f - uy * 0.5f;
+	x1 = (float)l_x2 + 0.5f + ux * 0.5f;
+	y1 = (float)l_y2 + 0.5f + uy * 0.5f;
+
+	shape.uc_kind = RASTER_QUAD;
+	shape.f_x[0] = x0 + nx;
+	shape.f_y[0] = y0 + ny;
+	shape.f_x[1] = x1 + nx;
+	shape.f_y[1] = y1 + ny;
+	shape.f_x[2] = x1 - nx;
+	shape.f_y[2] = y1 - ny;
+	shape.f_x[3] = x0 - nx;
+	shape.f_y[3] = y0 - ny;
+
+	xmin = xmax = shape.f_x[0];
+	ymin = ymax = shape.f_y[0];
+	for (i = 1; i < 4; i++) {
+		xmin = Min(xmin, shape.f_x[i]);
+		xmax = Max(xmax, shape.f_x[i]);
+		ymin = Min(ymin, shape.f_y[i]);
+		ymax = Max(ymax, shape.f_y[i]);
+	}
+	/* Pixels whose center is inside, as in raster_quad_row() */
+	shape.x1 = (int32_t)ceilf(xmin - 0.5f);
+	shape.x2 = (int32_t)ceilf(xmax - 0.5f) - 1;
+	shape.y1 = (int32_t)ceilf(ymin - 0.5f);
+	shape.y2 = (int32_t)ceilf(ymax - 0.5f) - 1;
+	raster_render(p_style, &shape);
+}
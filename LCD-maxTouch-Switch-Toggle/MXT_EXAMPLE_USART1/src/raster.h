@@ -0,0 +1,50 @@
+/**
+ * \file
+ *
+ * \brief Scanline rasteriser for circles, arcs, rounded rectangles and lines.
+ *
+ * Each shape is walked one screen row at a time, giving the horizontal
+ * spans of the row it covers. Drawn into the compositor the spans are
+ * filled in the shadow framebuffer; drawn straight to the LCD the rows of
+ * the bounding box are built in a line buffer, the background around the
+ * spans included, and streamed through a single window, the way
+ * text_draw_lcd() draws strings.
+ *
+ * Circles are centered on a pixel: a pixel is inside a circle of radius r
+ * when dx * dx + dy * dy <= r * r + r, which is the midpoint circle of the
+ * driver. Outlines are us_thickness pixels thick, inwards. Arcs go
+ * clockwise on the screen from their start to their end angle, in degrees
+ * from 3 o'clock. Lines are us_thickness pixels wide and cover both end
+ * pixels.
+ */
+
+#ifndef RASTER_H_
+#define RASTER_H_
+
+#include "compiler.h"
+
+/** Spans of one row of a shape: an outline row crossed by an arc gap has
+ *  at most four. */
+#define RASTER_MAX_SPANS 4
+
+struct raster_style {
+	uint32_t ul_color;       //!< 24-bit color of the shape
+	uint32_t ul_background;  //!< 24-bit color around it in its box, LCD only
+	uint16_t us_thickness;   //!< outlines, arcs and lines
+	bool b_lcd;              //!< straight to the LCD instead of the compositor
+};
+
+void raster_fill_circle(const struct raster_style *p_style, int32_t l_x,
+		int32_t l_y, uint32_t ul_r);
+void raster_draw_circle(const struct raster_style *p_style, int32_t l_x,
+		int32_t l_y, uint32_t ul_r);
+void raster_draw_arc(const struct raster_style *p_style, int32_t l_x,
+		int32_t l_y, uint32_t ul_r, int32_t l_start, int32_t l_end);
+void raster_fill_round_rect(const struct raster_style *p_style,
+		int32_t l_x1, int32_t l_y1, int32_t l_x2, int32_t l_y2, uint32_t ul_r);
+void raster_draw_round_rect(const struct raster_style *p_style,
+		int32_t l_x1, int32_t l_y1, int32_t l_x2, int32_t l_y2, uint32_t ul_r);
+void raster_draw_line(const struct raster_style *p_style, int32_t l_x1,
+		int32_t l_y1, int32_t l_x2, int32_t l_y2);
+
+#endif /* RASTER_H_ */
@@ -0,0 +1,605 @@
+/**
+ * \file
+ *
+ * \brief Retained scene of the screen: a tree of nodes that repaint
+ * themselves.
+ *
+ * Each node remembers the rectangle it was last painted in. A render first
+ * walks the tree and collects, for every node whose content changed or
+ * whose visibility differs from what the screen shows, the rectangle it
+ * was painted in and the one it is in now. These areas are filled with the
+ * background, then the tree is walked again in z-order and every visible
+ * node over an area is painted whole, as are the nodes above it that
+ * overlap what was just painted. The display list culls the background
+ * under the opaque nodes, and the compositor sends only the pixels that
+ * differ in the end.
+ *
+ * The recording runs with the interrupts masked, so a handler changing a
+ * node never sees half a render; drawing the list runs with them enabled.
+ * Everything the list draws is taken when it is recorded: the bounds, the
+ * image pointers, and a copy of the label strings in the list. A setter
+ * called while the list is drawn only marks its node for the next render,
+ * the frame drawn is the one recorded.
+ */
+
+#include <asf.h>
+#include <string.h>
+#include "scene.h"
+#include "displaylist.h"
+
+enum scene_type {
+	SCENE_GROUP,
+	SCENE_LABEL,
+	SCENE_ICON,
+	SCENE_BUTTON,
+	SCENE_BAR,
+};
+
+#define SCENE_VISIBLE  0x01    /* shown when its parent is */
+#define SCENE_SHOWN    0x02    /* on screen, in painted */
+#define SCENE_DIRTY    0x04    /* content changed since it was painted */
+
+struct scene_node {
+	struct compositor_rect bounds;   /* pixels painted, empty for a group */
+	struct compositor_rect painted;  /* bounds when last painted */
+	struct scene_node *p_parent;
+	struct scene_node *p_child;      /* first child, the lowest one */
+	struct scene_node *p_next;       /* next sibling, above this one */
+	uint8_t uc_type;                 /* enum scene_type */
+	uint8_t uc_flags;
+};
+
+struct scene_label {
+	struct scene_node node;
+	struct text_style style;
+	char c_text[SCENE_LABEL_SIZE];
+};
+
+struct scene_icon {
+	struct scene_node node;
+	const tImage *p_image;           /* NULL paints nothing */
+};
+
+struct scene_button {
+	struct scene_node node;
+	const tImage *p_image[2];        /* off, on */
+	bool b_on;
+};
+
+struct scene_bar {
+	struct scene_node node;
+	uint32_t ul_color;
+	uint32_t ul_background;
+	uint16_t us_filled;              /* columns in ul_color */
+};
+
+#define SCENE_MAX_NODES (1 + SCENE_MAX_GROUPS + SCENE_MAX_LABELS \
+		+ SCENE_MAX_ICONS + SCENE_MAX_BUTTONS + SCENE_MAX_BARS)
+
+/* Two areas per node, as it was and as it is, and the invalidated ones */
+#define SCENE_MAX_DAMAGE (2 * SCENE_MAX_NODES + SCENE_MAX_INVALID)
+
+static struct scene_node g_root;
+static struct scene_node g_groups[SCENE_MAX_GROUPS];
+static struct scene_label g_labels[SCENE_MAX_LABELS];
+static struct scene_icon g_icons[SCENE_MAX_ICONS];
+static struct scene_button g_buttons[SCENE_MAX_BUTTONS];
+static struct scene_bar g_bars[SCENE_MAX_BARS];
+static uint8_t g_uc_groups, g_uc_labels, g_uc_icons, g_uc_buttons, g_uc_bars;
+
+static uint32_t g_ul_background;
+static struct compositor_rect g_invalid[SCENE_MAX_INVALID];
+static uint32_t g_ul_invalid;
+static volatile bool g_b_dirty;
+
+/* Areas of a render: the damaged ones first, then the bounds of the nodes
+ * painted, which the nodes above them must be painted over again */
+static struct compositor_rect g_areas[SCENE_MAX_DAMAGE + SCENE_MAX_NODES];
+static uint32_t g_ul_damaged;
+static uint32_t g_ul_areas;
+
+static struct scene_stats g_stats;
+
+static bool scene_overlap(const struct compositor_rect *p_a,
+		const struct compositor_rect *p_b)
+{
+	return (p_a->x1 <= p_b->x2) && (p_b->x1 <= p_a->x2)
+			&& (p_a->y1 <= p_b->y2) && (p_b->y1 <= p_a->y2);
+}
+
+static bool scene_is_empty(const struct compositor_rect *p_rect)
+{
+	return (p_rect->x1 > p_rect->x2) || (p_rect->y1 > p_rect->y2);
+}
+
+static void scene_set_rect(struct compositor_rect *p_rect, uint32_t ul_x1,
+		uint32_t ul_y1, uint32_t ul_x2, uint32_t ul_y2)
+{
+	/* Clipped to the screen, nothing is painted outside */
+	p_rect->x1 = Min(ul_x1, COMPOSITOR_WIDTH);
+	p_rect->y1 = Min(ul_y1, COMPOSITOR_HEIGHT);
+	p_rect->x2 = Min(ul_x2, COMPOSITOR_WIDTH - 1);
+	p_rect->y2 = Min(ul_y2, COMPOSITOR_HEIGHT - 1);
+}
+
+static void scene_set_image_bounds(struct scene_node *p_node, uint32_t ul_x,
+		uint32_t ul_y, const tImage *p_image)
+{
+	if (p_image) {
+		scene_set_rect(&p_node->bounds, ul_x, ul_y, ul_x + p_image->width - 1,
+				ul_y + p_image->height - 1);
+	} else {
+		scene_set_rect(&p_node->bounds, ul_x, ul_y, 0, 0);
+		p_node->bounds.x2 = p_node->bounds.x1 - 1;
+	}
+}
+
+static void scene_mark(struct scene_node *p_node)
+{
+	p_node->uc_flags |= SCENE_DIRTY;
+	g_b_dirty = true;
+}
+
+/**
+ * \brief Hook a new node on top of the children of its parent.
+ */
+static struct scene_node *scene_add(struct scene_node *p_node,
+		struct scene_node *p_parent, enum scene_type type)
+{
+	struct scene_node **p_p_link;
+
+	p_node->p_parent = p_parent ? p_parent : &g_root;
+	p_node->p_child = NULL;
+	p_node->p_next = NULL;
+	p_node->uc_type = type;
+	p_node->uc_flags = SCENE_VISIBLE;
+	scene_set_rect(&p_node->bounds, 1, 1, 0, 0);
+	for (p_p_link = &p_node->p_parent->p_child; *p_p_link;
+			p_p_link = &(*p_p_link)->p_next) {
+	}
+	*p_p_link = p_node;
+	scene_mark(p_node);
+	return p_node;
+}
+
+/**
+ * \brief Start an empty scene.
+ *
+ * Nothing is painted: the screen is expected to be of the background color
+ * already, as after compositor_init().
+ *
+ * \param ul_background 24-bit color behind the nodes.
+ */
+void scene_init(uint32_t ul_background)
+{
+	memset(&g_root, 0, sizeof(g_root));
+	g_root.uc_type = SCENE_GROUP;
+	g_root.uc_flags = SCENE_VISIBLE | SCENE_SHOWN;
+	scene_set_rect(&g_root.bounds, 1, 1, 0, 0);
+	g_uc_groups = g_uc_labels = g_uc_icons = g_uc_buttons = g_uc_bars = 0;
+	g_ul_background = ul_background;
+	g_ul_invalid = 0;
+	g_b_dirty = false;
+}
+
+/**
+ * \brief The group all the nodes are in, the parent given as NULL.
+ */
+struct scene_node *scene_get_root(void)
+{
+	return &g_root;
+}
+
+/**
+ * \brief Add a group, which paints nothing and holds other nodes.
+ *
+ * \param p_parent node to add it to, NULL for the root.
+ *
+ * \return NULL if the pool is used up.
+ */
+struct scene_node *scene_group_new(struct scene_node *p_parent)
+{
+	if (g_uc_groups >= SCENE_MAX_GROUPS) {
+		return NULL;
+	}
+	return scene_add(&g_groups[g_uc_groups++], p_parent, SCENE_GROUP);
+}
+
+/**
+ * \brief Add a label, a string drawn into a box as text_draw() does.
+ *
+ * \param p_style font and layout of the string, copied.
+ * \param ul_x1 X coordinate of upper-left corner of the box.
+ * \param ul_y1 Y coordinate of upper-left corner of the box.
+ * \param ul_x2 X coordinate of lower-right corner of the box.
+ * \param ul_y2 Y coordinate of lower-right corner of the box.
+ *
+ * \return NULL if the pool is used up; the label starts empty.
+ */
+struct scene_node *scene_label_new(struct scene_node *p_parent,
+		const struct text_style *p_style, uint32_t ul_x1, uint32_t ul_y1,
+		uint32_t ul_x2, uint32_t ul_y2)
+{
+	struct scene_label *p_label;
+
+	if (g_uc_labels >= SCENE_MAX_LABELS) {
+		return NULL;
+	}
+	p_label = &g_labels[g_uc_labels++];
+	p_label->style = *p_style;
+	p_label->c_text[0] = '\0';
+	scene_add(&p_label->node, p_parent, SCENE_LABEL);
+	scene_set_rect(&p_label->node.bounds, ul_x1, ul_y1, ul_x2, ul_y2);
+	return &p_label->node;
+}
+
+/**
+ * \brief Add an icon, an image whose upper-left corner stays put.
+ *
+ * \param p_image image, NULL for none.
+ *
+ * \return NULL if the pool is used up.
+ */
+struct scene_node *scene_icon_new(struct scene_node *p_parent, uint32_t ul_x,
+		uint32_t ul_y, const tImage *p_image)
+{
+	struct scene_icon *p_icon;
+
+	if (g_uc_icons >= SCENE_MAX_ICONS) {
+		return NULL;
+	}
+	p_icon = &g_icons[g_uc_icons++];
+	p_icon->p_image = p_image;
+	scene_add(&p_icon->node, p_parent, SCENE_ICON);
+	scene_set_image_bounds(&p_icon->node, ul_x, ul_y, p_image);
+	return &p_icon->node;
+}
+
+/**
+ * \brief Add a button, with an image for each of its two states.
+ *
+ * Both images must be of the same size; the button starts off.
+ *
+ * \return NULL if the pool is used up.
+ */
+struct scene_node *scene_button_new(struct scene_node *p_parent, uint32_t ul_x,
+		uint32_t ul_y, const tImage *p_off, const tImage *p_on)
+{
+	struct scene_button *p_button;
+
+	if (g_uc_buttons >= SCENE_MAX_BUTTONS) {
+		return NULL;
+	}
+	p_button = &g_buttons[g_uc_buttons++];
+	p_button->p_image[0] = p_off;
+	p_button->p_image[1] = p_on ? p_on : p_off;
+	p_button->b_on = false;
+	scene_add(&p_button->node, p_parent, SCENE_BUTTON);
+	scene_set_image_bounds(&p_button->node, ul_x, ul_y, p_off);
+	return &p_button->node;
+}
+
+/**
+ * \brief Add a progress bar, filled from the left in ul_color.
+ *
+ * \param ul_background 24-bit color of the part not filled.
+ *
+ * \return NULL if the pool is used up; the bar starts empty.
+ */
+struct scene_node *scene_bar_new(struct scene_node *p_parent, uint32_t ul_x1,
+		uint32_t ul_y1, uint32_t ul_x2, uint32_t ul_y2, uint32_t ul_color,
+		uint32_t ul_background)
+{
+	struct scene_bar *p_bar;
+
+	if (g_uc_bars >= SCENE_MAX_BARS) {
+		return NULL;
+	}
+	p_bar = &g_bars[g_uc_bars++];
+	p_bar->ul_color = ul_color;
+	p_bar->ul_background = ul_background;
+	p_bar->us_filled = 0;
+	scene_add(&p_bar->node, p_parent, SCENE_BAR);
+	scene_set_rect(&p_bar->node.bounds, ul_x1, ul_y1, ul_x2, ul_y2);
+	return &p_bar->node;
+}
+
+/**
+ * \brief Show or hide a node, and its children with it.
+ */
+void scene_set_visible(struct scene_node *p_node, bool b_visible)
+{
+	irqflags_t flags = cpu_irq_save();
+
+	if (b_visible != !!(p_node->uc_flags & SCENE_VISIBLE)) {
+		p_node->uc_flags ^= SCENE_VISIBLE;
+		/* The render compares what each node shows with the screen */
+		g_b_dirty = true;
+	}
+	cpu_irq_restore(flags);
+}
+
+/**
+ * \brief Change the string of a label; the same string changes nothing.
+ *
+ * \param p_str string, cut to SCENE_LABEL_SIZE - 1 characters.
+ */
+void scene_label_set_text(struct scene_node *p_node, const char *p_str)
+{
+	struct scene_label *p_label = (struct scene_label *)p_node;
+	irqflags_t flags = cpu_irq_save();
+
+	if (strncmp(p_label->c_text, p_str, SCENE_LABEL_SIZE - 1)) {
+		strncpy(p_label->c_text, p_str, SCENE_LABEL_SIZE - 1);
+		p_label->c_text[SCENE_LABEL_SIZE - 1] = '\0';
+		scene_mark(p_node);
+	}
+	cpu_irq_restore(flags);
+}
+
+/**
+ * \brief Change the image of an icon; its bounds follow the image size.
+ */
+void scene_icon_set_image(struct scene_node *p_node, const tImage *p_image)
+{
+	struct scene_icon *p_icon = (struct scene_icon *)p_node;
+	irqflags_t flags = cpu_irq_save();
+
+	if (p_icon->p_image != p_image) {
+		p_icon->p_image = p_image;
+		scene_set_image_bounds(p_node, p_node->bounds.x1, p_node->bounds.y1,
+				p_image);
+		scene_mark(p_node);
+	}
+	cpu_irq_restore(flags);
+}
+
+void scene_button_set_state(struct scene_node *p_node, bool b_on)
+{
+	struct scene_button *p_button = (struct scene_button *)p_node;
+	irqflags_t flags = cpu_irq_save();
+
+	if ((p_button->b_on != b_on)
+			&& (p_button->p_image[0] != p_button->p_image[1])) {
+		scene_mark(p_node);
+	}
+	p_button->b_on = b_on;
+	cpu_irq_restore(flags);
+}
+
+/**
+ * \brief Fill a progress bar in proportion to ul_value / ul_max.
+ *
+ * The bar is only repainted when the number of columns filled changes.
+ */
+void scene_bar_set_value(struct scene_node *p_node, uint32_t ul_value,
+		uint32_t ul_max)
+{
+	struct scene_bar *p_bar = (struct scene_bar *)p_node;
+	uint32_t ul_width = p_node->bounds.x2 - p_node->bounds.x1 + 1;
+	uint32_t ul_filled = ul_max ? (uint32_t)((uint64_t)Min(ul_value, ul_max)
+			* ul_width / ul_max) : 0;
+	irqflags_t flags = cpu_irq_save();
+
+	if (p_bar->us_filled != ul_filled) {
+		p_bar->us_filled = ul_filled;
+		scene_mark(p_node);
+	}
+	cpu_irq_restore(flags);
+}
+
+/**
+ * \brief Rectangle of the screen a node paints, empty for a group.
+ */
+void scene_get_bounds(const struct scene_node *p_node,
+		struct compositor_rect *p_rect)
+{
+	*p_rect = p_node->bounds;
+}
+
+/**
+ * \brief Paint an area again with the background and the nodes over it,
+ * on the next render.
+ *
+ * For what was drawn there by something else, the drum that stopped.
+ */
+void scene_invalidate(uint32_t ul_x1, uint32_t ul_y1, uint32_t ul_x2,
+		uint32_t ul_y2)
+{
+	struct compositor_rect rect;
+	struct compositor_rect *p_last;
+	irqflags_t flags;
+
+	scene_set_rect(&rect, ul_x1, ul_y1, ul_x2, ul_y2);
+	if (scene_is_empty(&rect)) {
+		return;
+	}
+	flags = cpu_irq_save();
+	if (g_ul_invalid < SCENE_MAX_INVALID) {
+		g_invalid[g_ul_invalid++] = rect;
+	} else {
+		/* Full: the last one grows to hold this one */
+		p_last = &g_invalid[SCENE_MAX_INVALID - 1];
+		p_last->x1 = Min(p_last->x1, rect.x1);
+		p_last->y1 = Min(p_last->y1, rect.y1);
+		p_last->x2 = Max(p_last->x2, rect.x2);
+		p_last->y2 = Max(p_last->y2, rect.y2);
+	}
+	g_b_dirty = true;
+	cpu_irq_restore(flags);
+}
+
+/**
+ * \brief Check if scene_render() has something to paint.
+ */
+bool scene_is_dirty(void)
+{
+	return g_b_dirty;
+}
+
+static void scene_damage_add(const struct compositor_rect *p_rect)
+{
+	uint32_t i;
+
+	if (scene_is_empty(p_rect)) {
+		return;
+	}
+	for (i = 0; i < g_ul_damaged; i++) {
+		if ((p_rect->x1 >= g_areas[i].x1) && (p_rect->x2 <= g_areas[i].x2)
+				&& (p_rect->y1 >= g_areas[i].y1) && (p_rect->y2 <= g_areas[i].y2)) {
+			return;
+		}
+	}
+	g_areas[g_ul_damaged++] = *p_rect;
+}
+
+/**
+ * \brief Collect the areas of the nodes that do not show what they should.
+ *
+ * \param b_shown the parent of p_node is visible.
+ */
+static void scene_damage(struct scene_node *p_node, bool b_shown)
+{
+	for (; p_node; p_node = p_node->p_next) {
+		bool b_visible = b_shown && (p_node->uc_flags & SCENE_VISIBLE);
+
+		if ((p_node->uc_type != SCENE_GROUP) && ((p_node->uc_flags & SCENE_DIRTY)
+				|| (b_visible != !!(p_node->uc_flags & SCENE_SHOWN)))) {
+			if (p_node->uc_flags & SCENE_SHOWN) {
+				scene_damage_add(&p_node->painted);
+			}
+			if (b_visible) {
+				scene_damage_add(&p_node->bounds);
+			}
+		}
+		scene_damage(p_node->p_child, b_visible);
+	}
+}
+
+static void scene_paint_node(struct scene_node *p_node)
+{
+	const struct compositor_rect *p_b = &p_node->bounds;
+	struct scene_label *p_label;
+	struct scene_button *p_button;
+	struct scene_icon *p_icon;
+	struct scene_bar *p_bar;
+
+	switch (p_node->uc_type) {
+	case SCENE_LABEL:
+		p_label = (struct scene_label *)p_node;
+		/* Copied into the list, the handlers may change c_text meanwhile */
+		displaylist_draw_text(&p_label->style, p_label->c_text, p_b->x1, p_b->y1,
+				p_b->x2, p_b->y2);
+		break;
+
+	case SCENE_ICON:
+		p_icon = (struct scene_icon *)p_node;
+		displaylist_draw_image(p_b->x1, p_b->y1, p_icon->p_image);
+		break;
+
+	case SCENE_BUTTON:
+		p_button = (struct scene_button *)p_node;
+		displaylist_draw_image(p_b->x1, p_b->y1, p_button->p_image[p_button->b_on]);
+		break;
+
+	case SCENE_BAR:
+		p_bar = (struct scene_bar *)p_node;
+		if (p_bar->us_filled) {
+			displaylist_fill_rect(p_b->x1, p_b->y1, p_b->x1 + p_bar->us_filled - 1,
+					p_b->y2, p_bar->ul_color);
+		}
+		if (p_b->x1 + p_bar->us_filled <= p_b->x2) {
+			displaylist_fill_rect(p_b->x1 + p_bar->us_filled, p_b->y1, p_b->x2,
+					p_b->y2, p_bar->ul_background);
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+/**
+ * \brief Paint, in z-order, the visible nodes over the areas collected.
+ */
+static void scene_paint(struct scene_node *p_node, bool b_shown)
+{
+	uint32_t i;
+
+	for (; p_node; p_node = p_node->p_next) {
+		bool b_visible = b_shown && (p_node->uc_flags & SCENE_VISIBLE);
+
+		if ((p_node->uc_type != SCENE_GROUP) && b_visible
+				&& !scene_is_empty(&p_node->bounds)) {
+			for (i = 0; i < g_ul_areas; i++) {
+				if (scene_overlap(&p_node->bounds, &g_areas[i])) {
+					break;
+				}
+			}
+			if (i < g_ul_areas) {
+				scene_paint_node(p_node);
+				g_stats.ul_painted++;
+				/* The nodes above it that overlap it are painted back */
+				g_areas[g_ul_areas++] = p_node->bounds;
+			}
+			p_node->painted = p_node->bounds;
+			p_node->uc_flags |= SCENE_SHOWN;
+		} else if (!b_visible) {
+			p_node->uc_flags &= ~SCENE_SHOWN;
+		}
+		p_node->uc_flags &= ~SCENE_DIRTY;
+		scene_paint(p_node->p_child, b_visible);
+	}
+}
+
+/**
+ * \brief Paint what changed since the last render.
+ *
+ * Call from the main loop, before the compositor is flushed.
+ */
+void scene_render(void)
+{
+	irqflags_t flags;
+	uint32_t i;
+
+	if (!g_b_dirty) {
+		return;
+	}
+
+	flags = cpu_irq_save();
+	g_b_dirty = false;
+	g_ul_damaged = 0;
+	for (i = 0; i < g_ul_invalid; i++) {
+		scene_damage_add(&g_invalid[i]);
+	}
+	g_ul_invalid = 0;
+	scene_damage(g_root.p_child, true);
+	g_ul_areas = g_ul_damaged;
+
+	displaylist_begin();
+	if (g_ul_damaged) {
+		g_stats.ul_renders++;
+	}
+	for (i = 0; i < g_ul_damaged; i++) {
+		displaylist_fill_rect(g_areas[i].x1, g_areas[i].y1, g_areas[i].x2,
+				g_areas[i].y2, g_ul_background);
+		g_stats.ul_damaged++;
+		g_stats.ul_pixels += (uint32_t)(g_areas[i].x2 - g_areas[i].x1 + 1)
+				* (g_areas[i].y2 - g_areas[i].y1 + 1);
+	}
+	scene_paint(g_root.p_child, true);
+	cpu_irq_restore(flags);
+
+	/* Drawn with the interrupts enabled, from the copies in the list */
+	displaylist_end();
+}
+
+void scene_get_stats(struct scene_stats *p_stats)
+{
+	*p_stats = g_stats;
+}
+
+void scene_reset_stats(void)
+{
+	memset(&g_stats, 0, sizeof(g_stats));
+}
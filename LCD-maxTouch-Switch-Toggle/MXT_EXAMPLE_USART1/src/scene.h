@@ -0,0 +1,100 @@
+/**
+ * \file
+ *
+ * \brief Retained scene of the screen: a tree of nodes that repaint
+ * themselves.
+ *
+ * The screen is described once by nodes taken from fixed pools: labels,
+ * icons, buttons (an image per state), progress bars, and groups that only
+ * hold other nodes. The application then only changes their properties.
+ * A change that alters what a node shows marks it dirty, and
+ * scene_render() repaints the areas of the dirty nodes, as they were and
+ * as they are now, with the background and the visible nodes over them in
+ * z-order, through one display list.
+ *
+ * Z-order is the order of the tree: a node is painted over its parent and
+ * over the siblings added before it. Positions are screen coordinates, a
+ * parent hides or shows its children with it.
+ *
+ * Every node paints all the pixels of its bounds, as the display list
+ * expects: labels fill their box with the text background, icons and
+ * buttons are opaque images. The rest of the screen (the cycle list, the
+ * drum) belongs to other drawers; the scene only paints there when a node
+ * there changes or scene_invalidate() asks for it.
+ *
+ * The setters may be called from interrupt handlers, scene_render() only
+ * from the main loop.
+ */
+
+#ifndef SCENE_H_
+#define SCENE_H_
+
+#include "compiler.h"
+#include "compositor.h"
+#include "text.h"
+
+/** Nodes of each kind. */
+#ifndef SCENE_MAX_GROUPS
+#  define SCENE_MAX_GROUPS    4
+#endif
+#ifndef SCENE_MAX_LABELS
+#  define SCENE_MAX_LABELS    6
+#endif
+#ifndef SCENE_MAX_ICONS
+#  define SCENE_MAX_ICONS     2
+#endif
+#ifndef SCENE_MAX_BUTTONS
+#  define SCENE_MAX_BUTTONS   4
+#endif
+#ifndef SCENE_MAX_BARS
+#  define SCENE_MAX_BARS      2
+#endif
+
+/** Characters kept by a label, the terminator included. */
+#ifndef SCENE_LABEL_SIZE
+#  define SCENE_LABEL_SIZE    24
+#endif
+
+/** Areas passed to scene_invalidate() kept until the next render. */
+#ifndef SCENE_MAX_INVALID
+#  define SCENE_MAX_INVALID   4
+#endif
+
+struct scene_node;
+
+struct scene_stats {
+	uint32_t ul_renders;     //!< scene_render() calls that painted something
+	uint32_t ul_damaged;     //!< areas repainted
+	uint32_t ul_pixels;      //!< pixels of those areas
+	uint32_t ul_painted;     //!< nodes painted
+};
+
+void scene_init(uint32_t ul_background);
+struct scene_node *scene_get_root(void);
+struct scene_node *scene_group_new(struct scene_node *p_parent);
+struct scene_node *scene_label_new(struct scene_node *p_parent,
+		const struct text_style *p_style, uint32_t ul_x1, uint32_t ul_y1,
+		uint32_t ul_x2, uint32_t ul_y2);
+struct scene_node *scene_icon_new(struct scene_node *p_parent, uint32_t ul_x,
+		uint32_t ul_y, const tImage *p_image);
+struct scene_node *scene_button_new(struct scene_node *p_parent, uint32_t ul_x,
+		uint32_t ul_y, const tImage *p_off, const tImage *p_on);
+struct scene_node *scene_bar_new(struct scene_node *p_parent, uint32_t ul_x1,
+		uint32_t ul_y1, uint32_t ul_x2, uint32_t ul_y2, uint32_t ul_color,
+		uint32_t ul_background);
+void scene_set_visible(struct scene_node *p_node, bool b_visible);
+void scene_label_set_text(struct scene_node *p_node, const char *p_str);
+void scene_icon_set_image(struct scene_node *p_node, const tImage *p_image);
+void scene_button_set_state(struct scene_node *p_node, bool b_on);
+void scene_bar_set_value(struct scene_node *p_node, uint32_t ul_value,
+		uint32_t ul_max);
+void scene_get_bounds(const struct scene_node *p_node,
+		struct compositor_rect *p_rect);
+void scene_invalidate(uint32_t ul_x1, uint32_t ul_y1, uint32_t ul_x2,
+		uint32_t ul_y2);
+bool scene_is_dirty(void);
+void scene_render(void);
+void scene_get_stats(struct scene_stats *p_stats);
+void scene_reset_stats(void);
+
+#endif /* SCENE_H_ */
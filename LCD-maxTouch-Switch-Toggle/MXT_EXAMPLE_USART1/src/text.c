@@ -0,0 +1,395 @@
+/**
+ * \file
+ *
+ * \brief Text layout and rendering for tFont fonts.
+ *
+ * Every glyph of the string gets its own streaming decoder, so a row of the
+ * string is built by pulling one row from each glyph in turn and the glyph
+ * bitmaps are never expanded in RAM. Glyphs found in the glyph cache are
+ * copied from there instead, a row at a time as well.
+ */
+
+#include <asf.h>
+#include <string.h>
+#include "text.h"
+#include "compositor.h"
+#include "glyphcache.h"
+#include "ili9488_pixel.h"
+
+/* Glyphs wider than this are decoded through the scratch buffer in chunks
+ * when they are partly clipped */
+#define TEXT_SCRATCH_PIXELS 16
+
+struct text_glyph {
+	const tImage *p_image;
+	const uint16_t *p_us_cached;  /* next row in the glyph cache, NULL decodes */
+	struct timage_decoder dec;
+	uint16_t us_pad_left;    /* padding inside a fixed-width digit cell */
+	uint16_t us_advance;     /* cell width, spacing included */
+};
+
+struct text_layout {
+	struct text_glyph glyph[TEXT_MAX_GLYPHS];
+	uint32_t ul_count;
+	uint32_t ul_width;
+	uint32_t ul_height;
+};
+
+/* Receives the rows of the box, top to bottom */
+typedef void (*text_row_sink_t)(uint32_t ul_x, uint32_t ul_y,
+		const uint16_t *p_us_row, uint32_t ul_count);
+
+/**
+ * \brief Decode the next character of a UTF-8 string.
+ *
+ * Overlong forms, surrogates and truncated sequences give
+ * TEXT_UTF8_INVALID and consume a single byte, so decoding picks up again
+ * at the next one.
+ *
+ * \param pp_str string, moved past the character.
+ *
+ * \return the code point, 0 at the end of the string (not moved then).
+ */
+uint32_t text_utf8_next(const char **pp_str)
+{
+	const uint8_t *p_uc = (const uint8_t *)*pp_str;
+	uint32_t ul_code, ul_min, i, n;
+
+	if (p_uc[0] < 0x80) {
+		if (p_uc[0]) {
+			(*pp_str)++;
+		}
+		return p_uc[0];
+	}
+	if ((p_uc[0] & 0xE0) == 0xC0) {
+		n = 1;
+		ul_min = 0x80;
+		ul_code = p_uc[0] & 0x1F;
+	} else if ((p_uc[0] & 0xF0) == 0xE0) {
+		n = 2;
+		ul_min = 0x800;
+		ul_code = p_uc[0] & 0x0F;
+	} else if ((p_uc[0] & 0xF8) == 0xF0) {
+		n = 3;
+		ul_min = 0x10000;
+		ul_code = p_uc[0] & 0x07;
+	} else {
+		(*pp_str)++;
+		return TEXT_UTF8_INVALID;
+	}
+	/* Stops at the terminator, which is not a continuation byte */
+	for (i = 1; i <= n; i++) {
+		if ((p_uc[i] & 0xC0) != 0x80) {
+			(*pp_str)++;
+			return TEXT_UTF8_INVALID;
+		}
+		ul_code = (ul_code << 6) | (p_uc[i] & 0x3F);
+	}
+	if ((ul_code < ul_min) || (ul_code > 0x10FFFF)
+			|| ((ul_code >= 0xD800) && (ul_code <= 0xDFFF))) {
+		(*pp_str)++;
+		return TEXT_UTF8_INVALID;
+	}
+	*pp_str += n + 1;
+	return ul_code;
+}
+
+/**
+ * \brief Get the image of a character.
+ *
+ * The contiguous characters of the font are indexed, the others are
+ * searched by bisection of the sorted rest of the table.
+ *
+ * \param ul_code code point.
+ *
+ * \return NULL if the character is not in the font.
+ */
+const tImage *text_get_glyph(const tFont *p_font, uint32_t ul_code)
+{
+	uint32_t ul_start = (uint8_t)p_font->start_char;
+	uint32_t ul_end = (uint8_t)p_font->end_char;
+	uint32_t ul_low, ul_high, ul_mid;
+
+	if ((ul_code >= ul_start) && (ul_code <= ul_end)) {
+		return p_font->chars[ul_code - ul_start].image;
+	}
+
+	ul_low = (ul_end >= ul_start) ? ul_end - ul_start + 1 : 0;
+	ul_high = p_font->length;
+	while (ul_low < ul_high) {
+		ul_mid = (ul_low + ul_high) / 2;
+		if ((uint32_t)p_font->chars[ul_mid].code < ul_code) {
+			ul_low = ul_mid + 1;
+		} else if ((uint32_t)p_font->chars[ul_mid].code > ul_code) {
+			ul_high = ul_mid;
+		} else {
+			return p_font->chars[ul_mid].image;
+		}
+	}
+	return NULL;
+}
+
+static uint32_t text_digit_width(const tFont *p_font)
+{
+	const tImage *p_image;
+	uint32_t width = 0;
+	uint32_t c;
+
+	for (c = '0'; c <= '9'; c++) {
+		p_image = text_get_glyph(p_font, c);
+		if (p_image) {
+			width = Max(width, (uint32_t)p_image->width);
+		}
+	}
+	return width;
+}
+
+/**
+ * \brief Place the glyphs of a string; unknown characters are skipped.
+ */
+static void text_layout(const struct text_style *p_style, const char *p_str,
+		struct text_layout *p_layout)
+{
+	uint32_t digit = p_style->b_fixed_digits ? text_digit_width(p_style->p_font) : 0;
+	struct text_glyph *p_glyph;
+	const tImage *p_image;
+	uint32_t cell, code;
+
+	p_layout->ul_count = 0;
+	p_layout->ul_width = 0;
+	p_layout->ul_height = 0;
+
+	while (*p_str && (p_layout->ul_count < TEXT_MAX_GLYPHS)) {
+		code = text_utf8_next(&p_str);
+		p_image = text_get_glyph(p_style->p_font, code);
+		if (!p_image) {
+			continue;
+		}
+		p_glyph = &p_layout->glyph[p_layout->ul_count++];
+		p_glyph->p_image = p_image;
+		cell = p_image->width;
+		p_glyph->us_pad_left = 0;
+		if (digit && (code >= '0') && (code <= '9')) {
+			p_glyph->us_pad_left = (digit - p_image->width) / 2;
+			cell = digit;
+		}
+		p_glyph->us_advance = cell + p_style->uc_spacing;
+		p_layout->ul_width += p_glyph->us_advance;
+		p_layout->ul_height = Max(p_layout->ul_height, (uint32_t)p_image->height);
+	}
+
+	/* No spacing after the last glyph */
+	if (p_layout->ul_count) {
+		p_layout->ul_width -= p_style->uc_spacing;
+	}
+}
+
+/**
+ * \brief Width of a string in pixels.
+ */
+uint32_t text_get_width(const struct text_style *p_style, const char *p_str)
+{
+	struct text_layout layout;
+
+	text_layout(p_style, p_str, &layout);
+	return layout.ul_width;
+}
+
+/**
+ * \brief Height of a string in pixels, the tallest of its glyphs.
+ */
+uint32_t text_get_height(const struct text_style *p_style, const char *p_str)
+{
+	const tImage *p_image;
+	uint32_t height = 0;
+
+	while (*p_str) {
+		p_image = text_get_glyph(p_style->p_font, text_utf8_next(&p_str));
+		if (p_image) {
+			height = Max(height, (uint32_t)p_image->height);
+		}
+	}
+	return height;
+}
+
+/**
+ * \brief Decode one glyph row into the visible part of the box row.
+ *
+ * \param p_us_row box row, its first pixel is at ul_x1.
+ * \param l_x screen position of the first pixel of the glyph row.
+ */
+static void text_glyph_row(struct text_glyph *p_glyph, uint16_t *p_us_row,
+		int32_t l_x, int32_t l_x1, int32_t l_x2)
+{
+	uint16_t us_scratch[TEXT_SCRATCH_PIXELS];
+	int32_t width = p_glyph->p_image->width;
+	int32_t i, n, k;
+
+	if (p_glyph->p_us_cached) {
+		i = Max(l_x, l_x1);
+		n = Min(l_x + width - 1, l_x2) - i + 1;
+		if (n > 0) {
+			memcpy(p_us_row + (i - l_x1), p_glyph->p_us_cached + (i - l_x),
+					n * sizeof(uint16_t));
+		}
+		p_glyph->p_us_cached += width;
+		return;
+	}
+
+	if ((l_x >= l_x1) && (l_x + width - 1 <= l_x2)) {
+		timage_decode(&p_glyph->dec, p_us_row + (l_x - l_x1), width);
+		return;
+	}
+
+	/* Partly clipped: the whole row must still be consumed */
+	for (i = 0; i < width; i += n) {
+		n = Min(width - i, TEXT_SCRATCH_PIXELS);
+		timage_decode(&p_glyph->dec, us_scratch, n);
+		for (k = 0; k < n; k++) {
+			if ((l_x + i + k >= l_x1) && (l_x + i + k <= l_x2)) {
+				p_us_row[l_x + i + k - l_x1] = us_scratch[k];
+			}
+		}
+	}
+}
+
+/**
+ * \brief Render a string into a box, one row at a time.
+ */
+static void text_render(const struct text_style *p_style, const char *p_str,
+		uint32_t ul_x1, uint32_t ul_y1, uint32_t ul_x2, uint32_t ul_y2,
+		text_row_sink_t sink)
+{
+	uint16_t us_row[ILI9488_LCD_WIDTH];
+	uint16_t us_bg = COMPOSITOR_RGB565(p_style->ul_background);
+	struct text_layout layout;
+	struct text_glyph *p_glyph;
+	uint32_t i, y, row, width;
+	int32_t x, x0;
+	bool b_cached;
+
+	/* Clip the box to the screen */
+	if ((ul_x1 > ul_x2) || (ul_y1 > ul_y2)
+			|| (ul_x1 >= ILI9488_LCD_WIDTH) || (ul_y1 >= ILI9488_LCD_HEIGHT)) {
+		return;
+	}
+	ul_x2 = Min(ul_x2, ILI9488_LCD_WIDTH - 1);
+	ul_y2 = Min(ul_y2, ILI9488_LCD_HEIGHT - 1);
+	width = ul_x2 - ul_x1 + 1;
+
+	text_layout(p_style, p_str, &layout);
+	b_cached = glyph_cache_acquire();
+	for (i = 0; i < layout.ul_count; i++) {
+		p_glyph = &layout.glyph[i];
+		p_glyph->p_us_cached = b_cached ? glyph_cache_get(p_glyph->p_image,
+				p_style->ul_color, p_style->ul_background) : NULL;
+		if (!p_glyph->p_us_cached) {
+			timage_decoder_init(&p_glyph->dec, p_glyph->p_image);
+			timage_decoder_set_colors(&p_glyph->dec, p_style->ul_color,
+					p_style->ul_background);
+		}
+	}
+
+	switch (p_style->uc_align) {
+	case TEXT_ALIGN_CENTER:
+		x0 = (int32_t)ul_x1 + ((int32_t)width - (int32_t)layout.ul_width) / 2;
+		break;
+	case TEXT_ALIGN_RIGHT:
+		x0 = (int32_t)ul_x2 + 1 - (int32_t)layout.ul_width;
+		break;
+	default:
+		x0 = ul_x1;
+		break;
+	}
+
+	for (y = ul_y1, row = 0; y <= ul_y2; y++, row++) {
+		ili9488_pixel_fill16(us_row, us_bg, width);
+
+		x = x0;
+		for (i = 0; (i < layout.ul_count) && (row < layout.ul_height); i++) {
+			p_glyph = &layout.glyph[i];
+			if (row < (uint32_t)p_glyph->p_image->height) {
+				text_glyph_row(p_glyph, us_row, x + p_glyph->us_pad_left,
+						ul_x1, ul_x2);
+			}
+			x += p_glyph->us_advance;
+		}
+
+		sink(ul_x1, y, us_row, width);
+	}
+	if (b_cached) {
+		glyph_cache_release();
+	}
+}
+
+static void text_sink_compositor(uint32_t ul_x, uint32_t ul_y,
+		const uint16_t *p_us_row, uint32_t ul_count)
+{
+	compositor_draw_span(ul_x, ul_y, p_us_row, ul_count);
+}
+
+static void text_sink_lcd(uint32_t ul_x, uint32_t ul_y,
+		const uint16_t *p_us_row, uint32_t ul_count)
+{
+	UNUSED(ul_x);
+	UNUSED(ul_y);
+	ili9488_draw_stream_rgb565(p_us_row, ul_count);
+}
+
+/**
+ * \brief Draw a string into a box of the compositor.
+ *
+ * The whole box is painted: glyphs are aligned horizontally as set by the
+ * style and top aligned, the rest is filled with the background color.
+ * Glyphs are clipped to the box.
+ *
+ * \param p_style font and layout options.
+ * \param p_str string to draw.
+ * \param ul_x1 X coordinate of upper-left corner of the box.
+ * \param ul_y1 Y coordinate of upper-left corner of the box.
+ * \param ul_x2 X coordinate of lower-right corner of the box.
+ * \param ul_y2 Y coordinate of lower-right corner of the box.
+ */
+void text_draw(const struct text_style *p_style, const char *p_str,
+		uint32_t ul_x1, uint32_t ul_y1, uint32_t ul_x2, uint32_t ul_y2)
+{
+	text_render(p_style, p_str, ul_x1, ul_y1, ul_x2, ul_y2, text_sink_compositor);
+}
+
+/**
+ * \brief Draw a string in a box of its own measured size.
+ *
+ * \param p_style font and layout options.
+ * \param p_str string to draw.
+ * \param ul_x X coordinate of the upper-left corner of the string.
+ * \param ul_y Y coordinate of the upper-left corner of the string.
+ */
+void text_draw_at(const struct text_style *p_style, const char *p_str,
+		uint32_t ul_x, uint32_t ul_y)
+{
+	uint32_t width = text_get_width(p_style, p_str);
+	uint32_t height = text_get_height(p_style, p_str);
+
+	if (width && height) {
+		text_draw(p_style, p_str, ul_x, ul_y, ul_x + width - 1, ul_y + height - 1);
+	}
+}
+
+/**
+ * \brief Draw a string into a box straight to the LCD, through one window.
+ *
+ * Same layout as text_draw(), for screens that are not composited.
+ */
+void text_draw_lcd(const struct text_style *p_style, const char *p_str,
+		uint32_t ul_x1, uint32_t ul_y1, uint32_t ul_x2, uint32_t ul_y2)
+{
+	if ((ul_x1 > ul_x2) || (ul_y1 > ul_y2)
+			|| (ul_x1 >= ILI9488_LCD_WIDTH) || (ul_y1 >= ILI9488_LCD_HEIGHT)) {
+		return;
+	}
+	ul_x2 = Min(ul_x2, ILI9488_LCD_WIDTH - 1);
+	ul_y2 = Min(ul_y2, ILI9488_LCD_HEIGHT - 1);
+
+	ili9488_draw_prepare(ul_x1, ul_y1, ul_x2 - ul_x1 + 1, ul_y2 - ul_y1 + 1);
+	text_render(p_style, p_str, ul_x1, ul_y1, ul_x2, ul_y2, text_sink_lcd);
+}
@@ -0,0 +1,61 @@
+/**
+ * \file
+ *
+ * \brief Text layout and rendering for tFont fonts.
+ *
+ * A string is measured first, then rendered row by row into a box: every
+ * pixel of the box is written (glyphs, spacing and padding), so redrawing a
+ * label never needs a background clear. Glyph rows of the whole string are
+ * concatenated, so the direct LCD path sends the string through a single
+ * window.
+ *
+ * Glyphs of anti-aliased fonts are blended between ul_color and the
+ * background through a table computed once per color pair, the other
+ * formats keep the colors they were exported with. Glyphs drawn again and
+ * again, like those of the timer, come decoded from glyphcache.c.
+ *
+ * Strings are UTF-8. Characters the font does not have, and bytes that are
+ * not valid UTF-8, are skipped.
+ */
+
+#ifndef TEXT_H_
+#define TEXT_H_
+
+#include "compiler.h"
+#include "tfont.h"
+
+/** Maximum number of glyphs rendered from one string. */
+#ifndef TEXT_MAX_GLYPHS
+#  define TEXT_MAX_GLYPHS 24
+#endif
+
+/** Code point returned for a byte sequence that is not valid UTF-8. */
+#define TEXT_UTF8_INVALID 0xFFFDu
+
+enum text_align {
+	TEXT_ALIGN_LEFT = 0,
+	TEXT_ALIGN_CENTER,
+	TEXT_ALIGN_RIGHT,
+};
+
+struct text_style {
+	const tFont *p_font;
+	uint32_t ul_background;  //!< 24-bit color of spacing and padding
+	uint8_t uc_spacing;      //!< pixels between two glyphs
+	uint8_t uc_align;        //!< enum text_align, inside the box
+	bool b_fixed_digits;     //!< draw '0'..'9' in cells of the widest digit
+	uint32_t ul_color;       //!< 24-bit color of anti-aliased (TIMAGE_A4) glyphs
+};
+
+uint32_t text_utf8_next(const char **pp_str);
+const tImage *text_get_glyph(const tFont *p_font, uint32_t ul_code);
+uint32_t text_get_width(const struct text_style *p_style, const char *p_str);
+uint32_t text_get_height(const struct text_style *p_style, const char *p_str);
+void text_draw(const struct text_style *p_style, const char *p_str,
+		uint32_t ul_x1, uint32_t ul_y1, uint32_t ul_x2, uint32_t ul_y2);
+void text_draw_at(const struct text_style *p_style, const char *p_str,
+		uint32_t ul_x, uint32_t ul_y);
+void text_draw_lcd(const struct text_style *p_style, const char *p_str,
+		uint32_t ul_x1, uint32_t ul_y1, uint32_t ul_x2, uint32_t ul_y2);
+
+#endif /* TEXT_H_ */
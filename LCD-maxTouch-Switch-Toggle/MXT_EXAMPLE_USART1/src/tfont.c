@@ -0,0 +1,291 @@
+/**
+ * \file
+ *
+ * \brief Streaming decoder for tImage pixel data.
+ *
+ * Images are expanded a few pixels at a time into RGB565, so a compressed
+ * glyph or icon is drawn through a line buffer and never needs a full
+ * bitmap in RAM. See enum timage_format for the layouts.
+ *
+ * Anti-aliased TIMAGE_A4 glyphs decode like 16-color palette images: the
+ * palette is the table of the 16 alpha levels already blended between the
+ * glyph and the background color, so drawing them needs neither blending
+ * math per pixel nor a read-back of the GRAM. The tables of the last color
+ * pairs are kept, a string of one color pair computes its table once.
+ */
+
+#include <asf.h>
+#include <string.h>
+#include "tfont.h"
+#include "ili9488_pixel.h"
+
+#define TIMAGE_ALPHA_MAX (TIMAGE_MAX_PALETTE - 1)
+
+struct timage_lut {
+	uint32_t ul_color;
+	uint32_t ul_background;
+	uint32_t ul_last_use;
+	bool b_valid;
+	uint16_t us_lut[TIMAGE_MAX_PALETTE];
+};
+
+static struct timage_lut g_lut[TIMAGE_LUT_CACHE];
+static uint32_t g_ul_lut_clock;
+static struct timage_lut_stats g_lut_stats;
+
+static uint8_t timage_blend(uint32_t ul_color, uint32_t ul_background,
+		uint32_t ul_shift, uint32_t ul_alpha)
+{
+	uint32_t ul_fg = (ul_color >> ul_shift) & 0xFF;
+	uint32_t ul_bg = (ul_background >> ul_shift) & 0xFF;
+
+	return (ul_fg * ul_alpha + ul_bg * (TIMAGE_ALPHA_MAX - ul_alpha)
+			+ TIMAGE_ALPHA_MAX / 2) / TIMAGE_ALPHA_MAX;
+}
+
+/**
+ * \brief Copy the alpha table of a color pair, computing it on a miss in
+ * place of the least recently used one.
+ *
+ * Not reentrant: images are only drawn from the main loop, the interrupt
+ * handlers only change the scene that scene_render() draws.
+ */
+static void timage_get_lut(uint32_t ul_color, uint32_t ul_background,
+		uint16_t *p_us_lut)
+{
+	struct timage_lut *p_lut = &g_lut[0];
+	uint32_t i, r, g, b;
+
+	for (i = 0; i < TIMAGE_LUT_CACHE; i++) {
+		if (g_lut[i].b_valid && (g_lut[i].ul_color == ul_color)
+				&& (g_lut[i].ul_background == ul_background)) {
+			p_lut = &g_lut[i];
+			break;
+		}
+		if (!g_lut[i].b_valid || (g_lut[i].ul_last_use < p_lut->ul_last_use)) {
+			p_lut = &g_lut[i];
+		}
+	}
+	if (i < TIMAGE_LUT_CACHE) {
+		g_lut_stats.ul_hits++;
+	} else {
+		g_lut_stats.ul_misses++;
+		for (i = 0; i < TIMAGE_MAX_PALETTE; i++) {
+			r = timage_blend(ul_color, ul_background, 16, i);
+			g = timage_blend(ul_color, ul_background, 8, i);
+			b = timage_blend(ul_color, ul_background, 0, i);
+			p_lut->us_lut[i] = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+		}
+		p_lut->ul_color = ul_color;
+		p_lut->ul_background = ul_background;
+		p_lut->b_valid = true;
+	}
+	p_lut->ul_last_use = ++g_ul_lut_clock;
+	memcpy(p_us_lut, p_lut->us_lut, sizeof(p_lut->us_lut));
+}
+
+/**
+ * \brief Prepare a decoder for an image.
+ *
+ * \param p_dec decoder state.
+ * \param p_image image to decode, from its upper-left pixel.
+ */
+void timage_decoder_init(struct timage_decoder *p_dec, const tImage *p_image)
+{
+	const uint8_t *p_data = p_image->data;
+	uint32_t i, count;
+
+	p_dec->p_image = p_image;
+	p_dec->uc_shift = 8;
+	p_dec->uc_run = 0;
+	p_dec->uc_literal = 0;
+
+	switch (p_image->format) {
+	case TIMAGE_PAL1:
+	case TIMAGE_PAL2:
+	case TIMAGE_PAL4:
+	case TIMAGE_RLE:
+		count = *p_data++ + 1;
+		for (i = 0; i < count; i++, p_data += 2) {
+			p_dec->us_palette[i] = p_data[0] | (p_data[1] << 8);
+		}
+		p_dec->uc_bits = (p_image->format == TIMAGE_PAL1) ? 1
+				: (p_image->format == TIMAGE_PAL2) ? 2 : 4;
+		break;
+
+	case TIMAGE_A4:
+		timage_get_lut(0x000000, 0xFFFFFF, p_dec->us_palette);
+		p_dec->uc_bits = 4;
+		break;
+
+	default:
+		break;
+	}
+	p_dec->p_data = p_data;
+}
+
+/**
+ * \brief Set the colors of an anti-aliased image.
+ *
+ * Call after timage_decoder_init(), before the first pixel is decoded;
+ * images of other formats keep their own colors.
+ *
+ * \param p_dec decoder state.
+ * \param ul_color 24-bit color of the opaque pixels.
+ * \param ul_background 24-bit color of the transparent pixels.
+ */
+void timage_decoder_set_colors(struct timage_decoder *p_dec, uint32_t ul_color,
+		uint32_t ul_background)
+{
+	if (p_dec->p_image->format == TIMAGE_A4) {
+		timage_get_lut(ul_color, ul_background, p_dec->us_palette);
+	}
+}
+
+static uint32_t timage_decode_pal(struct timage_decoder *p_dec,
+		uint16_t *p_us_out, uint32_t ul_count)
+{
+	const uint8_t *p_data = p_dec->p_data;
+	uint8_t uc_bits = p_dec->uc_bits;
+	uint8_t uc_mask = (1 << uc_bits) - 1;
+	uint8_t uc_shift = p_dec->uc_shift;
+	uint32_t i, ul_bit;
+
+	/* Icons and masks of one bit per pixel are expanded a byte at a time */
+	if (uc_bits == 1) {
+		ul_bit = 8 - uc_shift;
+		ili9488_pixel_expand_mono(p_us_out, p_data, ul_bit, ul_count,
+				p_dec->us_palette[1], p_dec->us_palette[0]);
+		ul_bit += ul_count;
+		p_dec->p_data = p_data + (ul_bit >> 3);
+		p_dec->uc_shift = 8 - (ul_bit & 7);
+		return ul_count;
+	}
+
+	for (i = 0; i < ul_count; i++) {
+		if (uc_shift == 0) {
+			p_data++;
+			uc_shift = 8;
+		}
+		uc_shift -= uc_bits;
+		*p_us_out++ = p_dec->us_palette[(*p_data >> uc_shift) & uc_mask];
+	}
+
+	p_dec->p_data = p_data;
+	p_dec->uc_shift = uc_shift;
+	return ul_count;
+}
+
+static uint32_t timage_decode_rle(struct timage_decoder *p_dec,
+		uint16_t *p_us_out, uint32_t ul_count)
+{
+	const uint8_t *p_data = p_dec->p_data;
+	uint32_t left = ul_count;
+	uint32_t n;
+	uint16_t us_color;
+	uint8_t uc_ctrl;
+
+	while (left) {
+		if (p_dec->uc_run) {
+			n = Min(left, p_dec->uc_run);
+			us_color = p_dec->us_palette[p_dec->uc_run_index];
+			p_dec->uc_run -= n;
+			left -= n;
+			while (n--) {
+				*p_us_out++ = us_color;
+			}
+		} else if (p_dec->uc_literal) {
+			n = Min(left, p_dec->uc_literal);
+			p_dec->uc_literal -= n;
+			left -= n;
+			while (n--) {
+				*p_us_out++ = p_dec->us_palette[*p_data++ & (TIMAGE_MAX_PALETTE - 1)];
+			}
+		} else {
+			uc_ctrl = *p_data++;
+			if (uc_ctrl & 0x80) {
+				p_dec->uc_run = (uc_ctrl & 0x7F) + 1;
+				p_dec->uc_run_index = *p_data++ & (TIMAGE_MAX_PALETTE - 1);
+			} else {
+				p_dec->uc_literal = uc_ctrl + 1;
+			}
+		}
+	}
+
+	p_dec->p_data = p_data;
+	return ul_count;
+}
+
+/**
+ * \brief Expand the next pixels of an image.
+ *
+ * \param p_dec decoder state.
+ * \param p_us_out receives the pixels in RGB565.
+ * \param ul_count number of pixels wanted; rows follow each other without
+ * padding.
+ *
+ * \return number of pixels written.
+ */
+uint32_t timage_decode(struct timage_decoder *p_dec, uint16_t *p_us_out, uint32_t ul_count)
+{
+	const uint8_t *p_data = p_dec->p_data;
+
+	switch (p_dec->p_image->format) {
+	case TIMAGE_RGB565:
+		memcpy(p_us_out, p_data, ul_count * sizeof(uint16_t));
+		p_dec->p_data = p_data + ul_count * sizeof(uint16_t);
+		return ul_count;
+
+	case TIMAGE_PAL1:
+	case TIMAGE_PAL2:
+	case TIMAGE_PAL4:
+	case TIMAGE_A4:
+		return timage_decode_pal(p_dec, p_us_out, ul_count);
+
+	case TIMAGE_RLE:
+		return timage_decode_rle(p_dec, p_us_out, ul_count);
+
+	case TIMAGE_RGB888:
+	default:
+		ili9488_pixel_rgb888_to_rgb565(p_us_out, p_data, ul_count);
+		p_dec->p_data = p_data + ul_count * 3;
+		return ul_count;
+	}
+}
+
+/**
+ * \brief Draw an image straight to the LCD, one decoded row at a time.
+ *
+ * Bypasses the compositor, meant for screens that are not composited.
+ *
+ * \param ul_x X coordinate of upper-left corner.
+ * \param ul_y Y coordinate of upper-left corner.
+ * \param p_image image to draw.
+ */
+void timage_draw(uint32_t ul_x, uint32_t ul_y, const tImage *p_image)
+{
+	static uint16_t us_row[ILI9488_LCD_WIDTH];
+	struct timage_decoder dec;
+	uint32_t y;
+
+	/* The window must be fully on screen, the panel would wrap otherwise */
+	if ((ul_x + p_image->width > ILI9488_LCD_WIDTH)
+			|| (ul_y + p_image->height > ILI9488_LCD_HEIGHT)) {
+		return;
+	}
+
+	timage_decoder_init(&dec, p_image);
+	ili9488_draw_prepare(ul_x, ul_y, p_image->width, p_image->height);
+	for (y = 0; y < (uint32_t)p_image->height; y++) {
+		timage_decode(&dec, us_row, p_image->width);
+		ili9488_draw_stream_rgb565(us_row, p_image->width);
+	}
+}
+
+/**
+ * \brief Get the hits and misses of the alpha table cache.
+ */
+void timage_get_lut_stats(struct timage_lut_stats *p_stats)
+{
+	*p_stats = g_lut_stats;
+}
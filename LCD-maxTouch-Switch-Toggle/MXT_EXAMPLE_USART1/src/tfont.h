@@ -9,11 +9,42 @@
 #ifndef TFONT_H_
 #define TFONT_H_
 
+#include <stdint.h>
+
+/* Formato dos pixels de tImage.data. Zero e' o R8G8B8 gerado pelo
+ * lcd-image-converter, os outros sao gerados por tools/asset_compiler.py */
+enum timage_format {
+	TIMAGE_RGB888 = 0,	/* 3 bytes por pixel: R, G, B */
+	TIMAGE_RGB565,		/* um uint16_t por pixel */
+	TIMAGE_PAL1,		/* indices de paleta de 1, 2 ou 4 bits, MSB primeiro */
+	TIMAGE_PAL2,
+	TIMAGE_PAL4,
+	TIMAGE_RLE,		/* pacotes run-length de indices de paleta */
+	TIMAGE_A4,		/* alfa de 4 bits por pixel, MSB primeiro */
+};
+
+/*
+ * Formatos com paleta: data[0] = numero de cores - 1 (ate 16), seguido das
+ * cores em RGB565 little-endian e dos pixels.
+ * TIMAGE_RLE: byte de controle c; se c & 0x80, (c & 0x7F) + 1 pixels do
+ * indice no byte seguinte; senao c + 1 indices literais, um por byte.
+ * TIMAGE_A4: so os pixels, 0 e' o fundo e 15 a cor do glifo. As cores vem
+ * de timage_decoder_set_colors() (preto no branco se nao for chamada), que
+ * usa uma tabela alfa -> RGB565 ja misturada para o par de cores.
+ */
+#define TIMAGE_MAX_PALETTE	16
+
+/* Tabelas alfa -> cor guardadas, uma por par de cores */
+#ifndef TIMAGE_LUT_CACHE
+#  define TIMAGE_LUT_CACHE	4
+#endif
+
 typedef struct {
 	const uint8_t *data;
 	int width;
 	int height;
 	int other;
+	int format;		/* enum timage_format */
 } tImage;
 
  typedef struct {
@@ -21,6 +52,13 @@ typedef struct {
 	 const tImage *image;
  } tChar;
  
+/*
+ * Os (end_char - start_char + 1) primeiros chars sao os codigos seguidos
+ * start_char..end_char, achados pelo indice; os outros, ate length, vem
+ * ordenados por code (UTF-32) e sao achados por busca binaria. As fontes
+ * do lcd-image-converter so tem a primeira parte, as fontes esparsas de
+ * tools/asset_compiler.py (--compose) tem as duas.
+ */
  typedef struct {
 	 int length;
 	 const tChar *chars;
@@ -29,5 +67,28 @@ typedef struct {
  } tFont;
  
 
+/* Estado do decodificador, expande a imagem em pedacos sem guardar o bitmap */
+struct timage_decoder {
+	const tImage *p_image;
+	const uint8_t *p_data;		/* proximo byte a ler */
+	uint16_t us_palette[TIMAGE_MAX_PALETTE];
+	uint8_t uc_bits;		/* bits por indice (PAL) */
+	uint8_t uc_shift;		/* bits ainda nao lidos em *p_data (PAL) */
+	uint8_t uc_run_index;		/* indice repetido (RLE) */
+	uint8_t uc_run;			/* pixels restantes do run (RLE) */
+	uint8_t uc_literal;		/* indices literais restantes (RLE) */
+};
+
+struct timage_lut_stats {
+	uint32_t ul_hits;		/* tabelas achadas no cache */
+	uint32_t ul_misses;		/* tabelas calculadas */
+};
+
+void timage_decoder_init(struct timage_decoder *p_dec, const tImage *p_image);
+void timage_decoder_set_colors(struct timage_decoder *p_dec, uint32_t ul_color,
+		uint32_t ul_background);
+uint32_t timage_decode(struct timage_decoder *p_dec, uint16_t *p_us_out, uint32_t ul_count);
+void timage_draw(uint32_t ul_x, uint32_t ul_y, const tImage *p_image);
+void timage_get_lut_stats(struct timage_lut_stats *p_stats);
 
 #endif /* TFONT_H_ */
\ No newline at end of file
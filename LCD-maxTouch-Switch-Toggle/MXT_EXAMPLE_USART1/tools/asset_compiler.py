@@ -0,0 +1,819 @@
+#!/usr/bin/env python3
+"""
+Offline asset compiler for the tImage/tFont headers used by the firmware.
+
+Inputs:
+  * PNG/JPG/... pictures (needs Pillow: pip install Pillow)
+  * headers produced by lcd-image-converter (images and fonts), so the
+    existing assets can be converted without their original sources
+
+Output is a header with the same symbols as the lcd-image-converter one,
+so it can replace it without touching the code that includes it. The
+tImage format field (see src/tfont.h) tells the drawing code how to
+decode the data.
+
+The a4 format keeps a 4-bit coverage per pixel, from the background
+(0) to the foreground color (15), and the firmware blends it with the
+colors of the text at draw time. Fonts exported without antialiasing get
+their coverage from a bigger export box-filtered down with --scale.
+
+--frames makes a tAnim (see src/anim.h) instead: the picture turned by
+--turn degrees over that many frames, each frame kept as the spans of
+pixels that differ from the one before, so the firmware only redraws what
+moves. Turning the full size picture and shrinking it with --scale
+smooths the edges.
+
+--compose adds accented letters to a font, each drawn from its base letter
+and the grave accent of the font (mirrored for the acute). The characters
+past the contiguous range of the font are kept sorted at the end of its
+tChar array, where text_get_glyph() finds them by bisection.
+
+Examples:
+  asset_compiler.py -f rgb565 -n Play -o src/icons/Play.h src/icons/play.jpg
+  asset_compiler.py -f rgb565 -i src/icons/next.h
+  asset_compiler.py -f auto -i src/calibri_36.h
+  asset_compiler.py -f auto --compose áíÍ -i src/calibri_36.h
+  asset_compiler.py -f a4 --scale 2 -n arial_36_aa -o src/arial_36_aa.h src/arial_72.h
+  asset_compiler.py --frames 8 --turn 120 --scale 3 -n drum -o src/icons/drum.h src/icons/cent.h
+"""
+
+import argparse
+import os
+import re
+import sys
+
+# Must match enum timage_format in src/tfont.h
+FORMATS = {
+    'rgb888': ('TIMAGE_RGB888', 24),
+    'rgb565': ('TIMAGE_RGB565', 16),
+    'pal1': ('TIMAGE_PAL1', 1),
+    'pal2': ('TIMAGE_PAL2', 2),
+    'pal4': ('TIMAGE_PAL4', 4),
+    'rle': ('TIMAGE_RLE', 8),
+    'a4': ('TIMAGE_A4', 4),
+}
+TAGS = {tag: fmt for fmt, (tag, bits) in FORMATS.items()}
+
+MAX_PALETTE = 16
+ALPHA_MAX = 15
+
+DATA_RE = re.compile(
+    r'static const (uint8_t|uint16_t) image_data_(\w+)\[(\d+)\] = \{(.*?)\};',
+    re.S)
+IMAGE_RE = re.compile(
+    r'((?:static )?const tImage (\w+) = \{ )(?:\(const uint8_t \*\))?image_data_(\w+),'
+    r'\s*(\d+),\s*(\d+),\s*(\d+)\s*(?:,\s*(\w+)\s*)?\};')
+
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def rgb565_to_rgb(v):
+    r = (v >> 11) & 0x1F
+    g = (v >> 5) & 0x3F
+    b = v & 0x1F
+    return ((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2))
+
+
+def format_array(ctype, name, values, per_line):
+    width = 6 if ctype == 'uint16_t' else 4
+    lines = []
+    for i in range(0, len(values), per_line):
+        chunk = values[i:i + per_line]
+        lines.append('    ' + ''.join('0x%0*x, ' % (width - 2, v) for v in chunk))
+    return 'static const %s image_data_%s[%d] = {\n%s\n};' % (
+        ctype, name, len(values), '\n'.join(lines))
+
+
+class Encoded:
+    """Encoded pixel data of one image."""
+
+    def __init__(self, ctype, values, bits, tag):
+        self.ctype = ctype
+        self.values = values
+        self.bits = bits
+        self.tag = tag
+
+    def size(self):
+        return len(self.values) * (2 if self.ctype == 'uint16_t' else 1)
+
+
+def distance2(a, b):
+    return sum((x - y) * (x - y) for x, y in zip(a, b))
+
+
+def alpha_of(pixels, fg, bg):
+    """Coverage of each pixel, 0..ALPHA_MAX, along the way from bg to fg."""
+    axis = [f - b for f, b in zip(fg, bg)]
+    norm = distance2(fg, bg)
+    if not norm:
+        raise ValueError('foreground and background are the same color')
+    return [min(ALPHA_MAX, max(0, int(round(
+        ALPHA_MAX * sum((c - b) * a for c, b, a in zip(p, bg, axis)) / norm))))
+        for p in pixels]
+
+
+def blend(fg, bg, alpha):
+    """Same rounding as timage_blend() in src/tfont.c."""
+    return tuple((f * alpha + b * (ALPHA_MAX - alpha) + ALPHA_MAX // 2) // ALPHA_MAX
+                 for f, b in zip(fg, bg))
+
+
+def downscale(pixels, width, height, scale, bg):
+    """Box filter of scale x scale pixels, bg past the right and bottom edges."""
+    out_w = (width + scale - 1) // scale
+    out_h = (height + scale - 1) // scale
+    out = []
+    n = scale * scale
+    for oy in range(out_h):
+        for ox in range(out_w):
+            acc = [0, 0, 0]
+            for y in range(oy * scale, oy * scale + scale):
+                for x in range(ox * scale, ox * scale + scale):
+                    p = pixels[y * width + x] if x < width and y < height else bg
+                    for c in range(3):
+                        acc[c] += p[c]
+            out.append(tuple((a + n // 2) // n for a in acc))
+    return out_w, out_h, out
+
+
+def palette_of(pixels):
+    """RGB565 palette and index list, None if there are too many colors."""
+    colors = []
+    lookup = {}
+    indices = []
+    for p in pixels:
+        c = rgb565(*p)
+        if c not in lookup:
+            if len(colors) == MAX_PALETTE:
+                return None, None
+            lookup[c] = len(colors)
+            colors.append(c)
+        indices.append(lookup[c])
+    return colors, indices
+
+
+def palette_header(colors):
+    out = [len(colors) - 1]
+    for c in colors:
+        out += [c & 0xFF, c >> 8]
+    return out
+
+
+def pack_indices(indices, bits):
+    out = []
+    acc = 0
+    used = 0
+    for i in indices:
+        acc = (acc << bits) | i
+        used += bits
+        if used == 8:
+            out.append(acc)
+            acc = used = 0
+    if used:
+        out.append(acc << (8 - used))
+    return out
+
+
+def rle_indices(indices):
+    """Control byte c: c & 0x80 -> run of (c & 0x7f) + 1 copies of the next
+    byte, otherwise c + 1 literal index bytes follow."""
+    out = []
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:128]
+            del literal[:128]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    i = 0
+    while i < len(indices):
+        run = 1
+        while i + run < len(indices) and indices[i + run] == indices[i] and run < 128:
+            run += 1
+        # a run of 2 costs as much as two literals, only break literals for 3+
+        if run >= 3 or (run == 2 and not literal):
+            flush_literal()
+            out += [0x80 | (run - 1), indices[i]]
+        else:
+            literal.extend(indices[i:i + run])
+        i += run
+    flush_literal()
+    return out
+
+
+def encode(pixels, width, height, fmt, fg=(0, 0, 0), bg=(255, 255, 255)):
+    """pixels: list of (r, g, b) tuples, rows top to bottom."""
+    if fmt == 'auto':
+        candidates = []
+        for f in ('pal1', 'pal2', 'pal4', 'rle', 'rgb565'):
+            try:
+                candidates.append(encode(pixels, width, height, f))
+            except ValueError:
+                pass
+        return min(candidates, key=Encoded.size)
+    tag, bits = FORMATS[fmt]
+    if fmt == 'rgb888':
+        values = [c for p in pixels for c in p]
+        return Encoded('uint8_t', values, bits, tag)
+    if fmt == 'rgb565':
+        values = [rgb565(*p) for p in pixels]
+        return Encoded('uint16_t', values, bits, tag)
+    if fmt == 'a4':
+        return Encoded('uint8_t', pack_indices(alpha_of(pixels, fg, bg), bits), bits, tag)
+    colors, indices = palette_of(pixels)
+    if colors is None:
+        raise ValueError('more than %d colors, %s is not possible' % (MAX_PALETTE, fmt))
+    if fmt == 'rle':
+        payload = rle_indices(indices)
+    elif len(colors) > (1 << bits):
+        raise ValueError('%d colors do not fit in %s' % (len(colors), fmt))
+    else:
+        payload = pack_indices(indices, bits)
+    return Encoded('uint8_t', palette_header(colors) + payload, bits, tag)
+
+
+def image_decl(sym, data_name, width, height, enc, static=False):
+    ref = 'image_data_%s' % data_name
+    if enc.ctype != 'uint8_t':
+        ref = '(const uint8_t *)' + ref
+    return '%sconst tImage %s = { %s,\n    %d, %d, %d, %s };' % (
+        'static ' if static else '', sym, ref, width, height, enc.bits, enc.tag)
+
+
+def decode_values(ctype, body, tag, count, fg=(0, 0, 0), bg=(255, 255, 255)):
+    values = [int(v, 16) for v in re.findall(r'0x[0-9a-fA-F]+', body)]
+    fmt = TAGS.get(tag or 'TIMAGE_RGB888')
+    if fmt == 'a4':
+        alphas = [(byte >> shift) & ALPHA_MAX for byte in values for shift in (4, 0)]
+        return [blend(fg, bg, a) for a in alphas[:count]]
+    if fmt == 'rgb888':
+        if ctype != 'uint8_t' or len(values) % 3:
+            raise ValueError('unexpected R8G8B8 data')
+        return [tuple(values[i:i + 3]) for i in range(0, len(values), 3)]
+    if fmt == 'rgb565':
+        return [rgb565_to_rgb(v) for v in values]
+    if fmt is None:
+        raise ValueError('cannot decode %s data' % tag)
+    ncolors = values[0] + 1
+    colors = [values[1 + 2 * i] | (values[2 + 2 * i] << 8) for i in range(ncolors)]
+    payload = values[1 + 2 * ncolors:]
+    indices = []
+    if fmt == 'rle':
+        i = 0
+        while len(indices) < count:
+            c = payload[i]
+            if c & 0x80:
+                indices += [payload[i + 1]] * ((c & 0x7F) + 1)
+                i += 2
+            else:
+                indices += payload[i + 1:i + 2 + c]
+                i += c + 2
+    else:
+        bits = FORMATS[fmt][1]
+        for byte in payload:
+            for shift in range(8 - bits, -1, -bits):
+                indices.append((byte >> shift) & ((1 << bits) - 1))
+    return [rgb565_to_rgb(colors[i]) for i in indices[:count]]
+
+
+def update_comment(text, fmt, encoded, scale):
+    """Describe the new encoding in the lcd-image-converter comment block."""
+    bits = set(e.bits for e in encoded)
+    blocks = set(16 if e.ctype == 'uint16_t' else 8 for e in encoded)
+    rle = any(e.tag == 'TIMAGE_RLE' for e in encoded)
+    text = re.sub(r'(\* preset name: ).*', r'\g<1>asset_compiler %s' % fmt, text, count=1)
+    text = re.sub(r'(\* bits per pixel: ).*',
+                  r'\g<1>' + '/'.join(str(b) for b in sorted(bits)), text, count=1)
+    if len(blocks) == 1:
+        block = blocks.pop()
+        text = re.sub(r'(\* data block size: ).*',
+                      r'\g<1>%d bit(s), uint%d_t' % (block, block), text, count=1)
+    text = re.sub(r'(\* RLE compression enabled: ).*',
+                  r'\g<1>' + ('yes' if rle else 'no'), text, count=1)
+    if fmt == 'a4':
+        text = re.sub(r'(\* antialiasing: ).*', r'\g<1>yes, 4 bit alpha', text, count=1)
+    if scale > 1:
+        text = re.sub(r'(\* size: )(\d+)',
+                      lambda m: m.group(1) + str(int(m.group(2)) // scale), text, count=1)
+    return text
+
+
+def ink_of(text, images, bg):
+    """Color farthest from the background in all the images of a header."""
+    ink = bg
+    for m in DATA_RE.finditer(text):
+        img = images.get(m.group(2))
+        if img is None:
+            continue
+        count = int(img.group(4)) * int(img.group(5))
+        for p in decode_values(m.group(1), m.group(4), img.group(7), count):
+            if distance2(p, bg) > distance2(ink, bg):
+                ink = p
+    return ink
+
+
+def convert_header(text, fmt, fg=None, bg=(255, 255, 255), scale=1, name=None):
+    """Re-encode every image of a lcd-image-converter header in place,
+    renaming its symbols after name if given. Without fg the glyphs of an
+    a4 font are the color farthest from bg."""
+    images = {}
+    for m in IMAGE_RE.finditer(text):
+        images[m.group(3)] = m
+    saved = [0, 0]
+    if fg is None:
+        fg = ink_of(text, images, bg) if fmt == 'a4' else (0, 0, 0)
+
+    def repl_data(m):
+        ctype, name, body = m.group(1), m.group(2), m.group(4)
+        img = images.get(name)
+        if img is None:
+            return m.group(0)
+        width, height = int(img.group(4)), int(img.group(5))
+        pixels = decode_values(ctype, body, img.group(7), width * height, fg, bg)
+        if len(pixels) != width * height:
+            raise ValueError('%s: %d pixels for %dx%d' % (name, len(pixels), width, height))
+        if scale > 1:
+            width, height, pixels = downscale(pixels, width, height, scale, bg)
+        repl_data.sizes[name] = (width, height)
+        enc = encode(pixels, width, height, fmt, fg, bg)
+        saved[0] += int(m.group(3)) * (2 if ctype == 'uint16_t' else 1)
+        saved[1] += enc.size()
+        repl_data.encoded[name] = enc
+        return format_array(enc.ctype, name, enc.values, 16 if enc.ctype == 'uint8_t' else 12)
+    repl_data.encoded = {}
+    repl_data.sizes = {}
+
+    text = DATA_RE.sub(repl_data, text)
+
+    def repl_image(m):
+        enc = repl_data.encoded.get(m.group(3))
+        if enc is None:
+            return m.group(0)
+        width, height = repl_data.sizes[m.group(3)]
+        return image_decl(m.group(2), m.group(3), width, height,
+                          enc, m.group(1).startswith('static'))
+
+    text = IMAGE_RE.sub(repl_image, text)
+    if repl_data.encoded:
+        text = update_comment(text, fmt, repl_data.encoded.values(), scale)
+    old = re.search(r'\* name: (\w+)', text)
+    if name and old:
+        text = text.replace(old.group(1), name)
+    return text, saved
+
+
+# Combining marks composed from the spacing marks of the ASCII range, the
+# acute being the grave mirrored. ^ and ~ are drawn at the size of the
+# glyphs, too big to stand for the marks.
+MARKS = {
+    '\u0300': ('`', False),
+    '\u0301': ('`', True),
+}
+
+FONT_RE = re.compile(r'const tFont (\w+) = \{ (\d+), (\w+), ([^,]+), ([^}]+?) \};')
+CHAR_RE = re.compile(r'\{(0x[0-9a-fA-F]+), &(\w+)\}')
+
+
+def char_comment(code):
+    """How lcd-image-converter writes a character in its comments."""
+    if 0x20 <= code < 0x7F and chr(code) != '@':
+        return chr(code)
+    return '\\x%04x' % code
+
+
+def char_literal(code):
+    if 0x20 <= code < 0x7F and chr(code) not in '\'\\':
+        return "'%s'" % chr(code)
+    return '0x%02x' % code
+
+
+def font_chars(text):
+    """Font symbol and {code: glyph symbol} of a font header."""
+    font = FONT_RE.search(text)
+    if font is None:
+        raise ValueError('no tFont in the header')
+    array = re.search(r'static const tChar %s\[\] = \{(.*?)\n\};' % font.group(3), text, re.S)
+    chars = {}
+    for m in CHAR_RE.finditer(array.group(1)):
+        # The #else branch of each character points at an empty symbol
+        if m.group(2) != font.group(1) + '_0x':
+            chars[int(m.group(1), 16)] = m.group(2)
+    return font.group(1), chars
+
+
+def font_array(name, chars):
+    """tChar array and tFont of a font: the longest run of consecutive codes
+    under 256 first, to be indexed, then the other codes in order."""
+    codes = sorted(chars)
+    best = (0, 0)
+    start = 0
+    for i in range(1, len(codes) + 1):
+        if i == len(codes) or codes[i] != codes[i - 1] + 1 or codes[i] > 0xFF:
+            if codes[start] <= 0xFF and i - start > best[1] - best[0]:
+                best = (start, i)
+            start = i
+    run = codes[best[0]:best[1]]
+    order = run + [c for c in codes if c not in set(run)]
+    entries = []
+    for i, code in enumerate(order):
+        comma = ',' if i < len(order) - 1 else ''
+        entries.append('#if (0x0 == 0x0)\n'
+                       '  // character: \'%s\'\n'
+                       '  {0x%02x, &%s}%s\n'
+                       '#else\n'
+                       '  // character: \'%s\' == \'\'\n'
+                       '  {0x%02x, &%s_0x}%s\n'
+                       '#endif\n' % (char_comment(code), code, chars[code], comma,
+                                     char_comment(code), code, name, comma))
+    body = '\n'.join(entries)
+    first, last = (run[0], run[-1]) if run else (1, 0)
+    return ('static const tChar %s_array[] = {\n\n%s\n};\n\n\n'
+            'const tFont %s = { %d, %s_array, %s, %s };' % (
+                name, body, name, len(order), name, char_literal(first),
+                char_literal(last)))
+
+
+def set_font_chars(text, name, chars):
+    """Rewrite the tChar array, the tFont and the character list comment."""
+    array = re.compile(r'static const tChar %s_array\[\] = \{.*?\n\};\n\n\n'
+                       r'const tFont %s = \{[^}]*\};' % (name, name), re.S)
+    if not array.search(text):
+        raise ValueError('%s: unexpected tChar array' % name)
+    text = array.sub(lambda m: font_array(name, chars), text, count=1)
+    return re.sub(r'(\* included characters: ).*',
+                  lambda m: m.group(1) + ''.join(char_comment(c) for c in sorted(chars)),
+                  text, count=1)
+
+
+def glyph_pixels(text, sym):
+    img = re.search(r'const tImage %s = \{ (?:\(const uint8_t \*\))?image_data_(\w+),'
+                    r'\s*(\d+),\s*(\d+),\s*(\d+)\s*(?:,\s*(\w+)\s*)?\};' % sym, text)
+    data = re.search(r'static const (uint8_t|uint16_t) image_data_%s\[(\d+)\] = \{(.*?)\};'
+                     % img.group(1), text, re.S)
+    width, height = int(img.group(2)), int(img.group(3))
+    return width, height, decode_values(data.group(1), data.group(3), img.group(5),
+                                        width * height)
+
+
+def ink_box(pixels, width, height, bg):
+    rows = [y for y in range(height) if any(pixels[y * width + x] != bg for x in range(width))]
+    cols = [x for x in range(width) if any(pixels[y * width + x] != bg for y in range(height))]
+    if not rows:
+        return None
+    return cols[0], rows[0], cols[-1], rows[-1]
+
+
+def compose_glyph(base, mark, mirror, bg):
+    """Base glyph with a mark over its ink: the mark keeps its own rows if
+    they clear the base, else it is moved up and squeezed into the rows left
+    above it (capitals)."""
+    width, height, pixels = base[:3]
+    pixels = list(pixels)
+    box = ink_box(pixels, width, height, bg)
+    # i and j lose their dot: the ink above the first blank row
+    rows = [any(pixels[y * width + x] != bg for x in range(width)) for y in range(height)]
+    top = box[1]
+    gap = next((y for y in range(top, box[3] + 1) if not rows[y]), None)
+    if gap is not None and chr(base[3]) in 'ij':
+        for y in range(top, gap):
+            for x in range(width):
+                pixels[y * width + x] = bg
+        top = next(y for y in range(gap, height) if rows[y])
+
+    mw, mh, mpixels = mark[:3]
+    mx1, my1, mx2, my2 = ink_box(mpixels, mw, mh, bg)
+    ink = [[mpixels[y * mw + x] for x in range(mx1, mx2 + 1)] for y in range(my1, my2 + 1)]
+    if mirror:
+        ink = [row[::-1] for row in ink]
+    if len(ink[0]) > width:
+        raise ValueError('%s: mark %s wider than the glyph' % (chr(base[3]), chr(mark[3])))
+    bottom = min(my2, top - 2)
+    rows_left = bottom + 1
+    if rows_left < 2:
+        raise ValueError('%s: no room for a mark above it' % chr(base[3]))
+    n = min(len(ink), rows_left)
+    ink = [ink[i * len(ink) // n] for i in range(n)]
+    y0 = bottom - n + 1
+    x0 = (box[0] + box[2] + 1 - len(ink[0])) // 2
+    x0 = max(0, min(width - len(ink[0]), x0))
+    for y, row in enumerate(ink):
+        for x, p in enumerate(row):
+            if p != bg:
+                pixels[(y0 + y) * width + x0 + x] = p
+    return width, height, pixels
+
+
+def compose_font(text, compose, fmt, bg=(255, 255, 255)):
+    """Add to a font the characters of compose, each drawn from its base
+    letter and a mark of the font (see MARKS)."""
+    import unicodedata
+    name, chars = font_chars(text)
+    decls = []
+    for ch in sorted(set(compose)):
+        code = ord(ch)
+        if code in chars:
+            continue
+        parts = unicodedata.normalize('NFD', ch)
+        if len(parts) != 2 or parts[1] not in MARKS or ord(parts[0]) not in chars:
+            raise ValueError('%s (U+%04X) cannot be composed from %s' % (ch, code, name))
+        spacing, mirror = MARKS[parts[1]]
+        if ord(spacing) not in chars:
+            raise ValueError('%s has no %s to compose %s' % (name, spacing, ch))
+        base = glyph_pixels(text, chars[ord(parts[0])]) + (ord(parts[0]),)
+        mark = glyph_pixels(text, chars[ord(spacing)]) + (ord(spacing),)
+        width, height, pixels = compose_glyph(base, mark, mirror, bg)
+        sym = '%s_0x%02x' % (name, code)
+        enc = encode(pixels, width, height, fmt)
+        decls.append('#if (0x0 == 0x0)\n%s\n%s\n#endif\n' % (
+            format_array(enc.ctype, sym, enc.values, 16 if enc.ctype == 'uint8_t' else 12),
+            image_decl(sym, sym, width, height, enc, static=True)))
+        chars[code] = sym
+    if decls:
+        at = text.index('\n\nstatic const tChar %s_array[]' % name)
+        text = text[:at] + '\n' + '\n'.join(decls) + text[at:]
+    return set_font_chars(text, name, chars)
+
+
+def load_picture(path, size, background):
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit('Pillow is needed to read %s (pip install Pillow)' % path)
+    img = Image.open(path)
+    if size:
+        img = img.resize(size, Image.LANCZOS)
+    img = img.convert('RGBA')
+    bg = Image.new('RGBA', img.size, background + (255,))
+    img = Image.alpha_composite(bg, img).convert('RGB')
+    return img.size[0], img.size[1], list(img.getdata())
+
+
+HEADER = '''
+/*******************************************************************************
+* image
+* filename: {filename}
+* name: {name}
+*
+* preset name: asset_compiler {fmt}
+* data block size: {block} bit(s), {ctype}
+* RLE compression enabled: {rle}
+* conversion type: Color, not_used not_used
+* bits per pixel: {bits}
+*
+* preprocess:
+*  main scan direction: top_to_bottom
+*  line scan direction: forward
+*  inverse: no
+*******************************************************************************/
+
+#include <stdint.h>
+
+
+
+{data}
+{decl}
+
+'''
+
+
+def picture_header(path, name, fmt, size, foreground, background):
+    width, height, pixels = load_picture(path, size, background)
+    foreground = foreground or (0, 0, 0)
+    enc = encode(pixels, width, height, fmt, foreground, background)
+    text = HEADER.format(filename=os.path.basename(path), name=name, fmt=fmt,
+                         block=16 if enc.ctype == 'uint16_t' else 8, ctype=enc.ctype,
+                         bits=enc.bits, rle='yes' if enc.tag == 'TIMAGE_RLE' else 'no',
+                         data=format_array(enc.ctype, name, enc.values,
+                                           16 if enc.ctype == 'uint8_t' else 12),
+                         decl=image_decl(name, name, width, height, enc))
+    return text, (width * height * 3, enc.size())
+
+
+ANIM_HEADER = '''
+/*******************************************************************************
+* animation
+* filename: {filename}
+* name: {name}
+*
+* preset name: asset_compiler --frames {frames} --turn {turn}
+* size: {width}x{height}, {colors} colors
+* frames: {frames}, {pixels} pixels changed per turn
+*
+* Needs tAnim, from anim.h
+*******************************************************************************/
+
+#include <stdint.h>
+
+
+
+{data}
+{offsets}
+const tAnim {name} = {{ anim_data_{name}, anim_frames_{name},
+    {width}, {height}, {frames}, {turn} }};
+
+'''
+
+# Unchanged pixels between two spans of a row costing less than a new span
+# header (3 bytes, 6 indices)
+ANIM_GAP = 6
+ANIM_MAX_SIDE = 255
+
+
+def header_picture(text, bg):
+    """First image of a lcd-image-converter header."""
+    img = IMAGE_RE.search(text)
+    if img is None:
+        raise ValueError('no tImage in the header')
+    for m in DATA_RE.finditer(text):
+        if m.group(2) == img.group(3):
+            width, height = int(img.group(4)), int(img.group(5))
+            pixels = decode_values(m.group(1), m.group(4), img.group(7),
+                                   width * height, bg=bg)
+            return width, height, pixels
+    raise ValueError('no data for %s' % img.group(2))
+
+
+def rotate(pixels, width, height, degrees, bg):
+    """Turn clockwise around the center, nearest pixel, bg outside."""
+    import math
+    a = math.radians(degrees)
+    cos, sin = math.cos(a), math.sin(a)
+    cx, cy = (width - 1) / 2.0, (height - 1) / 2.0
+    out = []
+    for y in range(height):
+        for x in range(width):
+            dx, dy = x - cx, y - cy
+            sx = int(round(cx + dx * cos + dy * sin))
+            sy = int(round(cy - dx * sin + dy * cos))
+            if 0 <= sx < width and 0 <= sy < height:
+                out.append(pixels[sy * width + sx])
+            else:
+                out.append(bg)
+    return out
+
+
+def anim_spans(prev, cur, width, height):
+    """Spans (y, x, indices) of cur that differ from prev."""
+    spans = []
+    for y in range(height):
+        row = y * width
+        x = 0
+        while x < width:
+            if prev[row + x] == cur[row + x]:
+                x += 1
+                continue
+            start = end = x
+            x += 1
+            while x < width:
+                if prev[row + x] != cur[row + x]:
+                    end = x
+                elif x - end > ANIM_GAP:
+                    break
+                x += 1
+            spans.append((y, start, cur[row + start:row + end + 1]))
+            x = end + 1
+    return spans
+
+
+def anim_encode(spans):
+    """Span: <y> <x> <count> then the indices, 4 bits, MSB first."""
+    out = []
+    for y, x, indices in spans:
+        out += [y, x, len(indices)] + pack_indices(indices, 4)
+    return out
+
+
+def anim_header(path, name, frames, turn, scale, size, foreground, background):
+    if path.endswith('.h'):
+        with open(path) as f:
+            width, height, pixels = header_picture(f.read(), background)
+    else:
+        width, height, pixels = load_picture(path, size, background)
+    pictures = []
+    for i in range(frames):
+        p = rotate(pixels, width, height, turn * i / float(frames), background)
+        w, h = width, height
+        if scale > 1:
+            w, h, p = downscale(p, width, height, scale, background)
+        pictures.append(p)
+    if w > ANIM_MAX_SIDE or h > ANIM_MAX_SIDE:
+        raise ValueError('%dx%d, at most %d pixels a side' % (w, h, ANIM_MAX_SIDE))
+
+    # Exact colors if they fit, else coverages from the background to the ink
+    colors, _ = palette_of([background] + [c for p in pictures for c in p])
+    if colors is not None:
+        lookup = dict((c, i) for i, c in enumerate(colors))
+        frames_idx = [[lookup[rgb565(*c)] for c in p] for p in pictures]
+    else:
+        fg = foreground
+        if fg is None:
+            fg = max((c for p in pictures for c in p),
+                     key=lambda c: distance2(c, background))
+        colors = [rgb565(*blend(fg, background, a)) for a in range(ALPHA_MAX + 1)]
+        frames_idx = [alpha_of(p, fg, background) for p in pictures]
+
+    # Blank to the first frame, then each frame from the one before, the
+    # last one back to the first
+    data = palette_header(colors)
+    offsets = []
+    changed = 0
+    previous = [0] * (w * h)
+    for i in range(frames + 1):
+        cur = frames_idx[i % frames]
+        spans = anim_spans(previous, cur, w, h)
+        offsets.append(len(data))
+        data += anim_encode(spans)
+        if i:
+            changed += sum(len(s[2]) for s in spans)
+        previous = cur
+    offsets.append(len(data))
+
+    lines = []
+    for i in range(0, len(offsets), 8):
+        lines.append('    ' + ''.join('%d, ' % v for v in offsets[i:i + 8]))
+    text = ANIM_HEADER.format(
+        filename=os.path.basename(path), name=name, frames=frames, turn=turn,
+        width=w, height=h, colors=len(colors), pixels=changed,
+        data=format_array('uint8_t', name, data, 16).replace(
+            'image_data_', 'anim_data_'),
+        offsets='static const uint32_t anim_frames_%s[%d] = {\n%s\n};' % (
+            name, len(offsets), '\n'.join(lines)))
+    return text, (w * h * 2 * frames, len(data) + 4 * len(offsets))
+
+
+def parse_size(value):
+    w, h = value.lower().split('x')
+    return int(w), int(h)
+
+
+def parse_color(value):
+    value = int(value, 16)
+    return ((value >> 16) & 0xFF, (value >> 8) & 0xFF, value & 0xFF)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('input', nargs='+', help='picture or lcd-image-converter header')
+    parser.add_argument('-f', '--format', choices=sorted(FORMATS) + ['auto'], default='rgb565',
+                        help='pixel format, auto picks the smallest per image')
+    parser.add_argument('-n', '--name', help='symbol name, or new name of a header')
+    parser.add_argument('-o', '--output', help='output header (single input)')
+    parser.add_argument('-i', '--in-place', action='store_true', help='rewrite headers in place')
+    parser.add_argument('--size', type=parse_size, help='resize pictures to WxH')
+    parser.add_argument('--scale', type=int, default=1,
+                        help='shrink headers N times with a box filter')
+    parser.add_argument('--background', type=parse_color, default=(255, 255, 255),
+                        help='RRGGBB used under transparent pixels, alpha 0 of a4 (default ffffff)')
+    parser.add_argument('--foreground', type=parse_color,
+                        help='RRGGBB of alpha 15 of a4 (default: the ink of a font, '
+                        'else 000000)')
+    parser.add_argument('--frames', type=int,
+                        help='make a tAnim of N frames turning the picture')
+    parser.add_argument('--turn', type=int, default=360,
+                        help='degrees turned over the frames (default 360)')
+    parser.add_argument('--compose', default='',
+                        help='accented letters to add to a font header')
+    args = parser.parse_args()
+
+    if args.output and len(args.input) > 1:
+        parser.error('--output needs a single input')
+    if args.frames:
+        if len(args.input) > 1 or not args.output:
+            parser.error('--frames needs a single input and --output')
+        name = args.name or os.path.splitext(os.path.basename(args.input[0]))[0]
+        text, (before, after) = anim_header(args.input[0], name, args.frames,
+                                            args.turn, args.scale, args.size,
+                                            args.foreground, args.background)
+        with open(args.output, 'w') as f:
+            f.write(text)
+        sys.stderr.write('%s: %d -> %d bytes\n' % (args.input[0], before, after))
+        return
+
+    for path in args.input:
+        if path.endswith('.h'):
+            with open(path) as f:
+                text = f.read()
+            if args.compose:
+                text = compose_font(text, args.compose, args.format, args.background)
+            text, (before, after) = convert_header(text, args.format,
+                                                   args.foreground, args.background,
+                                                   args.scale, args.name)
+        else:
+            name = args.name or os.path.splitext(os.path.basename(path))[0]
+            text, (before, after) = picture_header(path, name, args.format, args.size,
+                                                   args.foreground, args.background)
+        out = args.output or (path if args.in_place else None)
+        if out:
+            with open(out, 'w') as f:
+                f.write(text)
+        else:
+            sys.stdout.write(text)
+        sys.stderr.write('%s: %d -> %d bytes\n' % (path, before, after))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,258 @@
+#!/usr/bin/env python3
+"""
+Decoder of the screen capture streamed by src/capture.c.
+
+Reads what the serial port received (a file, or - for stdin, e.g. from
+"cat /dev/ttyACM0") and writes each completed frame as a picture. The
+console text sent between the packets goes to stdout unchanged; packets
+with a bad CRC are skipped, and the frames are only written from the
+first keyframe on, as the ones before it are not complete.
+
+The stream format is described in src/capture.h.
+
+Examples:
+  capture_decode.py -o frames capture.bin
+  capture_decode.py --png -o frames - < /dev/ttyACM0
+  capture_decode.py --last-only -o /tmp --expect /tmp/end.ppm /tmp/cap.bin
+
+--expect compares the last frame with a picture of the panel (the "dump"
+command of the host simulator) at the RGB565 precision of the capture,
+and exits with 1 if they differ.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+# Must match src/capture.h
+SYNC = b'\xa5\x5a'
+PKT_BEGIN = 1
+PKT_RECT = 2
+PKT_END = 3
+FRAME_KEY = 0x01
+HEADER_SIZE = 6
+CRC_SIZE = 2
+
+
+def crc16(data):
+    """CRC-16/CCITT, starting at 0xFFFF."""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+
+def rgb565_to_rgb(v):
+    r = (v >> 11) & 0x1F
+    g = (v >> 5) & 0x3F
+    b = v & 0x1F
+    return (r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)
+
+
+def packets(data, stats):
+    """Split the stream in packets, yielding text runs in between."""
+    pos = 0
+    text = bytearray()
+    while pos < len(data):
+        start = data.find(SYNC, pos)
+        if start < 0:
+            text += data[pos:]
+            break
+        text += data[pos:start]
+        if start + HEADER_SIZE > len(data):
+            text += data[start:]
+            break
+        kind, length, seq = struct.unpack_from('<BHB', data, start + 2)
+        end = start + HEADER_SIZE + length + CRC_SIZE
+        if (end > len(data)
+                or struct.unpack_from('<H', data, end - CRC_SIZE)[0]
+                != crc16(data[start + 2:end - CRC_SIZE])):
+            # Not a packet, or a damaged one: resync after the sync bytes
+            stats['bad'] += 1
+            text += data[start:start + 2]
+            pos = start + 2
+            continue
+        if text:
+            yield None, bytes(text), 0
+            text = bytearray()
+        yield kind, data[start + HEADER_SIZE:end - CRC_SIZE], seq
+        pos = end
+    if text:
+        yield None, bytes(text), 0
+
+
+def decode_rect(frame, width, payload):
+    x, y, w, rows = struct.unpack_from('<HHHH', payload, 0)
+    pos = 8
+    above = None
+    for row in range(rows):
+        pixels = []
+        while len(pixels) < w:
+            token = payload[pos]
+            pos += 1
+            n = (token & 0x3F) + 1
+            kind = token >> 6
+            if kind == 0:
+                pixels += struct.unpack_from('<%dH' % n, payload, pos)
+                pos += 2 * n
+            elif kind == 1:
+                pixels += struct.unpack_from('<H', payload, pos) * n
+                pos += 2
+            elif kind == 2 and above is not None:
+                pixels += above[len(pixels):len(pixels) + n]
+            else:
+                raise ValueError('bad token 0x%02x' % token)
+        if len(pixels) != w:
+            raise ValueError('token crosses a row')
+        base = (y + row) * width + x
+        frame[base:base + w] = pixels
+        above = pixels
+    if pos != len(payload):
+        raise ValueError('%d bytes left in the packet' % (len(payload) - pos))
+
+
+def write_ppm(path, frame, width, height):
+    out = bytearray()
+    for v in frame:
+        out += bytes(rgb565_to_rgb(v))
+    with open(path, 'wb') as f:
+        f.write(b'P6\n%d %d\n255\n' % (width, height))
+        f.write(out)
+
+
+def write_png(path, frame, width, height):
+    raw = bytearray()
+    for y in range(height):
+        raw.append(0)
+        for v in frame[y * width:(y + 1) * width]:
+            raw += bytes(rgb565_to_rgb(v))
+
+    def chunk(tag, body):
+        return (struct.pack('>I', len(body)) + tag + body
+                + struct.pack('>I', zlib.crc32(tag + body) & 0xFFFFFFFF))
+
+    with open(path, 'wb') as f:
+        f.write(b'\x89PNG\r\n\x1a\n')
+        f.write(chunk(b'IHDR', struct.pack('>IIBBBBB', width, height, 8, 2, 0, 0, 0)))
+        f.write(chunk(b'IDAT', zlib.compress(bytes(raw), 6)))
+        f.write(chunk(b'IEND', b''))
+
+
+def read_ppm(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    fields = []
+    pos = 0
+    while len(fields) < 4:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b'#':
+            pos = data.index(b'\n', pos)
+            continue
+        end = pos
+        while not data[end:end + 1].isspace():
+            end += 1
+        fields.append(data[pos:end])
+        pos = end
+    if fields[0] != b'P6' or fields[3] != b'255':
+        raise ValueError('%s: not an 8-bit P6 picture' % path)
+    width, height = int(fields[1]), int(fields[2])
+    pixels = data[pos + 1:pos + 1 + 3 * width * height]
+    # Same conversion as the verify command of the simulator
+    frame = [((pixels[i] & 0xF8) << 8) | ((pixels[i + 1] & 0xFC) << 3)
+             | (pixels[i + 2] >> 3) for i in range(0, len(pixels), 3)]
+    return frame, width, height
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[1])
+    parser.add_argument('input', help='captured stream, - for stdin')
+    parser.add_argument('-o', '--output', default='.', help='directory of the frames')
+    parser.add_argument('--png', action='store_true', help='write PNG instead of PPM')
+    parser.add_argument('--last-only', action='store_true',
+                        help='only write the last frame')
+    parser.add_argument('--expect', metavar='FILE.ppm',
+                        help='compare the last frame with this picture')
+    args = parser.parse_args()
+
+    if args.input == '-':
+        data = sys.stdin.buffer.read()
+    else:
+        with open(args.input, 'rb') as f:
+            data = f.read()
+
+    stats = {'bad': 0, 'lost': 0, 'frames': 0, 'skipped': 0}
+    frame = None
+    width = height = 0
+    number = 0
+    keyed = False
+    seq_next = None
+    last = None
+    write = write_png if args.png else write_ppm
+    ext = 'png' if args.png else 'ppm'
+
+    for kind, payload, seq in packets(data, stats):
+        if kind is None:
+            sys.stdout.buffer.write(payload)
+            continue
+        if seq_next is not None and seq != seq_next:
+            # Areas are missing from the picture until the next keyframe
+            stats['lost'] += (seq - seq_next) & 0xFF
+            keyed = False
+        seq_next = (seq + 1) & 0xFF
+
+        if kind == PKT_BEGIN:
+            number, flags, ms, w, h = struct.unpack_from('<HBIHH', payload)
+            if flags & FRAME_KEY:
+                keyed = True
+            if (w, h) != (width, height):
+                width, height = w, h
+                frame = [0] * (width * height)
+        elif kind == PKT_RECT and frame is not None:
+            try:
+                decode_rect(frame, width, payload)
+            except (ValueError, struct.error, IndexError) as e:
+                sys.stderr.write('frame %d: %s\n' % (number, e))
+                keyed = False
+        elif kind == PKT_END and frame is not None:
+            if not keyed:
+                stats['skipped'] += 1
+                continue
+            stats['frames'] += 1
+            last = '%s/frame_%05d.%s' % (args.output, number, ext)
+            if not args.last_only:
+                write(last, frame, width, height)
+
+    sys.stdout.flush()
+    if last and args.last_only:
+        write(last, frame, width, height)
+    sys.stderr.write('%d frames, %d skipped before a keyframe, %d bad packets, '
+                     '%d lost\n' % (stats['frames'], stats['skipped'],
+                                    stats['bad'], stats['lost']))
+
+    if args.expect:
+        if not last:
+            sys.stderr.write('no frame to compare\n')
+            return 1
+        expected, w, h = read_ppm(args.expect)
+        if (w, h) != (width, height):
+            sys.stderr.write('%s is %dx%d, the capture %dx%d\n'
+                             % (args.expect, w, h, width, height))
+            return 1
+        diff = [i for i in range(len(frame)) if frame[i] != expected[i]]
+        if diff:
+            sys.stderr.write('%s: %d pixels differ, first at %d,%d\n'
+                             % (os.path.basename(last), len(diff),
+                                diff[0] % width, diff[0] // width))
+            return 1
+        sys.stderr.write('%s matches %s\n' % (os.path.basename(last), args.expect))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
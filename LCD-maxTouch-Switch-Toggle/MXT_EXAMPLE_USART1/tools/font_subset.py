@@ -0,0 +1,270 @@
+#!/usr/bin/env python3
+"""
+Font subsetter: cut a tFont header down to the characters the firmware
+draws with it.
+
+The strings are taken from the C sources given:
+  * string literals passed to the text API (text_draw(), text_get_width(),
+    displaylist_draw_text(), scene_label_set_text(), ...)
+  * the formats of sprintf()/snprintf() into a buffer that is passed to
+    the text API in the same file, without their conversions
+  * string literals given to the struct fields named by --field, for the
+    strings drawn from a struct at run time (the cycle names)
+
+What the conversions print (the digits of the timer) is not in any
+literal and must be listed with --allow.
+
+The subset keeps the glyph data of the font as it is and rewrites its
+tChar array as asset_compiler.py does (an indexed run, then the other
+characters sorted for bisection), so the header is a drop-in replacement
+with the same symbols. A character needed but not in the font is an
+error: the header is not written and the exit status is 1, so the build
+fails instead of the text missing a letter on the screen.
+
+With --check nothing is written: the exit status is 1 when a character
+needed is missing from the font or from the subset header given with -o,
+which is then out of date. The host build runs this check first.
+
+Example:
+  font_subset.py --allow 0123456789 --field nome -o src/fonts/calibri_36.h \\
+      src/calibri_36.h src/main.c src/maquina1.h
+  font_subset.py --check --allow 0123456789 --field nome -o src/fonts/calibri_36.h \\
+      src/calibri_36.h src/main.c src/maquina1.h
+"""
+
+import argparse
+import os
+import re
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from asset_compiler import font_chars, set_font_chars, char_comment  # noqa: E402
+
+# Functions whose string arguments are drawn
+TEXT_API = (
+    'text_draw', 'text_draw_at', 'text_draw_lcd', 'text_get_width', 'text_get_height',
+    'displaylist_draw_text', 'displaylist_draw_text_at', 'scene_label_set_text',
+)
+
+# On the board: tChar is a long and a pointer, tImage a pointer and 4 ints
+TCHAR_SIZE = 8
+TIMAGE_SIZE = 20
+
+STRING_RE = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+CONVERSION_RE = re.compile(r'%[-+ #0]*(?:\d+|\*)?(?:\.(?:\d+|\*))?'
+                           r'(?:hh|h|ll|l|L|j|z|t)?[diouxXeEfFgGaAcsp%]')
+ESCAPES = {'n': 10, 't': 9, 'r': 13, '0': 0, '\\': 92, '"': 34, "'": 39,
+           'a': 7, 'b': 8, 'f': 12, 'v': 11, '?': 63}
+GLYPH_RE = (r'#if \(0x0 == 0x0\)\nstatic const (?:uint8_t|uint16_t) image_data_%s\[\d+\] = '
+            r'\{.*?\};\nstatic const tImage %s = \{[^}]*\};\n#endif\n\n')
+
+
+def strip_comments(text):
+    """Comments blanked out, the strings and the line numbers kept."""
+    out = []
+    i = 0
+    while i < len(text):
+        if text.startswith('/*', i):
+            end = text.find('*/', i + 2)
+            end = len(text) if end < 0 else end + 2
+            out.append(re.sub(r'[^\n]', ' ', text[i:end]))
+            i = end
+        elif text.startswith('//', i):
+            end = text.find('\n', i)
+            end = len(text) if end < 0 else end
+            out.append(' ' * (end - i))
+            i = end
+        elif text[i] in '"\'':
+            m = re.compile(r'%s(?:[^%s\\\n]|\\.)*%s' % ((re.escape(text[i]),) * 3)).match(text, i)
+            end = m.end() if m else i + 1
+            out.append(text[i:end])
+            i = end
+        else:
+            out.append(text[i])
+            i += 1
+    return ''.join(out)
+
+
+def unescape(body):
+    """Bytes of the body of a C string literal, decoded as UTF-8."""
+    out = bytearray()
+    i = 0
+    while i < len(body):
+        c = body[i]
+        if c != '\\':
+            out += c.encode('utf-8')
+            i += 1
+            continue
+        c = body[i + 1]
+        if c == 'x':
+            m = re.match(r'[0-9a-fA-F]+', body[i + 2:])
+            out.append(int(m.group(0), 16) & 0xFF)
+            i += 2 + len(m.group(0))
+        elif c in '01234567':
+            m = re.match(r'[0-7]{1,3}', body[i + 1:])
+            out.append(int(m.group(0), 8) & 0xFF)
+            i += 1 + len(m.group(0))
+        else:
+            out.append(ESCAPES.get(c, ord(c)))
+            i += 2
+    return out.decode('utf-8', errors='replace')
+
+
+def call_args(text, start):
+    """Top level arguments of the call whose '(' is at start, and the end."""
+    args = []
+    depth = 0
+    arg_start = start + 1
+    i = start
+    while i < len(text):
+        c = text[i]
+        if c in '"\'':
+            m = STRING_RE.match(text, i) if c == '"' else re.compile(
+                r"'(?:[^'\\\n]|\\.)*'").match(text, i)
+            i = m.end() if m else i + 1
+            continue
+        if c in '([{':
+            depth += 1
+        elif c in ')]}':
+            depth -= 1
+            if not depth:
+                args.append(text[arg_start:i])
+                return args, i
+        elif c == ',' and depth == 1:
+            args.append(text[arg_start:i])
+            arg_start = i + 1
+        i += 1
+    return args, i
+
+
+def literal(arg):
+    """The string of an argument made only of string literals, else None."""
+    parts = STRING_RE.findall(arg)
+    if not parts or STRING_RE.sub('', arg).strip():
+        return None
+    return unescape(''.join(parts))
+
+
+def calls(text, names):
+    pattern = re.compile(r'\b(%s)\s*\(' % '|'.join(names))
+    for m in pattern.finditer(text):
+        args, _ = call_args(text, m.end() - 1)
+        yield m, args
+
+
+def source_strings(path, fields):
+    """(line, string) of the text drawn by a source file."""
+    with open(path, encoding='utf-8') as f:
+        text = strip_comments(f.read())
+
+    def line(pos):
+        return text.count('\n', 0, pos) + 1
+
+    found = []
+    drawn = set()
+    for m, args in calls(text, TEXT_API):
+        for arg in args:
+            s = literal(arg)
+            if s is not None:
+                found.append((line(m.start()), s))
+            else:
+                # Identifiers that may be buffers filled by sprintf()
+                drawn.update(re.findall(r'\b[A-Za-z_]\w*\b', arg))
+    for m, args in calls(text, ('sprintf', 'snprintf')):
+        fmt = args[2 if m.group(1) == 'snprintf' else 1] if len(args) > 1 else ''
+        dest = re.findall(r'\b[A-Za-z_]\w*\b', args[0]) if args else []
+        s = literal(fmt)
+        if s is not None and dest and dest[-1] in drawn:
+            found.append((line(m.start()), CONVERSION_RE.sub(
+                lambda c: '%' if c.group(0) == '%%' else '', s)))
+    for name in fields:
+        for m in re.finditer(r'\.%s\s*=\s*((?:"(?:[^"\\\n]|\\.)*"\s*)+)' % re.escape(name), text):
+            found.append((line(m.start()), literal(m.group(1))))
+    return found
+
+
+def subset_font(text, keep, source):
+    """Header with only the glyphs of the characters in keep."""
+    name, chars = font_chars(text)
+    for code, sym in chars.items():
+        if code not in keep:
+            text, n = re.subn(GLYPH_RE % (sym, sym), '', text, flags=re.S)
+            if n != 1:
+                raise ValueError('%s: glyph %s not found' % (name, sym))
+    text = set_font_chars(text, name, {c: s for c, s in chars.items() if c in keep})
+    note = '* subset of %s by tools/font_subset.py, do not edit\n' % source
+    return re.sub(r'(\* name: .*\n)', lambda m: m.group(1) + note, text, count=1)
+
+
+def glyph_bytes(text):
+    """Bytes of the glyph data, the tImage and the tChar array of a header."""
+    data = sum(int(n) * (2 if t == 'uint16_t' else 1) for t, n in re.findall(
+        r'static const (uint8_t|uint16_t) image_data_\w+\[(\d+)\]', text))
+    images = len(re.findall(r'const tImage \w+ = \{', text))
+    return data + images * TIMAGE_SIZE + len(font_chars(text)[1]) * TCHAR_SIZE
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('font', help='tFont header to cut down')
+    parser.add_argument('sources', nargs='+', help='C sources drawing with the font')
+    parser.add_argument('-o', '--output', required=True, help='subset header')
+    parser.add_argument('--allow', default='',
+                        help='characters printed at run time, the digits of %%d')
+    parser.add_argument('--field', action='append', default=[],
+                        help='struct field whose string literals are drawn')
+    parser.add_argument('-v', '--verbose', action='store_true',
+                        help='list the strings found')
+    parser.add_argument('--check', action='store_true',
+                        help='write nothing, fail if the font or the subset lacks a character')
+    args = parser.parse_args()
+
+    with open(args.font, encoding='utf-8') as f:
+        text = f.read()
+    name, chars = font_chars(text)
+
+    needed = {}
+    for ch in args.allow:
+        needed.setdefault(ord(ch), ('--allow', args.allow))
+    for path in args.sources:
+        for line, s in source_strings(path, args.field):
+            if args.verbose:
+                sys.stderr.write('%s:%d: "%s"\n' % (path, line, s))
+            for ch in s:
+                needed.setdefault(ord(ch), ('%s:%d' % (path, line), s))
+
+    missing = [c for c in sorted(needed) if c not in chars]
+    for c in missing:
+        where, s = needed[c]
+        sys.stderr.write('%s: %s has no \'%s\' (U+%04X), needed by "%s"\n' % (
+            where, name, char_comment(c), c, s))
+    if missing:
+        sys.exit(1)
+
+    if args.check:
+        try:
+            with open(args.output, encoding='utf-8') as f:
+                kept = font_chars(f.read())[1]
+        except OSError:
+            kept = {}
+        stale = [c for c in sorted(needed) if c not in kept]
+        for c in stale:
+            where, s = needed[c]
+            sys.stderr.write('%s: %s has no \'%s\' (U+%04X), needed by "%s": '
+                             'run "make -C host fonts"\n' % (
+                                 where, args.output, char_comment(c), c, s))
+        sys.exit(1 if stale else 0)
+
+    out = subset_font(text, set(needed), os.path.basename(args.font))
+    before, after = glyph_bytes(text), glyph_bytes(out)
+    os.makedirs(os.path.dirname(args.output) or '.', exist_ok=True)
+    # Left as it is when nothing changed, not to rebuild what includes it
+    if not os.path.exists(args.output) or open(args.output, encoding='utf-8').read() != out:
+        with open(args.output, 'w', encoding='utf-8') as f:
+            f.write(out)
+    sys.stderr.write('%s: %d of %d characters, %d -> %d bytes of flash, %d saved\n' % (
+        name, len(needed), len(chars), before, after, before - after))
+
+
+if __name__ == '__main__':
+    main()